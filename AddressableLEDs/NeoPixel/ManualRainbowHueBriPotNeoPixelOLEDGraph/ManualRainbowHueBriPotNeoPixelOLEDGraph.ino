@@ -23,6 +23,12 @@
  * For our OLED tutorials, see:
  * https://makeabilitylab.github.io/physcomp/advancedio/oled.html
  *
+ * Rather than calling setPixelColor(ColorHSV(...)) for every LED, this sketch
+ * converts the whole strip at once with RGBConverter::hsvToGrbFixed, which
+ * writes packed GRB bytes directly into the NeoPixel library's pixel buffer.
+ * Uses a (modified) RGB to HSV conversion library from here:
+ *   https://github.com/ratkins/RGBConverter
+ *
  * By Jon E. Froehlich
  * @jonfroehlich
  * http://makeabilitylab.io
@@ -38,6 +44,8 @@
 // Include for NeoPixels
 #include <Adafruit_NeoPixel.h>
 
+#include "src/RGBConverter/RGBConverter.h"
+
 #define SCREEN_WIDTH 128 // OLED display width, in pixels
 #define SCREEN_HEIGHT 64 // OLED display height, in pixels
 
@@ -51,6 +59,13 @@ const int NUM_LEDS = 8;
 const uint32_t MAX_HUE = 65536; // Full circle (360 degrees) in 16-bit hue
 Adafruit_NeoPixel _ledStrip(NUM_LEDS, NEOPIXEL_PIN, NEO_GRB + NEO_KHZ800);
 
+// Per-pixel hue, saturation, and value, stored as separate arrays
+// so the whole strip can be converted in one call to hsvToGrbFixed
+uint16_t _pixelHues[NUM_LEDS];
+byte _pixelSats[NUM_LEDS];
+byte _pixelVals[NUM_LEDS];
+RGBConverter _rgbConverter;
+
 // Potentiometer pins
 const int HUE_POT_PIN = A0;
 const int BRI_POT_PIN = A1;
@@ -105,14 +120,26 @@ void loop()
   int hueDegrees = map(huePotVal, 0, MAX_ANALOG_VAL, 0, 360);
 
   // Update NeoPixels: spread the rainbow across all LEDs
-  _ledStrip.setBrightness(brightness);
   for(int i = 0; i < NUM_LEDS; i++) {
     int32_t hueOffset = (int32_t)i * MAX_HUE / NUM_LEDS;
     if(REVERSE_HUE_INDICATOR) {
       hueOffset = -hueOffset;  // spread rainbow in opposite direction
     }
-    uint32_t pixelHue = firstPixelHue + hueOffset;
-    _ledStrip.setPixelColor(i, _ledStrip.gamma32(_ledStrip.ColorHSV(pixelHue)));
+    _pixelHues[i] = firstPixelHue + hueOffset; // wraps around the color wheel
+    _pixelSats[i] = 255;
+    _pixelVals[i] = 255;
+  }
+
+  // Convert the whole strip at full value straight into the NeoPixel buffer
+  // (GRB order), then gamma correct each byte and scale it by brightness.
+  // This is the same as setBrightness(brightness) and
+  // setPixelColor(i, gamma32(ColorHSV(hue))), but setBrightness only applies
+  // to colors set with setPixelColor, so we scale the bytes ourselves
+  uint8_t* pixelBuffer = _ledStrip.getPixels();
+  _rgbConverter.hsvToGrbFixed(_pixelHues, _pixelSats, _pixelVals, pixelBuffer, NUM_LEDS);
+  uint16_t brightnessScale = brightness + 1;
+  for(int i = 0; i < NUM_LEDS * 3; i++) {
+    pixelBuffer[i] = (Adafruit_NeoPixel::gamma8(pixelBuffer[i]) * brightnessScale) >> 8;
   }
   _ledStrip.show();
 
@@ -0,0 +1,222 @@
+/**
+ * ColorTables.hpp - lookup tables for LED color correction that are computed
+ * by the compiler and stored in flash (PROGMEM).
+ *
+ * Computing a gamma curve with pow() at runtime is slow on 8-bit boards and
+ * the resulting table takes up RAM. Instead, these templates evaluate the
+ * curves with constexpr math at build time, so the tables cost no startup
+ * time and no RAM. Each table has 256 entries indexed by an 8-bit value.
+ *
+ * Usage:
+ *   typedef GammaTable<byte, 25> Gamma;          // gamma 2.5, 8-bit output
+ *   analogWrite(RGB_RED_PIN, Gamma::get(red));
+ *
+ *   typedef GammaTable<uint16_t, 22, 10, 1023> Gamma10;  // gamma 2.2, 10-bit PWM
+ *   typedef LightnessTable<byte> Lightness;      // CIE 1931 perceived brightness
+ *   typedef HueWheelTable<25> HueWheel;          // gamma-corrected 0x00RRGGBB colors
+ *   strip.setPixelColor(i, HueWheel::get16(hue));
+ *
+ * By Jon E. Froehlich
+ * @jonfroehlich
+ * http://makeabilitylab.io
+ *
+ */
+#ifndef COLOR_TABLES_HPP
+#define COLOR_TABLES_HPP
+
+#include <Arduino.h>
+
+namespace ColorTableMath {
+
+  // C++11 constexpr functions must be a single return statement, so the math
+  // below is written recursively. It's only ever evaluated by the compiler.
+
+  constexpr double LN2 = 0.69314718055994530942;
+
+  // Taylor series for e^x, accurate for |x| <= 0.5
+  constexpr double expTaylor(double x, int n, double term) {
+    return n > 24 ? 0 : term + expTaylor(x, n + 1, term * x / (n + 1));
+  }
+
+  // e^x using e^x = (e^(x/2))^2 to bring x into the Taylor series' range
+  constexpr double square(double x) { return x * x; }
+  constexpr double constExp(double x) {
+    return (x > 0.5 || x < -0.5) ? square(constExp(x / 2)) : expTaylor(x, 0, 1);
+  }
+
+  // ln(x) = 2 * atanh(z) where z = (x - 1) / (x + 1), which converges quickly for x in [0.5, 1]
+  constexpr double atanhSeries(double z, double zPow, int n) {
+    return n > 41 ? 0 : zPow / n + atanhSeries(z, zPow * z * z, n + 2);
+  }
+
+  // ln(x) for x > 0, using ln(x) = ln(x * 2^k) - k * ln(2) to bring x into [0.5, 1]
+  constexpr double constLog(double x) {
+    return x < 0.5 ? constLog(x * 2) - LN2 :
+           x > 1.0 ? constLog(x / 2) + LN2 :
+           2 * atanhSeries((x - 1) / (x + 1), (x - 1) / (x + 1), 1);
+  }
+
+  // x^p for x in [0, 1]
+  constexpr double constPow(double x, double p) {
+    return x <= 0 ? 0 : x >= 1 ? 1 : constExp(p * constLog(x));
+  }
+
+  constexpr double clamp01(double x) { return x < 0 ? 0 : x > 1 ? 1 : x; }
+  constexpr double minimum(double a, double b) { return a < b ? a : b; }
+
+  // Rounds x in [0, 1] to an integer in [0, maxOut]
+  constexpr unsigned long scale(double x, unsigned long maxOut) {
+    return (unsigned long)(x * maxOut + 0.5);
+  }
+
+  // Scales x in [0, 1] to an integer in [0, maxOut], rounding down
+  constexpr unsigned long scaleDown(double x, unsigned long maxOut) {
+    return (unsigned long)(x * maxOut);
+  }
+
+  // CIE 1931 luminance (0-1) for a perceived lightness L* in [0, 100]
+  constexpr double cieLuminance(double lightness) {
+    return lightness <= 8 ? lightness / 903.3 :
+           ((lightness + 16) / 116) * ((lightness + 16) / 116) * ((lightness + 16) / 116);
+  }
+
+  // One channel (0-1) of a fully saturated, full value hue in [0, 1). offset
+  // is 5, 3, or 1 for red, green, and blue (see RGBConverter::hsvToGrbFixed)
+  constexpr double wrap6(double k) { return k >= 6 ? k - 6 : k; }
+  constexpr double hueChannel(double hue, double offset) {
+    return 1 - clamp01(minimum(wrap6(offset + hue * 6), 4 - wrap6(offset + hue * 6)));
+  }
+
+  // A list of indices 0, 1, ..., N - 1 used to expand a table initializer.
+  // std::index_sequence is C++14 and isn't available on AVR, so roll our own
+  // that splits in half to keep template recursion depth at log2(N).
+  template<unsigned... I> struct IndexSequence {};
+
+  template<typename A, typename B> struct ConcatSequence;
+  template<unsigned... A, unsigned... B>
+  struct ConcatSequence<IndexSequence<A...>, IndexSequence<B...> > {
+    typedef IndexSequence<A..., (sizeof...(A) + B)...> type;
+  };
+
+  template<unsigned N> struct MakeIndexSequence {
+    typedef typename ConcatSequence<typename MakeIndexSequence<N / 2>::type,
+                                    typename MakeIndexSequence<N - N / 2>::type>::type type;
+  };
+  template<> struct MakeIndexSequence<0> { typedef IndexSequence<> type; };
+  template<> struct MakeIndexSequence<1> { typedef IndexSequence<0> type; };
+
+  typedef MakeIndexSequence<256>::type Indices256;
+
+  // Reads a value of the right width back out of flash
+  inline uint8_t readProgmem(const uint8_t* p) { return pgm_read_byte(p); }
+  inline uint16_t readProgmem(const uint16_t* p) { return pgm_read_word(p); }
+  inline uint32_t readProgmem(const uint32_t* p) { return pgm_read_dword(p); }
+}
+
+/**
+ * Gamma correction table: get(i) = floor((i / 255)^(GammaNum / GammaDen) * OutputMax).
+ * T is the output type (byte or uint16_t) and OutputMax defaults to T's maximum,
+ * so GammaTable<byte, 25> is the classic 8-bit gamma 2.5 table. It rounds down
+ * like the pow() loop it replaces (https://learn.adafruit.com/chameleon-scarf/code),
+ * so the values are the same as before.
+ */
+template<typename T, unsigned GammaNum, unsigned GammaDen = 10,
+         unsigned long OutputMax = (T)~0UL, typename Seq = ColorTableMath::Indices256>
+struct GammaTable;
+
+template<typename T, unsigned GammaNum, unsigned GammaDen, unsigned long OutputMax, unsigned... I>
+struct GammaTable<T, GammaNum, GammaDen, OutputMax, ColorTableMath::IndexSequence<I...> > {
+  static constexpr T values[sizeof...(I)] PROGMEM = {
+    (T)ColorTableMath::scaleDown(ColorTableMath::constPow(I / 255.0, (double)GammaNum / GammaDen), OutputMax)...
+  };
+
+  static T get(uint8_t i) { return ColorTableMath::readProgmem(&values[i]); }
+};
+
+template<typename T, unsigned GammaNum, unsigned GammaDen, unsigned long OutputMax, unsigned... I>
+constexpr T GammaTable<T, GammaNum, GammaDen, OutputMax, ColorTableMath::IndexSequence<I...> >::values[sizeof...(I)] PROGMEM;
+
+/**
+ * Perceived brightness table based on the CIE 1931 lightness curve. get(i)
+ * returns the output level (0 to OutputMax) that looks i / 255 as bright
+ * to the human eye, which makes brightness fades look linear.
+ */
+template<typename T, unsigned long OutputMax = (T)~0UL, typename Seq = ColorTableMath::Indices256>
+struct LightnessTable;
+
+template<typename T, unsigned long OutputMax, unsigned... I>
+struct LightnessTable<T, OutputMax, ColorTableMath::IndexSequence<I...> > {
+  static constexpr T values[sizeof...(I)] PROGMEM = {
+    (T)ColorTableMath::scale(ColorTableMath::cieLuminance(I * 100.0 / 255), OutputMax)...
+  };
+
+  static T get(uint8_t i) { return ColorTableMath::readProgmem(&values[i]); }
+};
+
+template<typename T, unsigned long OutputMax, unsigned... I>
+constexpr T LightnessTable<T, OutputMax, ColorTableMath::IndexSequence<I...> >::values[sizeof...(I)] PROGMEM;
+
+/**
+ * Hue wheel table of fully saturated colors. get(hue) returns a packed
+ * 0x00RRGGBB color (the format Adafruit_NeoPixel::setPixelColor takes) for an
+ * 8-bit hue, where 0 is red, ~85 is green, and ~170 is blue. Each channel is
+ * gamma corrected by GammaNum / GammaDen and rounded, like gamma32();
+ * use HueWheelTable<10, 10> for none.
+ *
+ * For a 16-bit NeoPixel hue, use get16(hue), so a slow fade or a long strip
+ * doesn't step between 256 colors. It works out each channel's linear level
+ * at the full 16-bit hue and then gamma corrects it, blending between the
+ * two nearest entries of a 16-bit gamma table. Blending the gamma-corrected
+ * colors in the table instead would be off by up to 4/255, since the gamma
+ * curve isn't a straight line between them; this way each channel is within
+ * 1/255 of the exact gamma-corrected color. get(hue >> 8) is faster but only
+ * has those 256 colors.
+ */
+template<unsigned GammaNum = 25, unsigned GammaDen = 10, typename Seq = ColorTableMath::Indices256>
+struct HueWheelTable;
+
+template<unsigned GammaNum, unsigned GammaDen, unsigned... I>
+struct HueWheelTable<GammaNum, GammaDen, ColorTableMath::IndexSequence<I...> > {
+  static constexpr uint32_t values[sizeof...(I)] PROGMEM = {
+    ((uint32_t)ColorTableMath::scale(ColorTableMath::constPow(ColorTableMath::hueChannel(I / 256.0, 5), (double)GammaNum / GammaDen), 255) << 16 |
+     (uint32_t)ColorTableMath::scale(ColorTableMath::constPow(ColorTableMath::hueChannel(I / 256.0, 3), (double)GammaNum / GammaDen), 255) << 8 |
+     (uint32_t)ColorTableMath::scale(ColorTableMath::constPow(ColorTableMath::hueChannel(I / 256.0, 1), (double)GammaNum / GammaDen), 255))...
+  };
+
+  static uint32_t get(uint8_t hue) { return ColorTableMath::readProgmem(&values[hue]); }
+
+  typedef GammaTable<uint16_t, GammaNum, GammaDen> Gamma16;
+
+  static uint32_t get16(uint16_t hue) {
+    const uint32_t SECTOR = 65536;          // one sixth of the wheel, in 1/65536ths of a sector
+    uint32_t position = (uint32_t)hue * 6;  // where hue is on the wheel, 0 to 6 sectors
+    uint32_t color = 0;
+
+    // Blue, green, then red, at offsets 1, 3, and 5 like hueChannel()
+    for (uint8_t channel = 0; channel < 3; channel++) {
+      uint32_t k = position + (2 * channel + 1) * SECTOR;
+      if (k >= 6 * SECTOR) {
+        k -= 6 * SECTOR;
+      }
+      uint32_t fromEnd = k < 4 * SECTOR ? 4 * SECTOR - k : 0;
+      uint32_t distance = k < fromEnd ? k : fromEnd;
+      uint32_t linear = distance >= SECTOR ? 0 : SECTOR - distance;  // 0 to 65536
+
+      // Gamma correct linear / 65536 by blending the two nearest of the 256 entries
+      uint16_t index = (linear * 255) >> 8;  // in 1/256ths of an entry, 0 to 255 * 256
+      uint8_t entry = index >> 8;
+      uint8_t fraction = index & 0xFF;
+      uint32_t level = Gamma16::get(entry);
+      if (fraction > 0) {
+        level += ((Gamma16::get(entry + 1) - level) * fraction) >> 8;
+      }
+      color |= ((level * 255 + 32768) >> 16) << (8 * channel);
+    }
+    return color;
+  }
+};
+
+template<unsigned GammaNum, unsigned GammaDen, unsigned... I>
+constexpr uint32_t HueWheelTable<GammaNum, GammaDen, ColorTableMath::IndexSequence<I...> >::values[sizeof...(I)] PROGMEM;
+
+#endif
@@ -12,6 +12,7 @@
  */
 
 #include <Adafruit_NeoPixel.h>
+#include "ColorTables.hpp"
 
 const int LED_PIN = 2;
 const int NUM_LEDS = 8;
@@ -27,6 +28,11 @@ const uint32_t MAX_HUE = 65536; // Full circle (360 degrees) in 16-bit hue
 //   NEO_RGBW    Pixels are wired for RGBW bitstream (NeoPixel RGBW products)
 Adafruit_NeoPixel _ledStrip(NUM_LEDS, LED_PIN, NEO_GRB + NEO_KHZ800);
 
+// Gamma-corrected (2.6, same as gamma32) rainbow colors for 256 hues, computed at
+// compile time and stored in flash. Looking up a color is much cheaper than
+// calling gamma32(ColorHSV(hue)) for every pixel of every frame
+typedef HueWheelTable<26> HueWheel;
+
 // Use signed types so negative values behave predictably during comparison
 int32_t _hueStep = 128;
 int32_t _firstPixelHue = 0;
@@ -42,8 +48,8 @@ void loop() {
     // Offset each pixel's hue to spread the rainbow across the _ledStrip
     uint32_t pixelHue = _firstPixelHue + (i * MAX_HUE / _ledStrip.numPixels());
     
-    // ColorHSV accepts a 16-bit hue; gamma32 provides more natural color transitions
-    _ledStrip.setPixelColor(i, _ledStrip.gamma32(_ledStrip.ColorHSV(pixelHue)));
+    // get16 blends the two nearest of the wheel's 256 colors for the 16-bit hue
+    _ledStrip.setPixelColor(i, HueWheel::get16((uint16_t)pixelHue));
   }
   _ledStrip.show();
   
@@ -0,0 +1,160 @@
+/**
+ * Reads an analog input with more resolution than the ADC has by taking
+ * 4^ExtraBits readings and averaging them down (oversampling and
+ * decimation). Each factor of 4 in readings adds one bit, so on a 10-bit
+ * Arduino Uno:
+ *
+ *   OversampledAnalogIn<1>  4 readings -> 11 bits (0 - 2046)
+ *   OversampledAnalogIn<2>  16 readings -> 12 bits (0 - 4092)
+ *   OversampledAnalogIn<3>  64 readings -> 13 bits (0 - 8184)
+ *   OversampledAnalogIn<4>  256 readings -> 14 bits (0 - 16368)
+ *
+ * The readings are summed and the sum is divided by 2^ExtraBits (not 4^ExtraBits),
+ * which is a boxcar (first-order CIC) decimation filter. Besides the extra bits,
+ * this also averages out noise, so it replaces smoothing after the fact.
+ *
+ * This only works if the input has at least ~1 LSB of noise (which analog
+ * sensors on an Arduino almost always do). A perfectly steady input reads the
+ * same value every time, and averaging identical values adds nothing.
+ *
+ * Each analogRead takes ~112 microseconds on a 16 MHz AVR, so read() with
+ * ExtraBits = 2 blocks for ~1.8 ms and with ExtraBits = 4 for ~29 ms. To avoid
+ * blocking, give the constructor an output rate and call update() every loop;
+ * it takes one reading at a time, spread evenly across each output period.
+ *
+ * Usage:
+ *  OversampledAnalogIn<2> _potInput(A0);   // 12-bit readings
+ *
+ *  loop(){
+ *    int potVal = _potInput.read();         // 0 - 4092
+ *  }
+ *
+ *  OversampledAnalogIn<4> _tempInput(A1, 10); // 14-bit readings at 10 Hz
+ *
+ *  loop(){
+ *    if(_tempInput.update()){
+ *      int tempVal = _tempInput.getValue(); // 0 - 16368
+ *    }
+ *  }
+ *
+ * See: Atmel AVR121: Enhancing ADC resolution by oversampling
+ *
+ * By Jon E. Froehlich
+ * @jonfroehlich
+ * http://makeabilitylab.io
+ *
+ */
+#ifndef OVERSAMPLED_ANALOG_IN_HPP
+#define OVERSAMPLED_ANALOG_IN_HPP
+
+#include <Arduino.h>
+
+template<uint8_t ExtraBits, uint8_t AdcBits = 10>
+class OversampledAnalogIn{
+
+  static_assert(ExtraBits >= 1 && ExtraBits <= 6, "ExtraBits must be between 1 and 6");
+  static_assert(AdcBits + ExtraBits <= 16, "The oversampled value must fit in 16 bits");
+
+  private:
+    static const uint16_t NUM_SAMPLES = 1U << (2 * ExtraBits);
+
+    const uint8_t _pin;
+    const unsigned long _samplePeriodUs;  // time between readings in update()
+    unsigned long _lastSampleTimestampUs;
+
+    uint32_t _sum;          // sum of the readings so far in this output period
+    uint16_t _sampleCount;  // number of readings in _sum
+    uint16_t _value;        // the last oversampled value
+
+    // Divides the sum of NUM_SAMPLES readings by 2^ExtraBits, rounding to nearest
+    static uint16_t decimate(uint32_t sum) {
+      return (sum + (1UL << (ExtraBits - 1))) >> ExtraBits;
+    }
+
+  public:
+    /**
+     * Creates an oversampled input on the given analog pin. outputRateHz
+     * is how many oversampled values per second update() produces
+     * (0 = as fast as possible). It isn't used by read()
+     */
+    OversampledAnalogIn(uint8_t pin, float outputRateHz = 0)
+      : _pin(pin),
+        _samplePeriodUs(outputRateHz > 0 ? (unsigned long)(1000000.0 / (outputRateHz * NUM_SAMPLES)) : 0),
+        _lastSampleTimestampUs(0), _sum(0), _sampleCount(0), _value(0) {
+    }
+
+    /**
+     * Takes all 4^ExtraBits readings now and returns the oversampled value
+     */
+    uint16_t read() {
+      uint32_t sum = 0;
+      for (uint16_t i = 0; i < NUM_SAMPLES; i++) {
+        sum += analogRead(_pin);
+      }
+      _value = decimate(sum);
+      return _value;
+    }
+
+    /**
+     * Takes one reading if it's time for one. Call this every loop. Returns
+     * true when a new oversampled value is ready (see getValue())
+     */
+    bool update() {
+      if (_samplePeriodUs > 0) {
+        unsigned long currentTimestampUs = micros();
+        if (currentTimestampUs - _lastSampleTimestampUs < _samplePeriodUs) {
+          return false;
+        }
+
+        // If the loop fell more than a reading behind, start over from now
+        // rather than taking a burst of readings to catch up
+        if (currentTimestampUs - _lastSampleTimestampUs >= 2 * _samplePeriodUs) {
+          _lastSampleTimestampUs = currentTimestampUs;
+        } else {
+          _lastSampleTimestampUs += _samplePeriodUs;
+        }
+      }
+
+      _sum += analogRead(_pin);
+      _sampleCount++;
+      if (_sampleCount < NUM_SAMPLES) {
+        return false;
+      }
+
+      _value = decimate(_sum);
+      _sum = 0;
+      _sampleCount = 0;
+      return true;
+    }
+
+    /**
+     * Returns the last oversampled value from read() or update()
+     */
+    uint16_t getValue() const {
+      return _value;
+    }
+
+    /**
+     * Returns the largest oversampled value, e.g., 4092 for 12 bits from a
+     * 10-bit ADC. Use this instead of 1023 in map() and voltage conversions
+     */
+    static uint16_t getMaxValue() {
+      return ((1UL << AdcBits) - 1) << ExtraBits;
+    }
+
+    /**
+     * Returns the resolution of the oversampled value in bits
+     */
+    static uint8_t getResolutionBits() {
+      return AdcBits + ExtraBits;
+    }
+
+    /**
+     * Returns the number of ADC readings per oversampled value
+     */
+    static uint16_t getNumSamples() {
+      return NUM_SAMPLES;
+    }
+};
+
+#endif
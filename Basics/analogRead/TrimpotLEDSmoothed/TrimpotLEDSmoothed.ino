@@ -3,6 +3,10 @@
  * of an LED (hooked up to Pin 3). As the potentiomer readings can be a bit noisy,
  * we take a simple moving average using a SMOOTHING_WINDOW_SIZE of 10 (as the default).
  * If you increase this window size, you will get a smoother signal but at a cost of lag.
+ *
+ * Each reading is itself the average of 16 quick analogReads (see OversampledAnalogIn.hpp
+ * in this folder), which gives 12-bit readings (0 - 4092) rather than 10-bit and
+ * removes most of the ADC noise before the moving average even starts.
  * 
  * The analogWrite() function uses PWM, so if you want to change the pin you're
  * using, be sure to use another PWM capable pin. On the Arduino Uno, the PWM pins
@@ -21,12 +25,15 @@
  * 
  */
 
-// The Arduino Uno ADC is 10 bits (thus, 0 - 1023 values)
-#define MAX_ANALOG_INPUT_VAL 1023
+#include "OversampledAnalogIn.hpp"
 
 const int LED_OUTPUT_PIN = 3;
 const int POT_INPUT_PIN = A0;
 
+// The Arduino Uno ADC is 10 bits (thus, 0 - 1023 values). Oversampling by
+// 4^2 = 16 adds 2 bits, so readings are 0 - 4092 (_potInput.getMaxValue())
+OversampledAnalogIn<2> _potInput(POT_INPUT_PIN);
+
 // Define the number of samples to keep track of. The higher the number, the
 // more the readings will be smoothed, but the slower the output will respond to
 // the input. Using a constant rather than a normal variable lets us use this
@@ -35,7 +42,7 @@ const int SMOOTHING_WINDOW_SIZE = 10; // 10 samples
 
 int _samples[SMOOTHING_WINDOW_SIZE];  // the readings from the analog input
 int _curReadIndex = 0;                // the index of the current reading
-int _sampleTotal = 0;                 // the running total
+long _sampleTotal = 0;                // the running total (10 12-bit readings don't fit in an int)
 int _sampleAvg = 0;                   // the average
 
 void setup() {
@@ -53,8 +60,8 @@ void loop() {
   // subtract the last reading:
   _sampleTotal = _sampleTotal - _samples[_curReadIndex];
   
-  // read the potentiometer value
-  int potVal = analogRead(POT_INPUT_PIN);
+  // read the potentiometer value (with 12 bits of resolution)
+  int potVal = _potInput.read();
   _samples[_curReadIndex] = potVal;
   
   // add the reading to the total:
@@ -73,13 +80,13 @@ void loop() {
   _sampleAvg = _sampleTotal / SMOOTHING_WINDOW_SIZE;
 
   
-  // the analogRead on the Arduino Uno goes from 0 to 1023. We need to remap
+  // the oversampled reading goes from 0 to 4092. We need to remap
   // this value to the smaller range (0-255) since the analogWrite function can 
   // only write out 0-255 (a byte--2^8). The map function provides a linear
   // mapping to do this (however, a better way would likely be some sort of
   // non-linear mapping given that perceived LED brightness is not linear with current,
   // perhaps logarithmic)
-  int ledVal = map(_sampleAvg, 0, MAX_ANALOG_INPUT_VAL, 0, 255);
+  int ledVal = map(_sampleAvg, 0, _potInput.getMaxValue(), 0, 255);
 
   // print the raw pot value and the converted led value
   Serial.print("Analog in: ");
@@ -44,13 +44,15 @@ void loop() {
   int potHueVal = analogRead(POT_HUE_PIN);
   int potBrightnessVal = analogRead(POT_BRIGHTNESS_PIN);
 
-  // convert potentiometer value to a fraction between 0 and 1 where
-  // 1 is brightest (1023 is the maximum analog input value).
-  float hue = potHueVal / 1023.0;
-  float brightness = potBrightnessVal / 1023.0; 
+  // convert the 10-bit potentiometer values to the ranges used by the fixed-point
+  // (integer) conversion functions: hue from 0 - 65535 and brightness (lightness)
+  // from 0 - 255 where 255 is brightest. Shifts are much cheaper than floating
+  // point division on 8-bit boards.
+  uint16_t hue = potHueVal << 6;
+  byte brightness = potBrightnessVal >> 2; 
   
   byte rgb[3];
-  _rgbConverter.hslToRgb(hue,1.0,brightness,rgb);
+  _rgbConverter.hslToRgbFixed(hue, 255, brightness, rgb);
 
   Serial.print("hue=");
   Serial.print(hue);
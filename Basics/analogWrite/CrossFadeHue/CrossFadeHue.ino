@@ -28,8 +28,11 @@ const int RGB_BLUE_PIN  = 3;
 const int DELAY_INTERVAL = 50; // interval in ms between incrementing hues
 const byte MAX_RGB_VALUE = 255;
 
-float _hue = 0; //hue varies between 0 - 1
-float _step = 0.001f;
+// We use the fixed-point (integer) conversion functions, which are much faster
+// than the floating point ones on 8-bit boards like the Uno and Leonardo.
+// Hue varies between 0 - 65535 and wraps around the color wheel on overflow
+uint16_t _hue = 0;
+const uint16_t HUE_STEP = 66; // ~0.001 of the color wheel
 
 RGBConverter _rgbConverter;
 
@@ -46,11 +49,11 @@ void setup() {
 void loop() {
 
   // Convert current hue, saturation, and lightness to RGB
-  // The library assumes hue, saturation, and lightness range from 0 - 1
-  // and that RGB ranges from 0 - 255
-  // If lightness is equal to 1, then the RGB LED will be white
+  // The fixed-point functions take hue from 0 - 65535 and saturation and
+  // lightness from 0 - 255. RGB ranges from 0 - 255
+  // If lightness is equal to 255, then the RGB LED will be white
   byte rgb[3];
-  _rgbConverter.hslToRgb(_hue, 1, 0.5, rgb);
+  _rgbConverter.hslToRgbFixed(_hue, 255, 128, rgb);
 
   Serial.print("hue=");
   Serial.print(_hue);
@@ -63,13 +66,9 @@ void loop() {
   
   setColor(rgb[0], rgb[1], rgb[2]); 
 
-  // update hue based on step size
-  _hue += _step;
-
-  // hue ranges between 0-1, so if > 1, reset to 0
-  if(_hue > 1.0){
-    _hue = 0;
-  }
+  // update hue based on step size. Because _hue is a uint16_t, it
+  // automatically wraps back around to 0 (red) after 65535
+  _hue += HUE_STEP;
 
   delay(DELAY_INTERVAL);
 }
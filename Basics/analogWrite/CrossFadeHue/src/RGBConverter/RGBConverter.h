@@ -72,11 +72,97 @@ public:
      * @return  byte    rgb[]   The RGB representation
      */
     void hsvToRgb(double h, double s, double v, byte rgb[]);
+
+    /*
+     * Fixed-point versions of the conversions above. These use only integer
+     * multiplies, shifts, and adds (no floating point and no divides), which
+     * makes them many times faster on 8-bit AVR boards where both floats and
+     * division are implemented in software.
+     *
+     * Hue is a uint16_t in [0, 65535] that wraps around the color wheel, so
+     * 0 is red, ~21845 is green, and ~43690 is blue. To use an 8-bit hue,
+     * pass (hue8 << 8). Saturation, value, and lightness are in [0, 255].
+     *
+     * Each output matches the double version to within +/-1 on the 8-bit
+     * scale (and hue to within +/-1 on the 16-bit scale).
+     */
+
+    /**
+     * Converts an RGB color value to HSL using fixed-point math.
+     * Assumes r, g, and b are contained in the set [0, 255] and
+     * returns h in [0, 65535] and s and l in [0, 255].
+     *
+     * @param   byte      r       The red color value
+     * @param   byte      g       The green color value
+     * @param   byte      b       The blue color value
+     * @param   uint16_t  hsl[]   The HSL representation
+     */
+    void rgbToHslFixed(byte r, byte g, byte b, uint16_t hsl[]);
+
+    /**
+     * Converts an HSL color value to RGB using fixed-point math.
+     * Assumes h is in [0, 65535] and s and l are in [0, 255] and
+     * returns r, g, and b in the set [0, 255].
+     *
+     * @param   uint16_t  h       The hue
+     * @param   byte      s       The saturation
+     * @param   byte      l       The lightness
+     * @return  byte      rgb[]   The RGB representation
+     */
+    void hslToRgbFixed(uint16_t h, byte s, byte l, byte rgb[]);
+
+    /**
+     * Converts an RGB color value to HSV using fixed-point math.
+     * Assumes r, g, and b are contained in the set [0, 255] and
+     * returns h in [0, 65535] and s and v in [0, 255].
+     *
+     * @param   byte      r       The red color value
+     * @param   byte      g       The green color value
+     * @param   byte      b       The blue color value
+     * @return  uint16_t  hsv[]   The HSV representation
+     */
+    void rgbToHsvFixed(byte r, byte g, byte b, uint16_t hsv[]);
+
+    /**
+     * Converts an HSV color value to RGB using fixed-point math.
+     * Assumes h is in [0, 65535] and s and v are in [0, 255] and
+     * returns r, g, and b in the set [0, 255].
+     *
+     * @param   uint16_t  h       The hue
+     * @param   byte      s       The saturation
+     * @param   byte      v       The value
+     * @return  byte      rgb[]   The RGB representation
+     */
+    void hsvToRgbFixed(uint16_t h, byte s, byte v, byte rgb[]);
+
+    /**
+     * Converts an array of HSV colors to RGB using fixed-point math, writing
+     * the results as packed G, R, B byte triples (the order WS2812B NeoPixels
+     * expect) so they can go straight into an LED strip's pixel buffer.
+     * Hue, saturation, and value are passed as separate arrays (one entry
+     * per pixel) using the same ranges as hsvToRgbFixed, and the results are
+     * identical to calling hsvToRgbFixed on each pixel.
+     *
+     * @param   uint16_t  h[]       The hues, one per pixel
+     * @param   byte      s[]       The saturations, one per pixel
+     * @param   byte      v[]       The values, one per pixel
+     * @return  byte      grb[]     The packed GRB output (3 * numPixels bytes)
+     * @param   uint16_t  numPixels The number of pixels to convert
+     */
+    void hsvToGrbFixed(const uint16_t h[], const byte s[], const byte v[],
+                       byte grb[], uint16_t numPixels);
      
 private:
     double threeway_max(double a, double b, double c);
     double threeway_min(double a, double b, double c);
     double hue2rgb(double p, double q, double t);
+
+    byte threeway_max(byte a, byte b, byte c);
+    byte threeway_min(byte a, byte b, byte c);
+    byte hue2rgbFixed(uint16_t p, uint16_t q, uint32_t t);
+    uint16_t hueFixed(byte r, byte g, byte b, byte max, byte d);
+    uint16_t hueFraction(byte num, byte den);
+    uint32_t fraction16(uint16_t num, uint16_t den);
 };
 
 #endif
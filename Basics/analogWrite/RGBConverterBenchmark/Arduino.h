@@ -0,0 +1,25 @@
+/**
+ * Just enough of Arduino.h for RGBConverter to compile on a desktop computer.
+ * Only used by RGBConverterBenchmark.cpp; don't copy this into a sketch folder.
+ *
+ * By Jon E. Froehlich
+ * @jonfroehlich
+ * http://makeabilitylab.io
+ *
+ */
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include <algorithm>
+using std::min;
+using std::max;
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+#endif
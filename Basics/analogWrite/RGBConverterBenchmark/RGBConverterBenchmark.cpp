@@ -0,0 +1,245 @@
+/**
+ * Checks RGBConverter's fixed-point conversions against its double versions
+ * on a desktop computer (Linux or Mac) and measures how fast each one runs.
+ * It runs:
+ *
+ *  - RgbToHsv, RgbToHsl: every one of the 16,777,216 RGB colors. Hue must be
+ *    within 1 of the double version's h * 65536 (around the color wheel) and
+ *    saturation, value, and lightness within 1 of s, v, or l * 255
+ *  - HsvToRgb, HslToRgb: every saturation and value (or lightness) for 256
+ *    hues spread around the wheel (h = i * 257, so the low byte varies too),
+ *    again 16,777,216 colors. Each of r, g, and b must be within 1 of the
+ *    double version's
+ *  - Time: nanoseconds and cycles (the x86 timestamp counter, if there is
+ *    one) per conversion on this computer for the double and fixed-point
+ *    versions. A desktop computer has hardware floating point and divide,
+ *    so here rgbToHsvFixed and rgbToHslFixed (which divide one bit at a time)
+ *    are slower than the double versions. On an Arduino Uno, floats and
+ *    divides are done in software, which is what the fixed-point versions
+ *    avoid, so only compare the numbers here against each other
+ *  - Strip: for strips of 8 to 1024 pixels with a rainbow of random
+ *    saturations and values, hsvToGrbFixed must give exactly the same bytes
+ *    as calling hsvToRgbFixed for each pixel. Reports pixels per second for
+ *    both (converting into a GRB buffer, like a NeoPixel strip's)
+ *
+ * RGBConverter.cpp is included straight from the CrossFadeHue sketch folder
+ * (the other copies are identical), so the results are for the exact code
+ * that runs on the Arduino. It prints PASS or FAIL for each check and exits
+ * with 1 if any failed.
+ *
+ * To build and run (from this folder):
+ *  g++ -std=c++11 -O2 -I. RGBConverterBenchmark.cpp -o RGBConverterBenchmark
+ *  ./RGBConverterBenchmark
+ *
+ * By Jon E. Froehlich
+ * @jonfroehlich
+ * http://makeabilitylab.io
+ *
+ */
+#include <Arduino.h>  // the host stand-in in this folder (needs -I.)
+
+#include "../CrossFadeHue/src/RGBConverter/RGBConverter.cpp"
+
+#include <chrono>
+#include <cstdio>
+#include <functional>
+#include <random>
+#include <vector>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define HAS_CYCLE_COUNTER 1
+#endif
+
+const long NUM_COLORS = 1L << 24;
+const long NUM_STRIP_PIXELS = 1L << 24;  // pixels converted for each strip length
+
+int _numFailures = 0;
+RGBConverter _converter;
+
+void check(bool passed, const char* name) {
+  printf("%-9s %s\n", name, passed ? "PASS" : "FAIL");
+  if (!passed) {
+    _numFailures++;
+  }
+}
+
+// The hue difference around the color wheel, in 1/65536ths of it
+double hueError(uint16_t hue, double reference) {
+  double error = fabs(hue - reference * 65536);
+  return std::min(error, 65536 - error);
+}
+
+// isHsl selects rgbToHsl or rgbToHsv
+void checkRgbToHsx(bool isHsl, const char* name) {
+  double maxErrors[3] = { 0, 0, 0 };
+  for (long rgb = 0; rgb < NUM_COLORS; rgb++) {
+    byte r = rgb >> 16, g = rgb >> 8, b = rgb;
+    double reference[3];
+    uint16_t fixed[3];
+    if (isHsl) {
+      _converter.rgbToHsl(r, g, b, reference);
+      _converter.rgbToHslFixed(r, g, b, fixed);
+    } else {
+      _converter.rgbToHsv(r, g, b, reference);
+      _converter.rgbToHsvFixed(r, g, b, fixed);
+    }
+    maxErrors[0] = std::max(maxErrors[0], hueError(fixed[0], reference[0]));
+    for (int i = 1; i < 3; i++) {
+      maxErrors[i] = std::max(maxErrors[i], fabs(fixed[i] - reference[i] * 255));
+    }
+  }
+  printf("%-9s largest error: h %.3f/65536, s %.3f/255, %c %.3f/255\n", name,
+         maxErrors[0], maxErrors[1], isHsl ? 'l' : 'v', maxErrors[2]);
+  check(maxErrors[0] <= 1 && maxErrors[1] <= 1 && maxErrors[2] <= 1, name);
+}
+
+// isHsl selects hslToRgb or hsvToRgb
+void checkHsxToRgb(bool isHsl, const char* name) {
+  int maxError = 0;
+  for (long i = 0; i < NUM_COLORS; i++) {
+    uint16_t h = (i >> 16) * 257;
+    byte s = i >> 8, x = i;
+    byte reference[3], fixed[3];
+    if (isHsl) {
+      _converter.hslToRgb(h / 65536.0, s / 255.0, x / 255.0, reference);
+      _converter.hslToRgbFixed(h, s, x, fixed);
+    } else {
+      _converter.hsvToRgb(h / 65536.0, s / 255.0, x / 255.0, reference);
+      _converter.hsvToRgbFixed(h, s, x, fixed);
+    }
+    for (int c = 0; c < 3; c++) {
+      maxError = std::max(maxError, abs(fixed[c] - reference[c]));
+    }
+  }
+  printf("%-9s largest error: %d/255\n", name, maxError);
+  check(maxError <= 1, name);
+}
+
+// Runs convert(i) for every i in [0, NUM_COLORS) and prints the time per call
+void timeConversion(const char* name, const std::function<long(long)>& convert) {
+  long checksum = 0;
+#ifdef HAS_CYCLE_COUNTER
+  unsigned long long startCycles = __rdtsc();
+#endif
+  auto startTime = std::chrono::steady_clock::now();
+  for (long i = 0; i < NUM_COLORS; i++) {
+    checksum += convert(i);
+  }
+  double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - startTime).count();
+#ifdef HAS_CYCLE_COUNTER
+  double cycles = (double)(__rdtsc() - startCycles) / NUM_COLORS;
+  printf("Time      %-14s %8.2f ns %8.1f cycles per conversion (checksum %ld)\n", name,
+         ns / NUM_COLORS, cycles, checksum);
+#else
+  printf("Time      %-14s %8.2f ns per conversion (checksum %ld)\n", name, ns / NUM_COLORS, checksum);
+#endif
+}
+
+void timeConversions() {
+  timeConversion("rgbToHsv", [](long i){
+    double hsv[3];
+    _converter.rgbToHsv(i >> 16, i >> 8, i, hsv);
+    return (long)(hsv[0] * 65536);
+  });
+  timeConversion("rgbToHsvFixed", [](long i){
+    uint16_t hsv[3];
+    _converter.rgbToHsvFixed(i >> 16, i >> 8, i, hsv);
+    return (long)hsv[0];
+  });
+  timeConversion("rgbToHsl", [](long i){
+    double hsl[3];
+    _converter.rgbToHsl(i >> 16, i >> 8, i, hsl);
+    return (long)(hsl[0] * 65536);
+  });
+  timeConversion("rgbToHslFixed", [](long i){
+    uint16_t hsl[3];
+    _converter.rgbToHslFixed(i >> 16, i >> 8, i, hsl);
+    return (long)hsl[0];
+  });
+  timeConversion("hsvToRgb", [](long i){
+    byte rgb[3];
+    _converter.hsvToRgb((i >> 8) / 65536.0, (byte)(i >> 16) / 255.0, (byte)i / 255.0, rgb);
+    return (long)rgb[0];
+  });
+  timeConversion("hsvToRgbFixed", [](long i){
+    byte rgb[3];
+    _converter.hsvToRgbFixed(i >> 8, i >> 16, i, rgb);
+    return (long)rgb[0];
+  });
+  timeConversion("hslToRgb", [](long i){
+    byte rgb[3];
+    _converter.hslToRgb((i >> 8) / 65536.0, (byte)(i >> 16) / 255.0, (byte)i / 255.0, rgb);
+    return (long)rgb[0];
+  });
+  timeConversion("hslToRgbFixed", [](long i){
+    byte rgb[3];
+    _converter.hslToRgbFixed(i >> 8, i >> 16, i, rgb);
+    return (long)rgb[0];
+  });
+}
+
+// Converts numRuns strips with convert() and returns the pixels per second
+template<typename Convert>
+double timeStrip(uint16_t numPixels, long numRuns, Convert convert) {
+  auto startTime = std::chrono::steady_clock::now();
+  for (long run = 0; run < numRuns; run++) {
+    convert();
+  }
+  double secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+  return numPixels * numRuns / secs;
+}
+
+void timeStrips() {
+  std::mt19937 rng(2);
+  bool passed = true;
+  printf("Strip     %6s %16s %16s\n", "pixels", "per pixel Mpx/s", "batched Mpx/s");
+  for (uint16_t numPixels = 8; numPixels <= 1024; numPixels *= 2) {
+    std::vector<uint16_t> h(numPixels);
+    std::vector<byte> s(numPixels), v(numPixels);
+    std::vector<byte> perPixel(3 * numPixels), batched(3 * numPixels);
+    for (uint16_t i = 0; i < numPixels; i++) {
+      h[i] = (uint32_t)i * 65536 / numPixels;
+      s[i] = rng();
+      v[i] = rng();
+    }
+
+    auto convertPerPixel = [&](){
+      for (uint16_t i = 0; i < numPixels; i++) {
+        byte rgb[3];
+        _converter.hsvToRgbFixed(h[i], s[i], v[i], rgb);
+        perPixel[3 * i + 0] = rgb[1];
+        perPixel[3 * i + 1] = rgb[0];
+        perPixel[3 * i + 2] = rgb[2];
+      }
+    };
+    auto convertBatched = [&](){
+      _converter.hsvToGrbFixed(h.data(), s.data(), v.data(), batched.data(), numPixels);
+    };
+    convertPerPixel();
+    convertBatched();
+    passed = passed && perPixel == batched;
+
+    // Each run changes a hue, so the compiler can't skip runs
+    long numRuns = NUM_STRIP_PIXELS / numPixels;
+    double perPixelRate = timeStrip(numPixels, numRuns, [&](){ convertPerPixel(); h[0]++; });
+    double batchedRate = timeStrip(numPixels, numRuns, [&](){ convertBatched(); h[0]++; });
+    printf("Strip     %6d %16.1f %16.1f\n", numPixels, perPixelRate / 1e6, batchedRate / 1e6);
+  }
+  check(passed, "Strip");
+}
+
+int main() {
+  checkRgbToHsx(false, "RgbToHsv");
+  checkRgbToHsx(true, "RgbToHsl");
+  checkHsxToRgb(false, "HsvToRgb");
+  checkHsxToRgb(true, "HslToRgb");
+  timeConversions();
+  timeStrips();
+
+  if (_numFailures > 0) {
+    printf("%d checks FAILED\n", _numFailures);
+    return 1;
+  }
+  printf("All checks passed\n");
+  return 0;
+}
@@ -1,16 +1,12 @@
 /*
  * Compares common signal filtering algorithms 
  * 
- * This code requires the Median Filter 2 library from Luis Llamas:
- * https://github.com/warhog/Arduino-MedianFilter and the MovingAverageFilter.hpp 
- * class from the MakeabilityLab_Arduino_Library 
- * 
- * For the MEdian Filter 2 library:
- *
- * 1. Tools -> Manage Libraries
- * 2. Search for median filter
- * 3. Select MedianFilterLib2 by Luis Llamas
- * 4. Click the 'Install' button
+ * This code requires the MovingAverageFilter.hpp class from the 
+ * MakeabilityLab_Arduino_Library. The moving median filter is in 
+ * MovingMedianFilter.hpp (in this folder) and updates in O(log n) time per sample.
+ * It produces the same output as the MedianFilter2 class from Luis Llamas'
+ * MedianFilterLib2 (https://github.com/warhog/Arduino-MedianFilter), which we
+ * used previously. The EWMA uses the integer-only Ewma.hpp (also in this folder).
  * 
  * For the MovingAverageFilter library:
  * 
@@ -27,7 +23,8 @@
  * 
  */
 #include <MovingAverageFilter.hpp>
-#include <MedianFilterLib2.h>
+#include "MovingMedianFilter.hpp"
+#include "Ewma.hpp"
 
 // The Arduino Uno ADC is 10 bits (thus, 0 - 1023 values)
 #define MAX_ANALOG_INPUT_VAL 1023
@@ -37,17 +34,15 @@ const int SENSOR_INPUT_PIN = A0;
 MovingAverageFilter _movingAverageFilter5(5);
 MovingAverageFilter _movingAverageFilter10(10);
 
-MedianFilter2<int> _movingMedianFilter5(5);
-MedianFilter2<int> _movingMedianFilter10(10);
+MovingMedianFilter<int, 5> _movingMedianFilter5;
+MovingMedianFilter<int, 10> _movingMedianFilter10;
 
-const float ALPHA0_5 = 0.5f;
-double _ewma0_5 = 0;   // the EWMA for 0.5 alpha
+Ewma<int, 1> _ewma0_5; // the EWMA for 0.5 alpha (1 / 2^1)
 
 void setup() {
   Serial.begin(9600);
 
-  int sensorVal = analogRead(SENSOR_INPUT_PIN); 
-  _ewma0_5 = sensorVal;
+  _ewma0_5.add(analogRead(SENSOR_INPUT_PIN));
 }
 
 void loop() {
@@ -60,11 +55,11 @@ void loop() {
   _movingAverageFilter10.add(sensorVal);
 
   // Exponentially weighted moving average
-  _ewma0_5 = (ALPHA0_5 * sensorVal) + (1 - ALPHA0_5) * _ewma0_5;
+  _ewma0_5.add(sensorVal);
 
   // Median filter
-  int median5 = _movingMedianFilter5.AddValue(sensorVal);
-  int median10 = _movingMedianFilter10.AddValue(sensorVal);
+  int median5 = _movingMedianFilter5.add(sensorVal);
+  int median10 = _movingMedianFilter10.add(sensorVal);
 
   // print the sensor value and the smoothed values
   // best to visualize these in the serial plotter tool
@@ -81,7 +76,7 @@ void loop() {
   Serial.print(", MovingMedian10:");
   Serial.print(median10);
   Serial.print(", EWMA0.5:");  
-  Serial.println(_ewma0_5); 
+  Serial.println(_ewma0_5.getFloat()); 
 
   delay(50);
 }
@@ -0,0 +1,184 @@
+/**
+ * A moving median filter that costs O(log n) per sample rather than O(n),
+ * so large windows stay cheap. The window size is a template parameter and
+ * all memory is allocated statically (no new/malloc).
+ *
+ * The window is kept as two heaps that share a single array around the
+ * median: a max-heap of the values below the median (negative indices) and
+ * a min-heap of the values above it (positive indices), with the median
+ * itself at index 0. Each sample in the circular buffer remembers where it
+ * lives in the heap, so the oldest sample can be replaced in place and
+ * sifted up or down in O(log n). Based on the "Mediator" running median by
+ * AShelly: https://stackoverflow.com/a/5970314
+ *
+ * To produce the same output as MedianFilter2 from MedianFilterLib2, the
+ * window starts out filled with zeros and, for even window sizes, the
+ * median is the upper of the two middle values.
+ *
+ * Memory: WindowSize * (sizeof(T) + 2) bytes plus a few bytes of state.
+ *
+ * Usage:
+ *  MovingMedianFilter<int, 5> _medianFilter; // window size of 5
+ *
+ *  loop(){
+ *    int median = _medianFilter.add(analogRead(A0));
+ *  }
+ *
+ * By Jon E. Froehlich
+ * @jonfroehlich
+ * http://makeabilitylab.io
+ *
+ */
+#ifndef MOVING_MEDIAN_FILTER_HPP
+#define MOVING_MEDIAN_FILTER_HPP
+
+#include <Arduino.h>
+
+template<typename T, uint8_t WindowSize>
+class MovingMedianFilter{
+
+  static_assert(WindowSize > 0, "MovingMedianFilter needs a window size of at least 1");
+
+  private:
+    // Number of values in the max-heap (below the median) and min-heap (above it)
+    static const int16_t MAX_HEAP_COUNT = WindowSize / 2;
+    static const int16_t MIN_HEAP_COUNT = (WindowSize - 1) / 2;
+
+    T _samples[WindowSize];       // circular buffer of the samples in the window
+    int8_t _heapPos[WindowSize];  // heap index of each sample in _samples
+    uint8_t _heap[WindowSize];    // sample index at each heap index, offset by MAX_HEAP_COUNT
+    uint8_t _nextIndex;           // index in _samples of the oldest sample
+
+    uint8_t& heap(int16_t i) { return _heap[i + MAX_HEAP_COUNT]; }
+
+    bool isLess(int16_t i, int16_t j) {
+      return _samples[heap(i)] < _samples[heap(j)];
+    }
+
+    // Swaps heap nodes i and j if node i is less than node j. Returns true if swapped
+    bool swapIfLess(int16_t i, int16_t j) {
+      if (!isLess(i, j)) {
+        return false;
+      }
+      uint8_t tmp = heap(i);
+      heap(i) = heap(j);
+      heap(j) = tmp;
+      _heapPos[heap(i)] = i;
+      _heapPos[heap(j)] = j;
+      return true;
+    }
+
+    // Restores the min-heap property for node i and everything below it,
+    // starting by comparing node i with its parent i / 2
+    void minSortDown(int16_t i) {
+      for (; i <= MIN_HEAP_COUNT; i *= 2) {
+        if (i > 1 && i < MIN_HEAP_COUNT && isLess(i + 1, i)) {
+          ++i;
+        }
+        if (!swapIfLess(i, i / 2)) {
+          break;
+        }
+      }
+    }
+
+    // Same as minSortDown but for the max-heap (negative indices)
+    void maxSortDown(int16_t i) {
+      for (; i >= -MAX_HEAP_COUNT; i *= 2) {
+        if (i < -1 && i > -MAX_HEAP_COUNT && isLess(i, i - 1)) {
+          --i;
+        }
+        if (!swapIfLess(i / 2, i)) {
+          break;
+        }
+      }
+    }
+
+    // Moves node i up the min-heap. Returns true if it became the median
+    bool minSortUp(int16_t i) {
+      while (i > 0 && swapIfLess(i, i / 2)) {
+        i /= 2;
+      }
+      return i == 0;
+    }
+
+    // Moves node i up the max-heap. Returns true if it became the median
+    bool maxSortUp(int16_t i) {
+      while (i < 0 && swapIfLess(i / 2, i)) {
+        i /= 2;
+      }
+      return i == 0;
+    }
+
+  public:
+    MovingMedianFilter() {
+      reset();
+    }
+
+    /**
+     * Clears the window back to all zeros
+     */
+    void reset() {
+      _nextIndex = 0;
+
+      // Alternate samples between the median (0), max-heap (-1, -2, ...), and
+      // min-heap (1, 2, ...). All zeros is already a valid pair of heaps
+      for (int16_t i = 0; i < WindowSize; i++) {
+        _samples[i] = 0;
+        _heapPos[i] = ((i + 1) / 2) * ((i & 1) ? -1 : 1);
+        heap(_heapPos[i]) = i;
+      }
+    }
+
+    /**
+     * Adds a new sample, replacing the oldest one in the window, and returns
+     * the new median
+     */
+    T add(T value) {
+      int16_t p = _heapPos[_nextIndex];
+      T old = _samples[_nextIndex];
+      _samples[_nextIndex] = value;
+      _nextIndex = _nextIndex + 1 < WindowSize ? _nextIndex + 1 : 0;
+
+      if (MIN_HEAP_COUNT > 0 && p > 0) {
+        // New value is in the min-heap (above the median)
+        if (old < value) {
+          minSortDown(p * 2);
+        } else if (minSortUp(p)) {
+          maxSortDown(-1);
+        }
+      } else if (MAX_HEAP_COUNT > 0 && p < 0) {
+        // New value is in the max-heap (below the median)
+        if (value < old) {
+          maxSortDown(p * 2);
+        } else if (maxSortUp(p)) {
+          minSortDown(1);
+        }
+      } else {
+        // New value replaced the median
+        if (MAX_HEAP_COUNT > 0) {
+          maxSortDown(-1);
+        }
+        if (MIN_HEAP_COUNT > 0) {
+          minSortDown(1);
+        }
+      }
+
+      return getMedian();
+    }
+
+    /**
+     * Returns the median of the current window
+     */
+    T getMedian() {
+      return _samples[heap(0)];
+    }
+
+    /**
+     * Returns the window size
+     */
+    uint8_t getWindowSize() const {
+      return WindowSize;
+    }
+};
+
+#endif
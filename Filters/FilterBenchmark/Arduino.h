@@ -0,0 +1,24 @@
+/**
+ * Just enough of Arduino.h for the filter headers (MovingMedianFilter.hpp,
+ * Ewma.hpp, FilterBank.hpp) to compile on a desktop computer. Only used by
+ * FilterBenchmark.cpp; don't copy this into a sketch folder.
+ *
+ * By Jon E. Froehlich
+ * @jonfroehlich
+ * http://makeabilitylab.io
+ *
+ */
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#define PI 3.1415926535897932384626433832795
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+#endif
@@ -0,0 +1,632 @@
+/**
+ * Replays recorded sensor traces through each of our smoothing filters on a
+ * desktop computer (Linux or Mac) and reports, for each filter and window size:
+ *
+ *  - Throughput: samples per second on this computer. Only useful for
+ *    comparing filters against each other; an Arduino Uno is ~100-1000x slower
+ *  - Lag: the shift (in samples) that best lines up the filtered trace with
+ *    the raw trace (smallest mean squared difference). Depends on the trace
+ *  - Group delay: the average delay of a 0 to 1000 step, i.e., the area
+ *    between the step and the filter's response divided by the step height.
+ *    (N - 1) / 2 for a moving average and (1 - alpha) / alpha for an EWMA
+ *  - Step delay: samples until the output reaches half of the step
+ *  - Settle time: samples until the output stays within 2% of the step
+ *  - Jitter: the standard deviation of the output for a still input with
+ *    Gaussian noise of 3 (so 3.00 = no smoothing). Lower is smoother
+ *  - RAM: sizeof the filter object on this computer with 16-bit samples. On
+ *    AVR it's the same or slightly smaller (no padding)
+ *
+ * Then, for each trace, it sweeps MovingMedianFilter's window size from 5 to
+ * 255 and reports nanoseconds per sample and RAM for it and for a median
+ * that sorts a copy of its window every sample (the O(n) way), and checks
+ * that both give the same output. It exits with 1 if they ever differ.
+ *
+ * Last, it compares each Ewma against a float EWMA with the same alpha on
+ * each trace: the largest difference between their smoothed values (Ewma's
+ * getFloat()) and between their rounded outputs, and the nanoseconds and
+ * cycles (the x86 timestamp counter, if there is one) per add(). Floats are
+ * done in hardware here but in software on an Uno, so the gap there is much
+ * bigger.
+ *
+ * The filter headers are included straight from their sketch folders, so the
+ * numbers are for the exact code that runs on the Arduino.
+ *
+ * Traces are CSV files with one sample per line, like those saved by
+ * Processing/GestureRecorder/GestureRecorder.pde ("Processing Timestamp (ms),
+ * Arduino Timestamp (ms), X, Y, Z") or by copying the Serial Monitor output of
+ * LIS3DHGestureRecorder.ino or a pot/mic sketch that prints "millis(), value".
+ * Lines that don't parse (e.g., a header) are skipped.
+ *
+ * To build and run (from this folder):
+ *  g++ -std=c++11 -O2 -I. FilterBenchmark.cpp -o FilterBenchmark
+ *  ./FilterBenchmark                          # uses a built-in synthetic trace
+ *  ./FilterBenchmark fulldatastream.csv       # uses column "X" if there is a header, else column 1
+ *  ./FilterBenchmark -c 2 potlog.csv micLog.csv
+ *  ./FilterBenchmark -c Z Gestures/Shake_*.csv
+ *  ./FilterBenchmark -r 50 potlog.csv         # sample rate for the OneEuroFilters (default 100 Hz)
+ *
+ * By Jon E. Froehlich
+ * @jonfroehlich
+ * http://makeabilitylab.io
+ *
+ */
+#include <Arduino.h>  // the host stand-in in this folder (needs -I.)
+
+#include "../MovingMedianFilter/MovingMedianFilter.hpp"
+#include "../ComparingFilters/Ewma.hpp"
+#include "../../HumanInterfaceDevice/MakeyMakey/FilterBank.hpp"
+#include "../OneEuroFilter/OneEuroFilter.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define HAS_CYCLE_COUNTER 1
+#endif
+
+typedef int16_t Sample;  // int is 16 bits on AVR
+
+const int MAX_LAG = 200;                 // largest shift tried when lining up traces
+const int STEP_HEIGHT = 1000;
+const int STEP_LENGTH = 2000;            // samples fed in after the step
+const double SETTLE_TOLERANCE = 0.02;    // settled when within 2% of the step
+const double MIN_TIMING_SECS = 0.25;     // replay each trace for at least this long
+const int JITTER_LENGTH = 5000;          // samples of noisy still input for the jitter test
+const double JITTER_NOISE = 3;           // standard deviation of that noise
+const double DEFAULT_SAMPLE_RATE_HZ = 100;
+
+/**
+ * The running sum moving average from MovingAverageFilter.hpp in the
+ * MakeabilityLab_Arduino_Library (which isn't in this repo)
+ */
+template<uint8_t WindowSize>
+class MovingAverage{
+  private:
+    Sample _samples[WindowSize];
+    long _sum;
+    uint8_t _nextIndex;
+    uint8_t _count;
+
+  public:
+    MovingAverage() : _sum(0), _nextIndex(0), _count(0) {}
+
+    Sample add(Sample value) {
+      if (_count < WindowSize) {
+        _count++;
+      } else {
+        _sum -= _samples[_nextIndex];
+      }
+      _samples[_nextIndex] = value;
+      _sum += value;
+      _nextIndex = _nextIndex + 1 < WindowSize ? _nextIndex + 1 : 0;
+      return _sum / _count;
+    }
+};
+
+/**
+ * The float EWMA our sketches used before Ewma.hpp
+ */
+class FloatEwma{
+  private:
+    float _alpha;
+    float _smoothed;
+    bool _isEmpty;
+
+  public:
+    FloatEwma(float alpha) : _alpha(alpha), _smoothed(0), _isEmpty(true) {}
+
+    Sample add(Sample value) {
+      _smoothed = _isEmpty ? value : _alpha * value + (1 - _alpha) * _smoothed;
+      _isEmpty = false;
+      return (Sample)(_smoothed + 0.5f);
+    }
+
+    float getFloat() const {
+      return _smoothed;
+    }
+};
+
+/**
+ * A median that copies its window and partially sorts it every sample, the
+ * O(n) way, to check MovingMedianFilter's output and compare its speed.
+ * Like MovingMedianFilter, the window starts out filled with zeros and, for
+ * even window sizes, the median is the upper of the two middle values
+ */
+template<uint8_t WindowSize>
+class SortedMedian{
+  private:
+    Sample _samples[WindowSize];
+    uint8_t _nextIndex;
+
+  public:
+    SortedMedian() : _nextIndex(0) {
+      memset(_samples, 0, sizeof(_samples));
+    }
+
+    Sample add(Sample value) {
+      _samples[_nextIndex] = value;
+      _nextIndex = _nextIndex + 1 < WindowSize ? _nextIndex + 1 : 0;
+
+      Sample sorted[WindowSize];
+      memcpy(sorted, _samples, sizeof(sorted));
+      std::nth_element(sorted, sorted + WindowSize / 2, sorted + WindowSize);
+      return sorted[WindowSize / 2];
+    }
+};
+
+// Rounds the float OneEuroFilter's output like the integer filters
+class OneEuroFilterRounded{
+  private:
+    OneEuroFilter _filter;
+
+  public:
+    OneEuroFilterRounded(float sampleRateHz, float minCutoffHz, float beta)
+      : _filter(sampleRateHz, minCutoffHz, beta) {}
+
+    Sample add(Sample value) {
+      return (Sample)floor(_filter.add(value) + 0.5f);
+    }
+};
+
+// FilterBank computes every kernel per add(), so these adapters pull out one
+template<uint8_t WindowSize>
+class FilterBankAverage{
+  private:
+    FilterBank<1, Sample, WindowSize> _bank;
+
+  public:
+    Sample add(Sample value) {
+      _bank.add(&value);
+      return _bank.getAverage(0);
+    }
+};
+
+template<uint8_t WindowSize>
+class FilterBankMedian{
+  private:
+    FilterBank<1, Sample, WindowSize> _bank;
+
+  public:
+    Sample add(Sample value) {
+      _bank.add(&value);
+      return _bank.getMedian(0);
+    }
+};
+
+struct Trace{
+  std::string name;
+  std::vector<Sample> samples;
+};
+
+struct Result{
+  double samplesPerSec;
+  int lag;
+  double groupDelay;
+  int stepDelay;
+  int settleTime;
+  double jitter;
+  size_t ramBytes;
+};
+
+static std::string trim(const std::string& s) {
+  size_t start = s.find_first_not_of(" \t\r\n\"");
+  size_t end = s.find_last_not_of(" \t\r\n\"");
+  return start == std::string::npos ? "" : s.substr(start, end - start + 1);
+}
+
+static bool equalsIgnoreCase(const std::string& a, const std::string& b) {
+  if (a.size() != b.size()) {
+    return false;
+  }
+  for (size_t i = 0; i < a.size(); i++) {
+    if (tolower(a[i]) != tolower(b[i])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+static std::vector<std::string> splitCsvLine(const std::string& line) {
+  std::vector<std::string> fields;
+  std::stringstream ss(line);
+  std::string field;
+  while (std::getline(ss, field, ',')) {
+    fields.push_back(trim(field));
+  }
+  return fields;
+}
+
+/**
+ * Loads one column of a CSV file. column is a 0-based index or a header name
+ * (case-insensitive); if empty, uses "X" if there is one, else column 1 (or 0
+ * if there's only one column). Returns false if no samples were read.
+ */
+static bool loadTrace(const char* path, const std::string& column, Trace& trace) {
+  std::ifstream file(path);
+  if (!file) {
+    fprintf(stderr, "Could not open %s\n", path);
+    return false;
+  }
+
+  trace.name = path;
+  trace.samples.clear();
+
+  int columnIndex = -1;
+  if (!column.empty() && isdigit((unsigned char)column[0])) {
+    columnIndex = atoi(column.c_str());
+  }
+
+  std::string line;
+  while (std::getline(file, line)) {
+    std::vector<std::string> fields = splitCsvLine(line);
+    if (fields.empty()) {
+      continue;
+    }
+
+    // Look up the column by name in the header (the first non-numeric line)
+    if (columnIndex < 0 && trace.samples.empty()) {
+      char* end;
+      strtod(fields[0].c_str(), &end);
+      if (end == fields[0].c_str()) {
+        std::string wanted = column.empty() ? "X" : column;
+        for (size_t i = 0; i < fields.size(); i++) {
+          if (equalsIgnoreCase(fields[i], wanted)) {
+            columnIndex = i;
+          }
+        }
+        if (columnIndex < 0 && !column.empty()) {
+          fprintf(stderr, "%s has no column named %s\n", path, column.c_str());
+          return false;
+        }
+        continue;
+      }
+    }
+
+    if (columnIndex < 0) {
+      columnIndex = fields.size() > 1 ? 1 : 0;
+    }
+
+    if (columnIndex >= (int)fields.size()) {
+      continue;
+    }
+    char* end;
+    double value = strtod(fields[columnIndex].c_str(), &end);
+    if (end != fields[columnIndex].c_str()) {
+      trace.samples.push_back((Sample)value);
+    }
+  }
+
+  if (trace.samples.empty()) {
+    fprintf(stderr, "No samples found in %s\n", path);
+    return false;
+  }
+  return true;
+}
+
+/**
+ * A made up pot-like trace: slow random walk and sine sweeps over the 10-bit
+ * ADC range with a little noise and occasional single-sample spikes
+ */
+static Trace makeSyntheticTrace() {
+  Trace trace;
+  trace.name = "synthetic pot-like trace";
+
+  std::mt19937 rng(42);
+  std::normal_distribution<double> noise(0, 4);
+  std::uniform_int_distribution<int> spikeChance(0, 199);
+  std::uniform_int_distribution<int> spikeValue(0, 1023);
+
+  double walk = 512;
+  for (int i = 0; i < 20000; i++) {
+    walk += noise(rng) * 0.5;
+    walk = walk < 100 ? 100 : walk > 923 ? 923 : walk;
+    double value = walk + 300 * sin(i * 2 * M_PI / 500) * (i / 5000 % 2) + noise(rng);
+    if (spikeChance(rng) == 0) {
+      value = spikeValue(rng);
+    }
+    value = value < 0 ? 0 : value > 1023 ? 1023 : value;
+    trace.samples.push_back((Sample)value);
+  }
+  return trace;
+}
+
+// Finds the shift (0 to MAX_LAG samples) that best lines the filtered trace
+// up with the raw trace, i.e., with the smallest mean squared difference
+// between filtered[i + lag] and raw[i]. Returns -1 if the trace is too short
+static int findLag(const std::vector<Sample>& raw, const std::vector<Sample>& filtered) {
+  int n = raw.size();
+  if (n < 2 * MAX_LAG) {
+    return -1;
+  }
+
+  int bestLag = 0;
+  double bestError = 0;
+  for (int lag = 0; lag <= MAX_LAG; lag++) {
+    double error = 0;
+    for (int i = 0; i + MAX_LAG < n; i++) {
+      double diff = filtered[i + lag] - raw[i];
+      error += diff * diff;
+    }
+    if (lag == 0 || error < bestError) {
+      bestLag = lag;
+      bestError = error;
+    }
+  }
+  return bestLag;
+}
+
+// Replays the whole trace through copies of prototype until enough time has
+// passed and returns the samples per second
+template<typename Filter>
+static double measureSamplesPerSec(const Trace& trace, const Filter& prototype) {
+  volatile long sink = 0;
+  long samplesProcessed = 0;
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  double elapsedSecs = 0;
+  do {
+    Filter filter(prototype);
+    long sum = 0;
+    for (size_t i = 0; i < trace.samples.size(); i++) {
+      sum += filter.add(trace.samples[i]);
+    }
+    sink = sink + sum;
+    samplesProcessed += trace.samples.size();
+    elapsedSecs = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  } while (elapsedSecs < MIN_TIMING_SECS);
+  return samplesProcessed / elapsedSecs;
+}
+
+template<typename Filter>
+static std::vector<Sample> filterTrace(const Trace& trace, const Filter& prototype) {
+  Filter filter(prototype);
+  std::vector<Sample> filtered;
+  filtered.reserve(trace.samples.size());
+  for (size_t i = 0; i < trace.samples.size(); i++) {
+    filtered.push_back(filter.add(trace.samples[i]));
+  }
+  return filtered;
+}
+
+template<typename Filter>
+static Result measure(const Trace& trace, const Filter& prototype) {
+  Result result;
+  result.ramBytes = sizeof(Filter);
+  result.samplesPerSec = measureSamplesPerSec(trace, prototype);
+
+  // Lag against the raw trace
+  result.lag = findLag(trace.samples, filterTrace(trace, prototype));
+
+  // Step response: settle at 0, then jump to STEP_HEIGHT
+  Filter stepFilter(prototype);
+  for (int i = 0; i < MAX_LAG; i++) {
+    stepFilter.add(0);
+  }
+  result.groupDelay = 0;
+  result.stepDelay = -1;
+  result.settleTime = -1;
+  int tolerance = (int)(STEP_HEIGHT * SETTLE_TOLERANCE);
+  for (int i = 0; i < STEP_LENGTH; i++) {
+    Sample out = stepFilter.add(STEP_HEIGHT);
+    result.groupDelay += 1.0 - (double)out / STEP_HEIGHT;
+    if (result.stepDelay < 0 && out >= STEP_HEIGHT / 2) {
+      result.stepDelay = i + 1;
+    }
+    if (abs(out - STEP_HEIGHT) > tolerance) {
+      result.settleTime = -1;
+    } else if (result.settleTime < 0) {
+      result.settleTime = i + 1;
+    }
+  }
+
+  // Jitter: hold still at STEP_HEIGHT with noise added. The noise is the
+  // same for every filter
+  std::mt19937 rng(7);
+  std::normal_distribution<double> noise(0, JITTER_NOISE);
+  double sum = 0;
+  double sumSquares = 0;
+  for (int i = 0; i < JITTER_LENGTH; i++) {
+    double out = stepFilter.add((Sample)floor(STEP_HEIGHT + noise(rng) + 0.5));
+    sum += out;
+    sumSquares += out * out;
+  }
+  double mean = sum / JITTER_LENGTH;
+  result.jitter = sqrt(sumSquares / JITTER_LENGTH - mean * mean);
+
+  return result;
+}
+
+static void printHeader(const Trace& trace) {
+  printf("\nTrace: %s (%u samples)\n", trace.name.c_str(), (unsigned)trace.samples.size());
+  printf("%-30s %14s %5s %8s %7s %7s %7s %6s\n", "Filter", "Samples/sec", "Lag", "GrpDelay", "Step50", "Settle", "Jitter", "RAM");
+}
+
+template<typename Filter>
+static void report(const char* name, const Trace& trace, const Filter& prototype = Filter()) {
+  Result r = measure(trace, prototype);
+
+  char lag[16], stepDelay[16], settle[16];
+  snprintf(lag, sizeof(lag), r.lag < 0 ? "n/a" : "%d", r.lag);
+  snprintf(stepDelay, sizeof(stepDelay), r.stepDelay < 0 ? "never" : "%d", r.stepDelay);
+  snprintf(settle, sizeof(settle), r.settleTime < 0 ? "never" : "%d", r.settleTime);
+  printf("%-30s %14.0f %5s %8.1f %7s %7s %7.2f %6u\n", name, r.samplesPerSec, lag, r.groupDelay, stepDelay, settle,
+         r.jitter, (unsigned)r.ramBytes);
+}
+
+static void runAll(const Trace& trace, float sampleRateHz) {
+  printHeader(trace);
+
+  report<MovingAverage<5> >("MovingAverage 5", trace);
+  report<MovingAverage<10> >("MovingAverage 10", trace);
+  report<MovingAverage<20> >("MovingAverage 20", trace);
+
+  report<MovingMedianFilter<Sample, 3> >("MovingMedianFilter 3", trace);
+  report<MovingMedianFilter<Sample, 5> >("MovingMedianFilter 5", trace);
+  report<MovingMedianFilter<Sample, 10> >("MovingMedianFilter 10", trace);
+  report<MovingMedianFilter<Sample, 21> >("MovingMedianFilter 21", trace);
+  report<MovingMedianFilter<Sample, 51> >("MovingMedianFilter 51", trace);
+
+  report<FilterBankAverage<5> >("FilterBank 1ch average 5", trace);
+  report<FilterBankMedian<5> >("FilterBank 1ch median 5", trace);
+  report<FilterBankMedian<10> >("FilterBank 1ch median 10", trace);
+
+  report<FloatEwma>("float EWMA 0.5", trace, FloatEwma(0.5f));
+  report<FloatEwma>("float EWMA 0.15", trace, FloatEwma(0.15f));
+  report<Ewma<Sample, 1> >("Ewma 1/2", trace);
+  report<Ewma<Sample, 2> >("Ewma 1/4", trace);
+  report<Ewma<Sample, 3> >("Ewma 1/8", trace);
+  report<Ewma<Sample, 7, 51> >("Ewma 51/128 (~0.4)", trace);
+  report<Ewma<Sample, 7, 19> >("Ewma 19/128 (~0.15)", trace);
+
+  // Adaptive: little smoothing when moving, lots when still
+  report<OneEuroFilterRounded>("OneEuroFilter 1Hz b=0.005", trace, OneEuroFilterRounded(sampleRateHz, 1.0, 0.005));
+  report<OneEuroFilterRounded>("OneEuroFilter 1Hz b=0.02", trace, OneEuroFilterRounded(sampleRateHz, 1.0, 0.02));
+  report<OneEuroFilterFixed>("OneEuroFilterFixed 1Hz b=0.005", trace, OneEuroFilterFixed(sampleRateHz, 1.0, 0.005));
+  report<OneEuroFilterFixed>("OneEuroFilterFixed 1Hz b=0.02", trace, OneEuroFilterFixed(sampleRateHz, 1.0, 0.02));
+}
+
+// Reports one window size of the median sweep. Returns false if
+// MovingMedianFilter and SortedMedian gave different outputs
+template<uint8_t WindowSize>
+static bool sweepMedian(const Trace& trace) {
+  MovingMedianFilter<Sample, WindowSize> heapMedian;
+  SortedMedian<WindowSize> sortedMedian;
+  bool isSame = filterTrace(trace, heapMedian) == filterTrace(trace, sortedMedian);
+  printf("%6d %18.1f %10u %18.1f %10u %5s\n", WindowSize,
+         1e9 / measureSamplesPerSec(trace, heapMedian), (unsigned)sizeof(heapMedian),
+         1e9 / measureSamplesPerSec(trace, sortedMedian), (unsigned)sizeof(sortedMedian),
+         isSame ? "yes" : "NO");
+  return isSame;
+}
+
+// Returns the nanoseconds and cycles (-1 without a cycle counter) per add()
+// for prototype, timed over the whole trace
+template<typename Filter>
+static void measureUpdateCost(const Trace& trace, const Filter& prototype, double& ns, double& cycles) {
+#ifdef HAS_CYCLE_COUNTER
+  unsigned long long startCycles = __rdtsc();
+#endif
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  double samplesPerSec = measureSamplesPerSec(trace, prototype);
+  double elapsedSecs = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  ns = 1e9 / samplesPerSec;
+  cycles = -1;
+#ifdef HAS_CYCLE_COUNTER
+  cycles = (__rdtsc() - startCycles) / (elapsedSecs * samplesPerSec);
+#endif
+}
+
+// Reports one Ewma against a float EWMA with the same alpha
+template<uint8_t AlphaShift, uint8_t AlphaNum = 1, uint8_t FracBits = 8>
+static void compareEwma(const Trace& trace) {
+  typedef Ewma<Sample, AlphaShift, AlphaNum, FracBits> IntegerEwma;
+  IntegerEwma ewma;
+  FloatEwma floatEwma(IntegerEwma::getAlpha());
+  double maxSmoothedError = 0;
+  int maxOutputError = 0;
+  for (size_t i = 0; i < trace.samples.size(); i++) {
+    Sample out = ewma.add(trace.samples[i]);
+    Sample floatOut = floatEwma.add(trace.samples[i]);
+    maxSmoothedError = std::max(maxSmoothedError, (double)fabs(ewma.getFloat() - floatEwma.getFloat()));
+    maxOutputError = std::max(maxOutputError, abs(out - floatOut));
+  }
+
+  double ns, cycles, floatNs, floatCycles;
+  measureUpdateCost(trace, ewma, ns, cycles);
+  measureUpdateCost(trace, floatEwma, floatNs, floatCycles);
+
+  char name[32];
+  snprintf(name, sizeof(name), "%d/%d, %d frac bits", AlphaNum, 1 << AlphaShift, FracBits);
+  printf("%-22s %12.3f %10d %9.2f %9.1f %9.2f %9.1f\n", name, maxSmoothedError, maxOutputError,
+         ns, cycles, floatNs, floatCycles);
+}
+
+static void runEwmaComparison(const Trace& trace) {
+  printf("\nEwma against float EWMA: %s\n", trace.name.c_str());
+  printf("%-22s %12s %10s %9s %9s %9s %9s\n", "Alpha", "Smoothed err", "Output err",
+         "Ewma ns", "cycles", "float ns", "cycles");
+  compareEwma<1>(trace);
+  compareEwma<2>(trace);
+  compareEwma<3>(trace);
+  compareEwma<4>(trace);
+  compareEwma<7, 51>(trace);
+  compareEwma<7, 19>(trace);
+  compareEwma<3, 1, 0>(trace);  // without fractional bits, it gets stuck
+}
+
+static bool runMedianSweep(const Trace& trace) {
+  printf("\nMedian window sweep: %s\n", trace.name.c_str());
+  printf("%6s %18s %10s %18s %10s %5s\n", "Window", "MovingMedian ns", "RAM", "SortedMedian ns", "RAM", "Same");
+  bool isSame = sweepMedian<5>(trace);
+  isSame = sweepMedian<7>(trace) && isSame;
+  isSame = sweepMedian<11>(trace) && isSame;
+  isSame = sweepMedian<15>(trace) && isSame;
+  isSame = sweepMedian<21>(trace) && isSame;
+  isSame = sweepMedian<31>(trace) && isSame;
+  isSame = sweepMedian<51>(trace) && isSame;
+  isSame = sweepMedian<64>(trace) && isSame;
+  isSame = sweepMedian<101>(trace) && isSame;
+  isSame = sweepMedian<151>(trace) && isSame;
+  isSame = sweepMedian<201>(trace) && isSame;
+  isSame = sweepMedian<255>(trace) && isSame;
+  return isSame;
+}
+
+int main(int argc, char* argv[]) {
+  std::string column;
+  float sampleRateHz = DEFAULT_SAMPLE_RATE_HZ;
+  std::vector<const char*> paths;
+
+  for (int i = 1; i < argc; i++) {
+    std::string arg = argv[i];
+    if ((arg == "-c" || arg == "--column") && i + 1 < argc) {
+      column = argv[++i];
+    } else if ((arg == "-r" || arg == "--rate") && i + 1 < argc) {
+      sampleRateHz = atof(argv[++i]);
+      if (sampleRateHz <= 0) {
+        fprintf(stderr, "The sample rate must be greater than 0\n");
+        return 1;
+      }
+    } else if (arg == "-h" || arg == "--help") {
+      printf("Usage: %s [-c column] [-r sampleRateHz] [trace.csv ...]\n", argv[0]);
+      printf("  column is a 0-based index or header name (default: X, else column 1)\n");
+      printf("  sampleRateHz is the rate the trace was recorded at (default: %.0f)\n", DEFAULT_SAMPLE_RATE_HZ);
+      printf("  with no traces, replays a built-in synthetic pot trace\n");
+      return 0;
+    } else {
+      paths.push_back(argv[i]);
+    }
+  }
+
+  printf("Lag, GrpDelay, Step50 (half of a %d step), and Settle (within %.0f%%) are in samples.\n",
+         STEP_HEIGHT, SETTLE_TOLERANCE * 100);
+  printf("RAM is sizeof the filter in bytes with %u-byte samples.\n", (unsigned)sizeof(Sample));
+
+  if (paths.empty()) {
+    Trace trace = makeSyntheticTrace();
+    runAll(trace, sampleRateHz);
+    bool isSame = runMedianSweep(trace);
+    runEwmaComparison(trace);
+    return isSame ? 0 : 1;
+  }
+
+  int numFailed = 0;
+  for (size_t i = 0; i < paths.size(); i++) {
+    Trace trace;
+    if (loadTrace(paths[i], column, trace)) {
+      runAll(trace, sampleRateHz);
+      if (!runMedianSweep(trace)) {
+        numFailed++;
+      }
+      runEwmaComparison(trace);
+    } else {
+      numFailed++;
+    }
+  }
+  return numFailed > 0 ? 1 : 0;
+}
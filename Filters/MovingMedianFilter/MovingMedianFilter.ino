@@ -1,21 +1,17 @@
 /*
  * Example of smoothing input on A0 using a moving median filter.  
  * 
- * Requires the Median Filter 2 library from Luis Llamas:
+ * Uses MovingMedianFilter.hpp (in this folder), which updates the median in
+ * O(log n) time per sample using two heaps. It produces the same output as the
+ * MedianFilter2 class from Luis Llamas' MedianFilterLib2, which we used previously:
  * https://github.com/warhog/Arduino-MedianFilter
- * 
- * You can install this in the Arduino IDE by going to:
- * 1. Tools -> Manage Libraries
- * 2. Search for median filter
- * 3. Select MedianFilterLib2 by Luis Llamas
- * 4. Click the 'Install' button
  *
  * By Jon E. Froehlich
  * @jonfroehlich
  * http://makeabilitylab.io
  * 
  */
-#include <MedianFilterLib2.h>
+#include "MovingMedianFilter.hpp"
 
 // The Arduino Uno ADC is 10 bits (thus, 0 - 1023 values)
 #define MAX_ANALOG_INPUT_VAL 1023
@@ -23,7 +19,7 @@
 const int LED_OUTPUT_PIN = LED_BUILTIN;
 const int SENSOR_INPUT_PIN = A0;
 
-MedianFilter2<int> _movingMedianFilter5(5);
+MovingMedianFilter<int, 5> _movingMedianFilter5;
 
 void setup() {
   Serial.begin(9600);
@@ -35,7 +31,7 @@ void loop() {
   int sensorVal = analogRead(SENSOR_INPUT_PIN);
 
   // Get median filter value
-  int median5 = _movingMedianFilter5.AddValue(sensorVal);
+  int median5 = _movingMedianFilter5.add(sensorVal);
 
   // write out the LED value. 
   int ledVal = map(median5, 0, MAX_ANALOG_INPUT_VAL, 0, 255);
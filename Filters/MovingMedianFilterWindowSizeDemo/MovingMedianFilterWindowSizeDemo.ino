@@ -1,30 +1,26 @@
 /*
  * Example of smoothing input on A0 using a moving median filter of various window sizes.  
  * 
- * Requires the Median Filter 2 library from Luis Llamas:
+ * Uses MovingMedianFilter.hpp (in this folder), which updates the median in
+ * O(log n) time per sample using two heaps. It produces the same output as the
+ * MedianFilter2 class from Luis Llamas' MedianFilterLib2, which we used previously:
  * https://github.com/warhog/Arduino-MedianFilter
- * 
- * You can install this in the Arduino IDE by going to:
- * 1. Tools -> Manage Libraries
- * 2. Search for median filter
- * 3. Select MedianFilterLib2 by Luis Llamas
- * 4. Click the 'Install' button
  *
  * By Jon E. Froehlich
  * @jonfroehlich
  * http://makeabilitylab.io
  * 
  */
-#include <MedianFilterLib2.h>
+#include "MovingMedianFilter.hpp"
 
 // The Arduino Uno ADC is 10 bits (thus, 0 - 1023 values)
 #define MAX_ANALOG_INPUT_VAL 1023
 
 const int SENSOR_INPUT_PIN = A0;
 
-MedianFilter2<int> _movingMedianFilter5(5);
-MedianFilter2<int> _movingMedianFilter10(10);
-MedianFilter2<int> _movingMedianFilter20(20);
+MovingMedianFilter<int, 5> _movingMedianFilter5;
+MovingMedianFilter<int, 10> _movingMedianFilter10;
+MovingMedianFilter<int, 20> _movingMedianFilter20;
 
 void setup() {
   Serial.begin(9600);
@@ -36,9 +32,9 @@ void loop() {
   int sensorVal = analogRead(SENSOR_INPUT_PIN);
 
   // Get value
-  int median5 = _movingMedianFilter5.AddValue(sensorVal);
-  int median10 = _movingMedianFilter10.AddValue(sensorVal);
-  int median20 = _movingMedianFilter20.AddValue(sensorVal);
+  int median5 = _movingMedianFilter5.add(sensorVal);
+  int median10 = _movingMedianFilter10.add(sensorVal);
+  int median20 = _movingMedianFilter20.add(sensorVal);
 
   // print the sensor value and the smoothed values
   // best to visualize these in the serial plotter tool
@@ -0,0 +1,68 @@
+/*
+ * Example of smoothing input on A0 using an adaptive "1 Euro" filter, which
+ * smooths heavily when the input is still (removing jitter) and barely at all
+ * when it moves quickly (so it doesn't lag like a big moving average window).
+ *
+ * Uses OneEuroFilter.hpp (in this folder), which has a float version and an
+ * integer-only version. Both are shown here so you can compare them in the
+ * Serial Plotter. Try turning a potentiometer slowly and then quickly.
+ *
+ * The 1 Euro Filter is by Casiez, Roussel, and Vogel: https://gery.casiez.net/1euro/
+ *
+ * By Jon E. Froehlich
+ * @jonfroehlich
+ * http://makeabilitylab.io
+ *
+ */
+#include "OneEuroFilter.hpp"
+
+// The Arduino Uno ADC is 10 bits (thus, 0 - 1023 values)
+#define MAX_ANALOG_INPUT_VAL 1023
+
+const int LED_OUTPUT_PIN = LED_BUILTIN;
+const int SENSOR_INPUT_PIN = A0;
+
+// OneEuroFilterFixed assumes a steady sample rate, so we sample on a timer
+// rather than with delay()
+const int SAMPLE_RATE_HZ = 50;
+const unsigned long SAMPLE_PERIOD_MS = 1000 / SAMPLE_RATE_HZ;
+unsigned long _lastSampleTimestampMs = 0;
+
+// Lower MIN_CUTOFF_HZ for less jitter when still; raise BETA for less lag when moving
+const float MIN_CUTOFF_HZ = 1.0;
+const float BETA = 0.005;
+
+OneEuroFilter _oneEuroFilter(SAMPLE_RATE_HZ, MIN_CUTOFF_HZ, BETA);
+OneEuroFilterFixed _oneEuroFilterFixed(SAMPLE_RATE_HZ, MIN_CUTOFF_HZ, BETA);
+
+void setup() {
+  Serial.begin(115200); // fast enough to print every sample at 50 Hz
+}
+
+void loop() {
+
+  if (millis() - _lastSampleTimestampMs < SAMPLE_PERIOD_MS) {
+    return;
+  }
+  _lastSampleTimestampMs += SAMPLE_PERIOD_MS;
+
+  // Read the sensor value
+  int sensorVal = analogRead(SENSOR_INPUT_PIN);
+
+  // Get the filtered values
+  float oneEuroVal = _oneEuroFilter.add(sensorVal);
+  int oneEuroFixedVal = _oneEuroFilterFixed.add(sensorVal);
+
+  // write out the LED value.
+  int ledVal = map(oneEuroFixedVal, 0, MAX_ANALOG_INPUT_VAL, 0, 255);
+  analogWrite(LED_OUTPUT_PIN, ledVal);
+
+  // print the sensor value and the smoothed values
+  // best to visualize these in the serial plotter tool
+  Serial.print("AnalogIn:");
+  Serial.print(sensorVal);
+  Serial.print(", OneEuro:");
+  Serial.print(oneEuroVal);
+  Serial.print(", OneEuroFixed:");
+  Serial.println(oneEuroFixedVal);
+}
@@ -0,0 +1,45 @@
+/*
+ * Example of getting more resolution (and less noise) out of A0 by
+ * oversampling: taking 4^n readings and averaging them down to n extra bits.
+ *
+ * Uses OversampledAnalogIn.hpp (in this folder). Open the Serial Plotter and
+ * slowly turn a potentiometer: the raw 10-bit reading steps and flickers
+ * between adjacent values while the 12- and 14-bit readings move smoothly.
+ * To plot them on the same scale, all three are printed in 10-bit units.
+ *
+ * By Jon E. Froehlich
+ * @jonfroehlich
+ * http://makeabilitylab.io
+ *
+ */
+#include "OversampledAnalogIn.hpp"
+
+const int SENSOR_INPUT_PIN = A0;
+
+OversampledAnalogIn<2> _input12Bit(SENSOR_INPUT_PIN); // 16 readings per value
+OversampledAnalogIn<4> _input14Bit(SENSOR_INPUT_PIN); // 256 readings per value
+
+void setup() {
+  Serial.begin(9600);
+}
+
+void loop() {
+
+  // Read the sensor value
+  int sensorVal = analogRead(SENSOR_INPUT_PIN);
+
+  // Get the oversampled values. The 14-bit read takes ~29 ms
+  uint16_t val12Bit = _input12Bit.read();
+  uint16_t val14Bit = _input14Bit.read();
+
+  // print the raw and oversampled values, scaled back to 0 - 1023
+  // best to visualize these in the serial plotter tool
+  Serial.print("AnalogIn:");
+  Serial.print(sensorVal);
+  Serial.print(", Oversampled12Bit:");
+  Serial.print(val12Bit / 4.0, 2);
+  Serial.print(", Oversampled14Bit:");
+  Serial.println(val14Bit / 16.0, 3);
+
+  delay(20);
+}
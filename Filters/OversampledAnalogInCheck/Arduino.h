@@ -0,0 +1,29 @@
+/**
+ * Just enough of Arduino.h for OversampledAnalogIn.hpp to compile on a
+ * desktop computer. analogRead() and micros() are defined by
+ * OversampledAnalogInCheck.cpp, which feeds in synthetic readings and time.
+ * Only used by OversampledAnalogInCheck.cpp; don't copy this into a sketch
+ * folder.
+ *
+ * By Jon E. Froehlich
+ * @jonfroehlich
+ * http://makeabilitylab.io
+ *
+ */
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+const uint8_t A0 = 14;
+
+int analogRead(uint8_t pin);
+unsigned long micros();
+
+#endif
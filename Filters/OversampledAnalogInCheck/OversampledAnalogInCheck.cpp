@@ -0,0 +1,174 @@
+/**
+ * Checks OversampledAnalogIn.hpp on a desktop computer (Linux or Mac) by
+ * feeding it synthetic noisy ADC readings. It runs:
+ *
+ *  - Bits: for many random true input levels (anywhere between two ADC
+ *    steps), analogRead() returns the level plus Gaussian noise, rounded
+ *    and clamped like a 10-bit ADC. Reports the effective number of bits
+ *    (ENOB) of a single reading and of read() with 1 to 4 extra bits, for
+ *    several noise levels. ENOB is log2(1024 / (rms error * sqrt(12))) in
+ *    10-bit units, so a perfect 10-bit ADC scores 10 and each halving of
+ *    the error adds 1. With 1 LSB of noise, each extra bit must add at least
+ *    0.9 bits. With no noise, oversampling can't add anything, so every
+ *    ExtraBits must score the same as a single reading
+ *  - Range: read() of a steady 0 and 1023 gives 0 and getMaxValue()
+ *  - Update: with a 10 Hz output rate and a fast loop, update() takes
+ *    4^ExtraBits evenly spaced readings and has a new value every 100 ms.
+ *    After a long stall, it doesn't take a burst of readings to catch up
+ *
+ * The header is included straight from Filters/OversampledAnalogIn, so the
+ * results are for the exact code that runs on the Arduino. It prints PASS or
+ * FAIL for each check and exits with 1 if any failed.
+ *
+ * To build and run (from this folder):
+ *  g++ -std=c++11 -O2 -I. OversampledAnalogInCheck.cpp -o OversampledAnalogInCheck
+ *  ./OversampledAnalogInCheck
+ *
+ * By Jon E. Froehlich
+ * @jonfroehlich
+ * http://makeabilitylab.io
+ *
+ */
+#include <Arduino.h>  // the host stand-in in this folder (needs -I.)
+
+#include "../OversampledAnalogIn/OversampledAnalogIn.hpp"
+
+#include <cstdio>
+#include <random>
+#include <vector>
+
+const int NUM_LEVELS = 20000;           // true input levels per ENOB measurement
+const double MAX_ADC_VALUE = 1023;
+
+int _numFailures = 0;
+std::mt19937 _rng(9);
+
+// What analogRead() returns: _trueLevel plus noise, like a 10-bit ADC
+double _trueLevel = 0;
+double _noiseLsb = 0;
+long _numReads = 0;
+unsigned long _microsNow = 0;
+
+int analogRead(uint8_t /* pin */) {
+  _numReads++;
+  double reading = _trueLevel;
+  if (_noiseLsb > 0) {
+    reading += std::normal_distribution<double>(0, _noiseLsb)(_rng);
+  }
+  reading = floor(reading + 0.5);
+  return (int)(reading < 0 ? 0 : reading > MAX_ADC_VALUE ? MAX_ADC_VALUE : reading);
+}
+
+unsigned long micros() {
+  return _microsNow;
+}
+
+void check(bool passed, const char* name) {
+  printf("%-7s %s\n", name, passed ? "PASS" : "FAIL");
+  if (!passed) {
+    _numFailures++;
+  }
+}
+
+// The ENOB of readings from read(), which are in units of 1 / 2^ExtraBits LSB
+template<typename Reader>
+double measureEnob(Reader read, int extraBits) {
+  std::uniform_real_distribution<double> level(10, MAX_ADC_VALUE - 10);
+  double sumSquares = 0;
+  for (int i = 0; i < NUM_LEVELS; i++) {
+    _trueLevel = level(_rng);
+    double error = read() / (double)(1 << extraBits) - _trueLevel;
+    sumSquares += error * error;
+  }
+  double rmsError = sqrt(sumSquares / NUM_LEVELS);
+  return log2((MAX_ADC_VALUE + 1) / (rmsError * sqrt(12)));
+}
+
+template<uint8_t ExtraBits>
+double measureOversampledEnob() {
+  OversampledAnalogIn<ExtraBits> input(A0);
+  return measureEnob([&](){ return input.read(); }, ExtraBits);
+}
+
+void checkBits() {
+  const double noiseLevels[] = { 0, 0.3, 0.5, 1, 2 };
+  bool passed = true;
+  printf("Bits    %-9s %8s %8s %8s %8s %8s\n", "noise", "1 read", "+1 bit", "+2 bits", "+3 bits", "+4 bits");
+  for (double noise : noiseLevels) {
+    _noiseLsb = noise;
+    double enob[5];
+    enob[0] = measureEnob([](){ return analogRead(A0); }, 0);
+    enob[1] = measureOversampledEnob<1>();
+    enob[2] = measureOversampledEnob<2>();
+    enob[3] = measureOversampledEnob<3>();
+    enob[4] = measureOversampledEnob<4>();
+    printf("Bits    %4.1f LSB  %8.2f %8.2f %8.2f %8.2f %8.2f\n", noise, enob[0], enob[1], enob[2], enob[3], enob[4]);
+
+    for (int extraBits = 1; extraBits <= 4; extraBits++) {
+      if (noise == 1) {
+        passed = passed && enob[extraBits] - enob[extraBits - 1] >= 0.9;
+      } else if (noise == 0) {
+        passed = passed && fabs(enob[extraBits] - enob[0]) < 0.05;
+      }
+    }
+  }
+  check(passed, "Bits");
+}
+
+void checkRange() {
+  _noiseLsb = 0;
+  OversampledAnalogIn<2> input(A0);
+  _trueLevel = 0;
+  bool passed = input.read() == 0;
+  _trueLevel = MAX_ADC_VALUE;
+  passed = passed && input.read() == 4092 && input.getMaxValue() == 4092 && input.getValue() == 4092 &&
+           input.getResolutionBits() == 12 && input.getNumSamples() == 16;
+  check(passed, "Range");
+}
+
+void checkUpdate() {
+  _noiseLsb = 0;
+  _trueLevel = 500;
+  OversampledAnalogIn<3> input(A0, 10);  // 64 readings per 100 ms
+  bool passed = true;
+
+  // A loop that runs every 50 us for 10 seconds
+  _microsNow = 1000;
+  _numReads = 0;
+  std::vector<unsigned long> valueTimesUs;
+  for (; _microsNow < 10001000; _microsNow += 50) {
+    if (input.update()) {
+      valueTimesUs.push_back(_microsNow);
+      passed = passed && input.getValue() == 500 * 8;
+    }
+  }
+  const long samplePeriodUs = 1000000 / (10 * 64);  // 1562, rounded down like the header
+  passed = passed && valueTimesUs.size() >= 99 && valueTimesUs.size() <= 100 &&
+           labs(_numReads - 10000000 / samplePeriodUs) <= 1;
+  for (size_t i = 1; i < valueTimesUs.size(); i++) {
+    long periodUs = valueTimesUs[i] - valueTimesUs[i - 1];
+    passed = passed && periodUs >= 99900 && periodUs <= 100100;
+  }
+
+  // Stall for a second, then one reading per update() rather than a burst
+  _microsNow += 1000000;
+  long readsBefore = _numReads;
+  input.update();
+  input.update();
+  passed = passed && _numReads - readsBefore == 1;
+  check(passed, "Update");
+  printf("Update  %u values in 10 s, %ld readings\n", (unsigned)valueTimesUs.size(), readsBefore);
+}
+
+int main() {
+  checkBits();
+  checkRange();
+  checkUpdate();
+
+  if (_numFailures > 0) {
+    printf("%d checks FAILED\n", _numFailures);
+    return 1;
+  }
+  printf("All checks passed\n");
+  return 0;
+}
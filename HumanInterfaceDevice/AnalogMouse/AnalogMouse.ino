@@ -13,12 +13,16 @@
  * Leondardo, Esplora, Zero, Due, which can appear as a native mouse and/or keyboard
  * when connected to the computer via USB.
  *
+ * The analog inputs are smoothed with an adaptive "1 Euro" filter
+ * (OneEuroFilter.hpp in this folder), which removes jitter when the input is
+ * still but doesn't add lag when it moves quickly, so the mouse stays responsive.
  * 
  * By Jon Froehlich
  * @jonfroehlich
  * http://makeabilitylab.io
  */
 #include <Mouse.h> // https://www.arduino.cc/reference/en/language/functions/usb/mouse/
+#include "OneEuroFilter.hpp"
 
 // Analog in pins
 const int ANALOG_X_PIN = A0;
@@ -27,6 +31,16 @@ const int MAX_ANALOG_VAL = 1023;
 const int ANALOG_CENTER_VALUE = int(MAX_ANALOG_VAL / 2);
 const int MOUSE_MOVEMENT_THRESHOLD = 10; // distance from rest position
 
+// Adaptive smoothing of the analog inputs. Lower MIN_CUTOFF_HZ for less
+// jitter at rest; raise BETA for less lag when moving quickly. The loop
+// rate varies with the debug output, so we pass in the time between samples
+const float NOMINAL_SAMPLE_RATE_HZ = 20; // only used if no time has passed between samples
+const float MIN_CUTOFF_HZ = 1.0;
+const float BETA = 0.005;
+OneEuroFilter _xFilter(NOMINAL_SAMPLE_RATE_HZ, MIN_CUTOFF_HZ, BETA);
+OneEuroFilter _yFilter(NOMINAL_SAMPLE_RATE_HZ, MIN_CUTOFF_HZ, BETA);
+unsigned long _lastSampleTimestampMs = 0;
+
 // Sets the overall mouse sensitivity based on analog values 
 // a higher value will move the mouse more with
 const int MAX_MOUSE_MOVE_VAL = 30; 
@@ -80,8 +94,11 @@ void loop() {
   prevMouseToggleVal = mouseToggleVal;
 
   // Move mouse based on analog input values on analog input
-  int analogX = analogRead(ANALOG_X_PIN);
-  int analogY = analogRead(ANALOG_Y_PIN);
+  unsigned long currentTimestampMs = millis();
+  float dtSecs = (currentTimestampMs - _lastSampleTimestampMs) / 1000.0;
+  _lastSampleTimestampMs = currentTimestampMs;
+  int analogX = (int)(_xFilter.add(analogRead(ANALOG_X_PIN), dtSecs) + 0.5);
+  int analogY = (int)(_yFilter.add(analogRead(ANALOG_Y_PIN), dtSecs) + 0.5);
 
   if(isDebugModeOn){
     Serial.println((String)"analogX: " + analogX + " analogY: " + analogY);
@@ -12,12 +12,16 @@
  * Leondardo, Esplora, Zero, Due, which can appear as a native mouse and/or keyboard
  * when connected to the computer via USB.
  * 
+ * The joystick is smoothed with an adaptive "1 Euro" filter (OneEuroFilter.hpp
+ * in this folder) each time we send a mouse update. It removes jitter when the
+ * joystick is still without adding lag when it's moved quickly.
  * 
  * By Jon Froehlich
  * @jonfroehlich
  * http://makeabilitylab.io
  */
 #include <Mouse.h> // https://www.arduino.cc/reference/en/language/functions/usb/mouse/
+#include "OneEuroFilter.hpp"
 
 // Digital pins
 const int BUTTON_MOUSE_TOGGLE_PIN = 12;
@@ -32,6 +36,14 @@ const int MOUSE_UPDATE_FREQ = 20; // in hz or samples/sec (max is ~1000)
 int _sendMouseSampleThresholdInMs = -1; // set automatically based on MOUSE_UPDATE_FREQ
 unsigned long _lastSentMouseSampleTimestampInMs = -1;
 
+// Adaptive smoothing of the joystick, run at MOUSE_UPDATE_FREQ. The integer-only
+// version is used since 32u4 boards have no floating point unit. Lower
+// MIN_CUTOFF_HZ for less jitter at rest; raise BETA for less lag when moving
+const float MIN_CUTOFF_HZ = 1.0;
+const float BETA = 0.005;
+OneEuroFilterFixed _xFilter(MOUSE_UPDATE_FREQ, MIN_CUTOFF_HZ, BETA);
+OneEuroFilterFixed _yFilter(MOUSE_UPDATE_FREQ, MIN_CUTOFF_HZ, BETA);
+
 // The joysticks orientation with respect to the user
 // We need this because sometimes we have to place a joystick
 // upside down, etc. in our designs
@@ -120,27 +132,33 @@ void loop() {
   Serial.print(" joystickYVal: ");
   Serial.println(joystickYVal);
 
-  // Check to see if the joystick position has moved a certain
-  // threshold amount beyond its center point for each axis
-  // If so, calculate the movement values respectively
-  int yDistFromCenter = joystickYVal - JOYSTICK_CENTER_VALUE;
-  int xDistFromCenter = joystickXVal - JOYSTICK_CENTER_VALUE;
-  int yMouse = 0, xMouse = 0;
-  if(abs(yDistFromCenter) > JOYSTICK_MOVEMENT_THRESHOLD){
-    yMouse = map(joystickYVal, 0, MAX_ANALOG_VAL, MAX_MOUSE_MOVE_VAL, -MAX_MOUSE_MOVE_VAL);
-  }
-  
-  if(abs(xDistFromCenter) > JOYSTICK_MOVEMENT_THRESHOLD){
-    xMouse = map(joystickXVal, 0, MAX_ANALOG_VAL, -MAX_MOUSE_MOVE_VAL, MAX_MOUSE_MOVE_VAL);
-  }
-
-  // We control how often we send mouse updates via MOUSE_UPDATE_FREQ 
-  if(isMouseActive && millis() - _lastSentMouseSampleTimestampInMs > _sendMouseSampleThresholdInMs){
-    // Mouse.move takes xVal, yVal, and wheel
-    // See: https://www.arduino.cc/reference/tr/language/functions/usb/mouse/mousemove/
-    Mouse.move(xMouse, yMouse, 0);
+  // We control how often we send mouse updates via MOUSE_UPDATE_FREQ.
+  // The joystick is smoothed at this same rate
+  if(millis() - _lastSentMouseSampleTimestampInMs > _sendMouseSampleThresholdInMs){
     _lastSentMouseSampleTimestampInMs = millis();
-    Serial.println((String)"Sent xMouse: " + xMouse + " yMouse: " + yMouse);
+    int smoothedXVal = _xFilter.add(joystickXVal);
+    int smoothedYVal = _yFilter.add(joystickYVal);
+
+    // Check to see if the joystick position has moved a certain
+    // threshold amount beyond its center point for each axis
+    // If so, calculate the movement values respectively
+    int yDistFromCenter = smoothedYVal - JOYSTICK_CENTER_VALUE;
+    int xDistFromCenter = smoothedXVal - JOYSTICK_CENTER_VALUE;
+    int yMouse = 0, xMouse = 0;
+    if(abs(yDistFromCenter) > JOYSTICK_MOVEMENT_THRESHOLD){
+      yMouse = map(smoothedYVal, 0, MAX_ANALOG_VAL, MAX_MOUSE_MOVE_VAL, -MAX_MOUSE_MOVE_VAL);
+    }
+    
+    if(abs(xDistFromCenter) > JOYSTICK_MOVEMENT_THRESHOLD){
+      xMouse = map(smoothedXVal, 0, MAX_ANALOG_VAL, -MAX_MOUSE_MOVE_VAL, MAX_MOUSE_MOVE_VAL);
+    }
+
+    if(isMouseActive){
+      // Mouse.move takes xVal, yVal, and wheel
+      // See: https://www.arduino.cc/reference/tr/language/functions/usb/mouse/mousemove/
+      Mouse.move(xMouse, yMouse, 0);
+      Serial.println((String)"Sent xMouse: " + xMouse + " yMouse: " + yMouse);
+    }
   }
 
 }
@@ -0,0 +1,187 @@
+/**
+ * A bank of smoothing filters for many input channels at once (e.g., the
+ * x, y, z axes of an accelerometer or several analog inputs). Rather than one
+ * filter object per signal, the bank stores the recent history of every
+ * channel in a single block of arrays and updates all of them in one pass
+ * per sample. Each channel gets three filters (or "kernels") for free:
+ *
+ *  - a moving average over the last WindowSize samples
+ *  - a moving median over the last WindowSize samples
+ *  - an exponentially weighted moving average (EWMA) with alpha
+ *    EwmaNum / 2^EwmaShift
+ *
+ * The history is laid out as [WindowSize][NumChannels] (i.e., struct-of-arrays),
+ * so one add() walks memory in order. The moving average keeps a running sum
+ * and each channel's window is also kept sorted (via insertion) so the median
+ * is a lookup. This makes add() O(NumChannels * WindowSize), which is cheap
+ * for the small windows we typically use.
+ *
+ * The window is filled with the first sample on the first call to add(),
+ * so the filters start at the input value rather than ramping up from zero.
+ *
+ * Everything is integer math, so there's no float code on boards without a
+ * floating point unit (e.g., the Uno). T must be an integer type, and the
+ * samples must fit in 16 bits (e.g., analogRead), so the 32-bit sums can't
+ * overflow. Like Ewma.hpp, the EWMA keeps 8 fractional bits, so it settles
+ * to within rounding of the input; that fits 12-bit readings with any
+ * EwmaNum, or full 16-bit values with EwmaNum = 1.
+ *
+ * Memory: 2 * WindowSize * NumChannels * sizeof(T) + 8 * NumChannels bytes
+ *
+ * Usage:
+ *  FilterBank<3, int, 5, 7, 38> _accelFilters; // 3 channels, window of 5, EWMA alpha of 38/128 ~= 0.3
+ *
+ *  loop(){
+ *    int samples[3] = { analogRead(A0), analogRead(A1), analogRead(A2) };
+ *    _accelFilters.add(samples);
+ *    int smoothedX = _accelFilters.getMedian(0);
+ *  }
+ *
+ * By Jon E. Froehlich
+ * @jonfroehlich
+ * http://makeabilitylab.io
+ *
+ */
+#ifndef FILTER_BANK_HPP
+#define FILTER_BANK_HPP
+
+#include <Arduino.h>
+
+template<uint8_t NumChannels, typename T = int, uint8_t WindowSize = 5, uint8_t EwmaShift = 1, uint8_t EwmaNum = 1>
+class FilterBank{
+
+  static_assert(NumChannels > 0 && WindowSize > 0, "FilterBank needs at least one channel and a window size of at least 1");
+  static_assert((T)1 / 2 == 0, "T must be an integer type");
+  static_assert(EwmaShift < 16, "EwmaShift must be less than 16");
+  static_assert(EwmaNum > 0 && EwmaNum <= (1UL << EwmaShift), "EwmaNum / 2^EwmaShift must be in (0, 1]");
+
+  private:
+    static const uint8_t EWMA_FRAC_BITS = 8;
+
+    T _history[WindowSize][NumChannels];  // raw samples, one row per time step
+    T _sorted[NumChannels][WindowSize];   // each channel's window in ascending order
+    int32_t _sums[NumChannels];           // running sum of each channel's window
+    int32_t _ewmas[NumChannels];          // EWMA of each channel, scaled by 2^EWMA_FRAC_BITS
+
+    uint8_t _nextIndex;                   // row in _history of the oldest samples
+    bool _isEmpty;
+
+    // Replaces oldVal with newVal in a sorted window, shifting values over
+    // so the window stays sorted
+    static void replaceSorted(T sorted[], T oldVal, T newVal) {
+      uint8_t i = 0;
+      while (sorted[i] != oldVal) {
+        i++;
+      }
+
+      // Shift toward the end while newVal is bigger than the next value
+      // (or toward the start while it's smaller than the previous value)
+      while (i + 1 < WindowSize && sorted[i + 1] < newVal) {
+        sorted[i] = sorted[i + 1];
+        i++;
+      }
+      while (i > 0 && newVal < sorted[i - 1]) {
+        sorted[i] = sorted[i - 1];
+        i--;
+      }
+      sorted[i] = newVal;
+    }
+
+  public:
+    /**
+     * Creates a new filter bank. The EWMA's alpha (the weight of each new
+     * sample, higher = less smoothing) is EwmaNum / 2^EwmaShift
+     */
+    FilterBank() {
+      reset();
+    }
+
+    /**
+     * Clears all history. The next add() refills the windows
+     */
+    void reset() {
+      _nextIndex = 0;
+      _isEmpty = true;
+    }
+
+    /**
+     * Adds one new sample per channel (samples must have NumChannels values)
+     * and updates every filter in a single pass
+     */
+    void add(const T samples[]) {
+      if (_isEmpty) {
+        for (uint8_t c = 0; c < NumChannels; c++) {
+          for (uint8_t i = 0; i < WindowSize; i++) {
+            _history[i][c] = samples[c];
+            _sorted[c][i] = samples[c];
+          }
+          _sums[c] = (int32_t)samples[c] * WindowSize;
+          _ewmas[c] = (int32_t)samples[c] << EWMA_FRAC_BITS;
+        }
+        _isEmpty = false;
+        return;
+      }
+
+      T* oldest = _history[_nextIndex];
+      for (uint8_t c = 0; c < NumChannels; c++) {
+        T newVal = samples[c];
+        T oldVal = oldest[c];
+        oldest[c] = newVal;
+
+        _sums[c] += (int32_t)newVal - oldVal;
+
+        // Same as ewma += alpha * (newVal - ewma)
+        _ewmas[c] += ((((int32_t)newVal << EWMA_FRAC_BITS) - _ewmas[c]) * EwmaNum) >> EwmaShift;
+        if (newVal != oldVal) {
+          replaceSorted(_sorted[c], oldVal, newVal);
+        }
+      }
+
+      _nextIndex = _nextIndex + 1 < WindowSize ? _nextIndex + 1 : 0;
+    }
+
+    /**
+     * Returns the moving average of the given channel
+     */
+    T getAverage(uint8_t channel) const {
+      return _sums[channel] / WindowSize;
+    }
+
+    /**
+     * Returns the moving median of the given channel. For even window
+     * sizes, this is the upper of the two middle values
+     */
+    T getMedian(uint8_t channel) const {
+      return _sorted[channel][WindowSize / 2];
+    }
+
+    /**
+     * Returns the EWMA of the given channel, rounded to the nearest integer
+     */
+    T getEwma(uint8_t channel) const {
+      return (T)((_ewmas[channel] + (1L << (EWMA_FRAC_BITS - 1))) >> EWMA_FRAC_BITS);
+    }
+
+    /**
+     * Returns the most recent raw sample of the given channel
+     */
+    T getRaw(uint8_t channel) const {
+      return _history[_nextIndex > 0 ? _nextIndex - 1 : WindowSize - 1][channel];
+    }
+
+    /**
+     * Returns the number of channels
+     */
+    uint8_t getNumChannels() const {
+      return NumChannels;
+    }
+
+    /**
+     * Returns the window size
+     */
+    uint8_t getWindowSize() const {
+      return WindowSize;
+    }
+};
+
+#endif
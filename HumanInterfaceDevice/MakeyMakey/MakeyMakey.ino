@@ -28,6 +28,11 @@
  * Leonardo pins A6–A11 are analog-input only (no digital I/O)
  * but work fine for analogRead().
  *
+ * High-value pull-ups make the readings noisy, so we smooth every input with
+ * a moving median filter before comparing against the threshold. All inputs
+ * share one FilterBank (FilterBank.hpp in this folder), which updates every
+ * channel in a single pass rather than needing one filter object per pin.
+ *
  * Libraries: Keyboard (by Arduino) — install via Library Manager
  *
  * ------
@@ -39,6 +44,7 @@
  */
 
 #include <Keyboard.h>
+#include "FilterBank.hpp"
 
 /**
  * Represents a single resistive touch input mapped to a keyboard key.
@@ -69,6 +75,11 @@ TouchKey touchKeys[] = {
 
 const int NUM_KEYS = sizeof(touchKeys) / sizeof(touchKeys[0]);
 
+// One moving median filter (window size of 5) per key. A median rejects
+// the short spikes that floating, high-impedance inputs tend to produce
+const int FILTER_WINDOW_SIZE = 5;
+FilterBank<NUM_KEYS, int, FILTER_WINDOW_SIZE> _touchFilters;
+
 void setup() {
   Serial.begin(9600);
   pinMode(LED_BUILTIN, OUTPUT);
@@ -83,8 +94,15 @@ void setup() {
 void loop() {
   bool anyKeyPressed = false;
 
+  // Read all inputs, then smooth them all at once
+  int rawValues[NUM_KEYS];
+  for (int i = 0; i < NUM_KEYS; i++) {
+    rawValues[i] = analogRead(touchKeys[i].pin);
+  }
+  _touchFilters.add(rawValues);
+
   for (int i = 0; i < NUM_KEYS; i++) {
-    int sensorValue = analogRead(touchKeys[i].pin);
+    int sensorValue = _touchFilters.getMedian(i);
     bool touched = sensorValue < touchKeys[i].threshold;
 
     // Press on falling edge, release on rising edge
@@ -100,7 +118,7 @@ void loop() {
       anyKeyPressed = true;
     }
 
-    // Print raw value for Serial Plotter (comma-separated label:value pairs)
+    // Print smoothed value for Serial Plotter (comma-separated label:value pairs)
     Serial.print(touchKeys[i].label);
     Serial.print(":");
     Serial.print(sensorValue);
@@ -0,0 +1,154 @@
+
+/**
+ *  Draws a scrolling graph of a single analog input (set to A0) on the OLED
+ *  display that can zoom out to show minutes of history. Press the button
+ *  (on pin 4) to switch between zoom levels.
+ *
+ *  Each pixel column is drawn as a vertical line from the min to the max of
+ *  the samples in it, so spikes still show up when zoomed out. See
+ *  MinMaxHistory.hpp (in this folder), which keeps these columns for every
+ *  zoom level as the samples come in.
+ *
+ *  The history takes 768 bytes of RAM per level (~2.3 KB in all), so this
+ *  needs a board with more RAM than an Uno (e.g., an ESP32 or Feather M0).
+ *
+ *  By Jon E. Froehlich
+ *  @jonfroehlich
+ *  http://makeabilitylab.io
+ *
+ */
+
+#include <Wire.h>
+#include <SPI.h>
+
+#include <Adafruit_GFX.h>
+#include <Adafruit_SSD1306.h>
+#include "MinMaxHistory.hpp"
+
+#define SCREEN_WIDTH 128 // OLED display width, in pixels
+#define SCREEN_HEIGHT 64 // OLED display height, in pixels
+
+// Declaration for an SSD1306 display connected to I2C (SDA, SCL pins)
+#define OLED_RESET     4 // Reset pin # (or -1 if sharing Arduino reset pin)
+Adafruit_SSD1306 _display(SCREEN_WIDTH, SCREEN_HEIGHT, &Wire, OLED_RESET);
+
+const int ANALOG_INPUT_PIN = A0;
+const int ZOOM_BUTTON_PIN = 4;
+const int MIN_ANALOG_INPUT = 0;
+const int MAX_ANALOG_INPUT = 1023;
+const int SAMPLE_PERIOD_MS = 50; // 20 samples per second
+
+// With 8x zoom per level, the screen shows 6.4 s, 51 s, or 6.8 min
+const int NUM_LEVELS = 3;
+const int ZOOM_FACTOR = 8;
+MinMaxHistory<SCREEN_WIDTH, NUM_LEVELS, ZOOM_FACTOR> _history;
+
+const int STATUS_BAR_HEIGHT = 8;
+const int GRAPH_Y = STATUS_BAR_HEIGHT;
+const int GRAPH_HEIGHT = SCREEN_HEIGHT - GRAPH_Y;
+
+uint8_t _level = 0; // the zoom level on screen
+int _lastZoomButtonVal = HIGH;
+unsigned long _lastSampleTimeStamp = 0;
+
+void setup() {
+  Serial.begin(9600);
+
+  pinMode(ZOOM_BUTTON_PIN, INPUT_PULLUP);
+
+  // SSD1306_SWITCHCAPVCC = generate display voltage from 3.3V internally
+  if (!_display.begin(SSD1306_SWITCHCAPVCC, 0x3D)) { // Address 0x3D for 128x64
+    Serial.println(F("SSD1306 allocation failed"));
+    for (;;); // Don't proceed, loop forever
+  }
+
+  // Clear the buffer
+  _display.clearDisplay();
+
+  _display.setTextSize(1);
+  _display.setTextColor(WHITE, BLACK);
+  _display.setCursor(0, 0);
+  _display.println("Screen initialized!");
+  _display.display();
+  delay(500);
+
+  _lastSampleTimeStamp = millis();
+}
+
+void loop() {
+  boolean redraw = false;
+
+  // Sample at a steady rate, so each column is a known amount of time
+  if(millis() - _lastSampleTimeStamp >= SAMPLE_PERIOD_MS){
+    _lastSampleTimeStamp += SAMPLE_PERIOD_MS;
+
+    int analogVal = analogRead(ANALOG_INPUT_PIN);
+    Serial.println(analogVal);
+
+    // Only redraw if the level on screen got a new column
+    uint8_t numLevelsWithNewColumns = _history.add(analogVal);
+    redraw = numLevelsWithNewColumns > _level;
+  }
+
+  int zoomButtonVal = digitalRead(ZOOM_BUTTON_PIN);
+  if(_lastZoomButtonVal != zoomButtonVal && zoomButtonVal == LOW){
+    _level++;
+    if(_level >= NUM_LEVELS){
+      _level = 0;
+    }
+    redraw = true;
+  }
+  _lastZoomButtonVal = zoomButtonVal;
+
+  if(redraw){
+    _display.clearDisplay();
+    drawStatusBar();
+    drawGraph();
+    _display.display();
+  }
+}
+
+/**
+ * Draws the status bar at top of screen with the zoom level and the time on screen
+ */
+void drawStatusBar() {
+  _display.setCursor(0, 0);
+  _display.print("Zoom ");
+  _display.print(_level + 1);
+  _display.print("/");
+  _display.print(NUM_LEVELS);
+
+  // How much time the whole screen shows at this level
+  float screenSeconds = _history.getSamplesPerColumn(_level) * SCREEN_WIDTH * SAMPLE_PERIOD_MS / 1000.0;
+  int16_t x1, y1;
+  uint16_t w, h;
+  _display.getTextBounds("XXX.X min", 0, 0, &x1, &y1, &w, &h);
+  _display.setCursor(_display.width() - w, 0);
+  if(screenSeconds < 60){
+    _display.print(screenSeconds, 1);
+    _display.print(" s");
+  }else{
+    _display.print(screenSeconds / 60, 1);
+    _display.print(" min");
+  }
+}
+
+/**
+ * Draws each column at the current zoom level from its min to its max, newest on the right
+ */
+void drawGraph() {
+  uint8_t numColumns = _history.getNumColumns(_level);
+  for(uint8_t age = 0; age < numColumns; age++){
+    HistoryColumn column = _history.getColumn(_level, age);
+    int x = _display.width() - 1 - age;
+    int yMax = getYPixelForValue(column.max);
+    int yMin = getYPixelForValue(column.min);
+    _display.drawFastVLine(x, yMax, yMin - yMax + 1, SSD1306_WHITE);
+  }
+}
+
+// Get the y-pixel position for the analog value
+int getYPixelForValue(int analogVal) {
+  int lineHeight = map(analogVal, MIN_ANALOG_INPUT, MAX_ANALOG_INPUT, 0, GRAPH_HEIGHT - 1);
+  return GRAPH_Y + GRAPH_HEIGHT - 1 - lineHeight;
+}
@@ -0,0 +1,204 @@
+/**
+ * A history of samples at several zoom levels, summarized into one column
+ * (min, max, and mean) per pixel, for graphs that show minutes of signal
+ * rather than a second or two.
+ *
+ * A scrolling graph that draws one sample per pixel column only shows 128
+ * samples on a 128-pixel OLED. Drawing every 10th sample shows more time, but
+ * a spike that falls between the samples we draw disappears (aliasing).
+ * Instead, MinMaxHistory keeps, for each column, the min and max of all of
+ * the samples in it (so you can draw it as a vertical line from min to max
+ * and never lose a spike) and their mean.
+ *
+ * Level 0 has samplesPerColumn samples per column and each level after that
+ * has ZoomFactor times more. E.g., with 1 sample per column, ZoomFactor 4,
+ * and 3 levels, 128 columns show 128, 512, or 2048 samples. add() updates
+ * the levels as samples arrive: it adds each sample to level 0's column in
+ * progress, and each finished column is merged into the next level's column
+ * in progress. So, a sample costs a few comparisons and an addition per
+ * level at most, and there's no need to keep the samples themselves.
+ *
+ * Each level keeps NumColumns columns of 6 bytes each (on AVR), so
+ * MinMaxHistory<128, 3> takes ~2.3 KB. On an Uno (2 KB total, half of it for
+ * the SSD1306's framebuffer), use fewer columns or levels.
+ *
+ * Usage:
+ *  #include "MinMaxHistory.hpp"
+ *
+ *  MinMaxHistory<128, 3> _history;            // columns, levels (ZoomFactor is 4)
+ *
+ *  loop(){
+ *    uint8_t numLevels = _history.add(analogRead(A0));
+ *    if(numLevels > _level){                  // _level has a new column
+ *      for(uint8_t age = 0; age < _history.getNumColumns(_level); age++){
+ *        HistoryColumn column = _history.getColumn(_level, age);
+ *        // draw a line from column.min to column.max, 0 is the newest
+ *      }
+ *    }
+ *  }
+ *
+ * By Jon E. Froehlich
+ * @jonfroehlich
+ * http://makeabilitylab.io
+ *
+ */
+#ifndef MIN_MAX_HISTORY_HPP
+#define MIN_MAX_HISTORY_HPP
+
+#include <Arduino.h>
+
+struct HistoryColumn{
+  int min;
+  int max;
+  int mean;
+};
+
+template<uint8_t NumColumns, uint8_t NumLevels, uint8_t ZoomFactor = 4>
+class MinMaxHistory{
+
+  static_assert(NumColumns >= 1, "NumColumns must be at least 1");
+  static_assert(NumLevels >= 1, "NumLevels must be at least 1");
+  static_assert(ZoomFactor >= 2, "ZoomFactor must be at least 2");
+
+  private:
+    // A column in progress. It keeps the sum (rather than the mean) so
+    // merging it into the next level keeps the mean exact
+    struct Bucket{
+      int min;
+      int max;
+      int32_t sum;
+      uint32_t count;
+    };
+
+    const uint16_t _samplesPerColumn;
+
+    // For each level, its finished columns in a circular buffer and its column in progress
+    HistoryColumn _columns[NumLevels][NumColumns];
+    uint8_t _newest[NumLevels];
+    uint8_t _numColumns[NumLevels];
+    Bucket _inProgress[NumLevels];
+    uint8_t _numMerged[NumLevels];   // columns merged into _inProgress (levels > 0)
+
+    static void merge(Bucket& bucket, int min, int max, int32_t sum, uint32_t count) {
+      if (bucket.count == 0) {
+        bucket.min = min;
+        bucket.max = max;
+      } else {
+        if (min < bucket.min) {
+          bucket.min = min;
+        }
+        if (max > bucket.max) {
+          bucket.max = max;
+        }
+      }
+      bucket.sum += sum;
+      bucket.count += count;
+    }
+
+    // Adds level's column in progress to its columns and starts a new one
+    void finishColumn(uint8_t level) {
+      Bucket& bucket = _inProgress[level];
+      uint8_t index = _newest[level] + 1 >= NumColumns ? 0 : _newest[level] + 1;
+      HistoryColumn& column = _columns[level][index];
+      column.min = bucket.min;
+      column.max = bucket.max;
+      column.mean = (int)(bucket.sum / (int32_t)bucket.count);
+      _newest[level] = index;
+      if (_numColumns[level] < NumColumns) {
+        _numColumns[level]++;
+      }
+      bucket.sum = 0;
+      bucket.count = 0;
+    }
+
+  public:
+    /**
+     * Creates an empty history with samplesPerColumn samples per column at level 0
+     */
+    MinMaxHistory(uint16_t samplesPerColumn = 1)
+      : _samplesPerColumn(samplesPerColumn > 0 ? samplesPerColumn : 1) {
+      reset();
+    }
+
+    /**
+     * Adds a sample. Returns the number of levels that finished a column (so
+     * level has a new column if the result is greater than level)
+     */
+    uint8_t add(int sample) {
+      merge(_inProgress[0], sample, sample, sample, 1);
+      if (_inProgress[0].count < _samplesPerColumn) {
+        return 0;
+      }
+
+      // Finish level 0's column and carry it up as far as it finishes columns
+      uint8_t level = 0;
+      while (true) {
+        const Bucket finished = _inProgress[level];
+        finishColumn(level);
+        level++;
+        if (level >= NumLevels) {
+          return level;
+        }
+
+        merge(_inProgress[level], finished.min, finished.max, finished.sum, finished.count);
+        _numMerged[level]++;
+        if (_numMerged[level] < ZoomFactor) {
+          return level;
+        }
+        _numMerged[level] = 0;
+      }
+    }
+
+    /**
+     * Returns the column at level that's age columns old (0 is the newest).
+     * age must be less than getNumColumns(level)
+     */
+    HistoryColumn getColumn(uint8_t level, uint8_t age) const {
+      int index = (int)_newest[level] - age;
+      if (index < 0) {
+        index += NumColumns;
+      }
+      return _columns[level][index];
+    }
+
+    /**
+     * Returns the number of finished columns at level (up to NumColumns)
+     */
+    uint8_t getNumColumns(uint8_t level) const {
+      return _numColumns[level];
+    }
+
+    /**
+     * Returns the number of samples in each column at level
+     */
+    uint32_t getSamplesPerColumn(uint8_t level) const {
+      uint32_t samples = _samplesPerColumn;
+      for (uint8_t i = 0; i < level; i++) {
+        samples *= ZoomFactor;
+      }
+      return samples;
+    }
+
+    static uint8_t getNumLevels() {
+      return NumLevels;
+    }
+
+    static uint8_t getCapacity() {
+      return NumColumns;
+    }
+
+    /**
+     * Forgets all of the samples
+     */
+    void reset() {
+      for (uint8_t level = 0; level < NumLevels; level++) {
+        _newest[level] = 0;
+        _numColumns[level] = 0;
+        _inProgress[level].sum = 0;
+        _inProgress[level].count = 0;
+        _numMerged[level] = 0;
+      }
+    }
+};
+
+#endif
@@ -2,6 +2,10 @@
 /**
  *  Draws a scrolling graph of a single analog input (set to A0) on the OLED display
  *
+ *  Uses FastScrollingGraph.hpp (in this folder), which scrolls the graph by
+ *  moving the framebuffer's columns left and only draws the newest value, rather
+ *  than clearing the screen and redrawing all 128 values every frame.
+ *
  *  By Jon E. Froehlich
  *  @jonfroehlich
  *  http://makeabilitylab.io
@@ -13,6 +17,7 @@
 
 #include <Adafruit_GFX.h>
 #include <Adafruit_SSD1306.h>
+#include "FastScrollingGraph.hpp"
 
 #define SCREEN_WIDTH 128 // OLED display width, in pixels
 #define SCREEN_HEIGHT 64 // OLED display height, in pixels
@@ -26,17 +31,19 @@ const int MIN_ANALOG_INPUT = 0;
 const int MAX_ANALOG_INPUT = 1023;
 const int DELAY_LOOP_MS = 5; // change to slow down how often to read and graph value
 
-int _circularBuffer[SCREEN_WIDTH]; //fast way to store values 
-int _curWriteIndex = 0; // tracks where we are in the circular buffer
-
 // for tracking fps
 float _fps = 0;
 unsigned long _frameCount = 0;
 unsigned long _fpsStartTimeStamp = 0;
 
 // status bar
-boolean _drawStatusBar = true; // change to show/hide status bar
-int _graphHeight = SCREEN_HEIGHT;
+const boolean _drawStatusBar = true; // change to show/hide status bar
+const int STATUS_BAR_HEIGHT = 8;     // the top page (8 rows) of the screen
+
+// The graph fills the screen below the status bar
+const int GRAPH_Y = _drawStatusBar ? STATUS_BAR_HEIGHT : 0;
+FastScrollingGraph _graph(0, GRAPH_Y, SCREEN_WIDTH, SCREEN_HEIGHT - GRAPH_Y,
+                          MIN_ANALOG_INPUT, MAX_ANALOG_INPUT);
 
 void setup() {
   Serial.begin(9600);
@@ -58,45 +65,26 @@ void setup() {
   delay(500);
   _display.clearDisplay();
 
-  if(_drawStatusBar){
-    _graphHeight = SCREEN_HEIGHT - 10;
-  }
+  _graph.setStyle(GRAPH_BARS);
 
   _fpsStartTimeStamp = millis();
 }
 
 void loop() {
-  // Clear the display on each frame. We draw from the _circularBuffer
-  _display.clearDisplay();
+  // We don't clear the display each frame: the graph scrolls what's
+  // already there and the status bar erases itself
 
-  // Read and store the analog data into a circular buffer
+  // Read the analog value and add it to the right of the graph
   int analogVal = analogRead(ANALOG_INPUT_PIN);
   Serial.println(analogVal);
-  _circularBuffer[_curWriteIndex++] = analogVal;
-
-  // Set the circular buffer index back to zero when it reaches the 
-  // right of the screen
-  if(_curWriteIndex >= _display.width()){
-    _curWriteIndex = 0;
-  }
+  _graph.addData(analogVal);
   
   if(_drawStatusBar){
     drawStatusBar(analogVal);
   }
   
-  // Draw the line graph based on data in _circularBuffer
-  int xPos = 0; 
-  for (int i = _curWriteIndex; i < _display.width(); i++){
-    int analogVal = _circularBuffer[i];
-    drawLine(xPos, analogVal);
-    xPos++;
-  }
-  
-  for(int i = 0; i < _curWriteIndex; i++){
-    int analogVal = _circularBuffer[i];
-    drawLine(xPos, analogVal);
-    xPos++;;
-  }
+  // Scroll the graph and draw the new value
+  _graph.draw(_display);
   
   _display.display();
   
@@ -105,15 +93,6 @@ void loop() {
   delay(DELAY_LOOP_MS);
 }
 
-/**
- * Draw the line at the given x position and analog value
- */
-void drawLine(int xPos, int analogVal){
-  int lineHeight = map(analogVal, MIN_ANALOG_INPUT, MAX_ANALOG_INPUT, 0, _graphHeight);
-  int yPos = _display.height() - lineHeight;
-  _display.drawFastVLine(xPos, yPos, lineHeight, SSD1306_WHITE);
-}
-
 /**
  * Call this every frame to calculate frame rate
  */
@@ -134,7 +113,7 @@ void calcFrameRate() {
 void drawStatusBar(int analogVal) {
 
    // erase status bar by drawing all black
-  _display.fillRect(0, 0, _display.width(), 8, SSD1306_BLACK); 
+  _display.fillRect(0, 0, _display.width(), STATUS_BAR_HEIGHT, SSD1306_BLACK); 
   
   // Draw current val
   _display.setCursor(0, 0);
@@ -0,0 +1,264 @@
+/**
+ * A scrolling graph for the SSD1306 OLED that only draws what's new each frame.
+ *
+ * Our earlier scrolling graphs cleared the screen every frame and redrew all
+ * 128 points, calling map() for each one. But from one frame to the next, a
+ * scrolling graph is the same picture moved left by a column. So, rather than
+ * redrawing, FastScrollingGraph shifts the graph's columns left in the
+ * SSD1306 framebuffer (a quick memmove) and draws just the new points on the
+ * right. It only redraws everything when the y-axis range changes and then
+ * stays incremental again.
+ *
+ * When auto-scaling, the y-axis range is the min and max of just the points
+ * on the graph (tracked by SlidingMinMax.hpp in constant time per point), so
+ * after a spike scrolls off the left, the range shrinks back to fit the rest.
+ *
+ * You can add more than one point per frame. For example, read the sensor
+ * a few times between display() calls and the graph scrolls by that many
+ * columns, so you can graph faster than the screen refreshes.
+ *
+ * Notes:
+ *  - The graph moves whole SSD1306 pages (8 rows each), so its y and
+ *    height should be multiples of 8 and nothing else should be drawn in
+ *    those rows (except over the graph each frame, e.g., an axis label)
+ *  - Don't call clearDisplay() each frame; that would erase the graph. Clear
+ *    just the other parts of the screen (e.g., with fillRect)
+ *  - This changes the framebuffer directly, so it expects the display's
+ *    rotation to be 0. If you use it with PartialFlushSSD1306, call
+ *    markDirty() for the graph's area after draw()
+ *
+ * Usage:
+ *  FastScrollingGraph _graph(0, 8, 128, 56, 0, 1023); // x, y, width, height, min, max
+ *
+ *  loop(){
+ *    _graph.addData(analogRead(A0));
+ *    _graph.draw(_display);
+ *    _display.display();
+ *  }
+ *
+ * By Jon E. Froehlich
+ * @jonfroehlich
+ * http://makeabilitylab.io
+ *
+ */
+#ifndef FAST_SCROLLING_GRAPH_HPP
+#define FAST_SCROLLING_GRAPH_HPP
+
+#include <Arduino.h>
+#include <Adafruit_GFX.h>
+#include <Adafruit_SSD1306.h>
+#include "SlidingMinMax.hpp"
+
+enum GraphStyle{
+  GRAPH_POINTS,
+  GRAPH_LINES,
+  GRAPH_BARS    // filled from the bottom of the graph
+};
+
+class FastScrollingGraph{
+
+  public:
+    static const uint8_t MAX_WIDTH = 128;
+    static const uint8_t AXIS_DOT_SPACING = 5;
+
+  private:
+    const int16_t _x;
+    const int16_t _y;
+    const uint8_t _width;
+    const uint8_t _height;
+
+    GraphStyle _style;
+    bool _autoScale;
+    int _minValue;
+    int _maxValue;
+
+    bool _hasAxis;
+    int _axisValue;
+
+    // The points on the graph, one per column, and their min and max
+    SlidingMinMax<int, MAX_WIDTH> _points;
+    unsigned long _totalValues;  // spaces the axis dots so they scroll with the data
+
+    uint8_t _numNewValues;       // added since the last draw()
+    bool _needsRedraw;
+
+    int getValue(uint8_t age) const {
+      return _points.get(age);
+    }
+
+    int16_t getYPixel(int value) const {
+      int16_t bottom = _y + _height - 1;
+      if (_maxValue <= _minValue || value <= _minValue) {
+        return bottom;
+      }
+      if (value >= _maxValue) {
+        return _y;  // points outside a fixed range are drawn at its edge
+      }
+      // In long, since value - _minValue can overflow a 16-bit int on AVR
+      return bottom - (int16_t)(((long)value - _minValue) * (_height - 1) / ((long)_maxValue - _minValue));
+    }
+
+    // Draws the point that's age points old (0 is the newest) in its column
+    void drawColumn(Adafruit_SSD1306& display, uint8_t age) {
+      int16_t x = _x + _width - 1 - age;
+      int16_t y = getYPixel(getValue(age));
+
+      switch (_style) {
+        case GRAPH_POINTS:
+          display.drawPixel(x, y, SSD1306_WHITE);
+          break;
+        case GRAPH_LINES:
+          // The leftmost point is just a point, so its line doesn't
+          // go off the left of the graph
+          if (age + 1 < _points.getCount()) {
+            display.drawLine(x - 1, getYPixel(getValue(age + 1)), x, y, SSD1306_WHITE);
+          } else {
+            display.drawPixel(x, y, SSD1306_WHITE);
+          }
+          break;
+        case GRAPH_BARS:
+          display.drawFastVLine(x, y, _y + _height - y, SSD1306_WHITE);
+          break;
+      }
+
+      if (_hasAxis && (_totalValues - 1 - age) % AXIS_DOT_SPACING == 0 &&
+          _axisValue >= _minValue && _axisValue <= _maxValue) {
+        display.drawPixel(x, getYPixel(_axisValue), SSD1306_WHITE);
+      }
+    }
+
+    // Moves the graph's columns left by numColumns and clears the ones on the
+    // right. If the graph is full, it also clears the leftmost column, since
+    // that point's line to the point before it is now off the graph
+    void shiftLeft(Adafruit_SSD1306& display, uint8_t numColumns) {
+      uint8_t* buffer = display.getBuffer();
+      int16_t displayWidth = display.width();
+      for (int16_t page = _y / 8; page <= (_y + _height - 1) / 8; page++) {
+        uint8_t* row = buffer + page * displayWidth + _x;
+        memmove(row, row + numColumns, _width - numColumns);
+        memset(row + _width - numColumns, 0, numColumns);
+        if (_points.getCount() == _width) {
+          row[0] = 0;
+        }
+      }
+    }
+
+    void redraw(Adafruit_SSD1306& display) {
+      display.fillRect(_x, _y, _width, _height, SSD1306_BLACK);
+      for (int age = _points.getCount() - 1; age >= 0; age--) {
+        drawColumn(display, age);
+      }
+    }
+
+  public:
+    /**
+     * Creates a graph in the given area of the screen (see the notes about y
+     * and height above) with a fixed y-axis range from minValue to maxValue
+     */
+    FastScrollingGraph(int16_t x, int16_t y, uint8_t width, uint8_t height, int minValue, int maxValue)
+      : _x(x), _y(y), _width(width > MAX_WIDTH ? (uint8_t)MAX_WIDTH : width), _height(height),
+        _style(GRAPH_LINES), _autoScale(false), _minValue(minValue), _maxValue(maxValue),
+        _hasAxis(false), _axisValue(0), _points(_width) {
+      reset();
+    }
+
+    /**
+     * Creates a graph in the given area of the screen (see the notes about y
+     * and height above) whose y-axis range fits the points on the graph
+     */
+    FastScrollingGraph(int16_t x, int16_t y, uint8_t width, uint8_t height)
+      : FastScrollingGraph(x, y, width, height, 0, 0) {
+      _autoScale = true;
+    }
+
+    /**
+     * Adds a point to the right of the graph. It's drawn on the next draw()
+     */
+    void addData(int value) {
+      _points.add(value);
+      if (_autoScale && (_points.getMin() != _minValue || _points.getMax() != _maxValue)) {
+        _minValue = _points.getMin();
+        _maxValue = _points.getMax();
+        _needsRedraw = true;
+      }
+
+      _totalValues++;
+      if (_numNewValues < _width) {
+        _numNewValues++;
+      } else {
+        _needsRedraw = true;
+      }
+    }
+
+    /**
+     * Draws the graph into the display's framebuffer: just the points added
+     * since the last draw() or, if the range changed, everything. Returns
+     * true if it redrew everything
+     */
+    bool draw(Adafruit_SSD1306& display) {
+      if (_needsRedraw) {
+        redraw(display);
+        _needsRedraw = false;
+        _numNewValues = 0;
+        return true;
+      }
+
+      if (_numNewValues > 0) {
+        shiftLeft(display, _numNewValues);
+        if (_points.getCount() == _width && _width >= 2) {
+          // Redraw the leftmost column (and the line into it from the right)
+          drawColumn(display, _width - 1);
+          drawColumn(display, _width - 2);
+        }
+        for (int age = _numNewValues - 1; age >= 0; age--) {
+          drawColumn(display, age);
+        }
+        _numNewValues = 0;
+      }
+      return false;
+    }
+
+    /**
+     * Sets whether to draw points, lines between points, or bars
+     */
+    void setStyle(GraphStyle style) {
+      _style = style;
+      _needsRedraw = true;
+    }
+
+    /**
+     * Draws a dotted horizontal line at value (e.g., 0), if it's in the range
+     */
+    void setAxis(int value) {
+      _hasAxis = true;
+      _axisValue = value;
+      _needsRedraw = true;
+    }
+
+    /**
+     * Returns the y pixel of value on the graph (e.g., to label the axis)
+     */
+    int16_t getYPixelForValue(int value) const {
+      return getYPixel(value);
+    }
+
+    int getMinValue() const {
+      return _minValue;
+    }
+
+    int getMaxValue() const {
+      return _maxValue;
+    }
+
+    /**
+     * Forgets the points (and, if auto-scaling, the range). The next draw() clears the graph
+     */
+    void reset() {
+      _points.reset();
+      _totalValues = 0;
+      _numNewValues = 0;
+      _needsRedraw = true;
+    }
+};
+
+#endif
@@ -10,6 +10,15 @@
  *
  *  Adafruit OLED tutorials:
  *  https://learn.adafruit.com/monochrome-oled-breakouts
+ *
+ *  Uses PartialFlushSSD1306.hpp (in this folder) rather than Adafruit_SSD1306 so
+ *  that display() only sends the ball's old and new areas, not the whole screen.
+ *  Change _display back to an Adafruit_SSD1306 to compare the fps.
+ *
+ *  Uses GameLoop.hpp (also in this folder) so the ball moves at the same speed
+ *  however fast we draw: the ball moves every GAME_STEP_MS, and each frame
+ *  draws it between its last two positions. Set PRINT_FRAME_STATS_MS to print
+ *  the mean and max frame times over Serial that often.
  *  
  *  By Jon E. Froehlich
  *  @jonfroehlich
@@ -22,28 +31,36 @@
 
 #include <Adafruit_GFX.h>
 #include <Adafruit_SSD1306.h>
+#include "PartialFlushSSD1306.hpp"
+#include "GameLoop.hpp"
 
 #define SCREEN_WIDTH 128 // OLED display width, in pixels
 #define SCREEN_HEIGHT 64 // OLED display height, in pixels
 
 // Declaration for an SSD1306 display connected to I2C (SDA, SCL pins)
 #define OLED_RESET     4 // Reset pin # (or -1 if sharing Arduino reset pin)
-Adafruit_SSD1306 _display(SCREEN_WIDTH, SCREEN_HEIGHT, &Wire, OLED_RESET);
+PartialFlushSSD1306 _display(SCREEN_WIDTH, SCREEN_HEIGHT, &Wire, OLED_RESET);
+
+// The ball moves every GAME_STEP_MS (about 33 times a second), however long a
+// frame takes. We draw every loop(), so the ball is drawn between its last two
+// positions. 30 ms keeps the speed the ball had when it moved once per frame
+// (a 5 ms delay plus ~25 ms for a full display())
+const int GAME_STEP_MS = 30;
+GameLoop _gameLoop(GAME_STEP_MS, 4, true);
 
-const int DELAY_LOOP_MS = 5; // change to slow down how often to read and graph value
+// Print frame-time stats over Serial this often (0 for never). Printing
+// takes ~0.5 s at 9600 baud, so the ball pauses while it prints
+const unsigned long PRINT_FRAME_STATS_MS = 0;
 
 // Ball variables
 const int _ballRadius = 5;
 int _xBall = 0;
 int _yBall = 0;
+int _xLastBall = 0; // where the ball was before the last step
+int _yLastBall = 0;
 int _xSpeed = 0;
 int _ySpeed = 0;
 
-// for tracking fps
-float _fps = 0;
-unsigned long _frameCount = 0;
-unsigned long _fpsStartTimeStamp = 0;
-
 // status bar
 const boolean _drawStatusBar = true; // change to show/hide status bar
 
@@ -53,8 +70,8 @@ void setup() {
   initializeOledAndShowStartupScreen();
 
   // Initialize ball to center of screen
-  _xBall = _display.width() / 2;
-  _yBall = _display.height() / 2;
+  _xBall = _xLastBall = _display.width() / 2;
+  _yBall = _yLastBall = _display.height() / 2;
 
   // Gets a random long between min and max - 1
   // https://www.arduino.cc/reference/en/language/functions/random-numbers/random/
@@ -63,19 +80,43 @@ void setup() {
   _ySpeed = random(1, 4);
 
   //Serial.println((String)"_xBall:" + _xBall + " _xBall:" + _xBall + " _xSpeed:" + _xSpeed + " _ySpeed:" + _ySpeed);
-  _fpsStartTimeStamp = millis();
+  _gameLoop.begin();
 }
 
 void loop() {
+  // Move the ball once for each step that's due
+  while(_gameLoop.step()){
+    updateBall();
+  }
 
-  _display.clearDisplay();
+  if(_gameLoop.shouldDraw()){
+    _display.clearDisplay();
 
-  if(_drawStatusBar){
-    drawStatusBar();
+    if(_drawStatusBar){
+      drawStatusBar();
+    }
+
+    // Draw circle between its last two positions
+    float alpha = _gameLoop.getAlpha();
+    int xBall = _xLastBall + round((_xBall - _xLastBall) * alpha);
+    int yBall = _yLastBall + round((_yBall - _yLastBall) * alpha);
+    _display.drawCircle(xBall, yBall, _ballRadius, SSD1306_WHITE);
+
+    // Render buffer to screen
+    _display.display();
+    _gameLoop.endDraw();
   }
 
-  calcFrameRate();
-  
+  _gameLoop.printStatsEvery(Serial, PRINT_FRAME_STATS_MS);
+}
+
+/**
+ * Moves the ball one step and bounces it off the edges of the screen
+ */
+void updateBall() {
+  _xLastBall = _xBall;
+  _yLastBall = _yBall;
+
   // Update ball based on speed location
   _xBall += _xSpeed;
   _yBall += _ySpeed;
@@ -89,16 +130,6 @@ void loop() {
     _ySpeed = _ySpeed * -1; // reverse y direction
   }
 
-  // Draw circle
-  _display.drawCircle(_xBall, _yBall, _ballRadius, SSD1306_WHITE);
-  
-  // Render buffer to screen
-  _display.display();
-
-  if(DELAY_LOOP_MS > 0){
-    delay(DELAY_LOOP_MS);
-  }
-
   //Serial.println((String)"_xBall:" + _xBall + " _xBall:" + _xBall + " _xSpeed:" + _xSpeed + " _ySpeed:" + _ySpeed);
 }
 
@@ -132,19 +163,6 @@ void initializeOledAndShowStartupScreen(){
   _display.clearDisplay();
 }
 
-/**
- * Call this every frame to calculate frame rate
- */
-void calcFrameRate() {
-  unsigned long elapsedTime = millis() - _fpsStartTimeStamp;
-  _frameCount++;
-  if (elapsedTime > 1000) {
-    _fps = _frameCount / (elapsedTime / 1000.0);
-    _fpsStartTimeStamp = millis();
-    _frameCount = 0;
-  }
-}
-
 /**
  * Draws the status bar at top of screen with fps
  */
@@ -156,6 +174,6 @@ void drawStatusBar() {
   _display.setTextSize(1);
   _display.getTextBounds("XX.XX fps", 0, 0, &x1, &y1, &w, &h);
   _display.setCursor(_display.width() - w, 0);
-  _display.print(_fps);
+  _display.print(_gameLoop.getFps());
   _display.print(" fps");
 }
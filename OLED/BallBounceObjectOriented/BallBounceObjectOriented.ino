@@ -11,6 +11,10 @@
  *   - On Mac, it's: /Users/jonf/Documents/Arduino/libraries
  * 3. Then include the relevant libraries via #include <libraryname.h> or <libraryname.hpp>
  *
+ * GameLoop.hpp (in this folder) moves the ball every GAME_STEP_MS, however long
+ * drawing takes. Shape doesn't keep its last position, so the ball is drawn where
+ * it is rather than between steps.
+ *
  * Adafruit Gfx Library:
  * https://learn.adafruit.com/adafruit-gfx-graphics-library/overview 
  *
@@ -29,6 +33,7 @@
 
 #include <Adafruit_GFX.h>
 #include <Adafruit_SSD1306.h>
+#include "GameLoop.hpp"
 
 #define SCREEN_WIDTH 128 // OLED display width, in pixels
 #define SCREEN_HEIGHT 64 // OLED display height, in pixels
@@ -37,16 +42,18 @@
 #define OLED_RESET     4 // Reset pin # (or -1 if sharing Arduino reset pin)
 Adafruit_SSD1306 _display(SCREEN_WIDTH, SCREEN_HEIGHT, &Wire, OLED_RESET);
 
-const int DELAY_LOOP_MS = 5; 
+// 30 ms keeps the speed the ball had when it moved once per frame (a 5 ms
+// delay plus ~25 ms for display())
+const int GAME_STEP_MS = 30;
+GameLoop _gameLoop(GAME_STEP_MS);
+
+// Print frame-time stats over Serial this often (0 for never). Printing
+// takes ~0.5 s at 9600 baud, so the ball pauses while it prints
+const unsigned long PRINT_FRAME_STATS_MS = 0;
 
 // Initialize ball
 Ball _ball(20, 20, 5);  
 
-// for tracking fps
-float _fps = 0;
-unsigned long _frameCount = 0;
-unsigned long _fpsStartTimeStamp = 0;
-
 // status bar
 const boolean _drawStatusBar = true; // change to show/hide status bar
 
@@ -59,39 +66,39 @@ void setup() {
   int xSpeed = random(1, 4);
   int ySpeed = random(1, 4);
   _ball.setSpeed(xSpeed, ySpeed);
-  
-  _fpsStartTimeStamp = millis();
+
+  _gameLoop.begin();
 }
 
 void loop() {
-  
-  _display.clearDisplay();
-  
-  if(_drawStatusBar){
-    drawStatusBar();
-  }
+  // Update ball based on speed and location, once for each step that's due
+  while(_gameLoop.step()){
+    _ball.update();
 
-  calcFrameRate();
-  
-  // Update ball based on speed and location
-  _ball.update();
+    if(_ball.checkXBounce(0, _display.width())){
+      _ball.reverseXSpeed();
+    }
 
-  if(_ball.checkXBounce(0, _display.width())){
-    _ball.reverseXSpeed();
+    if(_ball.checkYBounce(0, _display.height())){
+      _ball.reverseYSpeed();
+    }
   }
 
-  if(_ball.checkYBounce(0, _display.height())){
-    _ball.reverseYSpeed();
-  }
+  if(_gameLoop.shouldDraw()){
+    _display.clearDisplay();
 
-  _ball.draw(_display);
+    if(_drawStatusBar){
+      drawStatusBar();
+    }
 
-  // Render buffer to screen
-  _display.display();
+    _ball.draw(_display);
 
-  if(DELAY_LOOP_MS > 0){
-    delay(DELAY_LOOP_MS);
+    // Render buffer to screen
+    _display.display();
+    _gameLoop.endDraw();
   }
+
+  _gameLoop.printStatsEvery(Serial, PRINT_FRAME_STATS_MS);
 }
 
 /**
@@ -116,19 +123,6 @@ void initializeOledAndShowStartupScreen(){
   _display.clearDisplay();
 }
 
-/**
- * Call this every frame to calculate frame rate
- */
-void calcFrameRate() {
-  unsigned long elapsedTime = millis() - _fpsStartTimeStamp;
-  _frameCount++;
-  if (elapsedTime > 1000) {
-    _fps = _frameCount / (elapsedTime / 1000.0);
-    _fpsStartTimeStamp = millis();
-    _frameCount = 0;
-  }
-}
-
 /**
  * Draws the status bar at top of screen with fps
  */
@@ -139,6 +133,6 @@ void drawStatusBar() {
   uint16_t w, h;
   _display.getTextBounds("XX.XX fps", 0, 0, &x1, &y1, &w, &h);
   _display.setCursor(_display.width() - w, 0);
-  _display.print(_fps);
+  _display.print(_gameLoop.getFps());
   _display.print(" fps");
 }
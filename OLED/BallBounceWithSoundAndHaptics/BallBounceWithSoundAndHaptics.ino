@@ -13,6 +13,9 @@
  *
  *  Adafruit OLED tutorials:
  *  https://learn.adafruit.com/monochrome-oled-breakouts
+ *
+ *  Uses GameLoop.hpp (in this folder) to move the ball in fixed time steps,
+ *  so the bounces, tones, and buzzes keep the same rhythm whatever the frame rate.
  *  
  *  By Jon E. Froehlich
  *  @jonfroehlich
@@ -25,6 +28,7 @@
 
 #include <Adafruit_GFX.h>
 #include <Adafruit_SSD1306.h>
+#include "GameLoop.hpp"
 
 #define SCREEN_WIDTH 128 // OLED display width, in pixels
 #define SCREEN_HEIGHT 64 // OLED display height, in pixels
@@ -38,7 +42,15 @@ const int TONE_OUTPUT_PIN = 5;
 const int VIBROMOTOR_OUTPUT_PIN = 6;
 
 // Set constants
-const int DELAY_LOOP_MS = 5; 
+// The ball moves every GAME_STEP_MS (see GameLoop.hpp) and is drawn between
+// its last two positions every loop(). 30 ms keeps the speed the ball had
+// when it moved once per frame (a 5 ms delay plus ~25 ms for display())
+const int GAME_STEP_MS = 30;
+GameLoop _gameLoop(GAME_STEP_MS, 4, true);
+
+// Print frame-time stats over Serial this often (0 for never). Printing
+// takes ~0.5 s at 9600 baud, so the ball pauses while it prints
+const unsigned long PRINT_FRAME_STATS_MS = 0;
 const int WALL_COLLISION_TONE_FREQUENCY = 100;
 const int CEILING_COLLISION_TONE_FREQUENCY = 200;
 const int PLAY_TONE_DURATION_MS = 200;
@@ -51,14 +63,11 @@ unsigned long _vibroMotorStartTimeStamp = -1;
 const int _ballRadius = 5;
 int _xBall = 0;
 int _yBall = 0;
+int _xLastBall = 0; // where the ball was before the last step
+int _yLastBall = 0;
 int _xSpeed = 0;
 int _ySpeed = 0;
 
-// for tracking fps
-float _fps = 0;
-unsigned long _frameCount = 0;
-unsigned long _fpsStartTimeStamp = 0;
-
 // status bar
 const boolean _drawStatusBar = true; // change to show/hide status bar
 
@@ -71,8 +80,8 @@ void setup() {
   initializeOledAndShowStartupScreen();
   
   // Initialize ball to center of screen
-  _xBall = _display.width() / 2;
-  _yBall = _display.height() / 2;
+  _xBall = _xLastBall = _display.width() / 2;
+  _yBall = _yLastBall = _display.height() / 2;
 
   // Gets a random long between min and max - 1
   // https://www.arduino.cc/reference/en/language/functions/random-numbers/random/
@@ -80,19 +89,43 @@ void setup() {
   _ySpeed = random(1, 4);
 
   //Serial.println((String)"_xBall:" + _xBall + " _xBall:" + _xBall + " _xSpeed:" + _xSpeed + " _ySpeed:" + _ySpeed);
-   _fpsStartTimeStamp = millis();
+  _gameLoop.begin();
 }
 
 void loop() {
+  // Move the ball once for each step that's due
+  while(_gameLoop.step()){
+    updateBall();
+  }
 
-  _display.clearDisplay();
+  if(_gameLoop.shouldDraw()){
+    _display.clearDisplay();
+
+    if(_drawStatusBar){
+      drawStatusBar();
+    }
+
+    // Draw circle between its last two positions
+    float alpha = _gameLoop.getAlpha();
+    int xBall = _xLastBall + round((_xBall - _xLastBall) * alpha);
+    int yBall = _yLastBall + round((_yBall - _yLastBall) * alpha);
+    _display.drawCircle(xBall, yBall, _ballRadius, SSD1306_WHITE);
 
-  if(_drawStatusBar){
-    drawStatusBar();
+    // Render buffer to screen
+    _display.display();
+    _gameLoop.endDraw();
   }
-  
-  calcFrameRate();
-  
+
+  _gameLoop.printStatsEvery(Serial, PRINT_FRAME_STATS_MS);
+}
+
+/**
+ * Moves the ball one step and bounces it off the edges of the screen
+ */
+void updateBall() {
+  _xLastBall = _xBall;
+  _yLastBall = _yBall;
+
   // Update ball based on speed location
   _xBall += _xSpeed;
   _yBall += _ySpeed;
@@ -129,16 +162,6 @@ void loop() {
     }
   }
 
-  // Draw circle
-  _display.drawCircle(_xBall, _yBall, _ballRadius, SSD1306_WHITE);
-  
-  // Render buffer to screen
-  _display.display();
-
-  if(DELAY_LOOP_MS > 0){
-    delay(DELAY_LOOP_MS);
-  }
-
   //Serial.println((String)"_xBall:" + _xBall + " _xBall:" + _xBall + " _xSpeed:" + _xSpeed + " _ySpeed:" + _ySpeed);
 }
 
@@ -164,19 +187,6 @@ void initializeOledAndShowStartupScreen(){
   _display.clearDisplay();
 }
 
-/**
- * Call this every frame to calculate frame rate
- */
-void calcFrameRate() {
-  unsigned long elapsedTime = millis() - _fpsStartTimeStamp;
-  _frameCount++;
-  if (elapsedTime > 1000) {
-    _fps = _frameCount / (elapsedTime / 1000.0);
-    _fpsStartTimeStamp = millis();
-    _frameCount = 0;
-  }
-}
-
 /**
  * Draws the status bar at top of screen with fps
  */
@@ -187,6 +197,6 @@ void drawStatusBar() {
   uint16_t w, h;
   _display.getTextBounds("XX.XX fps", 0, 0, &x1, &y1, &w, &h);
   _display.setCursor(_display.width() - w, 0);
-  _display.print(_fps);
+  _display.print(_gameLoop.getFps());
   _display.print(" fps");
 }
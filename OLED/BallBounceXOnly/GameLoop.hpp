@@ -0,0 +1,223 @@
+/**
+ * A fixed-timestep game loop for our OLED games.
+ *
+ * Our games used to move things a fixed amount per loop() (e.g., the ball
+ * moves _xSpeed pixels each frame) and pace themselves with delay(). So, the
+ * game's speed depended on how long drawing and display() took: a frame that
+ * drew more text, or a full-screen display() rather than a partial one,
+ * slowed the whole game down, and a faster display sped it up.
+ *
+ * GameLoop splits loop() into updating the game and drawing it. Updates run
+ * in "steps" of a fixed length of time (e.g., 20 ms), however long drawing
+ * takes: each loop(), the time since the last one goes into an
+ * "accumulator," and step() runs one update per whole step in it. So, the
+ * game always runs at the same speed and only the frame rate changes:
+ *  - If drawing is fast, we draw only after a step (nothing moved
+ *    otherwise), or every loop() if the game draws things between their
+ *    last two positions with getAlpha() (see isInterpolating below)
+ *  - If drawing takes longer than a step, the next loop() runs several
+ *    steps before drawing again: we skip frames rather than slow down. At
+ *    most maxStepsPerFrame steps run per loop(); time past that is dropped,
+ *    so a long stall doesn't make the game race to catch up afterwards
+ *
+ * printStatsEvery() optionally prints a line of frame-time stats over Serial.
+ *
+ * Usage:
+ *  GameLoop _gameLoop(20); // update the game every 20 ms (50 times a second)
+ *
+ *  setup(){
+ *    ...
+ *    _gameLoop.begin();
+ *  }
+ *
+ *  loop(){
+ *    while(_gameLoop.step()){
+ *      updateGame(); // move things by the same amount every step
+ *    }
+ *
+ *    if(_gameLoop.shouldDraw()){
+ *      _display.clearDisplay();
+ *      drawGame();
+ *      _display.display();
+ *      _gameLoop.endDraw();
+ *    }
+ *
+ *    _gameLoop.printStatsEvery(Serial, 10000); // every 10 secs (0 for never)
+ *  }
+ *
+ * By Jon E. Froehlich
+ * @jonfroehlich
+ * http://makeabilitylab.io
+ *
+ */
+#ifndef GAME_LOOP_HPP
+#define GAME_LOOP_HPP
+
+#include <Arduino.h>
+
+class GameLoop{
+
+  private:
+    const uint32_t _stepUs;
+    const uint8_t _maxStepsPerFrame;
+    const bool _isInterpolating;
+
+    uint32_t _lastUs;          // when step() last added to the accumulator
+    uint32_t _accumulatorUs;   // time that steps haven't used yet
+    bool _isStepping;          // between the first step() of a loop() and the one that returns false
+    uint16_t _stepsSinceDraw;
+    uint32_t _lastDrawUs;
+
+    // For getFps(), updated about once a second
+    float _fps;
+    uint16_t _fpsFrameCount;
+    unsigned long _fpsStartMs;
+
+    // Stats since the last printStatsEvery()
+    uint16_t _numFrames;
+    uint32_t _totalFrameUs;
+    uint32_t _maxFrameUs;
+    uint16_t _numSkippedFrames;
+    unsigned long _statsStartMs;
+
+    void resetStats() {
+      _numFrames = 0;
+      _totalFrameUs = 0;
+      _maxFrameUs = 0;
+      _numSkippedFrames = 0;
+      _statsStartMs = millis();
+    }
+
+  public:
+    /**
+     * Creates a game loop that updates the game every stepMs milliseconds.
+     * If isInterpolating is true, shouldDraw() is true every loop() (for
+     * games that draw between steps with getAlpha()); otherwise only after a step
+     */
+    GameLoop(uint16_t stepMs, uint8_t maxStepsPerFrame = 4, bool isInterpolating = false)
+      : _stepUs((uint32_t)stepMs * 1000), _maxStepsPerFrame(max((uint8_t)1, maxStepsPerFrame)),
+        _isInterpolating(isInterpolating) {
+      begin();
+    }
+
+    /**
+     * Starts (or restarts) the clock. Call it at the end of setup() so the
+     * time setup() took (e.g., showing a load screen) isn't counted. The
+     * first loop() runs one step right away
+     */
+    void begin() {
+      _lastUs = micros();
+      _accumulatorUs = _stepUs;
+      _isStepping = false;
+      _stepsSinceDraw = 0;
+      _lastDrawUs = _lastUs;
+      _fps = 0;
+      _fpsFrameCount = 0;
+      _fpsStartMs = millis();
+      resetStats();
+    }
+
+    /**
+     * Returns true if it's time to update the game by one step (and uses up
+     * that step). Call it in a while loop at the start of loop()
+     */
+    bool step() {
+      if (!_isStepping) {
+        // The first call this loop(): add the time since the last one, but
+        // drop whatever we can't catch up on
+        uint32_t now = micros();
+        _accumulatorUs = min(_accumulatorUs + (now - _lastUs), _stepUs * _maxStepsPerFrame);
+        _lastUs = now;
+        _isStepping = true;
+      }
+
+      if (_accumulatorUs < _stepUs) {
+        _isStepping = false;
+        return false;
+      }
+      _accumulatorUs -= _stepUs;
+      _stepsSinceDraw++;
+      return true;
+    }
+
+    /**
+     * Returns true if the game should draw a frame this loop(): if a step
+     * ran since the last frame or, if interpolating, every loop()
+     */
+    bool shouldDraw() const {
+      return _stepsSinceDraw > 0 || _isInterpolating;
+    }
+
+    /**
+     * Returns how far we are (from 0 to 1) between the last step and the
+     * next one, for drawing moving things between their last two positions:
+     *   x = lastX + (x - lastX) * alpha
+     */
+    float getAlpha() const {
+      return _accumulatorUs / (float)_stepUs;
+    }
+
+    /**
+     * Call this after drawing a frame (after display()) to time it
+     */
+    void endDraw() {
+      uint32_t now = micros();
+      uint32_t frameUs = now - _lastDrawUs;
+      _lastDrawUs = now;
+      if (_numFrames < 0xFFFF && _totalFrameUs <= 0xFFFFFFFF - frameUs) {
+        _numFrames++;
+        _totalFrameUs += frameUs;
+        _maxFrameUs = max(_maxFrameUs, frameUs);
+        if (_stepsSinceDraw > 1) {
+          _numSkippedFrames += _stepsSinceDraw - 1;  // each step past the first is a frame we skipped
+        }
+      }
+      _stepsSinceDraw = 0;
+
+      _fpsFrameCount++;
+      unsigned long elapsedMs = millis() - _fpsStartMs;
+      if (elapsedMs >= 1000) {
+        _fps = _fpsFrameCount * 1000.0 / elapsedMs;
+        _fpsFrameCount = 0;
+        _fpsStartMs = millis();
+      }
+    }
+
+    /**
+     * Returns the frames drawn per second (over the last second or so)
+     */
+    float getFps() const { return _fps; }
+
+    uint16_t getStepMs() const { return _stepUs / 1000; }
+    bool isInterpolating() const { return _isInterpolating; }
+
+    /**
+     * Every intervalMs milliseconds, prints the frame times since the last
+     * time it printed, like:
+     *   Frames: 412 (41.2 fps), mean 24.3 ms, max 33.0 ms, skipped: 88
+     * Printing takes a while (~1 ms per character at 9600 baud), so the
+     * game's clock is paused while it prints. Does nothing if intervalMs is 0
+     */
+    void printStatsEvery(Print& out, unsigned long intervalMs) {
+      unsigned long elapsedMs = millis() - _statsStartMs;
+      if (intervalMs == 0 || elapsedMs < intervalMs) {
+        return;
+      }
+      out.print(F("Frames: "));
+      out.print(_numFrames);
+      out.print(F(" ("));
+      out.print(_numFrames * 1000.0 / elapsedMs, 1);
+      out.print(F(" fps), mean "));
+      out.print(_numFrames > 0 ? _totalFrameUs / 1000.0 / _numFrames : 0, 1);
+      out.print(F(" ms, max "));
+      out.print(_maxFrameUs / 1000.0, 1);
+      out.print(F(" ms, skipped: "));
+      out.println(_numSkippedFrames);
+
+      resetStats();
+      _lastUs = micros();
+      _lastDrawUs = _lastUs;
+    }
+};
+
+#endif
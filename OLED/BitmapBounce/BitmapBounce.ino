@@ -4,6 +4,9 @@
  * To create the byte dumps of the images, I used the image2cpp tool here: 
  * http://javl.github.io/image2cpp/
  * 
+ * The logo is drawn with SpriteEngine.hpp (in this folder), which copies it
+ * into the framebuffer a byte (8 rows) at a time rather than pixel by pixel.
+ * 
  * By Jon E. Froehlich
  * @jonfroehlich
  * http://makeabilitylab.io
@@ -14,6 +17,7 @@
 #include <Wire.h>
 #include <Adafruit_GFX.h>
 #include <Adafruit_SSD1306.h>
+#include "SpriteEngine.hpp"
 
 #define SCREEN_WIDTH 128 // OLED display width, in pixels
 #define SCREEN_HEIGHT 64 // OLED display height, in pixels
@@ -25,24 +29,26 @@ Adafruit_SSD1306 _display(SCREEN_WIDTH, SCREEN_HEIGHT, &Wire, OLED_RESET);
 const int LOGO_WIDTH = 50;
 const int LOGO_HEIGHT = 35;
 
-// 'logo_bw_no_text_600w', 50x35px
+// 'logo_bw_no_text_600w', 50x35px, in the SSD1306's "vertical" layout for
+// SpriteEngine.hpp (image2cpp's "Vertical - 1 bit per pixel" draw mode):
+// 5 pages of 8 rows x 50 columns, a byte per column with the top row in the lowest bit
 const unsigned char PROGMEM _logoBitmap []  = {
-  0x00, 0x80, 0x00, 0x00, 0x00, 0x40, 0x00, 0x01, 0x40, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x02, 0x20, 
-  0x00, 0x00, 0x01, 0x50, 0x00, 0x04, 0x10, 0x00, 0x00, 0x02, 0x48, 0x00, 0x08, 0x08, 0x00, 0x00, 
-  0x04, 0x44, 0x00, 0x10, 0x04, 0x00, 0x00, 0x08, 0x42, 0x00, 0x20, 0x02, 0x00, 0x00, 0x10, 0x41, 
-  0x00, 0x40, 0x01, 0x00, 0x00, 0x20, 0x40, 0x80, 0x80, 0x00, 0x80, 0x00, 0x7f, 0xff, 0xc0, 0xc0, 
-  0x00, 0x40, 0x00, 0xe0, 0x40, 0xc0, 0xa0, 0x00, 0x20, 0x01, 0x30, 0x41, 0x40, 0x90, 0x00, 0x10, 
-  0x02, 0x18, 0x42, 0x40, 0x88, 0x00, 0x08, 0x04, 0x0c, 0x44, 0x40, 0x84, 0x00, 0x04, 0x08, 0x06, 
-  0x48, 0x40, 0x82, 0x00, 0x02, 0x10, 0x03, 0x50, 0x40, 0x81, 0x00, 0x01, 0x20, 0x01, 0xe0, 0x40, 
-  0x80, 0x80, 0x00, 0xc0, 0x00, 0xc0, 0x40, 0x80, 0xc0, 0x00, 0x40, 0x00, 0xc0, 0x40, 0x80, 0xe0, 
-  0x00, 0x20, 0x01, 0xc0, 0x40, 0x80, 0xf0, 0x00, 0x10, 0x03, 0xc0, 0x40, 0x80, 0xf8, 0x00, 0x08, 
-  0x07, 0xc0, 0x40, 0x80, 0xfc, 0x00, 0x04, 0x0f, 0xc0, 0x40, 0x80, 0xfe, 0x00, 0x02, 0x1f, 0xc0, 
-  0x40, 0x80, 0xff, 0x00, 0x01, 0x3f, 0xc0, 0x40, 0x80, 0xff, 0x80, 0x00, 0xff, 0xc0, 0x40, 0xc0, 
-  0xff, 0xc0, 0x00, 0xff, 0xc0, 0xc0, 0x60, 0xff, 0x20, 0x01, 0x3f, 0xc1, 0x80, 0x30, 0xfe, 0x10, 
-  0x02, 0x1f, 0xc3, 0x00, 0x18, 0xfc, 0x08, 0x04, 0x0f, 0xc6, 0x00, 0x0c, 0xf8, 0x04, 0x08, 0x07, 
-  0xcc, 0x00, 0x06, 0xf0, 0x02, 0x10, 0x03, 0xd8, 0x00, 0x03, 0xe0, 0x01, 0x20, 0x01, 0xf0, 0x00, 
-  0x01, 0xc0, 0x00, 0xc0, 0x00, 0xe0, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00
+  0x00, 0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0xff, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 
+  0x80, 0x00, 0xff, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x00, 0x00, 0x80, 0x40, 0x20, 0x10, 
+  0x08, 0x04, 0x02, 0x03, 0x07, 0x0d, 0x19, 0x31, 0x61, 0xc1, 0x81, 0xff, 0x81, 0x41, 0x21, 0x11, 
+  0x09, 0x05, 0x03, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xfe, 0xfc, 0xf8, 
+  0xf0, 0xe0, 0xc0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x04, 0x08, 
+  0x10, 0x20, 0x40, 0x80, 0x00, 0x00, 0x80, 0xc0, 0xe0, 0xf0, 0xf8, 0xfc, 0xff, 0xff, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x06, 0x0c, 0x18, 0x30, 0x60, 0xc0, 0x80, 0xff, 0xff, 
+  0xff, 0x7f, 0x3f, 0x1f, 0x0f, 0x07, 0x03, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x00, 0x00, 
+  0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x03, 0x03, 0x07, 0x0f, 0x1f, 0x3f, 0x7f, 0xff, 0xff, 0xff, 
+  0x80, 0xc0, 0x60, 0x30, 0x18, 0x0c, 0x06, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
+  0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x01, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 
 int _xLogo = 0;   // x location of logo (in pixels)
@@ -75,7 +81,7 @@ void loop() {
   _display.clearDisplay();
 
   // Draw the bitmap
-  _display.drawBitmap(_xLogo, _yLogo,  _logoBitmap, LOGO_WIDTH, LOGO_HEIGHT, WHITE);
+  SpriteBlitter::draw(_display, _xLogo, _yLogo, _logoBitmap, LOGO_WIDTH, LOGO_HEIGHT);
   _display.display();
 
   // Move the logo
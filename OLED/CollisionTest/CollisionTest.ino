@@ -15,6 +15,17 @@
  *
  * Adafruit OLED tutorials:
  * https://learn.adafruit.com/monochrome-oled-breakouts
+ *
+ * The player ball moves every GAME_STEP_MS using GameLoop.hpp (in this folder),
+ * so the joystick moves it at the same speed however long drawing takes.
+ *
+ * The target shapes are kept in a SpatialGrid (SpatialGrid.hpp, also in this
+ * folder), so we only call overlaps() on the shapes near the player ball
+ * rather than on every shape. Try raising NUM_TARGET_SHAPES.
+ *
+ * The target shapes are created in an ObjectPool (ObjectPool.hpp, also in this
+ * folder) rather than with new, so the RAM they take is set aside (and counted
+ * by the compiler) at compile time rather than taken from the heap.
  *  
  * By Jon E. Froehlich
  * @jonfroehlich
@@ -24,11 +35,15 @@
 
 #include <Wire.h>
 #include <SPI.h>
-#include <Shape.hpp>;
-#include <ParallaxJoystick.hpp>;
+#include <Shape.hpp>
+#include <ParallaxJoystick.hpp>
 
 #include <Adafruit_GFX.h>
 #include <Adafruit_SSD1306.h>
+#include "FastText.hpp"
+#include "GameLoop.hpp"
+#include "SpatialGrid.hpp"
+#include "ObjectPool.hpp"
 
 #define SCREEN_WIDTH 128 // OLED _display width, in pixels
 #define SCREEN_HEIGHT 64 // OLED _display height, in pixels
@@ -62,8 +77,16 @@ Ball _playerBall(20, 20, 3);
 // Set the number of target shapes.
 const int NUM_TARGET_SHAPES = 6;
 
-// Dynamic array of target shapes. We'll create and initialize this in setup()
-Shape **_targetShapes;
+// Array of target shapes. We'll create and initialize them in setup()
+Shape* _targetShapes[NUM_TARGET_SHAPES];
+
+// The RAM for the target shapes, which can be Balls or Rectangles
+const size_t TARGET_SHAPE_SIZE = sizeof(Ball) > sizeof(Rectangle) ? sizeof(Ball) : sizeof(Rectangle);
+ObjectPool<Shape, NUM_TARGET_SHAPES, TARGET_SHAPE_SIZE> _shapePool;
+
+// The target shapes by location, to find the ones near the player ball. A
+// shape's id in the grid is its index in _targetShapes
+SpatialGrid<Shape, NUM_TARGET_SHAPES> _grid(SCREEN_WIDTH, SCREEN_HEIGHT);
 
 // You cannot create the shapes array like this because polymorphism won't work!
 // Good reminder that C++ is not Java :)
@@ -77,16 +100,21 @@ Shape **_targetShapes;
 
 
 
-// for tracking fps
-float _fps = 0;
-unsigned long _frameCount = 0;
-unsigned long _fpsStartTimeStamp = 0;
+// 30 ms keeps the speed the player ball had when it moved once per frame (a
+// 5 ms delay plus ~25 ms for display())
+const int GAME_STEP_MS = 30;
+GameLoop _gameLoop(GAME_STEP_MS);
+
+// Print frame-time stats over Serial this often (0 for never)
+const unsigned long PRINT_FRAME_STATS_MS = 0;
 
 // status bar
 const boolean _drawStatusBar= true; // change to show/hide status bar
-const int DELAY_LOOP_MS = 5;
 const int LOAD_SCREEN_SHOW_MS = 500;
 
+// "XX.XX fps" in the top-right corner: the number is a 5-char field, right aligned
+TextField _fpsField(SCREEN_WIDTH - FastText::getTextWidth(9), 0, 5, TEXT_ALIGN_RIGHT);
+
 void setup() {
   Serial.begin(9600);
 
@@ -101,8 +129,7 @@ void setup() {
   
   // In order for polymorphism to work, we need to use pointers
   // See: https://stackoverflow.com/a/45176572
-  // So, we dynamically create our shapes here
-  _targetShapes = new Shape*[NUM_TARGET_SHAPES];
+  // So, we create our shapes here in _shapePool (rather than with new)
   for(int i = 0; i < NUM_TARGET_SHAPES; i++){
     
     // Create dimensions of shape
@@ -118,11 +145,13 @@ void setup() {
       // create slightly fewer balls than rects
       // balls want center pts rather than top left 
       int radius = max(2, randWidth / 2);
-      _targetShapes[i] = new Ball(randX + radius, randY + radius, radius);
+      _targetShapes[i] = _shapePool.acquire<Ball>(randX + radius, randY + radius, radius);
     }else{
-      _targetShapes[i] = new Rectangle(randX, randY, randWidth, randHeight);
+      _targetShapes[i] = _shapePool.acquire<Rectangle>(randX, randY, randWidth, randHeight);
     }
+    _grid.add(*_targetShapes[i]);
   }
+  _shapePool.printReport(Serial, F("Target shapes"));
 
   initializeOledAndShowLoadScreen();
 
@@ -130,19 +159,45 @@ void setup() {
   _playerBall.setDrawFill(true);
   _playerBall.setCenter(_display.width()/2, _display.height()/2);
 
-  _fpsStartTimeStamp = millis();
+  _gameLoop.begin();
 }
 
 void loop() {
-  
-  _display.clearDisplay();
+  while(_gameLoop.step()){
+    updatePlayer();
+  }
 
-  if(_drawStatusBar){
-    drawStatusBar();
+  if(_gameLoop.shouldDraw()){
+    _display.clearDisplay();
+
+    if(_drawStatusBar){
+      drawStatusBar();
+    }
+
+    // Draw the target shapes (filled if they overlap the player ball)
+    for (int i = 0; i < NUM_TARGET_SHAPES; i++) {
+      Shape *shape = _targetShapes[i];
+
+      //Serial.println("shape->getName(): " + shape->getName());
+      //Serial.println("shape->toString(): " + shape->toString());
+
+      shape->draw(_display);
+    }
+
+    // draw the player ball to the screen
+    _playerBall.draw(_display);
+
+    _display.display();
+    _gameLoop.endDraw();
   }
 
-  calcFrameRate();
+  _gameLoop.printStatsEvery(Serial, PRINT_FRAME_STATS_MS);
+}
 
+/**
+ * Reads the buttons and joystick and moves the player ball one step
+ */
+void updatePlayer(){
   // Check reset shapes button
   int resetShapesButtonVal = digitalRead(RESET_SHAPES_BUTTON_INPUT_PIN);
   if(resetShapesButtonVal == LOW){
@@ -166,34 +221,19 @@ void loop() {
   _playerBall.setLocation(_playerBall.getX() + xMovementPixels, _playerBall.getY() - yMovementPixels);
 
   // Don't let the ball outside of the screen area
-  _playerBall.forceInside(0, 0, _display.width(), _display.height()); 
+  _playerBall.forceInside(0, 0, _display.width(), _display.height());
 
-  // Cycle through all target shapes and check for collisions with player ball
-  // Then draw to screen
+  // Check for collisions with the player ball. The grid gives us the target
+  // shapes near the ball (their bounding boxes touch it), so we only call
+  // overlaps() on those. If the target shape overlaps with playerball, fill it
   for (int i = 0; i < NUM_TARGET_SHAPES; i++) {
-    Shape *shape = _targetShapes[i];
-    shape->draw(_display);
-    
-    //Serial.println("shape->getName(): " + shape->getName());
-    //Serial.println("shape->toString(): " + shape->toString());
-
-    // If the target shape overlaps with playerball, fill it
-    if(shape->overlaps(_playerBall)){
-      shape->setDrawFill(true);
-    }else{
-      shape->setDrawFill(false);
-    }
-    shape->draw(_display);
-  }
-
-  // draw the player ball to the screen
-  _playerBall.draw(_display);
-
-  _display.display();
-  
-  if(DELAY_LOOP_MS > 0){
-    delay(DELAY_LOOP_MS);
+    _targetShapes[i]->setDrawFill(false);
   }
+  _grid.forEachCandidate(_playerBall, [](Shape& shape){
+    if(shape.overlaps(_playerBall)){
+      shape.setDrawFill(true);
+    }
+  });
 }
 
 /**
@@ -209,35 +249,19 @@ void resetShapes(){
     int randY = random(0, _display.height() - randHeight / 2);
     _targetShapes[i]->setDimensions(randWidth, randHeight);
     _targetShapes[i]->setLocation(randX, randY);
+    _grid.update(i);
   }
   
 }
 
-/**
- * Call this every frame to calculate frame rate
- */
-void calcFrameRate() {
-  unsigned long elapsedTime = millis() - _fpsStartTimeStamp;
-  _frameCount++;
-  if (elapsedTime > 1000) {
-    _fps = _frameCount / (elapsedTime / 1000.0);
-    _fpsStartTimeStamp = millis();
-    _frameCount = 0;
-  }
-}
-
 /**
  * Draws the status bar at top of screen with fps
  */
 void drawStatusBar() {
 
-  // Draw frame count
-  int16_t x1, y1;
-  uint16_t w, h;
-  _display.getTextBounds("XX.XX fps", 0, 0, &x1, &y1, &w, &h);
-  _display.setCursor(_display.width() - w, 0);
-  _display.print(_fps);
-  _display.print(" fps");
+  // Draw frame count. The screen is cleared every frame, so draw (rather than update) the field
+  _fpsField.draw(_display, _gameLoop.getFps());
+  FastText::drawText(_display, _fpsField.getX() + _fpsField.getWidth(), 0, " fps");
 }
 
 /**
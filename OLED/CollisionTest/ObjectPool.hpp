@@ -0,0 +1,155 @@
+/**
+ * A fixed-size pool of objects (e.g., shapes) in a block of RAM that's set
+ * aside at compile time, for sketches that would otherwise create them with
+ * new and delete.
+ *
+ * An Uno has 2 KB of RAM and the SSD1306's framebuffer takes 1 KB of it. new
+ * puts objects on the heap, which the compiler doesn't count in "Global
+ * variables use X bytes", so a sketch can run out of RAM with no warning.
+ * Each new also costs 2 extra bytes, and deleting and re-creating objects of
+ * different sizes leaves holes in the heap that later objects may not fit in.
+ *
+ * ObjectPool keeps Capacity slots in a global array, so its RAM shows up in
+ * the compiler's count. acquire() constructs an object in a free slot and
+ * release() destroys it (calling its destructor, even if it's virtual) and
+ * frees the slot. Both are O(1): free slots are kept in a linked list of
+ * slot indexes. The pool also keeps a high-water mark (the most slots ever
+ * in use), so you can see how much of it a sketch really needs.
+ *
+ * A pool can also hold subclasses of T, e.g., Balls and Rectangles in an
+ * ObjectPool<Shape, ...>: make SlotSize the size of the largest one. Pass
+ * the subclass to acquire(), like acquire<Ball>(x, y, radius).
+ *
+ * Usage:
+ *  const size_t SHAPE_SIZE = sizeof(Ball) > sizeof(Rectangle) ? sizeof(Ball) : sizeof(Rectangle);
+ *  ObjectPool<Shape, 10, SHAPE_SIZE> _shapePool;  // up to 10 Balls or Rectangles
+ *
+ *  Shape* shape = _shapePool.acquire<Ball>(20, 20, 5); // NULL if the pool is full
+ *  ...
+ *  _shapePool.release(shape);
+ *
+ *  _shapePool.printReport(Serial, F("Shapes"));
+ *  // Shapes: 1 of 10 used (high water 4), 18 bytes each, 180 bytes
+ *
+ * By Jon E. Froehlich
+ * @jonfroehlich
+ * http://makeabilitylab.io
+ *
+ */
+#ifndef OBJECT_POOL_HPP
+#define OBJECT_POOL_HPP
+
+#include <Arduino.h>
+#if defined(__AVR__)
+#include <new.h>   // placement new
+#else
+#include <new>
+#endif
+
+template<typename T, uint8_t Capacity, size_t SlotSize = sizeof(T)>
+class ObjectPool{
+
+  static_assert(Capacity >= 1 && Capacity < 254, "Capacity must be from 1 to 253");
+  static_assert(SlotSize >= sizeof(T), "SlotSize must be at least sizeof(T)");
+
+  public:
+    // Each slot is rounded up so the next one is aligned for T
+    static const size_t SLOT_SIZE = (SlotSize + alignof(T) - 1) / alignof(T) * alignof(T);
+
+  private:
+    static const uint8_t NONE = 0xFF;  // the end of the free list
+    static const uint8_t USED = 0xFE;  // in _nextFree, for slots in use
+
+    alignas(T) uint8_t _slots[Capacity * SLOT_SIZE];
+    uint8_t _nextFree[Capacity];       // the next free slot after each free one (or USED)
+    uint8_t _firstFree;
+    uint8_t _count;
+    uint8_t _highWater;
+
+    // Returns the slot index of object, or NONE if it isn't in this pool
+    uint8_t getSlot(const T* object) const {
+      const uint8_t* address = reinterpret_cast<const uint8_t*>(object);
+      if (address < _slots || address >= _slots + sizeof(_slots) || (address - _slots) % SLOT_SIZE != 0) {
+        return NONE;
+      }
+      return (address - _slots) / SLOT_SIZE;
+    }
+
+  public:
+    ObjectPool() : _firstFree(0), _count(0), _highWater(0) {
+      for (uint8_t i = 0; i < Capacity; i++) {
+        _nextFree[i] = i + 1 < Capacity ? i + 1 : NONE;
+      }
+    }
+
+    /**
+     * Constructs a U (T or a subclass of it) in a free slot with args and
+     * returns it, or returns NULL if every slot is in use
+     */
+    template<typename U = T, typename... Args>
+    U* acquire(Args... args) {
+      static_assert(sizeof(U) <= SLOT_SIZE, "U doesn't fit in a slot; make SlotSize bigger");
+      static_assert(alignof(U) <= alignof(T), "U needs more alignment than T");
+      if (_firstFree == NONE) {
+        return NULL;
+      }
+      uint8_t slot = _firstFree;
+      _firstFree = _nextFree[slot];
+      _nextFree[slot] = USED;
+      _count++;
+      if (_count > _highWater) {
+        _highWater = _count;
+      }
+      return new (&_slots[slot * SLOT_SIZE]) U(args...);
+    }
+
+    /**
+     * Destroys object and frees its slot. Returns false (and does nothing) if
+     * object isn't in use in this pool, e.g., if it was already released
+     */
+    bool release(T* object) {
+      uint8_t slot = getSlot(object);
+      if (slot == NONE || _nextFree[slot] != USED) {
+        return false;
+      }
+      object->~T();
+      _nextFree[slot] = _firstFree;
+      _firstFree = slot;
+      _count--;
+      return true;
+    }
+
+    /**
+     * Returns true if object is in use in this pool
+     */
+    bool contains(const T* object) const {
+      uint8_t slot = getSlot(object);
+      return slot != NONE && _nextFree[slot] == USED;
+    }
+
+    uint8_t getCount() const { return _count; }
+    uint8_t getCapacity() const { return Capacity; }
+    uint8_t getHighWater() const { return _highWater; }
+    void resetHighWater() { _highWater = _count; }
+
+    /**
+     * Prints how much of the pool is in use, like:
+     *   Shapes: 6 of 6 used (high water 6), 18 bytes each, 108 bytes
+     */
+    void printReport(Print& out, const __FlashStringHelper* name) const {
+      out.print(name);
+      out.print(F(": "));
+      out.print(_count);
+      out.print(F(" of "));
+      out.print(Capacity);
+      out.print(F(" used (high water "));
+      out.print(_highWater);
+      out.print(F("), "));
+      out.print((unsigned long)SLOT_SIZE);
+      out.print(F(" bytes each, "));
+      out.print((unsigned long)sizeof(_slots));
+      out.println(F(" bytes"));
+    }
+};
+
+#endif
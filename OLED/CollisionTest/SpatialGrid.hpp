@@ -0,0 +1,268 @@
+/**
+ * A uniform grid over the screen for finding which shapes might collide
+ * (the "broad phase"), so we only call the slower, exact overlaps() (the
+ * "narrow phase") on shapes that are near each other.
+ *
+ * Checking every shape against every other takes n * (n - 1) / 2 overlaps()
+ * calls: 15 for 6 shapes but 8,128 for 128. The grid splits the screen into
+ * NumColumns x NumRows cells (8 x 4 cells of 16 x 16 pixels on a 128x64
+ * screen), and each shape is in every cell its bounding box covers (shapes
+ * off the screen go in the nearest cells). So, a query only looks at the
+ * cells its own box covers.
+ *
+ * Each cell keeps a bit per shape id (Capacity / 8 bytes, rounded up), so
+ * a query ORs the bits of its cells together and a shape in several of them
+ * is still only found once. That's NumColumns * NumRows * Capacity / 8
+ * bytes of RAM (32 bytes for 8 shapes, 256 for 64) plus 6 per shape on an
+ * AVR. update() only changes bits if the shape moved into different cells.
+ *
+ * What it saves depends on how it's used. On a desktop computer (see
+ * OLED/SpatialGridBenchmark), finding the shapes one moving shape touches
+ * among shapes that stay put (like CollisionTest's player and targets) was
+ * about twice as fast with the grid, even for 6 shapes: 0.3 overlaps()
+ * calls per query instead of 6. But when every shape moves and every pair
+ * is checked, updating the grid cost more than it saved up to about 32
+ * small (2 - 8 pixel) or 64 large (3 - 25 pixel) shapes.
+ *
+ * Shape.hpp is in the MakeabilityLab_Arduino_Library, so the grid doesn't
+ * move shapes itself or know when they move: call update() with a shape's
+ * id after you move or resize it (e.g., after setLocation()). It works with
+ * any ShapeType that has getLeft(), getTop(), getRight(), and getBottom().
+ *
+ * The candidates are the shapes whose bounding boxes overlap or touch,
+ * which includes every pair that Shape's overlaps() can find (and some it
+ * won't, like the corners of two balls' boxes). So, still call overlaps()
+ * on each candidate.
+ *
+ * Usage:
+ *  SpatialGrid<Shape, 64> _grid(SCREEN_WIDTH, SCREEN_HEIGHT); // up to 64 shapes
+ *
+ *  setup(){
+ *    _shapeId = _grid.add(_shape);
+ *  }
+ *
+ *  loop(){
+ *    _shape.setLocation(x, y);
+ *    _grid.update(_shapeId);
+ *
+ *    // Shapes near the player (the player doesn't have to be in the grid)
+ *    _grid.forEachCandidate(_player, [](Shape& shape){
+ *      if(shape.overlaps(_player)){ ... }
+ *    });
+ *
+ *    // Or every pair of shapes in the grid that might collide (each once)
+ *    _grid.forEachCandidatePair([](Shape& a, Shape& b){
+ *      if(a.overlaps(b)){ ... }
+ *    });
+ *  }
+ *
+ * By Jon E. Froehlich
+ * @jonfroehlich
+ * http://makeabilitylab.io
+ *
+ */
+#ifndef SPATIAL_GRID_HPP
+#define SPATIAL_GRID_HPP
+
+#include <Arduino.h>
+
+template<typename ShapeType, uint8_t Capacity, uint8_t NumColumns = 8, uint8_t NumRows = 4>
+class SpatialGrid{
+
+  static_assert(Capacity >= 1 && Capacity < 255, "Capacity must be from 1 to 254");
+  static_assert(NumColumns >= 1 && NumRows >= 1 && NumColumns * NumRows <= 255,
+                "The grid must have from 1 to 255 cells");
+
+  public:
+    static const uint8_t NONE = 0xFF;  // no shape
+
+  private:
+    static const uint8_t MASK_BYTES = (Capacity + 7) / 8;
+
+    ShapeType* _shapes[Capacity];      // by id; NULL if the id is free
+    uint8_t _firstColumns[Capacity];   // the cells each shape is in
+    uint8_t _lastColumns[Capacity];
+    uint8_t _firstRows[Capacity];
+    uint8_t _lastRows[Capacity];
+    uint8_t _cells[NumColumns * NumRows][MASK_BYTES];  // bit id is set if shape id is in the cell
+    uint8_t _count;
+
+    uint8_t _cellShift;                // cells are 2^_cellShift pixels square
+
+    uint8_t getColumn(int x) const {
+      int column = x >> _cellShift;
+      return column < 0 ? 0 : (column >= NumColumns ? NumColumns - 1 : column);
+    }
+
+    uint8_t getRow(int y) const {
+      int row = y >> _cellShift;
+      return row < 0 ? 0 : (row >= NumRows ? NumRows - 1 : row);
+    }
+
+    // Sets or clears the shape's bit in each of its cells
+    void mark(uint8_t id, bool isIn) {
+      uint8_t byte = id >> 3;
+      uint8_t bit = 1 << (id & 7);
+      for (uint8_t row = _firstRows[id]; row <= _lastRows[id]; row++) {
+        for (uint8_t column = _firstColumns[id]; column <= _lastColumns[id]; column++) {
+          uint8_t& cell = _cells[row * NumColumns + column][byte];
+          cell = isIn ? cell | bit : cell & ~bit;
+        }
+      }
+    }
+
+    // Puts the shape in the cells its box covers, if they changed
+    void place(uint8_t id, bool isNew) {
+      ShapeType& shape = *_shapes[id];
+      uint8_t firstColumn = getColumn(shape.getLeft());
+      uint8_t lastColumn = getColumn(shape.getRight());
+      uint8_t firstRow = getRow(shape.getTop());
+      uint8_t lastRow = getRow(shape.getBottom());
+      if (!isNew) {
+        if (firstColumn == _firstColumns[id] && lastColumn == _lastColumns[id] &&
+            firstRow == _firstRows[id] && lastRow == _lastRows[id]) {
+          return;
+        }
+        mark(id, false);
+      }
+      _firstColumns[id] = firstColumn;
+      _lastColumns[id] = lastColumn;
+      _firstRows[id] = firstRow;
+      _lastRows[id] = lastRow;
+      mark(id, true);
+    }
+
+    static bool boxesTouch(ShapeType& a, int left, int top, int right, int bottom) {
+      return a.getLeft() <= right && a.getRight() >= left && a.getTop() <= bottom && a.getBottom() >= top;
+    }
+
+    /**
+     * Calls callback(id) for each shape whose box overlaps or touches the
+     * given box, skipping ids up to minId (so pairs are found once)
+     */
+    template<typename Callback>
+    void forEachIdNear(int left, int top, int right, int bottom, int minId, Callback callback) const {
+      uint8_t near[MASK_BYTES];
+      memset(near, 0, sizeof(near));
+      uint8_t firstColumn = getColumn(left), lastColumn = getColumn(right);
+      for (uint8_t row = getRow(top); row <= getRow(bottom); row++) {
+        for (uint8_t column = firstColumn; column <= lastColumn; column++) {
+          const uint8_t* cell = _cells[row * NumColumns + column];
+          for (uint8_t i = 0; i < MASK_BYTES; i++) {
+            near[i] |= cell[i];
+          }
+        }
+      }
+
+      for (uint8_t i = (minId + 1) >> 3; i < MASK_BYTES; i++) {
+        uint8_t id = i << 3;
+        for (uint8_t bits = near[i]; bits != 0; bits >>= 1, id++) {
+          if ((bits & 1) && (int)id > minId && boxesTouch(*_shapes[id], left, top, right, bottom)) {
+            callback(id);
+          }
+        }
+      }
+    }
+
+  public:
+    /**
+     * Creates an empty grid covering a width x height screen. Each cell is the
+     * smallest power of 2 (in pixels) that covers it with NumColumns x NumRows cells
+     */
+    SpatialGrid(int width, int height) : _cellShift(0) {
+      while ((NumColumns << _cellShift) < width || (NumRows << _cellShift) < height) {
+        _cellShift++;
+      }
+      clear();
+    }
+
+    /**
+     * Removes all of the shapes
+     */
+    void clear() {
+      memset(_shapes, 0, sizeof(_shapes));
+      memset(_cells, 0, sizeof(_cells));
+      _count = 0;
+    }
+
+    /**
+     * Adds shape and returns its id (for update() and remove()), or NONE if
+     * the grid is full. The grid keeps a pointer, so shape must outlive it
+     */
+    uint8_t add(ShapeType& shape) {
+      for (uint8_t id = 0; id < Capacity; id++) {
+        if (_shapes[id] == NULL) {
+          _shapes[id] = &shape;
+          _count++;
+          place(id, true);
+          return id;
+        }
+      }
+      return NONE;
+    }
+
+    /**
+     * Removes the shape with this id. Its id can be given to the next shape added
+     */
+    void remove(uint8_t id) {
+      if (id >= Capacity || _shapes[id] == NULL) {
+        return;
+      }
+      mark(id, false);
+      _shapes[id] = NULL;
+      _count--;
+    }
+
+    /**
+     * Call this after moving or resizing the shape with this id. Only
+     * changes the cells if the shape moved into different ones
+     */
+    void update(uint8_t id) {
+      if (id >= Capacity || _shapes[id] == NULL) {
+        return;
+      }
+      place(id, false);
+    }
+
+    /**
+     * Calls update() for every shape, e.g., after moving them all
+     */
+    void updateAll() {
+      for (uint8_t id = 0; id < Capacity; id++) {
+        update(id);
+      }
+    }
+
+    uint8_t getCount() const { return _count; }
+    ShapeType* get(uint8_t id) const { return id < Capacity ? _shapes[id] : NULL; }
+    int getCellSize() const { return 1 << _cellShift; }
+
+    /**
+     * Calls callback(ShapeType&) for each shape in the grid whose bounding box
+     * overlaps or touches shape's. shape doesn't have to be in the grid; if
+     * it is, it's a candidate for itself (skip it with &candidate != &shape)
+     */
+    template<typename Callback>
+    void forEachCandidate(ShapeType& shape, Callback callback) const {
+      forEachIdNear(shape.getLeft(), shape.getTop(), shape.getRight(), shape.getBottom(), -1,
+                    [&](uint8_t id){ callback(*_shapes[id]); });
+    }
+
+    /**
+     * Calls callback(ShapeType& a, ShapeType& b) once for each pair of shapes
+     * in the grid whose bounding boxes overlap or touch
+     */
+    template<typename Callback>
+    void forEachCandidatePair(Callback callback) const {
+      for (uint8_t id = 0; id < Capacity; id++) {
+        if (_shapes[id] == NULL) {
+          continue;
+        }
+        ShapeType& shape = *_shapes[id];
+        forEachIdNear(shape.getLeft(), shape.getTop(), shape.getRight(), shape.getBottom(), id,
+                      [&](uint8_t otherId){ callback(shape, *_shapes[otherId]); });
+      }
+    }
+};
+
+#endif
@@ -0,0 +1,15 @@
+// 'child_dino_run', 20x21px, 2 frames, packed by OLED/SpritePacker/sprite_packer.py from:
+//   ChildDinoSheet.png
+//   (frames 2,4)
+// Don't edit by hand; change the PNGs and run the packer again. Draw it with
+// PackedAnimation from SpriteEngine.hpp. 56 bytes (120 bytes unpacked)
+//
+// Bytes read to unpack each frame (60 per frame unpacked):
+//   0: key frame              36
+//   1: delta from frame 0     45
+const unsigned char child_dino_run [] PROGMEM = {
+	0x14, 0x15, 0x02, 0x07, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x89, 0x00, 0xfc, 0xc2, 0xfe, 0xc2, 0xbe,
+	0x01, 0x3e, 0x1c, 0x81, 0x0b, 0x1f, 0x3c, 0x78, 0xf0, 0xf8, 0xfc, 0xfc, 0xfe, 0xff, 0xff, 0x7f,
+	0x1f, 0x80, 0x00, 0x04, 0x89, 0x02, 0x01, 0x0b, 0x01, 0x81, 0x00, 0x01, 0x88, 0x07, 0x00, 0xad,
+	0x01, 0x08, 0x01, 0x80, 0x01, 0x01, 0x0e, 0x88
+};
@@ -11,8 +11,17 @@
  * Sprite sheet from:
  * https://www.spriters-resource.com/browser_games/googledinosaurrungame/sheet/78171/
  *
- * Converted to byte arrays:
- * http://javl.github.io/image2cpp/
+ * Packed into ChildDinoRun.h by OLED/SpritePacker/sprite_packer.py (see
+ * DinoSpriteAnimationDemo2).
+ *
+ * The dino is drawn with SpriteEngine.hpp (in this folder), which unpacks the
+ * sprite as it copies it into the framebuffer a byte (8 rows) at a time
+ * rather than pixel by pixel.
+ *
+ * The game moves every GAME_STEP_MS using GameLoop.hpp (also in this folder)
+ * and draws the dino and obstacle between their last two positions every
+ * loop(), so jumps and obstacles move smoothly at the same speed whatever
+ * the frame rate.
  *
  * Based on DinoSpriteAnimationDemo by Jon E. Froehlich
  * @jonfroehlich
@@ -22,7 +31,9 @@
 #include <Wire.h>
 #include <Adafruit_GFX.h>
 #include <Adafruit_SSD1306.h>
-#include "Sprites.h"
+#include "SpriteEngine.hpp"
+#include "ChildDinoRun.h"
+#include "GameLoop.hpp"
 
 #define SCREEN_WIDTH 128
 #define SCREEN_HEIGHT 64
@@ -38,16 +49,19 @@ const int GROUND_Y = SCREEN_HEIGHT - 1; // y position of ground line
 
 // --- Dino sprites ---
 // Use the child dino (20x21px) — frames 3 & 5 have distinct leg poses
-const unsigned char* runSprites[2] = { epd_bitmap_child_dino3, epd_bitmap_child_dino5 };
+const PackedAnimation RUN_ANIMATION(child_dino_run);
 
-const int SPRITE_WIDTH = CHILD_SPRITE_WIDTH;   // 20
-const int SPRITE_HEIGHT = CHILD_SPRITE_HEIGHT;  // 21
+const int SPRITE_WIDTH = 20;
+const int SPRITE_HEIGHT = 21;
+
+Sprite _dino(RUN_ANIMATION);
 
 // --- Dino state ---
 const int DINO_X = 10;                       // Dino stays at fixed x position
 int _dinoY;                                  // current y (top-left of sprite)
+int _lastDinoY;                              // y before the last step
 float _velocityY = 0;                        // jump velocity (negative = up)
-const float GRAVITY = 1.2;                   // pixels/frame^2
+const float GRAVITY = 1.2;                   // pixels/step^2
 const float JUMP_VELOCITY = -8.0;            // initial jump impulse
 bool _isJumping = false;
 int _dinoGroundY;                            // y when standing on ground
@@ -57,7 +71,8 @@ int _runFrame = 0;                           // toggles 0/1 for leg animation
 const int OBSTACLE_WIDTH = 8;
 const int OBSTACLE_HEIGHT = 12;
 int _obstacleX;                              // current x position
-const int OBSTACLE_SPEED = 4;                // pixels per frame
+int _lastObstacleX;                          // x before the last step
+const int OBSTACLE_SPEED = 4;                // pixels per step
 int _obstacleY;                              // top-left y (sits on ground)
 
 // --- Game state ---
@@ -65,8 +80,9 @@ int _score = 0;
 bool _gameOver = false;
 
 // --- Timing ---
-unsigned long _lastFrameMs = 0;
-const int FRAME_DELAY_MS = 30;               // ~33 fps
+const int GAME_STEP_MS = 30;                 // ~33 updates per second
+GameLoop _gameLoop(GAME_STEP_MS, 4, true);
+const unsigned long PRINT_FRAME_STATS_MS = 0; // print frame-time stats this often (0 for never)
 
 // --- Animation timing ---
 unsigned long _lastAnimMs = 0;
@@ -86,18 +102,21 @@ void setup() {
   display.display();
 
   resetGame();
+  _gameLoop.begin();
 }
 
 void resetGame() {
   // Dino stands so its feet touch the ground line
   _dinoGroundY = GROUND_Y - SPRITE_HEIGHT;
   _dinoY = _dinoGroundY;
+  _lastDinoY = _dinoY;
   _velocityY = 0;
   _isJumping = false;
   _runFrame = 0;
 
   // Obstacle starts off-screen to the right
   _obstacleX = SCREEN_WIDTH;
+  _lastObstacleX = _obstacleX;
   _obstacleY = GROUND_Y - OBSTACLE_HEIGHT;
 
   _score = 0;
@@ -105,24 +124,42 @@ void resetGame() {
 }
 
 void loop() {
-  // Frame rate control
-  unsigned long now = millis();
-  if (now - _lastFrameMs < FRAME_DELAY_MS) {
-    return;
-  }
-  _lastFrameMs = now;
-
-  // Read button (active LOW with INPUT_PULLUP)
-  bool buttonPressed = (digitalRead(BUTTON_PIN) == LOW);
-
   if (_gameOver) {
-    // Wait for button press to restart
-    if (buttonPressed) {
+    // Wait for button press to restart (active LOW with INPUT_PULLUP)
+    if (digitalRead(BUTTON_PIN) == LOW) {
       resetGame();
+      _gameLoop.begin(); // don't count the time we waited
     }
     return; // Don't redraw while waiting
   }
 
+  while (_gameLoop.step()) {
+    updateGame();
+  }
+
+  if (_gameOver) {
+    drawGameOver();
+  } else if (_gameLoop.shouldDraw()) {
+    drawGame();
+    _gameLoop.endDraw();
+  }
+
+  _gameLoop.printStatsEvery(Serial, PRINT_FRAME_STATS_MS);
+}
+
+/**
+ * Jumps, moves, and animates the dino and obstacle one step and checks for a collision
+ */
+void updateGame() {
+  if (_gameOver) {
+    return; // Use up the rest of this loop()'s steps
+  }
+  _lastDinoY = _dinoY;
+  _lastObstacleX = _obstacleX;
+
+  // Read button (active LOW with INPUT_PULLUP)
+  bool buttonPressed = (digitalRead(BUTTON_PIN) == LOW);
+
   // Jump dino, jump!
   if (buttonPressed && !_isJumping) {
     _velocityY = JUMP_VELOCITY;
@@ -143,8 +180,10 @@ void loop() {
   // Move obstacle
   _obstacleX -= OBSTACLE_SPEED;
   if (_obstacleX + OBSTACLE_WIDTH < 0) {
-    // Obstacle passed off-screen: score a point, reset it
+    // Obstacle passed off-screen: score a point, reset it (rather than
+    // drawing it sliding back across the screen)
     _obstacleX = SCREEN_WIDTH;
+    _lastObstacleX = _obstacleX;
     _score++;
   }
 
@@ -162,17 +201,24 @@ void loop() {
 
   if (collided) {
     _gameOver = true;
-    drawGameOver();
     return;
   }
 
   // Animate legs (only when running on ground)
+  unsigned long now = millis();
   if (!_isJumping && now - _lastAnimMs >= ANIM_DELAY_MS) {
     _runFrame = 1 - _runFrame; // toggle 0 <-> 1
     _lastAnimMs = now;
   }
+}
 
-  // --- Draw ---
+/**
+ * Draws the dino and obstacle between their last two positions
+ */
+void drawGame() {
+  float alpha = _gameLoop.getAlpha();
+  int dinoY = _lastDinoY + round((_dinoY - _lastDinoY) * alpha);
+  int obstacleX = _lastObstacleX + round((_obstacleX - _lastObstacleX) * alpha);
 
   // Clear the display to prepare next frame
   display.clearDisplay();
@@ -181,11 +227,12 @@ void loop() {
   display.drawLine(0, GROUND_Y, SCREEN_WIDTH - 1, GROUND_Y, WHITE);
 
   // Dino sprite (use frame 0 when jumping for a static pose)
-  int frame = _isJumping ? 0 : _runFrame;
-  display.drawBitmap(DINO_X, _dinoY, runSprites[frame], SPRITE_WIDTH, SPRITE_HEIGHT, WHITE);
+  _dino.setFrame(_isJumping ? 0 : _runFrame);
+  _dino.setLocation(DINO_X, dinoY);
+  _dino.draw(display);
 
   // Draw obstacle
-  display.fillRect(_obstacleX, _obstacleY, OBSTACLE_WIDTH, OBSTACLE_HEIGHT, WHITE);
+  display.fillRect(obstacleX, _obstacleY, OBSTACLE_WIDTH, OBSTACLE_HEIGHT, WHITE);
 
   // Draw score
   display.setTextSize(1);
@@ -203,7 +250,9 @@ void drawGameOver() {
   display.drawLine(0, GROUND_Y, SCREEN_WIDTH - 1, GROUND_Y, WHITE);
 
   // Dino at current position
-  display.drawBitmap(DINO_X, _dinoY, runSprites[0], SPRITE_WIDTH, SPRITE_HEIGHT, WHITE);
+  _dino.setFrame(0);
+  _dino.setLocation(DINO_X, _dinoY);
+  _dino.draw(display);
 
   // Obstacle at current position
   display.fillRect(_obstacleX, _obstacleY, OBSTACLE_WIDTH, OBSTACLE_HEIGHT, WHITE);
@@ -5,8 +5,15 @@
  * Sprite sheet from:
  * https://www.spriters-resource.com/browser_games/googledinosaurrungame/sheet/78171/
  *
- * Converted to byte arrays:
- * http://javl.github.io/image2cpp/
+ * Packed into MotherDino.h and ChildDino.h by OLED/SpritePacker/sprite_packer.py
+ * (from the PNGs in DinoSpriteAnimationDemo), which stores each repeated frame
+ * once and most frames as just how they differ from the first. The 10 frames
+ * take 235 bytes of flash rather than 1620.
+ * 
+ * The dinos are Sprites from SpriteEngine.hpp (in this folder), which unpacks
+ * each frame as it copies it into the framebuffer a byte (8 rows) at a time
+ * rather than pixel by pixel. A SpriteList draws them in order (the child in
+ * front) and steps their animation frames.
  * 
  * By Jon E. Froehlich
  * @jonfroehlich
@@ -18,7 +25,9 @@
 #include <Wire.h>
 #include <Adafruit_GFX.h>
 #include <Adafruit_SSD1306.h>
-#include "Sprites.h"
+#include "SpriteEngine.hpp"
+#include "MotherDino.h"
+#include "ChildDino.h"
 
 #define SCREEN_WIDTH 128 // OLED display width, in pixels
 #define SCREEN_HEIGHT 64 // OLED display height, in pixels
@@ -28,16 +37,24 @@
 Adafruit_SSD1306 _display(SCREEN_WIDTH, SCREEN_HEIGHT, &Wire, OLED_RESET);
 
 
-int _motherDinoSpriteIndex = 0;
+const PackedAnimation MOTHER_DINO(mother_dino);
+const int MOTHER_SPRITE_WIDTH = 44;
+const int MOTHER_SPRITE_HEIGHT = 47;
+Sprite _motherDino(MOTHER_DINO);
 int _xMotherSprite = 0; 
 int _yMotherSprite = 0; 
 int _xMotherSpeed = 2; // in pixels per frame
 
-int _childDinoSpriteIndex = 0;
+const PackedAnimation CHILD_DINO(child_dino);
+const int CHILD_SPRITE_WIDTH = 20;
+const int CHILD_SPRITE_HEIGHT = 21;
+Sprite _childDino(CHILD_DINO);
 int _xChildSprite = 0; 
 int _yChildSprite = 0;
 int _xChildSpeed = 1; // in pixels per frame
 
+SpriteList<2> _sprites; // drawn in the order they're added
+
 void setup() {
   Serial.begin(9600);
 
@@ -55,21 +72,22 @@ void setup() {
 
   _xChildSprite = _xMotherSprite + MOTHER_SPRITE_WIDTH + 15;
   _yChildSprite = _yMotherSprite + MOTHER_SPRITE_HEIGHT - CHILD_SPRITE_HEIGHT;
-  
+
+  _sprites.add(_motherDino);
+  _sprites.add(_childDino);
 }
 
 void loop() {
   _display.clearDisplay();
 
-  // Draw mother sprite
-  _display.drawBitmap(_xMotherSprite, _yMotherSprite,  epd_bitmap_mother_dino_array[_motherDinoSpriteIndex], 
-                      MOTHER_SPRITE_WIDTH, MOTHER_SPRITE_HEIGHT, WHITE);  
-  
-  // Setup next animation index
-  _motherDinoSpriteIndex++;
-  if(_motherDinoSpriteIndex >= NUM_MOTHER_DINO_SPRITES){
-    _motherDinoSpriteIndex = 0;
-  }
+  // Draw both sprites
+  _motherDino.setLocation(_xMotherSprite, _yMotherSprite);
+  _childDino.setLocation(_xChildSprite, _yChildSprite);
+  _sprites.draw(_display);
+
+  // Setup next animation frames
+  _motherDino.nextFrame();
+  _childDino.nextFrame();
   
   // Setup movement 
   _xMotherSprite += _xMotherSpeed;
@@ -77,16 +95,6 @@ void loop() {
     _xMotherSprite = -MOTHER_SPRITE_WIDTH;
   }
 
-  // Draw child sprite
-  _display.drawBitmap(_xChildSprite, _yChildSprite,  epd_bitmap_child_dino_array[_childDinoSpriteIndex], 
-                      CHILD_SPRITE_WIDTH, CHILD_SPRITE_HEIGHT, WHITE);  
-  
-  // Setup next animation frame
-  _childDinoSpriteIndex++;
-  if(_childDinoSpriteIndex >= NUM_CHILD_DINO_SPRITES){
-    _childDinoSpriteIndex = 0;
-  }
-
   // Setup child movement
   // Setup movement 
   _xChildSprite += _xChildSpeed;
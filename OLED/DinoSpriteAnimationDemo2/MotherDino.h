@@ -0,0 +1,28 @@
+// 'mother_dino', 44x47px, 5 frames, packed by OLED/SpritePacker/sprite_packer.py from:
+//   Dino1.png
+//   Dino2.png
+//   Dino3.png
+//   Dino4.png
+//   Dino5.png
+// Don't edit by hand; change the PNGs and run the packer again. Draw it with
+// PackedAnimation from SpriteEngine.hpp. 169 bytes (1320 bytes unpacked)
+//
+// Bytes read to unpack each frame (264 per frame unpacked):
+//   0: key frame             103
+//   1: delta from frame 0    111
+//   2: delta from frame 0    121
+//   3: same as frame 2       121
+//   4: delta from frame 0    122
+const unsigned char mother_dino [] PROGMEM = {
+	0x2c, 0x2f, 0x05, 0x0d, 0x00, 0x76, 0x00, 0x80, 0x00, 0x80, 0x00, 0x94, 0x00, 0x00, 0x00, 0x95,
+	0x05, 0xf0, 0xf0, 0xfc, 0xfc, 0x9c, 0x9c, 0xcb, 0xfc, 0x01, 0xf0, 0xf0, 0x97, 0xc9, 0xff, 0xc5,
+	0x9f, 0xc3, 0x1f, 0x83, 0x05, 0xfe, 0xfe, 0xe0, 0xe0, 0x80, 0x80, 0x83, 0x01, 0x80, 0x80, 0xc2,
+	0xe0, 0xc2, 0xf8, 0x01, 0xfe, 0xfe, 0xc7, 0xff, 0x03, 0x61, 0x61, 0xe1, 0xe1, 0xc3, 0x01, 0x87,
+	0x05, 0x1f, 0x1f, 0x7f, 0x7f, 0xff, 0xff, 0xc3, 0xfe, 0xcf, 0xff, 0x01, 0x3f, 0x3f, 0x81, 0x01,
+	0x01, 0x01, 0x8f, 0x05, 0x01, 0x01, 0x07, 0x07, 0x1f, 0x1f, 0xc3, 0xff, 0x0b, 0x7f, 0x7f, 0x1f,
+	0x1f, 0x7f, 0x7f, 0xff, 0xff, 0x07, 0x07, 0x01, 0x01, 0x9b, 0x03, 0x1f, 0x1f, 0x19, 0x19, 0x85,
+	0x03, 0x1f, 0x1f, 0x18, 0x18, 0x91, 0x0d, 0x00, 0x99, 0x01, 0x60, 0x60, 0xbf, 0xbf, 0xbf, 0xab,
+	0x0d, 0x00, 0xbf, 0xbf, 0xbf, 0x83, 0x03, 0x60, 0x60, 0x80, 0x80, 0xc2, 0x60, 0xa6, 0x03, 0x1f,
+	0x1f, 0x18, 0x18, 0x91, 0x0d, 0x00, 0xbf, 0xbf, 0xbb, 0x01, 0x80, 0x80, 0x81, 0x01, 0xe0, 0xe0,
+	0xa5, 0x05, 0x1f, 0x1f, 0x18, 0x18, 0x01, 0x01, 0x99
+};
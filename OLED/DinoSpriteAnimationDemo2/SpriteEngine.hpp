@@ -0,0 +1,548 @@
+/**
+ * Fast sprites for the SSD1306 OLED: bitmaps copied into the framebuffer a
+ * byte (8 pixels) at a time, plus animated sprites and a list that draws
+ * them in order.
+ *
+ * drawBitmap() walks a bitmap one pixel at a time and calls drawPixel() for
+ * each pixel that's on (740 calls for one frame of the 44x47 dino). But the
+ * SSD1306 framebuffer stores each column of a page (8 rows) as one byte. So,
+ * SpriteEngine stores bitmaps the same way ("vertical" bitmaps: for each page
+ * of 8 rows, one byte per column with the top row in the lowest bit, which
+ * image2cpp calls "Vertical - 1 bit per pixel") and ORs whole bytes into the
+ * framebuffer, 6 pages x 44 columns = 264 bytes for that dino.
+ *
+ * When a sprite's y isn't a multiple of 8, each byte straddles two pages. We
+ * could keep 8 pre-shifted copies of every bitmap, but that's 8x the memory
+ * (over 10 KB for the mother dino's 5 frames). Instead, we shift each byte as
+ * we go by multiplying it by 2^shift: the 16-bit result's low byte goes in
+ * the upper page and its high byte in the lower one. AVRs have no barrel
+ * shifter (a shift by n takes n instructions) but do have a 2-cycle 8x8-bit
+ * multiply, so this costs the same for every shift.
+ *
+ * Animations can also be packed by OLED/SpritePacker/sprite_packer.py, which
+ * stores repeated frames once, run-length encodes each frame, and stores a
+ * frame that's close to an earlier one as the XOR of the two. The mother dino's
+ * 5 frames take 169 bytes instead of 1320. There's no need to unpack a frame
+ * into RAM first: PackedFrameReader decodes it a byte at a time as it's
+ * drawn, reading at most two streams (see the packer for the format).
+ *
+ * There are four parts:
+ *  - SpriteBlitter::draw() draws one bitmap (like drawBitmap())
+ *  - PackedAnimation draws the frames of a packed asset
+ *  - Sprite is a bitmap (or animation frames) with a location
+ *  - SpriteList keeps sprites in drawing order (back to front) and draws
+ *    and animates them all
+ *
+ * Notes:
+ *  - Bitmaps must be in PROGMEM in the vertical layout above. A bitmap
+ *    takes width * ceil(height / 8) bytes. A packed frame is drawn like a
+ *    bitmap, but reads up to about 2 bytes (and decodes them) for every
+ *    byte of bitmap; the packer lists how many for each frame
+ *  - SPRITE_OR draws like drawBitmap(..., WHITE): pixels that are on are
+ *    set and the rest are left alone. SPRITE_OPAQUE also clears the pixels
+ *    that are off, so the sprite hides what's behind it
+ *  - This changes the framebuffer directly, so it expects the display's
+ *    rotation to be 0. If you use it with PartialFlushSSD1306, call
+ *    markDirty() for the sprite's area after drawing
+ *
+ * Usage:
+ *  #include "SpriteEngine.hpp"
+ *
+ *  #include "ChildDino.h"                   // made by sprite_packer.py
+ *
+ *  Sprite _dino(PackedAnimation(child_dino), 100); // 100 ms per frame
+ *  SpriteList<4> _sprites;
+ *
+ *  setup(){
+ *    _sprites.add(_dino);                    // added later = drawn on top
+ *  }
+ *
+ *  loop(){
+ *    _dino.setLocation(x, y);
+ *    _sprites.animate(millis());             // go to the next frame when it's time
+ *    _display.clearDisplay();
+ *    _sprites.draw(_display);
+ *    _display.display();
+ *  }
+ *
+ * By Jon E. Froehlich
+ * @jonfroehlich
+ * http://makeabilitylab.io
+ *
+ */
+#ifndef SPRITE_ENGINE_HPP
+#define SPRITE_ENGINE_HPP
+
+#include <Arduino.h>
+#include <Adafruit_GFX.h>
+#include <Adafruit_SSD1306.h>
+
+enum SpriteDrawMode{
+  SPRITE_OR,      // turn on the sprite's pixels, leave the rest alone
+  SPRITE_OPAQUE   // the sprite's rectangle replaces what's behind it
+};
+
+// Reads a vertical bitmap (in PROGMEM) a byte at a time, in order
+class BitmapReader{
+
+  private:
+    const uint8_t* _next;
+
+  public:
+    BitmapReader(const uint8_t* bitmap) : _next(bitmap) {
+    }
+
+    uint8_t next() {
+      return pgm_read_byte(_next++);
+    }
+
+    void skip(uint8_t numBytes) {
+      _next += numBytes;
+    }
+};
+
+// Reads a run-length encoded stream (in PROGMEM) a byte at a time
+class RleReader{
+
+  private:
+    const uint8_t* _next;
+    uint8_t _runLength;   // the bytes left in the current run
+    uint8_t _value;       // the byte a zero or repeat run repeats
+    bool _isLiteralRun;   // true if the run's bytes are stored as is
+
+  public:
+    RleReader(const uint8_t* encoded)
+      : _next(encoded), _runLength(0), _value(0), _isLiteralRun(false) {
+    }
+
+    uint8_t next() {
+      if (_runLength == 0) {
+        uint8_t count = pgm_read_byte(_next++);
+        _isLiteralRun = count < 0x80;
+        if (_isLiteralRun) {
+          _runLength = count + 1;
+        } else {
+          _runLength = (count & 0x3F) + 1;
+          _value = count < 0xC0 ? 0 : pgm_read_byte(_next++);
+        }
+      }
+      _runLength--;
+      return _isLiteralRun ? pgm_read_byte(_next++) : _value;
+    }
+};
+
+// Reads one frame of a packed asset a byte at a time: its RLE bytes, XORed
+// with its key frame's if it's a delta
+class PackedFrameReader{
+
+  private:
+    RleReader _frame;
+    RleReader _keyFrame;
+    bool _isDelta;
+
+    static uint16_t readOffset(const uint8_t* address) {
+      uint8_t low = pgm_read_byte(address);
+      return low | (uint16_t)pgm_read_byte(address + 1) << 8;
+    }
+
+  public:
+    PackedFrameReader(const uint8_t* asset, uint8_t frameIndex)
+      : _frame(NULL), _keyFrame(NULL), _isDelta(false) {
+      // Each frame starts with its key frame's offset (0 if it is one), then its runs
+      const uint8_t* frame = asset + readOffset(asset + 3 + 2 * frameIndex);
+      uint16_t keyFrameOffset = readOffset(frame);
+      _frame = RleReader(frame + 2);
+      _isDelta = keyFrameOffset != 0;
+      if (_isDelta) {
+        _keyFrame = RleReader(asset + keyFrameOffset + 2);
+      }
+    }
+
+    uint8_t next() {
+      uint8_t value = _frame.next();
+      return _isDelta ? value ^ _keyFrame.next() : value;
+    }
+
+    void skip(uint8_t numBytes) {
+      for (; numBytes > 0; numBytes--) {
+        next();
+      }
+    }
+};
+
+class SpriteBlitter{
+
+  public:
+    /**
+     * Returns the number of bytes in a vertical bitmap of width x height pixels
+     */
+    static uint16_t getNumBytes(uint8_t width, uint8_t height) {
+      return (uint16_t)width * ((height + 7) / 8);
+    }
+
+    /**
+     * Draws a vertical bitmap (in PROGMEM) with its top-left corner at (x, y),
+     * clipped to the screen
+     */
+    static void draw(Adafruit_SSD1306& display, int16_t x, int16_t y, const uint8_t* bitmap,
+                     uint8_t width, uint8_t height, SpriteDrawMode mode = SPRITE_OR) {
+      BitmapReader reader(bitmap);
+      drawFrom(display, x, y, reader, width, height, mode);
+    }
+
+    /**
+     * Draws a width x height vertical bitmap with its top-left corner at (x, y),
+     * clipped to the screen, taking its bytes in order from reader (which has
+     * next() and skip(numBytes), like BitmapReader and PackedFrameReader)
+     */
+    template<typename Reader>
+    static void drawFrom(Adafruit_SSD1306& display, int16_t x, int16_t y, Reader& reader,
+                         uint8_t width, uint8_t height, SpriteDrawMode mode = SPRITE_OR) {
+      int16_t displayWidth = display.width();
+      int16_t numDisplayPages = display.height() / 8;
+      if (x >= displayWidth || y >= display.height() || x + width <= 0 || y + height <= 0) {
+        return;
+      }
+
+      // The columns on screen
+      uint8_t firstColumn = x < 0 ? -x : 0;
+      uint8_t endColumn = x + width > displayWidth ? displayWidth - x : width;
+
+      // The page the sprite's top row lands in (which may be above the screen)
+      // and how far down in that page
+      int16_t firstPage = y >= 0 ? y / 8 : (y - 7) / 8;
+      uint8_t multiplier = 1 << (y - firstPage * 8);
+
+      uint8_t numPages = (height + 7) / 8;
+      uint8_t* buffer = display.getBuffer();
+      for (uint8_t page = 0; page < numPages; page++) {
+        // The rest of the sprite is below the screen
+        int16_t upperPage = firstPage + page;
+        if (upperPage >= numDisplayPages) {
+          return;
+        }
+
+        // The bottom page may have rows past the bitmap's height
+        uint8_t rowMask = page < numPages - 1 ? 0xFF : 0xFF >> (numPages * 8 - height);
+        uint16_t shiftedMask = rowMask * multiplier;
+
+        // Each byte's low half goes in upperPage and its high half in the one below
+        uint8_t* upper = upperPage >= 0 ? buffer + upperPage * displayWidth : NULL;
+        uint8_t* lower = (shiftedMask >> 8) != 0 && upperPage + 1 >= 0 && upperPage + 1 < numDisplayPages
+                         ? buffer + (upperPage + 1) * displayWidth : NULL;
+
+        // The reader gives every byte in order, so skip the ones off the screen
+        reader.skip(firstColumn);
+        if (upper == NULL && lower == NULL) {
+          reader.skip(endColumn - firstColumn);
+        } else if (mode == SPRITE_OR) {
+          for (uint8_t column = firstColumn; column < endColumn; column++) {
+            uint16_t shifted = (uint8_t)(reader.next() & rowMask) * multiplier;
+            if (upper != NULL) {
+              upper[x + column] |= (uint8_t)shifted;
+            }
+            if (lower != NULL) {
+              lower[x + column] |= (uint8_t)(shifted >> 8);
+            }
+          }
+        } else {
+          uint8_t keepUpper = ~(uint8_t)shiftedMask;
+          uint8_t keepLower = ~(uint8_t)(shiftedMask >> 8);
+          for (uint8_t column = firstColumn; column < endColumn; column++) {
+            uint16_t shifted = (uint8_t)(reader.next() & rowMask) * multiplier;
+            if (upper != NULL) {
+              upper[x + column] = (upper[x + column] & keepUpper) | (uint8_t)shifted;
+            }
+            if (lower != NULL) {
+              lower[x + column] = (lower[x + column] & keepLower) | (uint8_t)(shifted >> 8);
+            }
+          }
+        }
+        reader.skip(width - endColumn);
+      }
+    }
+};
+
+class PackedAnimation{
+
+  private:
+    const uint8_t* _asset;
+
+  public:
+    /**
+     * Wraps an asset (in PROGMEM) made by sprite_packer.py
+     */
+    explicit PackedAnimation(const uint8_t* asset) : _asset(asset) {
+    }
+
+    const uint8_t* getAsset() const {
+      return _asset;
+    }
+
+    uint8_t getWidth() const {
+      return pgm_read_byte(_asset);
+    }
+
+    uint8_t getHeight() const {
+      return pgm_read_byte(_asset + 1);
+    }
+
+    uint8_t getNumFrames() const {
+      return pgm_read_byte(_asset + 2);
+    }
+
+    /**
+     * Draws frame frameIndex with its top-left corner at (x, y), clipped to the screen
+     */
+    void draw(Adafruit_SSD1306& display, int16_t x, int16_t y, uint8_t frameIndex,
+              SpriteDrawMode mode = SPRITE_OR) const {
+      PackedFrameReader reader(_asset, frameIndex);
+      SpriteBlitter::drawFrom(display, x, y, reader, getWidth(), getHeight(), mode);
+    }
+};
+
+class Sprite{
+
+  private:
+    // A list of frames (each a vertical bitmap in PROGMEM), one bitmap, or a packed asset
+    const uint8_t* const* _frames;
+    const uint8_t* _bitmap;
+    const uint8_t* _packedAsset;
+    uint8_t _numFrames;
+    uint8_t _frameIndex;
+
+    const uint8_t _width;
+    const uint8_t _height;
+    int16_t _x;
+    int16_t _y;
+    bool _isVisible;
+    SpriteDrawMode _drawMode;
+
+    // For animate()
+    uint16_t _frameIntervalMs;
+    unsigned long _lastFrameChangeMs;
+
+  public:
+    /**
+     * Creates an animated sprite from numFrames bitmaps of width x height.
+     * If frameIntervalMs is more than 0, animate() shows each frame for that long
+     */
+    Sprite(const uint8_t* const* frames, uint8_t numFrames, uint8_t width, uint8_t height,
+           uint16_t frameIntervalMs = 0)
+      : _frames(frames), _bitmap(NULL), _packedAsset(NULL), _numFrames(numFrames > 0 ? numFrames : 1),
+        _frameIndex(0), _width(width), _height(height), _x(0), _y(0), _isVisible(true), _drawMode(SPRITE_OR),
+        _frameIntervalMs(frameIntervalMs), _lastFrameChangeMs(0) {
+    }
+
+    /**
+     * Creates a sprite with a single bitmap of width x height
+     */
+    Sprite(const uint8_t* bitmap, uint8_t width, uint8_t height)
+      : _frames(NULL), _bitmap(bitmap), _packedAsset(NULL), _numFrames(1), _frameIndex(0),
+        _width(width), _height(height), _x(0), _y(0), _isVisible(true), _drawMode(SPRITE_OR),
+        _frameIntervalMs(0), _lastFrameChangeMs(0) {
+    }
+
+    /**
+     * Creates an animated sprite from a packed asset's frames. If frameIntervalMs
+     * is more than 0, animate() shows each frame for that long
+     */
+    Sprite(const PackedAnimation& animation, uint16_t frameIntervalMs = 0)
+      : _frames(NULL), _bitmap(NULL), _packedAsset(animation.getAsset()),
+        _numFrames(animation.getNumFrames() > 0 ? animation.getNumFrames() : 1), _frameIndex(0),
+        _width(animation.getWidth()), _height(animation.getHeight()), _x(0), _y(0), _isVisible(true),
+        _drawMode(SPRITE_OR), _frameIntervalMs(frameIntervalMs), _lastFrameChangeMs(0) {
+    }
+
+    void setLocation(int16_t x, int16_t y) {
+      _x = x;
+      _y = y;
+    }
+
+    int16_t getX() const {
+      return _x;
+    }
+
+    int16_t getY() const {
+      return _y;
+    }
+
+    uint8_t getWidth() const {
+      return _width;
+    }
+
+    uint8_t getHeight() const {
+      return _height;
+    }
+
+    /**
+     * Shows frame frameIndex (wrapped to the number of frames)
+     */
+    void setFrame(uint8_t frameIndex) {
+      _frameIndex = frameIndex % _numFrames;
+    }
+
+    uint8_t getFrame() const {
+      return _frameIndex;
+    }
+
+    uint8_t getNumFrames() const {
+      return _numFrames;
+    }
+
+    /**
+     * Goes to the next frame, back to the first after the last
+     */
+    void nextFrame() {
+      _frameIndex = _frameIndex + 1 >= _numFrames ? 0 : _frameIndex + 1;
+    }
+
+    /**
+     * Goes to the next frame if the current one has been shown for the frame
+     * interval (pass millis()). Returns true if the frame changed
+     */
+    bool animate(unsigned long currentTimeMs) {
+      if (_frameIntervalMs == 0 || currentTimeMs - _lastFrameChangeMs < _frameIntervalMs) {
+        return false;
+      }
+      _lastFrameChangeMs = currentTimeMs;
+      nextFrame();
+      return true;
+    }
+
+    void setVisible(bool isVisible) {
+      _isVisible = isVisible;
+    }
+
+    bool isVisible() const {
+      return _isVisible;
+    }
+
+    void setDrawMode(SpriteDrawMode drawMode) {
+      _drawMode = drawMode;
+    }
+
+    /**
+     * Returns the current frame's bitmap (or NULL for a packed asset)
+     */
+    const uint8_t* getBitmap() const {
+      return _frames != NULL ? _frames[_frameIndex] : _bitmap;
+    }
+
+    /**
+     * Draws the current frame (if the sprite is visible)
+     */
+    void draw(Adafruit_SSD1306& display) const {
+      if (!_isVisible) {
+        return;
+      }
+      if (_packedAsset != NULL) {
+        PackedAnimation(_packedAsset).draw(display, _x, _y, _frameIndex, _drawMode);
+      } else {
+        SpriteBlitter::draw(display, _x, _y, getBitmap(), _width, _height, _drawMode);
+      }
+    }
+};
+
+template<uint8_t Capacity>
+class SpriteList{
+
+  static_assert(Capacity >= 1, "Capacity must be at least 1");
+
+  private:
+    Sprite* _sprites[Capacity];  // in drawing order, back to front
+    uint8_t _count;
+
+    int indexOf(const Sprite& sprite) const {
+      for (uint8_t i = 0; i < _count; i++) {
+        if (_sprites[i] == &sprite) {
+          return i;
+        }
+      }
+      return -1;
+    }
+
+  public:
+    SpriteList() : _count(0) {
+    }
+
+    /**
+     * Adds sprite in front of the others. Returns false if the list is full
+     * (or already has it). The list keeps a pointer, so sprite must outlive it
+     */
+    bool add(Sprite& sprite) {
+      if (_count >= Capacity || indexOf(sprite) >= 0) {
+        return false;
+      }
+      _sprites[_count++] = &sprite;
+      return true;
+    }
+
+    /**
+     * Removes sprite, keeping the others in order. Returns false if it wasn't in the list
+     */
+    bool remove(const Sprite& sprite) {
+      int index = indexOf(sprite);
+      if (index < 0) {
+        return false;
+      }
+      for (uint8_t i = index; i + 1 < _count; i++) {
+        _sprites[i] = _sprites[i + 1];
+      }
+      _count--;
+      return true;
+    }
+
+    /**
+     * Moves sprite in front of all of the others
+     */
+    void bringToFront(Sprite& sprite) {
+      if (remove(sprite)) {
+        add(sprite);
+      }
+    }
+
+    /**
+     * Moves sprite behind all of the others
+     */
+    void sendToBack(Sprite& sprite) {
+      int index = indexOf(sprite);
+      for (; index > 0; index--) {
+        _sprites[index] = _sprites[index - 1];
+      }
+      if (index == 0) {
+        _sprites[0] = &sprite;
+      }
+    }
+
+    uint8_t getCount() const {
+      return _count;
+    }
+
+    /**
+     * Returns the sprite at index in drawing order (0 is the back)
+     */
+    Sprite& get(uint8_t index) const {
+      return *_sprites[index];
+    }
+
+    /**
+     * Calls animate() on every sprite (pass millis())
+     */
+    void animate(unsigned long currentTimeMs) {
+      for (uint8_t i = 0; i < _count; i++) {
+        _sprites[i]->animate(currentTimeMs);
+      }
+    }
+
+    /**
+     * Draws the visible sprites, back to front
+     */
+    void draw(Adafruit_SSD1306& display) const {
+      for (uint8_t i = 0; i < _count; i++) {
+        _sprites[i]->draw(display);
+      }
+    }
+};
+
+#endif
@@ -1,168 +0,0 @@
-// 'Dino1', 44x47px
-const unsigned char epd_bitmap_mother_dino1 [] PROGMEM = {
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 
-	0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xc0, 0x00, 0x00, 
-	0x03, 0xcf, 0xff, 0xc0, 0x00, 0x00, 0x03, 0xcf, 0xff, 0xc0, 0x00, 0x00, 0x03, 0xff, 0xff, 0xc0, 
-	0x00, 0x00, 0x03, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x03, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x03, 0xff, 
-	0xff, 0xc0, 0x00, 0x00, 0x03, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x03, 0xff, 0xff, 0xc0, 0x00, 0x00, 
-	0x03, 0xff, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xfc, 0x00, 
-	0x00, 0x00, 0x03, 0xff, 0xfc, 0x00, 0x30, 0x00, 0x0f, 0xfc, 0x00, 0x00, 0x30, 0x00, 0x0f, 0xfc, 
-	0x00, 0x00, 0x30, 0x00, 0x7f, 0xfc, 0x00, 0x00, 0x30, 0x00, 0x7f, 0xfc, 0x00, 0x00, 0x3c, 0x03, 
-	0xff, 0xff, 0xc0, 0x00, 0x3c, 0x03, 0xff, 0xff, 0xc0, 0x00, 0x3f, 0x0f, 0xff, 0xfc, 0xc0, 0x00, 
-	0x3f, 0x0f, 0xff, 0xfc, 0xc0, 0x00, 0x3f, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xfc, 
-	0x00, 0x00, 0x3f, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x0f, 0xff, 
-	0xff, 0xfc, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x03, 0xff, 0xff, 0xf0, 0x00, 0x00, 
-	0x03, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0xff, 0xff, 0xc0, 
-	0x00, 0x00, 0x00, 0x3f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x0f, 
-	0xcf, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x03, 0x00, 0x00, 0x00, 
-	0x00, 0x0f, 0x03, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x03, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x03, 0x00, 
-	0x00, 0x00, 0x00, 0x0f, 0x03, 0xc0, 0x00, 0x00, 0x00, 0x0f, 0x03, 0xc0, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-};
-// 'Dino2', 44x47px
-const unsigned char epd_bitmap_mother_dino2 [] PROGMEM = {
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 
-	0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xc0, 0x00, 0x00, 
-	0x03, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x03, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x03, 0xff, 0xff, 0xc0, 
-	0x00, 0x00, 0x03, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x03, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x03, 0xff, 
-	0xff, 0xc0, 0x00, 0x00, 0x03, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x03, 0xff, 0xff, 0xc0, 0x00, 0x00, 
-	0x03, 0xff, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xfc, 0x00, 
-	0x00, 0x00, 0x03, 0xff, 0xfc, 0x00, 0x30, 0x00, 0x0f, 0xfc, 0x00, 0x00, 0x30, 0x00, 0x0f, 0xfc, 
-	0x00, 0x00, 0x30, 0x00, 0x7f, 0xfc, 0x00, 0x00, 0x30, 0x00, 0x7f, 0xfc, 0x00, 0x00, 0x3c, 0x03, 
-	0xff, 0xff, 0xc0, 0x00, 0x3c, 0x03, 0xff, 0xff, 0xc0, 0x00, 0x3f, 0x0f, 0xff, 0xfc, 0xc0, 0x00, 
-	0x3f, 0x0f, 0xff, 0xfc, 0xc0, 0x00, 0x3f, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xfc, 
-	0x00, 0x00, 0x3f, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x0f, 0xff, 
-	0xff, 0xfc, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x03, 0xff, 0xff, 0xf0, 0x00, 0x00, 
-	0x03, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0xff, 0xff, 0xc0, 
-	0x00, 0x00, 0x00, 0x3f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x0f, 
-	0xcf, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x03, 0x00, 0x00, 0x00, 
-	0x00, 0x0f, 0x03, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x03, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x03, 0x00, 
-	0x00, 0x00, 0x00, 0x0f, 0x03, 0xc0, 0x00, 0x00, 0x00, 0x0f, 0x03, 0xc0, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-};
-// 'Dino3', 44x47px
-const unsigned char epd_bitmap_mother_dino3 [] PROGMEM = {
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 
-	0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xc0, 0x00, 0x00, 
-	0x03, 0xcf, 0xff, 0xc0, 0x00, 0x00, 0x03, 0xcf, 0xff, 0xc0, 0x00, 0x00, 0x03, 0xff, 0xff, 0xc0, 
-	0x00, 0x00, 0x03, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x03, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x03, 0xff, 
-	0xff, 0xc0, 0x00, 0x00, 0x03, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x03, 0xff, 0xff, 0xc0, 0x00, 0x00, 
-	0x03, 0xff, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xfc, 0x00, 
-	0x00, 0x00, 0x03, 0xff, 0xfc, 0x00, 0x30, 0x00, 0x0f, 0xfc, 0x00, 0x00, 0x30, 0x00, 0x0f, 0xfc, 
-	0x00, 0x00, 0x30, 0x00, 0x7f, 0xfc, 0x00, 0x00, 0x30, 0x00, 0x7f, 0xfc, 0x00, 0x00, 0x3c, 0x03, 
-	0xff, 0xff, 0xc0, 0x00, 0x3c, 0x03, 0xff, 0xff, 0xc0, 0x00, 0x3f, 0x0f, 0xff, 0xfc, 0xc0, 0x00, 
-	0x3f, 0x0f, 0xff, 0xfc, 0xc0, 0x00, 0x3f, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xfc, 
-	0x00, 0x00, 0x3f, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x0f, 0xff, 
-	0xff, 0xfc, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x03, 0xff, 0xff, 0xf0, 0x00, 0x00, 
-	0x03, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0xff, 0xff, 0xc0, 
-	0x00, 0x00, 0x00, 0x3f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x0f, 
-	0xc3, 0xe0, 0x00, 0x00, 0x00, 0x0f, 0xc3, 0xe0, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-};
-// 'Dino4', 44x47px
-const unsigned char epd_bitmap_mother_dino4 [] PROGMEM = {
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 
-	0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xc0, 0x00, 0x00, 
-	0x03, 0xcf, 0xff, 0xc0, 0x00, 0x00, 0x03, 0xcf, 0xff, 0xc0, 0x00, 0x00, 0x03, 0xff, 0xff, 0xc0, 
-	0x00, 0x00, 0x03, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x03, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x03, 0xff, 
-	0xff, 0xc0, 0x00, 0x00, 0x03, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x03, 0xff, 0xff, 0xc0, 0x00, 0x00, 
-	0x03, 0xff, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xfc, 0x00, 
-	0x00, 0x00, 0x03, 0xff, 0xfc, 0x00, 0x30, 0x00, 0x0f, 0xfc, 0x00, 0x00, 0x30, 0x00, 0x0f, 0xfc, 
-	0x00, 0x00, 0x30, 0x00, 0x7f, 0xfc, 0x00, 0x00, 0x30, 0x00, 0x7f, 0xfc, 0x00, 0x00, 0x3c, 0x03, 
-	0xff, 0xff, 0xc0, 0x00, 0x3c, 0x03, 0xff, 0xff, 0xc0, 0x00, 0x3f, 0x0f, 0xff, 0xfc, 0xc0, 0x00, 
-	0x3f, 0x0f, 0xff, 0xfc, 0xc0, 0x00, 0x3f, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xfc, 
-	0x00, 0x00, 0x3f, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x0f, 0xff, 
-	0xff, 0xfc, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x03, 0xff, 0xff, 0xf0, 0x00, 0x00, 
-	0x03, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0xff, 0xff, 0xc0, 
-	0x00, 0x00, 0x00, 0x3f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x0f, 
-	0xc3, 0xe0, 0x00, 0x00, 0x00, 0x0f, 0xc3, 0xe0, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-};
-// 'Dino5', 44x47px
-const unsigned char epd_bitmap_mother_dino5 [] PROGMEM = {
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 
-	0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xc0, 0x00, 0x00, 
-	0x03, 0xcf, 0xff, 0xc0, 0x00, 0x00, 0x03, 0xcf, 0xff, 0xc0, 0x00, 0x00, 0x03, 0xff, 0xff, 0xc0, 
-	0x00, 0x00, 0x03, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x03, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x03, 0xff, 
-	0xff, 0xc0, 0x00, 0x00, 0x03, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x03, 0xff, 0xff, 0xc0, 0x00, 0x00, 
-	0x03, 0xff, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xfc, 0x00, 
-	0x00, 0x00, 0x03, 0xff, 0xfc, 0x00, 0x30, 0x00, 0x0f, 0xfc, 0x00, 0x00, 0x30, 0x00, 0x0f, 0xfc, 
-	0x00, 0x00, 0x30, 0x00, 0x7f, 0xfc, 0x00, 0x00, 0x30, 0x00, 0x7f, 0xfc, 0x00, 0x00, 0x3c, 0x03, 
-	0xff, 0xff, 0xc0, 0x00, 0x3c, 0x03, 0xff, 0xff, 0xc0, 0x00, 0x3f, 0x0f, 0xff, 0xfc, 0xc0, 0x00, 
-	0x3f, 0x0f, 0xff, 0xfc, 0xc0, 0x00, 0x3f, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xfc, 
-	0x00, 0x00, 0x3f, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x0f, 0xff, 
-	0xff, 0xfc, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x03, 0xff, 0xff, 0xf0, 0x00, 0x00, 
-	0x03, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0xff, 0xff, 0xc0, 
-	0x00, 0x00, 0x00, 0x3f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x0f, 
-	0x0f, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x03, 0xc3, 0x00, 0x00, 0x00, 
-	0x00, 0x03, 0xc3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x03, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xc0, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-};
-
-// Array of all bitmaps for convenience. (Total bytes used to store images in PROGMEM = 1520)
-const unsigned char* epd_bitmap_mother_dino_array[5] = {
-	epd_bitmap_mother_dino1,
-	epd_bitmap_mother_dino2,
-	epd_bitmap_mother_dino3,
-	epd_bitmap_mother_dino4,
-	epd_bitmap_mother_dino5
-};
-
-// 'Dino1', 20x21px
-const unsigned char epd_bitmap_child_dino1 [] PROGMEM = {
-	0x00, 0x00, 0x00, 0x00, 0x1f, 0xc0, 0x00, 0x3f, 0xe0, 0x00, 0x3f, 0xe0, 0x00, 0x3f, 0xe0, 0x00, 
-	0x3f, 0xc0, 0x00, 0x3c, 0x00, 0x00, 0x3f, 0x80, 0x40, 0x78, 0x00, 0x40, 0xf8, 0x00, 0x63, 0xfa, 
-	0x00, 0x77, 0xf8, 0x00, 0x7f, 0xf8, 0x00, 0x3f, 0xf0, 0x00, 0x1f, 0xf0, 0x00, 0x0f, 0xe0, 0x00, 
-	0x07, 0x60, 0x00, 0x02, 0x20, 0x00, 0x00, 0x20, 0x00, 0x02, 0x20, 0x00, 0x00, 0x00, 0x00
-};
-// 'Dino2', 20x21px
-const unsigned char epd_bitmap_child_dino2 [] PROGMEM = {
-	0x00, 0x00, 0x00, 0x00, 0x1f, 0xc0, 0x00, 0x3f, 0xe0, 0x00, 0x3f, 0xe0, 0x00, 0x3f, 0xe0, 0x00, 
-	0x3f, 0xc0, 0x00, 0x3c, 0x00, 0x00, 0x3f, 0x80, 0x40, 0x78, 0x00, 0x40, 0xf8, 0x00, 0x63, 0xfa, 
-	0x00, 0x77, 0xf8, 0x00, 0x7f, 0xf8, 0x00, 0x3f, 0xf0, 0x00, 0x1f, 0xf0, 0x00, 0x0f, 0xe0, 0x00, 
-	0x07, 0x60, 0x00, 0x02, 0x20, 0x00, 0x00, 0x20, 0x00, 0x02, 0x20, 0x00, 0x00, 0x00, 0x00
-};
-// 'Dino3', 20x21px
-const unsigned char epd_bitmap_child_dino3 [] PROGMEM = {
-	0x00, 0x00, 0x00, 0x00, 0x1f, 0xc0, 0x00, 0x3f, 0xe0, 0x00, 0x3f, 0xe0, 0x00, 0x3f, 0xe0, 0x00, 
-	0x3f, 0xc0, 0x00, 0x3c, 0x00, 0x00, 0x3f, 0x80, 0x40, 0x78, 0x00, 0x40, 0xf8, 0x00, 0x63, 0xfa, 
-	0x00, 0x77, 0xf8, 0x00, 0x7f, 0xf8, 0x00, 0x3f, 0xf0, 0x00, 0x1f, 0xf0, 0x00, 0x0f, 0xe0, 0x00, 
-	0x07, 0x20, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00
-};
-// 'Dino4', 20x21px
-const unsigned char epd_bitmap_child_dino4 [] PROGMEM = {
-	0x00, 0x00, 0x00, 0x00, 0x1f, 0xc0, 0x00, 0x3f, 0xe0, 0x00, 0x3f, 0xe0, 0x00, 0x3f, 0xe0, 0x00, 
-	0x3f, 0xc0, 0x00, 0x3c, 0x00, 0x00, 0x3f, 0x80, 0x40, 0x78, 0x00, 0x40, 0xf8, 0x00, 0x63, 0xfa, 
-	0x00, 0x77, 0xf8, 0x00, 0x7f, 0xf8, 0x00, 0x3f, 0xf0, 0x00, 0x1f, 0xf0, 0x00, 0x0f, 0xe0, 0x00, 
-	0x07, 0x20, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00
-};
-// 'Dino5', 20x21px
-const unsigned char epd_bitmap_child_dino5 [] PROGMEM = {
-	0x00, 0x00, 0x00, 0x00, 0x1f, 0xc0, 0x00, 0x3f, 0xe0, 0x00, 0x3f, 0xe0, 0x00, 0x3f, 0xe0, 0x00, 
-	0x3f, 0xc0, 0x00, 0x3c, 0x00, 0x00, 0x3f, 0x80, 0x40, 0x78, 0x00, 0x40, 0xf8, 0x00, 0x63, 0xfa, 
-	0x00, 0x77, 0xf8, 0x00, 0x7f, 0xf8, 0x00, 0x3f, 0xf0, 0x00, 0x1f, 0xf0, 0x00, 0x0f, 0xe0, 0x00, 
-	0x06, 0x60, 0x00, 0x02, 0x20, 0x00, 0x00, 0x20, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00
-};
-
-// Array of all bitmaps for convenience. (Total bytes used to store images in PROGMEM = 400)
-const unsigned char* epd_bitmap_child_dino_array[5] = {
-	epd_bitmap_child_dino1,
-	epd_bitmap_child_dino2,
-	epd_bitmap_child_dino3,
-	epd_bitmap_child_dino4,
-	epd_bitmap_child_dino5
-};
-
-
-const int MOTHER_SPRITE_WIDTH = 44;
-const int MOTHER_SPRITE_HEIGHT = 47;
-const int NUM_MOTHER_DINO_SPRITES = 5;
-
-const int CHILD_SPRITE_WIDTH = 20;
-const int CHILD_SPRITE_HEIGHT = 21;
-const int NUM_CHILD_DINO_SPRITES = 5;
\ No newline at end of file
@@ -0,0 +1,73 @@
+/**
+ * A stand-in for the Adafruit GFX library with just the shapes that
+ * FastScrollingGraph.hpp draws. Like the real library, every shape is drawn
+ * with the virtual drawPixel(), drawFastHLine(), and drawFastVLine(). Only
+ * used by FastScrollingGraphCheck.cpp.
+ *
+ * By Jon E. Froehlich
+ * @jonfroehlich
+ * http://makeabilitylab.io
+ *
+ */
+#ifndef HOST_ADAFRUIT_GFX_H
+#define HOST_ADAFRUIT_GFX_H
+
+#include <Arduino.h>
+
+class Adafruit_GFX{
+
+  protected:
+    const int16_t WIDTH, HEIGHT;
+    int16_t _width, _height;
+
+  public:
+    Adafruit_GFX(int16_t w, int16_t h)
+      : WIDTH(w), HEIGHT(h), _width(w), _height(h) {
+    }
+
+    virtual ~Adafruit_GFX() {}
+
+    virtual void drawPixel(int16_t x, int16_t y, uint16_t color) = 0;
+
+    virtual void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+      for (int16_t i = 0; i < h; i++) {
+        drawPixel(x, y + i, color);
+      }
+    }
+
+    virtual void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+      for (int16_t i = 0; i < w; i++) {
+        drawPixel(x + i, y, color);
+      }
+    }
+
+    virtual void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+      for (int16_t i = x; i < x + w; i++) {
+        drawFastVLine(i, y, h, color);
+      }
+    }
+
+    virtual void fillScreen(uint16_t color) {
+      fillRect(0, 0, _width, _height, color);
+    }
+
+    void drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) {
+      int16_t dx = abs(x1 - x0), sx = x0 < x1 ? 1 : -1;
+      int16_t dy = -abs(y1 - y0), sy = y0 < y1 ? 1 : -1;
+      int16_t err = dx + dy;
+      while (true) {
+        drawPixel(x0, y0, color);
+        if (x0 == x1 && y0 == y1) {
+          break;
+        }
+        int16_t e2 = 2 * err;
+        if (e2 >= dy) { err += dy; x0 += sx; }
+        if (e2 <= dx) { err += dx; y0 += sy; }
+      }
+    }
+
+    int16_t width() const { return _width; }
+    int16_t height() const { return _height; }
+};
+
+#endif
@@ -0,0 +1,59 @@
+/**
+ * A stand-in for the Adafruit SSD1306 library with the same framebuffer
+ * layout as the real one (each byte is 8 rows of a column, one 128-byte page
+ * after another), but no display(): FastScrollingGraphCheck.cpp only looks
+ * at the framebuffer. Only used by FastScrollingGraphCheck.cpp.
+ *
+ * By Jon E. Froehlich
+ * @jonfroehlich
+ * http://makeabilitylab.io
+ *
+ */
+#ifndef HOST_ADAFRUIT_SSD1306_H
+#define HOST_ADAFRUIT_SSD1306_H
+
+#include <Arduino.h>
+#include <Adafruit_GFX.h>
+
+#define SSD1306_BLACK 0
+#define SSD1306_WHITE 1
+#define SSD1306_INVERSE 2
+
+class Adafruit_SSD1306 : public Adafruit_GFX{
+
+  private:
+    uint8_t* _buffer;
+
+  public:
+    Adafruit_SSD1306(uint8_t w, uint8_t h)
+      : Adafruit_GFX(w, h), _buffer(new uint8_t[w * h / 8]) {
+      clearDisplay();
+    }
+
+    ~Adafruit_SSD1306() {
+      delete[] _buffer;
+    }
+
+    void drawPixel(int16_t x, int16_t y, uint16_t color) override {
+      if (x < 0 || x >= WIDTH || y < 0 || y >= HEIGHT) {
+        return;
+      }
+      uint8_t& b = _buffer[x + (y / 8) * WIDTH];
+      uint8_t bit = 1 << (y & 7);
+      switch (color) {
+        case SSD1306_WHITE: b |= bit; break;
+        case SSD1306_BLACK: b &= ~bit; break;
+        case SSD1306_INVERSE: b ^= bit; break;
+      }
+    }
+
+    void clearDisplay() {
+      memset(_buffer, 0, WIDTH * HEIGHT / 8);
+    }
+
+    uint8_t* getBuffer() {
+      return _buffer;
+    }
+};
+
+#endif
@@ -0,0 +1,174 @@
+/**
+ * Checks FastScrollingGraph.hpp on a desktop computer (Linux or Mac). It
+ * feeds two graphs the same points: one draws incrementally, like a sketch,
+ * and the other is made to redraw everything every frame. After every frame,
+ * the graph's area of the two framebuffers must match pixel for pixel, and
+ * the rest of the screen (filled with a pattern) must be untouched. It runs
+ * every combination of:
+ *
+ *  - Style: GRAPH_POINTS, GRAPH_LINES, and GRAPH_BARS
+ *  - Scale: a fixed range (with points above and below it, which are
+ *    clipped) and auto-scaling, including a spike that scrolls off
+ *  - Axis: with and without a dotted axis, at a value inside the range
+ *  - Size: the full screen width, partial widths at an x offset (including
+ *    1 and 2 columns), and graphs one page and several pages tall
+ *  - Points per frame: 1, 3, and more than the graph's width
+ *
+ * Each combination prints nothing if it passed and its settings if it
+ * didn't. The header is included straight from AnalogGraphScrolling (the
+ * other copy is identical), so the results are for the exact code that runs
+ * on the Arduino. It prints PASS or FAIL for each check and exits with 1 if
+ * any failed.
+ *
+ * To build and run (from this folder):
+ *  g++ -std=c++11 -O2 -I. FastScrollingGraphCheck.cpp -o FastScrollingGraphCheck
+ *  ./FastScrollingGraphCheck
+ *
+ * By Jon E. Froehlich
+ * @jonfroehlich
+ * http://makeabilitylab.io
+ *
+ */
+#include <Arduino.h>  // the host stand-ins in this folder (needs -I.)
+
+#include "../AnalogGraphScrolling/FastScrollingGraph.hpp"
+
+#include <cstdio>
+#include <random>
+
+const uint8_t SCREEN_WIDTH = 128;
+const uint8_t SCREEN_HEIGHT = 64;
+const int NUM_FRAMES = 300;
+
+int _numFailures = 0;
+std::mt19937 _rng(16);
+
+void check(bool passed, const char* name) {
+  printf("%-9s %s\n", name, passed ? "PASS" : "FAIL");
+  if (!passed) {
+    _numFailures++;
+  }
+}
+
+struct GraphArea{
+  int16_t x, y;
+  uint8_t width, height;
+};
+
+// Fills the screen with a pattern that a graph drawing outside its area would change
+void fillPattern(Adafruit_SSD1306& display) {
+  uint8_t* buffer = display.getBuffer();
+  for (int i = 0; i < SCREEN_WIDTH * SCREEN_HEIGHT / 8; i++) {
+    buffer[i] = (i * 29) ^ 0xA5;
+  }
+}
+
+bool isInArea(const GraphArea& area, int x, int page) {
+  return x >= area.x && x < area.x + area.width && page >= area.y / 8 && page < (area.y + area.height) / 8;
+}
+
+// Compares the graph area of two framebuffers and checks that incremental
+// still has the pattern everywhere else
+bool matches(Adafruit_SSD1306& incremental, Adafruit_SSD1306& redrawn, const GraphArea& area) {
+  const uint8_t* a = incremental.getBuffer();
+  const uint8_t* b = redrawn.getBuffer();
+  for (int page = 0; page < SCREEN_HEIGHT / 8; page++) {
+    for (int x = 0; x < SCREEN_WIDTH; x++) {
+      int i = page * SCREEN_WIDTH + x;
+      uint8_t expected = isInArea(area, x, page) ? b[i] : (uint8_t)((i * 29) ^ 0xA5);
+      if (a[i] != expected) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+// A value from a signal that wanders around and now and then spikes
+int nextValue(long i, int minValue, int maxValue) {
+  int range = maxValue - minValue;
+  if (i % 97 == 40) {
+    return maxValue + range / 2;  // a spike above a fixed range
+  }
+  if (i % 89 == 10) {
+    return minValue - range / 3;
+  }
+  return minValue + (int)(range * (0.5 + 0.45 * sin(i * 0.07))) + (int)(_rng() % 7) - 3;
+}
+
+bool runGraph(const GraphArea& area, GraphStyle style, bool isAutoScale, bool hasAxis, int pointsPerFrame) {
+  const int minValue = -300, maxValue = 700;
+  Adafruit_SSD1306 incrementalDisplay(SCREEN_WIDTH, SCREEN_HEIGHT);
+  Adafruit_SSD1306 redrawnDisplay(SCREEN_WIDTH, SCREEN_HEIGHT);
+  fillPattern(incrementalDisplay);
+  fillPattern(redrawnDisplay);
+
+  FastScrollingGraph incremental = isAutoScale ? FastScrollingGraph(area.x, area.y, area.width, area.height)
+                                               : FastScrollingGraph(area.x, area.y, area.width, area.height, minValue, maxValue);
+  FastScrollingGraph redrawn = incremental;
+  incremental.setStyle(style);
+  redrawn.setStyle(style);
+  if (hasAxis) {
+    incremental.setAxis(0);
+    redrawn.setAxis(0);
+  }
+
+  long i = 0;
+  bool passed = true;
+  int numRedraws = 0;
+  for (int frame = 0; frame < NUM_FRAMES && passed; frame++) {
+    // Now and then, a frame with no new points
+    int numPoints = frame % 11 == 5 ? 0 : pointsPerFrame;
+    for (int p = 0; p < numPoints; p++, i++) {
+      int value = nextValue(i, minValue, maxValue);
+      incremental.addData(value);
+      redrawn.addData(value);
+    }
+    numRedraws += incremental.draw(incrementalDisplay);
+    redrawn.setStyle(style);  // makes the next draw() redraw everything
+    redrawn.draw(redrawnDisplay);
+    passed = matches(incrementalDisplay, redrawnDisplay, area);
+  }
+
+  // Unless every frame had to redraw, most frames should be incremental
+  if (!isAutoScale && pointsPerFrame <= area.width) {
+    passed = passed && numRedraws < NUM_FRAMES / 2;
+  }
+  if (!passed) {
+    printf("  failed: x %d y %d width %d height %d, style %d, %s, %s axis, %d points per frame\n",
+           area.x, area.y, area.width, area.height, style, isAutoScale ? "auto" : "fixed",
+           hasAxis ? "with" : "no", pointsPerFrame);
+  }
+  return passed;
+}
+
+// Runs every style, scale, axis, and points per frame for area
+bool runArea(const GraphArea& area) {
+  const GraphStyle styles[] = { GRAPH_POINTS, GRAPH_LINES, GRAPH_BARS };
+  const int pointsPerFrame[] = { 1, 3, 200 };
+  bool passed = true;
+  for (GraphStyle style : styles) {
+    for (int scale = 0; scale < 2; scale++) {
+      for (int axis = 0; axis < 2; axis++) {
+        for (int points : pointsPerFrame) {
+          passed = runGraph(area, style, scale == 1, axis == 1, points) && passed;
+        }
+      }
+    }
+  }
+  return passed;
+}
+
+int main() {
+  check(runArea({ 0, 8, 128, 56 }), "Full");
+  check(runArea({ 0, 0, 128, 64 }) && runArea({ 0, 16, 128, 8 }), "Heights");
+  check(runArea({ 20, 8, 100, 48 }) && runArea({ 7, 24, 37, 40 }), "Partial");
+  check(runArea({ 60, 16, 1, 32 }) && runArea({ 126, 16, 2, 32 }), "Narrow");
+
+  if (_numFailures > 0) {
+    printf("%d checks FAILED\n", _numFailures);
+    return 1;
+  }
+  printf("All checks passed\n");
+  return 0;
+}
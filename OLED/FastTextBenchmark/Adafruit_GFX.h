@@ -0,0 +1,360 @@
+/**
+ * A stand-in for the Adafruit GFX library with the shapes and the built-in
+ * font's text drawing, done the same way as the real library: drawChar()
+ * draws each character a pixel at a time with drawPixel() (or fillRect() for
+ * larger sizes), and print() formats numbers like the Arduino Print class.
+ *
+ * The font is the printable ASCII characters (' ' to '~') of the real
+ * library's glcdfont.c, copied separately from FastText.hpp's so that a wrong
+ * byte in either one fails FastTextBenchmark. Only used by FastTextBenchmark.cpp.
+ *
+ * By Jon E. Froehlich
+ * @jonfroehlich
+ * http://makeabilitylab.io
+ *
+ */
+#ifndef HOST_ADAFRUIT_GFX_H
+#define HOST_ADAFRUIT_GFX_H
+
+#include <Arduino.h>
+#include <stdio.h>
+
+// glcdfont.c's printable characters, 5 bytes (columns, top row in the lowest bit) each
+static const uint8_t HOST_GFX_FONT[] = {
+  0x00, 0x00, 0x00, 0x00, 0x00,  // ' '
+  0x00, 0x00, 0x5F, 0x00, 0x00,  // !
+  0x00, 0x07, 0x00, 0x07, 0x00,  // "
+  0x14, 0x7F, 0x14, 0x7F, 0x14,  // #
+  0x24, 0x2A, 0x7F, 0x2A, 0x12,  // $
+  0x23, 0x13, 0x08, 0x64, 0x62,  // %
+  0x36, 0x49, 0x56, 0x20, 0x50,  // &
+  0x00, 0x08, 0x07, 0x03, 0x00,  // '
+  0x00, 0x1C, 0x22, 0x41, 0x00,  // (
+  0x00, 0x41, 0x22, 0x1C, 0x00,  // )
+  0x2A, 0x1C, 0x7F, 0x1C, 0x2A,  // *
+  0x08, 0x08, 0x3E, 0x08, 0x08,  // +
+  0x00, 0x80, 0x70, 0x30, 0x00,  // ,
+  0x08, 0x08, 0x08, 0x08, 0x08,  // -
+  0x00, 0x00, 0x60, 0x60, 0x00,  // .
+  0x20, 0x10, 0x08, 0x04, 0x02,  // /
+  0x3E, 0x51, 0x49, 0x45, 0x3E,  // 0
+  0x00, 0x42, 0x7F, 0x40, 0x00,  // 1
+  0x72, 0x49, 0x49, 0x49, 0x46,  // 2
+  0x21, 0x41, 0x49, 0x4D, 0x33,  // 3
+  0x18, 0x14, 0x12, 0x7F, 0x10,  // 4
+  0x27, 0x45, 0x45, 0x45, 0x39,  // 5
+  0x3C, 0x4A, 0x49, 0x49, 0x31,  // 6
+  0x41, 0x21, 0x11, 0x09, 0x07,  // 7
+  0x36, 0x49, 0x49, 0x49, 0x36,  // 8
+  0x46, 0x49, 0x49, 0x29, 0x1E,  // 9
+  0x00, 0x00, 0x14, 0x00, 0x00,  // :
+  0x00, 0x40, 0x34, 0x00, 0x00,  // ;
+  0x00, 0x08, 0x14, 0x22, 0x41,  // <
+  0x14, 0x14, 0x14, 0x14, 0x14,  // =
+  0x00, 0x41, 0x22, 0x14, 0x08,  // >
+  0x02, 0x01, 0x59, 0x09, 0x06,  // ?
+  0x3E, 0x41, 0x5D, 0x59, 0x4E,  // @
+  0x7C, 0x12, 0x11, 0x12, 0x7C,  // A
+  0x7F, 0x49, 0x49, 0x49, 0x36,  // B
+  0x3E, 0x41, 0x41, 0x41, 0x22,  // C
+  0x7F, 0x41, 0x41, 0x41, 0x3E,  // D
+  0x7F, 0x49, 0x49, 0x49, 0x41,  // E
+  0x7F, 0x09, 0x09, 0x09, 0x01,  // F
+  0x3E, 0x41, 0x41, 0x51, 0x73,  // G
+  0x7F, 0x08, 0x08, 0x08, 0x7F,  // H
+  0x00, 0x41, 0x7F, 0x41, 0x00,  // I
+  0x20, 0x40, 0x41, 0x3F, 0x01,  // J
+  0x7F, 0x08, 0x14, 0x22, 0x41,  // K
+  0x7F, 0x40, 0x40, 0x40, 0x40,  // L
+  0x7F, 0x02, 0x1C, 0x02, 0x7F,  // M
+  0x7F, 0x04, 0x08, 0x10, 0x7F,  // N
+  0x3E, 0x41, 0x41, 0x41, 0x3E,  // O
+  0x7F, 0x09, 0x09, 0x09, 0x06,  // P
+  0x3E, 0x41, 0x51, 0x21, 0x5E,  // Q
+  0x7F, 0x09, 0x19, 0x29, 0x46,  // R
+  0x26, 0x49, 0x49, 0x49, 0x32,  // S
+  0x03, 0x01, 0x7F, 0x01, 0x03,  // T
+  0x3F, 0x40, 0x40, 0x40, 0x3F,  // U
+  0x1F, 0x20, 0x40, 0x20, 0x1F,  // V
+  0x3F, 0x40, 0x38, 0x40, 0x3F,  // W
+  0x63, 0x14, 0x08, 0x14, 0x63,  // X
+  0x03, 0x04, 0x78, 0x04, 0x03,  // Y
+  0x61, 0x59, 0x49, 0x4D, 0x43,  // Z
+  0x00, 0x7F, 0x41, 0x41, 0x41,  // [
+  0x02, 0x04, 0x08, 0x10, 0x20,  // backslash
+  0x00, 0x41, 0x41, 0x41, 0x7F,  // ]
+  0x04, 0x02, 0x01, 0x02, 0x04,  // ^
+  0x40, 0x40, 0x40, 0x40, 0x40,  // _
+  0x00, 0x03, 0x07, 0x08, 0x00,  // `
+  0x20, 0x54, 0x54, 0x78, 0x40,  // a
+  0x7F, 0x28, 0x44, 0x44, 0x38,  // b
+  0x38, 0x44, 0x44, 0x44, 0x28,  // c
+  0x38, 0x44, 0x44, 0x28, 0x7F,  // d
+  0x38, 0x54, 0x54, 0x54, 0x18,  // e
+  0x00, 0x08, 0x7E, 0x09, 0x02,  // f
+  0x18, 0xA4, 0xA4, 0x9C, 0x78,  // g
+  0x7F, 0x08, 0x04, 0x04, 0x78,  // h
+  0x00, 0x44, 0x7D, 0x40, 0x00,  // i
+  0x20, 0x40, 0x40, 0x3D, 0x00,  // j
+  0x7F, 0x10, 0x28, 0x44, 0x00,  // k
+  0x00, 0x41, 0x7F, 0x40, 0x00,  // l
+  0x7C, 0x04, 0x78, 0x04, 0x78,  // m
+  0x7C, 0x08, 0x04, 0x04, 0x78,  // n
+  0x38, 0x44, 0x44, 0x44, 0x38,  // o
+  0xFC, 0x18, 0x24, 0x24, 0x18,  // p
+  0x18, 0x24, 0x24, 0x18, 0xFC,  // q
+  0x7C, 0x08, 0x04, 0x04, 0x08,  // r
+  0x48, 0x54, 0x54, 0x54, 0x24,  // s
+  0x04, 0x04, 0x3F, 0x44, 0x24,  // t
+  0x3C, 0x40, 0x40, 0x20, 0x7C,  // u
+  0x1C, 0x20, 0x40, 0x20, 0x1C,  // v
+  0x3C, 0x40, 0x30, 0x40, 0x3C,  // w
+  0x44, 0x28, 0x10, 0x28, 0x44,  // x
+  0x4C, 0x90, 0x90, 0x90, 0x7C,  // y
+  0x44, 0x64, 0x54, 0x4C, 0x44,  // z
+  0x00, 0x08, 0x36, 0x41, 0x00,  // {
+  0x00, 0x00, 0x77, 0x00, 0x00,  // |
+  0x00, 0x41, 0x36, 0x08, 0x00,  // }
+  0x02, 0x01, 0x02, 0x04, 0x02   // ~
+};
+
+class Adafruit_GFX{
+
+  protected:
+    const int16_t WIDTH, HEIGHT;  // the display's size without rotation
+    int16_t _width, _height;      // the display's size with rotation
+    uint8_t rotation;
+
+    // Text
+    int16_t _cursorX, _cursorY;
+    uint8_t _textSize;
+    uint16_t _textColor, _textBgColor;
+    bool _wrap;
+
+    void printNumber(unsigned long n) {
+      char digits[21];
+      snprintf(digits, sizeof(digits), "%lu", n);
+      print(digits);
+    }
+
+  public:
+    Adafruit_GFX(int16_t w, int16_t h)
+      : WIDTH(w), HEIGHT(h), _width(w), _height(h), rotation(0),
+        _cursorX(0), _cursorY(0), _textSize(1), _textColor(1), _textBgColor(1), _wrap(true) {
+    }
+
+    virtual ~Adafruit_GFX() {}
+
+    virtual void drawPixel(int16_t x, int16_t y, uint16_t color) = 0;
+
+    virtual void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+      for (int16_t i = 0; i < h; i++) {
+        drawPixel(x, y + i, color);
+      }
+    }
+
+    virtual void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+      for (int16_t i = 0; i < w; i++) {
+        drawPixel(x + i, y, color);
+      }
+    }
+
+    virtual void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+      for (int16_t i = x; i < x + w; i++) {
+        drawFastVLine(i, y, h, color);
+      }
+    }
+
+    virtual void fillScreen(uint16_t color) {
+      fillRect(0, 0, _width, _height, color);
+    }
+
+    void drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+      drawFastHLine(x, y, w, color);
+      drawFastHLine(x, y + h - 1, w, color);
+      drawFastVLine(x, y, h, color);
+      drawFastVLine(x + w - 1, y, h, color);
+    }
+
+    void drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) {
+      int16_t dx = abs(x1 - x0), sx = x0 < x1 ? 1 : -1;
+      int16_t dy = -abs(y1 - y0), sy = y0 < y1 ? 1 : -1;
+      int16_t err = dx + dy;
+      while (true) {
+        drawPixel(x0, y0, color);
+        if (x0 == x1 && y0 == y1) {
+          break;
+        }
+        int16_t e2 = 2 * err;
+        if (e2 >= dy) { err += dy; x0 += sx; }
+        if (e2 <= dx) { err += dx; y0 += sy; }
+      }
+    }
+
+    void drawCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color) {
+      int16_t f = 1 - r, ddFx = 1, ddFy = -2 * r, x = 0, y = r;
+      drawPixel(x0, y0 + r, color);
+      drawPixel(x0, y0 - r, color);
+      drawPixel(x0 + r, y0, color);
+      drawPixel(x0 - r, y0, color);
+      while (x < y) {
+        if (f >= 0) { y--; ddFy += 2; f += ddFy; }
+        x++; ddFx += 2; f += ddFx;
+        drawPixel(x0 + x, y0 + y, color);
+        drawPixel(x0 - x, y0 + y, color);
+        drawPixel(x0 + x, y0 - y, color);
+        drawPixel(x0 - x, y0 - y, color);
+        drawPixel(x0 + y, y0 + x, color);
+        drawPixel(x0 - y, y0 + x, color);
+        drawPixel(x0 + y, y0 - x, color);
+        drawPixel(x0 - y, y0 - x, color);
+      }
+    }
+
+    void fillCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color) {
+      for (int16_t x = -r; x <= r; x++) {
+        int16_t h = (int16_t)sqrt((double)(r * r - x * x));
+        drawFastVLine(x0 + x, y0 - h, 2 * h + 1, color);
+      }
+    }
+
+    void setRotation(uint8_t r) {
+      rotation = r & 3;
+      _width = rotation % 2 == 0 ? WIDTH : HEIGHT;
+      _height = rotation % 2 == 0 ? HEIGHT : WIDTH;
+    }
+
+    void setCursor(int16_t x, int16_t y) { _cursorX = x; _cursorY = y; }
+    void setTextSize(uint8_t size) { _textSize = size > 0 ? size : 1; }
+    void setTextColor(uint16_t color) { _textColor = _textBgColor = color; }
+    void setTextColor(uint16_t color, uint16_t bg) { _textColor = color; _textBgColor = bg; }
+    void setTextWrap(bool wrap) { _wrap = wrap; }
+
+    void drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color, uint16_t bg, uint8_t size) {
+      if (x >= _width || y >= _height || x + 6 * size - 1 < 0 || y + 8 * size - 1 < 0) {
+        return;
+      }
+      const uint8_t* glyph = HOST_GFX_FONT + (c >= ' ' && c <= '~' ? c - ' ' : 0) * 5;
+      for (int8_t i = 0; i < 5; i++) {
+        uint8_t line = glyph[i];
+        for (int8_t j = 0; j < 8; j++, line >>= 1) {
+          if (line & 1) {
+            if (size == 1) {
+              drawPixel(x + i, y + j, color);
+            } else {
+              fillRect(x + i * size, y + j * size, size, size, color);
+            }
+          } else if (bg != color) {
+            if (size == 1) {
+              drawPixel(x + i, y + j, bg);
+            } else {
+              fillRect(x + i * size, y + j * size, size, size, bg);
+            }
+          }
+        }
+      }
+      if (bg != color) {
+        if (size == 1) {
+          drawFastVLine(x + 5, y, 8, bg);
+        } else {
+          fillRect(x + 5 * size, y, size, 8 * size, bg);
+        }
+      }
+    }
+
+    void write(char c) {
+      if (c == '\n') {
+        _cursorX = 0;
+        _cursorY += 8 * _textSize;
+      } else if (c != '\r') {
+        if (_wrap && _cursorX + 6 * _textSize > _width) {
+          _cursorX = 0;
+          _cursorY += 8 * _textSize;
+        }
+        drawChar(_cursorX, _cursorY, c, _textColor, _textBgColor, _textSize);
+        _cursorX += 6 * _textSize;
+      }
+    }
+
+    void print(const char* text) {
+      while (*text != '\0') {
+        write(*text++);
+      }
+    }
+
+    void print(long n) {
+      if (n < 0) {
+        write('-');
+        printNumber(0UL - (unsigned long)n);
+      } else {
+        printNumber(n);
+      }
+    }
+
+    void print(int n) {
+      print((long)n);
+    }
+
+    // Print::printFloat(), in floats like on an AVR (where double is the same as float)
+    void print(float number, int digits = 2) {
+      if (isnan(number)) { print("nan"); return; }
+      if (isinf(number)) { print("inf"); return; }
+      if (number > 4294967040.0 || number < -4294967040.0) { print("ovf"); return; }
+      if (number < 0.0) {
+        write('-');
+        number = -number;
+      }
+      float rounding = 0.5;
+      for (uint8_t i = 0; i < digits; ++i) {
+        rounding /= 10.0;
+      }
+      number += rounding;
+      unsigned long intPart = (unsigned long)number;
+      float remainder = number - (float)intPart;
+      printNumber(intPart);
+      if (digits > 0) {
+        write('.');
+      }
+      while (digits-- > 0) {
+        remainder *= 10.0;
+        unsigned int toPrint = (unsigned int)remainder;
+        printNumber(toPrint);
+        remainder -= toPrint;
+      }
+    }
+
+    void getTextBounds(const char* text, int16_t x, int16_t y, int16_t* x1, int16_t* y1, uint16_t* w, uint16_t* h) {
+      int16_t minX = _width, minY = _height, maxX = -1, maxY = -1;
+      for (; *text != '\0'; text++) {
+        if (*text == '\n') {
+          x = 0;
+          y += 8 * _textSize;
+          continue;
+        }
+        if (*text == '\r') {
+          continue;
+        }
+        if (_wrap && x + 6 * _textSize > _width) {
+          x = 0;
+          y += 8 * _textSize;
+        }
+        minX = min(minX, x);
+        minY = min(minY, y);
+        maxX = max(maxX, (int16_t)(x + 6 * _textSize - 1));
+        maxY = max(maxY, (int16_t)(y + 8 * _textSize - 1));
+        x += 6 * _textSize;
+      }
+      *x1 = minX;
+      *y1 = minY;
+      *w = maxX >= minX ? maxX - minX + 1 : 0;
+      *h = maxY >= minY ? maxY - minY + 1 : 0;
+    }
+
+    int16_t getCursorX() const { return _cursorX; }
+    int16_t getCursorY() const { return _cursorY; }
+    uint8_t getRotation() const { return rotation; }
+    int16_t width() const { return _width; }
+    int16_t height() const { return _height; }
+};
+
+#endif
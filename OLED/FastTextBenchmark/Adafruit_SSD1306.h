@@ -0,0 +1,155 @@
+/**
+ * A stand-in for the Adafruit SSD1306 library (I2C only) with the same
+ * framebuffer layout, rotation handling, and display() as the real one. It
+ * counts the calls to drawPixel(), drawFastHLine(), and drawFastVLine(),
+ * which each cost a few microseconds on an Arduino. Only used by
+ * FastTextBenchmark.cpp.
+ *
+ * By Jon E. Froehlich
+ * @jonfroehlich
+ * http://makeabilitylab.io
+ *
+ */
+#ifndef HOST_ADAFRUIT_SSD1306_H
+#define HOST_ADAFRUIT_SSD1306_H
+
+#include <Arduino.h>
+#include <Wire.h>
+#include <Adafruit_GFX.h>
+
+#define SSD1306_BLACK 0
+#define SSD1306_WHITE 1
+#define SSD1306_INVERSE 2
+#define SSD1306_SWITCHCAPVCC 0x02
+#define SSD1306_MEMORYMODE 0x20
+#define SSD1306_COLUMNADDR 0x21
+#define SSD1306_PAGEADDR 0x22
+
+class Adafruit_SSD1306 : public Adafruit_GFX{
+
+  private:
+    TwoWire* _wire;
+    uint8_t _i2cAddress;
+    uint8_t* _buffer;
+
+    // Sets a pixel in the SSD1306's own (unrotated) coordinates
+    void setPixel(int16_t x, int16_t y, uint16_t color) {
+      if (x < 0 || x >= WIDTH || y < 0 || y >= HEIGHT) {
+        return;
+      }
+      uint8_t& b = _buffer[x + (y / 8) * WIDTH];
+      uint8_t bit = 1 << (y & 7);
+      switch (color) {
+        case SSD1306_WHITE: b |= bit; break;
+        case SSD1306_BLACK: b &= ~bit; break;
+        case SSD1306_INVERSE: b ^= bit; break;
+      }
+    }
+
+    void rotate(int16_t& x, int16_t& y) {
+      int16_t t;
+      switch (rotation) {
+        case 1: t = x; x = WIDTH - y - 1; y = t; break;
+        case 2: x = WIDTH - x - 1; y = HEIGHT - y - 1; break;
+        case 3: t = x; x = y; y = HEIGHT - t - 1; break;
+      }
+    }
+
+  public:
+    unsigned long numDrawCalls;
+
+    Adafruit_SSD1306(uint8_t w, uint8_t h, TwoWire* twi = &Wire, int8_t = -1,
+                     uint32_t = 400000UL, uint32_t = 100000UL)
+      : Adafruit_GFX(w, h), _wire(twi), _i2cAddress(0), _buffer(new uint8_t[w * h / 8]), numDrawCalls(0) {
+    }
+
+    ~Adafruit_SSD1306() {
+      delete[] _buffer;
+    }
+
+    bool begin(uint8_t = SSD1306_SWITCHCAPVCC, uint8_t i2caddr = 0, bool = true, bool = true) {
+      _i2cAddress = i2caddr != 0 ? i2caddr : (HEIGHT == 32 ? 0x3C : 0x3D);
+      _wire->begin();
+      clearDisplay();
+      _wire->beginTransmission(_i2cAddress);
+      _wire->write((uint8_t)0x00);
+      _wire->write((uint8_t)SSD1306_MEMORYMODE);
+      _wire->write((uint8_t)0x00);  // horizontal addressing
+      _wire->endTransmission();
+      return true;
+    }
+
+    void drawPixel(int16_t x, int16_t y, uint16_t color) override {
+      numDrawCalls++;
+      if (x < 0 || x >= width() || y < 0 || y >= height()) {
+        return;
+      }
+      rotate(x, y);
+      setPixel(x, y, color);
+    }
+
+    // Like the real library, lines don't go through drawPixel()
+    void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override {
+      numDrawCalls++;
+      for (int16_t i = 0; i < w; i++) {
+        int16_t px = x + i, py = y;
+        if (px >= 0 && px < width() && py >= 0 && py < height()) {
+          rotate(px, py);
+          setPixel(px, py, color);
+        }
+      }
+    }
+
+    void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override {
+      numDrawCalls++;
+      for (int16_t i = 0; i < h; i++) {
+        int16_t px = x, py = y + i;
+        if (px >= 0 && px < width() && py >= 0 && py < height()) {
+          rotate(px, py);
+          setPixel(px, py, color);
+        }
+      }
+    }
+
+    void clearDisplay() {
+      memset(_buffer, 0, WIDTH * HEIGHT / 8);
+    }
+
+    uint8_t* getBuffer() {
+      return _buffer;
+    }
+
+    void display() {
+      const uint8_t commands[] = { SSD1306_PAGEADDR, 0, 0xFF, SSD1306_COLUMNADDR, 0, (uint8_t)(WIDTH - 1) };
+      _wire->beginTransmission(_i2cAddress);
+      _wire->write((uint8_t)0x00);
+      _wire->write(commands, sizeof(commands));
+      _wire->endTransmission();
+
+      uint16_t count = WIDTH * HEIGHT / 8;
+      uint8_t* ptr = _buffer;
+      _wire->beginTransmission(_i2cAddress);
+      _wire->write((uint8_t)0x40);
+      uint16_t bytesOut = 1;
+      while (count--) {
+        if (bytesOut >= BUFFER_LENGTH) {
+          _wire->endTransmission();
+          _wire->beginTransmission(_i2cAddress);
+          _wire->write((uint8_t)0x40);
+          bytesOut = 1;
+        }
+        _wire->write(*ptr++);
+        bytesOut++;
+      }
+      _wire->endTransmission();
+    }
+
+    void ssd1306_command(uint8_t c) {
+      _wire->beginTransmission(_i2cAddress);
+      _wire->write((uint8_t)0x00);
+      _wire->write(c);
+      _wire->endTransmission();
+    }
+};
+
+#endif
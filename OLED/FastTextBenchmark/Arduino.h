@@ -0,0 +1,30 @@
+/**
+ * Just enough of Arduino.h for FastText.hpp to compile on a desktop
+ * computer. Only used by FastTextBenchmark.cpp; don't copy this into a
+ * sketch folder.
+ *
+ * By Jon E. Froehlich
+ * @jonfroehlich
+ * http://makeabilitylab.io
+ *
+ */
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include <algorithm>
+using std::min;
+using std::max;
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+// Desktop computers read constants from flash like any other memory
+#define PROGMEM
+#define pgm_read_byte(addr) (*(const uint8_t*)(addr))
+
+#endif
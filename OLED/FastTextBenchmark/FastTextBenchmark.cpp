@@ -0,0 +1,298 @@
+/**
+ * Checks FastText.hpp against Adafruit GFX's text drawing on a desktop
+ * computer (Linux or Mac) and measures what a status bar costs per frame.
+ * The stand-in Adafruit_GFX.h in this folder draws text the same way as the
+ * real library (a pixel at a time), with its own copy of glcdfont.c. It runs:
+ *
+ *  - Chars: each character at sizes 1, 2, and 4, at every y offset within a
+ *    page and partly off the screen, over a random background. The
+ *    framebuffer must match drawChar() on black (setTextColor(WHITE, BLACK))
+ *    and, for transparent text, drawChar() with no background
+ *  - Transparent: TextField::draw() of a transparent field over a random
+ *    background must only add the text's white pixels
+ *  - Numbers: TextField::draw() of random ints and floats (0 - 4 decimals)
+ *    must match print(), including where right and center alignment put them
+ *  - Update: a random series of TextField::update() calls, with text that
+ *    changes length, doesn't fit, or only changes a digit. After each one,
+ *    the framebuffer must match erasing the field and printing the text,
+ *    and nothing outside the field may change
+ *  - Time: a "XX.XX fps" status bar drawn with getTextBounds() and print()
+ *    (like our sketches), with TextField::draw(), and with TextField::update().
+ *    Reports the drawing calls into the SSD1306 library per frame (a few
+ *    microseconds each on an Arduino) and the time per frame on this
+ *    computer, which is only useful for comparing the three
+ *
+ * The header is included straight from its sketch folder, so the results are
+ * for the exact code that runs on the Arduino. It prints PASS or FAIL for each
+ * check and exits with 1 if any failed.
+ *
+ * To build and run (from this folder):
+ *  g++ -std=c++11 -O2 -I. FastTextBenchmark.cpp -o FastTextBenchmark
+ *  ./FastTextBenchmark
+ *
+ * By Jon E. Froehlich
+ * @jonfroehlich
+ * http://makeabilitylab.io
+ *
+ */
+#include <Arduino.h>  // the host stand-ins in this folder (needs -I.)
+#include <Wire.h>
+
+#include "../CollisionTest/FastText.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <random>
+
+TwoWire Wire;
+
+const int SCREEN_WIDTH = 128;
+const int SCREEN_HEIGHT = 64;
+const int BUFFER_SIZE = SCREEN_WIDTH * SCREEN_HEIGHT / 8;
+const int NUM_TIMING_FRAMES = 100000;
+
+int _numFailures = 0;
+std::mt19937 _rng(7);
+
+void check(bool passed, const char* name) {
+  printf("%-11s %s\n", name, passed ? "PASS" : "FAIL");
+  if (!passed) {
+    _numFailures++;
+  }
+}
+
+int randomInt(int lo, int hi) {
+  return std::uniform_int_distribution<int>(lo, hi)(_rng);
+}
+
+void fillRandom(Adafruit_SSD1306& display) {
+  uint8_t* buffer = display.getBuffer();
+  for (int i = 0; i < BUFFER_SIZE; i++) {
+    buffer[i] = randomInt(0, 255);
+  }
+}
+
+// Creates a display like a sketch's: begun, with white on black text
+Adafruit_SSD1306* createDisplay() {
+  Adafruit_SSD1306* display = new Adafruit_SSD1306(SCREEN_WIDTH, SCREEN_HEIGHT, &Wire);
+  display->begin(SSD1306_SWITCHCAPVCC, 0x3D);
+  display->setTextColor(SSD1306_WHITE, SSD1306_BLACK);
+  display->setTextWrap(false);
+  return display;
+}
+
+bool buffersMatch(Adafruit_SSD1306& a, Adafruit_SSD1306& b) {
+  return memcmp(a.getBuffer(), b.getBuffer(), BUFFER_SIZE) == 0;
+}
+
+void checkChars(Adafruit_SSD1306& fast, Adafruit_SSD1306& gfx) {
+  const uint8_t sizes[] = { 1, 2, 4 };
+  bool passed = true;
+  for (int transparent = 0; transparent < 2; transparent++) {
+    // With no background, the real library draws the text color as the background
+    uint16_t bg = transparent ? SSD1306_WHITE : SSD1306_BLACK;
+    for (uint8_t size : sizes) {
+      for (int c = ' '; c <= '~'; c++) {
+        for (int y = -8 * size + 1; y < 16; y++) {
+          int x = y % 3 == 0 ? -3 * size : (y * 7 + c) % SCREEN_WIDTH;
+          fillRandom(fast);
+          memcpy(gfx.getBuffer(), fast.getBuffer(), BUFFER_SIZE);
+          FastText::drawChar(fast, x, y, c, size, transparent);
+          gfx.drawChar(x, y, c, SSD1306_WHITE, bg, size);
+          passed = passed && buffersMatch(fast, gfx);
+        }
+      }
+    }
+  }
+
+  // At the bottom and right edges
+  for (int c = ' '; c <= '~'; c++) {
+    fillRandom(fast);
+    memcpy(gfx.getBuffer(), fast.getBuffer(), BUFFER_SIZE);
+    FastText::drawChar(fast, SCREEN_WIDTH - 4, SCREEN_HEIGHT - 5, c, 1);
+    gfx.drawChar(SCREEN_WIDTH - 4, SCREEN_HEIGHT - 5, c, SSD1306_WHITE, SSD1306_BLACK, 1);
+    passed = passed && buffersMatch(fast, gfx);
+  }
+  check(passed, "Chars");
+}
+
+// Where print() would have to start for text to be aligned in field
+int16_t getAlignedX(Adafruit_SSD1306& gfx, const TextField& field, TextAlign align, const char* text, uint8_t size) {
+  int16_t x1, y1;
+  uint16_t w, h;
+  gfx.setTextSize(size);
+  gfx.getTextBounds(text, 0, 0, &x1, &y1, &w, &h);
+  int16_t space = field.getWidth() - w;
+  return field.getX() + (align == TEXT_ALIGN_RIGHT ? space : align == TEXT_ALIGN_CENTER ? space / 2 : 0);
+}
+
+void checkNumbers(Adafruit_SSD1306& fast, Adafruit_SSD1306& gfx) {
+  const TextAlign aligns[] = { TEXT_ALIGN_LEFT, TEXT_ALIGN_CENTER, TEXT_ALIGN_RIGHT };
+  // long is 32 bits on an Arduino (but may be 64 here)
+  const long extremes[] = { 0, -1, 9, -9, 10, INT32_MAX, INT32_MIN };
+  bool passed = true;
+  for (int i = 0; i < 20000; i++) {
+    TextAlign align = aligns[i % 3];
+    uint8_t size = i % 5 == 0 ? 2 : 1;
+    int16_t y = randomInt(-4, 40);
+    TextField field(randomInt(0, 20), y, 12, align, size);
+
+    fast.clearDisplay();
+    gfx.clearDisplay();
+    char text[24];
+    gfx.setTextSize(size);
+    if (i % 2 == 0) {
+      long value = i < 14 ? extremes[i / 2] : (long)((int32_t)_rng() >> randomInt(0, 31));
+      snprintf(text, sizeof(text), "%ld", value);
+      field.draw(fast, value);
+      gfx.setCursor(getAlignedX(gfx, field, align, text, size), y);
+      gfx.print(value);
+    } else {
+      float value = std::uniform_real_distribution<float>(-1000, 1000)(_rng) / (1 << randomInt(0, 10));
+      uint8_t decimals = randomInt(0, 4);
+      field.draw(fast, value, decimals);
+
+      // Print once to find how long the text is, then again where the field puts it
+      gfx.setCursor(0, y);
+      gfx.print(value, decimals);
+      int numChars = gfx.getCursorX() / (6 * size);
+      gfx.clearDisplay();
+      memset(text, 'X', numChars);
+      text[numChars] = '\0';
+      gfx.setCursor(getAlignedX(gfx, field, align, text, size), y);
+      gfx.print(value, decimals);
+    }
+    passed = passed && buffersMatch(fast, gfx);
+  }
+  check(passed, "Numbers");
+}
+
+void checkTransparent(Adafruit_SSD1306& fast, Adafruit_SSD1306& gfx) {
+  const TextAlign aligns[] = { TEXT_ALIGN_LEFT, TEXT_ALIGN_CENTER, TEXT_ALIGN_RIGHT };
+  bool passed = true;
+  for (int i = 0; i < 3000; i++) {
+    TextAlign align = aligns[i % 3];
+    uint8_t size = i % 4 == 3 ? 2 : 1;
+    int16_t y = randomInt(-4, 40);
+    TextField field(randomInt(0, 20), y, 8, align, size, true);
+
+    fillRandom(fast);
+    memcpy(gfx.getBuffer(), fast.getBuffer(), BUFFER_SIZE);
+    long value = randomInt(-9999999, 9999999);
+    char text[24];
+    snprintf(text, sizeof(text), "%ld", value);
+    field.draw(fast, value);
+    gfx.setTextSize(size);
+    gfx.setTextColor(SSD1306_WHITE);
+    gfx.setCursor(getAlignedX(gfx, field, align, text, size), y);
+    gfx.print(text);
+    gfx.setTextColor(SSD1306_WHITE, SSD1306_BLACK);
+    passed = passed && buffersMatch(fast, gfx);
+  }
+  check(passed, "Transparent");
+}
+
+void checkUpdate(Adafruit_SSD1306& fast, Adafruit_SSD1306& gfx) {
+  const TextAlign aligns[] = { TEXT_ALIGN_LEFT, TEXT_ALIGN_CENTER, TEXT_ALIGN_RIGHT };
+  bool passed = true;
+  for (int run = 0; run < 30; run++) {
+    TextAlign align = aligns[run % 3];
+    uint8_t size = run % 4 == 3 ? 2 : 1;
+    int16_t x = randomInt(0, 30), y = randomInt(0, 40);
+    uint8_t numChars = randomInt(3, 8);
+    TextField field(x, y, numChars, align, size);
+
+    fillRandom(fast);
+    Adafruit_SSD1306* background = createDisplay();
+    memcpy(background->getBuffer(), fast.getBuffer(), BUFFER_SIZE);
+
+    long value = randomInt(0, 1000);
+    for (int i = 0; i < 300; i++) {
+      switch (randomInt(0, 4)) {
+        case 0: value += 1; break;                         // just the last digit (usually)
+        case 1: value = -value; break;                     // longer or shorter
+        case 2: value = randomInt(-99999999, 99999999); break;  // may not fit
+        default: value += randomInt(-50, 50); break;
+      }
+      field.update(fast, value);
+
+      // Erase the field in the background and print the text there
+      char text[24];
+      snprintf(text, sizeof(text), "%ld", value);
+      if ((int)strlen(text) > numChars) {
+        memset(text, '*', numChars);
+        text[numChars] = '\0';
+      }
+      memcpy(gfx.getBuffer(), background->getBuffer(), BUFFER_SIZE);
+      gfx.fillRect(field.getX(), field.getY(), field.getWidth(), field.getHeight(), SSD1306_BLACK);
+      gfx.setCursor(getAlignedX(gfx, field, align, text, size), y);
+      gfx.print(text);
+      passed = passed && buffersMatch(fast, gfx);
+    }
+    delete background;
+  }
+  check(passed, "Update");
+}
+
+float getFps(int frame) {
+  // Like calcFrameRate(): frames over a second or so, changing a digit or two each time
+  return 30.0f + 5 * sin(frame * 0.001) + (frame % 7) * 0.01f;
+}
+
+void timeStatusBars(Adafruit_SSD1306& display) {
+  TextField fpsField(SCREEN_WIDTH - FastText::getTextWidth(9), 0, 5, TEXT_ALIGN_RIGHT);
+  int16_t labelX = fpsField.getX() + fpsField.getWidth();
+
+  for (int method = 0; method < 3; method++) {
+    display.clearDisplay();
+    display.setTextSize(1);
+    if (method == 2) {
+      FastText::drawText(display, labelX, 0, " fps");
+    }
+
+    display.numDrawCalls = 0;
+    auto startTime = std::chrono::steady_clock::now();
+    for (int frame = 0; frame < NUM_TIMING_FRAMES; frame++) {
+      float fps = getFps(frame);
+      if (method == 0) {
+        int16_t x1, y1;
+        uint16_t w, h;
+        display.getTextBounds("XX.XX fps", 0, 0, &x1, &y1, &w, &h);
+        display.setCursor(display.width() - w, 0);
+        display.print(fps);
+        display.print(" fps");
+      } else if (method == 1) {
+        fpsField.draw(display, fps);
+        FastText::drawText(display, labelX, 0, " fps");
+      } else {
+        fpsField.update(display, fps);
+      }
+    }
+    double elapsedUs = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - startTime).count();
+
+    const char* names[] = { "getTextBounds + print", "TextField::draw", "TextField::update" };
+    printf("Time        %-22s %7.2f draw calls/frame %7.3f us/frame\n", names[method],
+           display.numDrawCalls / (double)NUM_TIMING_FRAMES, elapsedUs / NUM_TIMING_FRAMES);
+  }
+}
+
+int main() {
+  Adafruit_SSD1306* fast = createDisplay();
+  Adafruit_SSD1306* gfx = createDisplay();
+
+  checkChars(*fast, *gfx);
+  checkNumbers(*fast, *gfx);
+  checkTransparent(*fast, *gfx);
+  checkUpdate(*fast, *gfx);
+  timeStatusBars(*gfx);
+
+  delete fast;
+  delete gfx;
+
+  if (_numFailures > 0) {
+    printf("%d checks FAILED\n", _numFailures);
+    return 1;
+  }
+  printf("All checks passed\n");
+  return 0;
+}
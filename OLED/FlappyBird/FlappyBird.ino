@@ -19,6 +19,9 @@
  * Code based on:
  * https://makeabilitylab.github.io/p5js/Games/FlappyBird
  * https://makeabilitylab.github.io/p5js/Games/FlappyBird2
+ *
+ * The bird and pipes move every GAME_STEP_MS using GameLoop.hpp (in this
+ * folder), so the game plays at the same speed however long drawing takes.
  *  
  * By Jon E. Froehlich
  * @jonfroehlich
@@ -31,6 +34,7 @@
 
 #include <Adafruit_GFX.h>
 #include <Adafruit_SSD1306.h>
+#include "GameLoop.hpp"
 
 #define SCREEN_WIDTH 128 // OLED _display width, in pixels
 #define SCREEN_HEIGHT 64 // OLED _display height, in pixels
@@ -50,14 +54,15 @@ const int FLAP_BUTTON_INPUT_PIN = 4;
 const int TONE_OUTPUT_PIN = 8;
 const int VIBROMOTOR_OUTPUT_PIN = 9;
 
-// for tracking fps
-unsigned long _frameCount = 0;
-float _fps = 0;
-unsigned long _fpsStartTimeStamp = 0;
+// The game moves every GAME_STEP_MS (about 30 times a second)
+const int GAME_STEP_MS = 33;
+GameLoop _gameLoop(GAME_STEP_MS);
+
+// Print frame-time stats over Serial this often (0 for never)
+const unsigned long PRINT_FRAME_STATS_MS = 0;
 
 // status bar
 const boolean _drawFrameCount = false; // change to show/hide frame count
-const int DELAY_LOOP_MS = 5;
 const int LOAD_SCREEN_SHOW_MS = 750;
 
 class Bird : public Rectangle {
@@ -156,30 +161,53 @@ void setup() {
   // Setup pipes
   initializeGameEntities();
 
-  _fpsStartTimeStamp = millis();
+  _gameLoop.begin();
 }
 
 void loop() {
+  while (_gameLoop.step()) {
+    if (_gameState == NEW_GAME || _gameState == GAME_OVER) {
+      nonGamePlayLoop();
+    } else if (_gameState == PLAYING) {
+      gamePlayLoop();
+    }
+  }
 
-  _display.clearDisplay();
+  if (_gameLoop.shouldDraw()) {
+    _display.clearDisplay();
+
+    drawStatusBar();
+    drawGame();
 
-  drawStatusBar();
-  if (_gameState == NEW_GAME || _gameState == GAME_OVER) {
-    nonGamePlayLoop();
-  } else if (_gameState == PLAYING) {
-    gamePlayLoop();
+    // Draw the display buffer to the screen
+    _display.display();
+    _gameLoop.endDraw();
   }
-  calcFrameRate();
 
-  // Draw the display buffer to the screen
-  _display.display();
+  _gameLoop.printStatsEvery(Serial, PRINT_FRAME_STATS_MS);
+}
 
-  if (DELAY_LOOP_MS > 0) {
-    delay(DELAY_LOOP_MS);
+void nonGamePlayLoop() {
+  int flapButtonVal = digitalRead(FLAP_BUTTON_INPUT_PIN);
+  if (_gameState == NEW_GAME) {
+    if (flapButtonVal == LOW) {
+      _gameState = PLAYING;
+    }
+  } else if (_gameState == GAME_OVER) {
+    // We ignore input a bit after game over so that user can see end game screen
+    // and not accidentally start a new game
+    if (flapButtonVal == LOW && millis() - _gameOverTimestamp >= IGNORE_INPUT_AFTER_GAME_OVER_MS) {
+      // if the current state is game over, need to reset
+      initializeGameEntities();
+      _gameState = PLAYING;
+    }
   }
 }
 
-void nonGamePlayLoop() {
+/**
+ * Draws the pipes, the bird, and (if we're not playing) the new game or game over text
+ */
+void drawGame() {
   for (int i = 0; i < NUM_PIPES; i++) {
     _topPipes[i].draw(_display);
     _bottomPipes[i].draw(_display);
@@ -187,16 +215,10 @@ void nonGamePlayLoop() {
 
   int16_t x1, y1;
   uint16_t w, h;
-  int flapButtonVal = digitalRead(FLAP_BUTTON_INPUT_PIN);
   if (_gameState == NEW_GAME) {
-
     _display.getTextBounds(STR_PRESS_FLAP_TO_PLAY, 0, 0, &x1, &y1, &w, &h);
     _display.setCursor(_display.width() / 2 - w / 2, 15);
     _display.print(STR_PRESS_FLAP_TO_PLAY);
-
-    if (flapButtonVal == LOW) {
-      _gameState = PLAYING;
-    }
   } else if (_gameState == GAME_OVER) {
     _display.setTextSize(2);
     _display.getTextBounds(STR_GAME_OVER, 0, 0, &x1, &y1, &w, &h);
@@ -209,14 +231,6 @@ void nonGamePlayLoop() {
     _display.getTextBounds(STR_PRESS_FLAP_TO_PLAY, 0, 0, &x1, &y1, &w, &h);
     _display.setCursor(_display.width() / 2 - w / 2, yText);
     _display.print(STR_PRESS_FLAP_TO_PLAY);
-
-    // We ignore input a bit after game over so that user can see end game screen
-    // and not accidentally start a new game
-    if (flapButtonVal == LOW && millis() - _gameOverTimestamp >= IGNORE_INPUT_AFTER_GAME_OVER_MS) {
-      // if the current state is game over, need to reset
-      initializeGameEntities();
-      _gameState = PLAYING;
-    }
   }
 
   _bird.draw(_display);
@@ -274,11 +288,6 @@ void gamePlayLoop() {
     _topPipes[i].setX(_topPipes[i].getX() - _pipeSpeed);
     _bottomPipes[i].setX(_bottomPipes[i].getX() - _pipeSpeed);
 
-    _topPipes[i].draw(_display);
-    _bottomPipes[i].draw(_display);
-
-    Serial.println(_topPipes[i].toString());
-
     // Check if the bird passed by the pipe
     if (_topPipes[i].getRight() < _bird.getLeft()) {
 
@@ -342,8 +351,6 @@ void gamePlayLoop() {
       xMaxRight = _topPipes[i].getRight();
     }
   }
-
-  _bird.draw(_display);
 }
 
 
@@ -382,19 +389,6 @@ void showLoadScreen() {
 
 }
 
-/**
- * Call this every frame to calculate frame rate
- */
-void calcFrameRate() {
-  unsigned long elapsedTime = millis() - _fpsStartTimeStamp;
-  _frameCount++;
-  if (elapsedTime > 1000) {
-    _fps = _frameCount / (elapsedTime / 1000.0);
-    _fpsStartTimeStamp = millis();
-    _frameCount = 0;
-  }
-}
-
 /**
  * Draws the status bar at top of screen with points and fps
  */
@@ -410,7 +404,7 @@ void drawStatusBar() {
     uint16_t w, h;
     _display.getTextBounds("XX.XX fps", 0, 0, &x1, &y1, &w, &h);
     _display.setCursor(_display.width() - w, 0);
-    _display.print(_fps);
+    _display.print(_gameLoop.getFps());
     _display.print(" fps");
   }
 }
@@ -3,6 +3,12 @@
  * This program simply tests out the rendering speed of the OLED with
  * the Adafruit Gfx Library
  * 
+ * Set USE_PARTIAL_FLUSH to 1 to use PartialFlushSSD1306.hpp (in this folder),
+ * which only sends the parts of the screen that changed, or 0 to use
+ * Adafruit_SSD1306, which sends the whole screen every frame. Each frame
+ * redraws just the FPS text, so the difference is the time spent sending
+ * unchanged pixels over I2C.
+ * 
  * Adafruit Gfx Library:
  * https://learn.adafruit.com/adafruit-gfx-graphics-library/overview
  * 
@@ -23,12 +29,22 @@
 #include <Adafruit_GFX.h>
 #include <Adafruit_SSD1306.h>
 
+#define USE_PARTIAL_FLUSH 1
+
+#if USE_PARTIAL_FLUSH
+#include "PartialFlushSSD1306.hpp"
+#endif
+
 #define SCREEN_WIDTH 128 // OLED display width, in pixels
 #define SCREEN_HEIGHT 64 // OLED display height, in pixels
 
 // Declaration for an SSD1306 display connected to I2C (SDA, SCL pins)
 #define OLED_RESET     4 // Reset pin # (or -1 if sharing Arduino reset pin)
+#if USE_PARTIAL_FLUSH
+PartialFlushSSD1306 display(SCREEN_WIDTH, SCREEN_HEIGHT, &Wire, OLED_RESET);
+#else
 Adafruit_SSD1306 display(SCREEN_WIDTH, SCREEN_HEIGHT, &Wire, OLED_RESET);
+#endif
 
 unsigned long _totalFrameCount = 0;
 unsigned long _startTimeStamp = 0;
@@ -74,5 +90,13 @@ void loop() {
     display.print(fps);
   }
   display.display();
+
+#if USE_PARTIAL_FLUSH
+  // Should be just the FPS text's columns (~60 bytes) rather than 1024
+  if(_totalFrameCount % 100 == 0){
+    Serial.print("Bytes sent last frame: ");
+    Serial.println(display.getLastFlushBytes());
+  }
+#endif
   _totalFrameCount++;
 }
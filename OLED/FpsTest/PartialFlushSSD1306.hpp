@@ -0,0 +1,279 @@
+/**
+ * A drop-in replacement for Adafruit_SSD1306 (I2C only) whose display() sends
+ * just the parts of the framebuffer that changed, rather than all of it.
+ *
+ * Adafruit_SSD1306's display() sends the whole framebuffer (1 KB for a
+ * 128x64 display) over I2C every frame, which takes ~25 ms at 400 kHz and
+ * caps most of our OLED sketches at ~30 fps, even when only a small ball moved.
+ *
+ * The SSD1306 stores pixels in pages: each page is 8 rows tall and each byte
+ * is one column of 8 pixels in that page. This class keeps, for each page,
+ * the range of columns that changed since the last display() (the "dirty"
+ * range). Every drawing call goes through drawPixel(), drawFastHLine(), or
+ * drawFastVLine() (Adafruit_GFX builds circles, text, bitmaps, etc. on these),
+ * so we widen the dirty ranges there. display() then uses the SSD1306's page
+ * and column addressing to send only the dirty columns of the dirty pages.
+ *
+ * The catch is clearDisplay(): if it marked the whole screen dirty, we'd be
+ * back to sending everything each frame. Instead, we also keep the range of
+ * columns drawn in each page since the last clearDisplay(). Those are the only
+ * pixels that can be on, so they're the only ones clearDisplay() has to
+ * mark dirty. So, a frame that clears and redraws a ball sends just the
+ * ball's old and new positions.
+ *
+ * What's on the screen is always exactly what's in the framebuffer, the same
+ * as with Adafruit_SSD1306. If you change the framebuffer directly (e.g.,
+ * with getBuffer()), call markDirty() or markAllDirty() for the area you changed.
+ *
+ * Usage (just change the type of your display object):
+ *  PartialFlushSSD1306 _display(SCREEN_WIDTH, SCREEN_HEIGHT, &Wire, OLED_RESET);
+ *
+ *  loop(){
+ *    _display.clearDisplay();
+ *    _display.drawCircle(x, y, 5, SSD1306_WHITE);
+ *    _display.display();  // sends just the circle's old and new areas
+ *  }
+ *
+ * By Jon E. Froehlich
+ * @jonfroehlich
+ * http://makeabilitylab.io
+ *
+ */
+#ifndef PARTIAL_FLUSH_SSD1306_HPP
+#define PARTIAL_FLUSH_SSD1306_HPP
+
+#include <Arduino.h>
+#include <Wire.h>
+#include <Adafruit_GFX.h>
+#include <Adafruit_SSD1306.h>
+
+// The most bytes we can send per I2C transmission (the same as Adafruit_SSD1306)
+#if defined(I2C_BUFFER_LENGTH)
+#define PARTIAL_FLUSH_WIRE_MAX min(256, I2C_BUFFER_LENGTH)
+#elif defined(BUFFER_LENGTH)
+#define PARTIAL_FLUSH_WIRE_MAX min(256, BUFFER_LENGTH)
+#elif defined(SERIAL_BUFFER_SIZE)
+#define PARTIAL_FLUSH_WIRE_MAX min(255, SERIAL_BUFFER_SIZE - 1)
+#else
+#define PARTIAL_FLUSH_WIRE_MAX 32
+#endif
+
+class PartialFlushSSD1306 : public Adafruit_SSD1306{
+
+  public:
+    static const uint8_t MAX_PAGES = 8; // 64 rows / 8 rows per page
+
+  private:
+    static const uint8_t NO_COLUMN = 0xFF;
+
+    TwoWire* _wire;
+    uint8_t _i2cAddress;
+    uint32_t _wireClock;
+    uint32_t _restoreClock;
+
+    // For each page, the columns that changed since the last display() and the
+    // columns drawn since the last clearDisplay(). A range is empty if its
+    // min is NO_COLUMN
+    uint8_t _dirtyMin[MAX_PAGES];
+    uint8_t _dirtyMax[MAX_PAGES];
+    uint8_t _drawnMin[MAX_PAGES];
+    uint8_t _drawnMax[MAX_PAGES];
+
+    uint16_t _lastFlushBytes;
+
+    static void widen(uint8_t& rangeMin, uint8_t& rangeMax, uint8_t x1, uint8_t x2) {
+      if (rangeMin == NO_COLUMN) {
+        rangeMin = x1;
+        rangeMax = x2;
+        return;
+      }
+      if (x1 < rangeMin) {
+        rangeMin = x1;
+      }
+      if (x2 > rangeMax) {
+        rangeMax = x2;
+      }
+    }
+
+    void clearRanges(uint8_t* rangeMin) {
+      for (uint8_t page = 0; page < MAX_PAGES; page++) {
+        rangeMin[page] = NO_COLUMN;
+      }
+    }
+
+    void sendCommands(const uint8_t* commands, uint8_t numCommands) {
+      _wire->beginTransmission(_i2cAddress);
+      _wire->write((uint8_t)0x00); // Co = 0, D/C = 0: the rest are commands
+      _wire->write(commands, numCommands);
+      _wire->endTransmission();
+    }
+
+    void sendData(const uint8_t* data, uint16_t numBytes) {
+      while (numBytes > 0) {
+        uint16_t chunkBytes = min((uint16_t)(PARTIAL_FLUSH_WIRE_MAX - 1), numBytes);
+        _wire->beginTransmission(_i2cAddress);
+        _wire->write((uint8_t)0x40); // Co = 0, D/C = 1: the rest are data
+        _wire->write(data, chunkBytes);
+        _wire->endTransmission();
+        data += chunkBytes;
+        numBytes -= chunkBytes;
+      }
+    }
+
+  public:
+    /**
+     * Creates the display. The parameters are the same as Adafruit_SSD1306's I2C constructor
+     */
+    PartialFlushSSD1306(uint8_t w, uint8_t h, TwoWire* twi = &Wire, int8_t rstPin = -1,
+                        uint32_t clkDuring = 400000UL, uint32_t clkAfter = 100000UL)
+      : Adafruit_SSD1306(w, h, twi, rstPin, clkDuring, clkAfter),
+        _wire(twi), _i2cAddress(0), _wireClock(clkDuring), _restoreClock(clkAfter),
+        _lastFlushBytes(0) {
+      clearRanges(_dirtyMin);
+      clearRanges(_drawnMin);
+    }
+
+    /**
+     * Starts the display, just like Adafruit_SSD1306::begin(). Since we don't
+     * know what's on the screen yet, the first display() sends everything
+     */
+    bool begin(uint8_t switchvcc = SSD1306_SWITCHCAPVCC, uint8_t i2caddr = 0,
+               bool reset = true, bool periphBegin = true) {
+      // Adafruit_SSD1306 uses 0x3C for 128x32 displays and 0x3D otherwise
+      _i2cAddress = i2caddr != 0 ? i2caddr : (HEIGHT == 32 ? 0x3C : 0x3D);
+      if (!Adafruit_SSD1306::begin(switchvcc, i2caddr, reset, periphBegin)) {
+        return false;
+      }
+      markAllDirty();
+      return true;
+    }
+
+    void drawPixel(int16_t x, int16_t y, uint16_t color) override {
+      Adafruit_SSD1306::drawPixel(x, y, color);
+
+      // Text and bitmaps are drawn a pixel at a time, so skip the rotating
+      // and clipping in markDirty() for the usual case
+      if (getRotation() == 0 && x >= 0 && x < WIDTH && y >= 0 && y < HEIGHT) {
+        uint8_t page = y / 8;
+        widen(_dirtyMin[page], _dirtyMax[page], x, x);
+        widen(_drawnMin[page], _drawnMax[page], x, x);
+        return;
+      }
+      markDirty(x, y, 1, 1);
+    }
+
+    void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override {
+      Adafruit_SSD1306::drawFastHLine(x, y, w, color);
+      markDirty(x, y, w, 1);
+    }
+
+    void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override {
+      Adafruit_SSD1306::drawFastVLine(x, y, h, color);
+      markDirty(x, y, 1, h);
+    }
+
+    /**
+     * Clears the framebuffer, marking dirty only what was drawn since the last clear
+     */
+    void clearDisplay() {
+      Adafruit_SSD1306::clearDisplay();
+      for (uint8_t page = 0; page < MAX_PAGES; page++) {
+        if (_drawnMin[page] != NO_COLUMN) {
+          widen(_dirtyMin[page], _dirtyMax[page], _drawnMin[page], _drawnMax[page]);
+        }
+      }
+      clearRanges(_drawnMin);
+    }
+
+    /**
+     * Marks the rectangle (in the same rotated coordinates as drawing) as
+     * changed so the next display() sends it. You only need this if you
+     * change the framebuffer from getBuffer() directly
+     */
+    void markDirty(int16_t x, int16_t y, int16_t w, int16_t h) {
+      if (w <= 0 || h <= 0) {
+        return;
+      }
+
+      // Rotate to the SSD1306's own coordinates, like Adafruit_SSD1306::drawPixel
+      int16_t t;
+      switch (getRotation()) {
+        case 1:
+          t = x; x = WIDTH - y - h; y = t;
+          t = w; w = h; h = t;
+          break;
+        case 2:
+          x = WIDTH - x - w;
+          y = HEIGHT - y - h;
+          break;
+        case 3:
+          t = x; x = y; y = HEIGHT - t - w;
+          t = w; w = h; h = t;
+          break;
+      }
+
+      // Clip to the screen
+      int16_t x2 = x + w - 1;
+      int16_t y2 = y + h - 1;
+      if (x < 0) x = 0;
+      if (y < 0) y = 0;
+      if (x2 >= WIDTH) x2 = WIDTH - 1;
+      if (y2 >= HEIGHT) y2 = HEIGHT - 1;
+      if (x > x2 || y > y2) {
+        return;
+      }
+
+      for (uint8_t page = y / 8; page <= y2 / 8; page++) {
+        widen(_dirtyMin[page], _dirtyMax[page], x, x2);
+        widen(_drawnMin[page], _drawnMax[page], x, x2);
+      }
+    }
+
+    /**
+     * Marks the whole screen as changed so the next display() sends everything
+     */
+    void markAllDirty() {
+      markDirty(0, 0, width(), height());
+    }
+
+    /**
+     * Sends the changed parts of the framebuffer to the screen
+     */
+    void display() {
+      uint8_t* buffer = getBuffer();
+      _lastFlushBytes = 0;
+
+      _wire->setClock(_wireClock);
+      for (uint8_t page = 0; page < HEIGHT / 8; page++) {
+        if (_dirtyMin[page] == NO_COLUMN) {
+          continue;
+        }
+
+        // Send to just this page's dirty columns. In horizontal addressing
+        // mode (set up by begin()), the data fills that range
+        uint8_t firstColumn = _dirtyMin[page];
+        uint8_t lastColumn = _dirtyMax[page];
+        const uint8_t commands[] = {
+          SSD1306_PAGEADDR, page, page,
+          SSD1306_COLUMNADDR, firstColumn, lastColumn
+        };
+        sendCommands(commands, sizeof(commands));
+
+        uint16_t numBytes = lastColumn - firstColumn + 1;
+        sendData(buffer + page * WIDTH + firstColumn, numBytes);
+        _lastFlushBytes += numBytes;
+        _dirtyMin[page] = NO_COLUMN;
+      }
+      _wire->setClock(_restoreClock);
+    }
+
+    /**
+     * Returns the number of framebuffer bytes the last display() sent
+     * (WIDTH * HEIGHT / 8 for a full update, e.g., 1024 for 128x64)
+     */
+    uint16_t getLastFlushBytes() const {
+      return _lastFlushBytes;
+    }
+};
+
+#endif
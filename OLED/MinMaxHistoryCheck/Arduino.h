@@ -0,0 +1,17 @@
+/**
+ * Just enough of Arduino.h for MinMaxHistory.hpp to compile on a desktop
+ * computer. Only used by MinMaxHistoryCheck.cpp; don't copy this into a
+ * sketch folder.
+ *
+ * By Jon E. Froehlich
+ * @jonfroehlich
+ * http://makeabilitylab.io
+ *
+ */
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#endif
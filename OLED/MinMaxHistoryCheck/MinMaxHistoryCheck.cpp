@@ -0,0 +1,139 @@
+/**
+ * Checks MinMaxHistory.hpp on a desktop computer (Linux or Mac) against a
+ * brute-force summary of every sample added. Each time add() finishes a
+ * column, it recomputes every column of every level from the samples (the
+ * min, max, and mean, rounded toward 0 like the header, of each run of
+ * getSamplesPerColumn(level) samples) and compares them all, along with
+ * getNumColumns() and add()'s return value. It runs:
+ *
+ *  - Random: random samples from 0 to 1023, like analogRead
+ *  - Spike: a single 1023 among 0s shows up as the max of the column it's
+ *    in at every level, however many samples the column covers
+ *  - Negative: samples from -1000 to 1000, so the means round toward 0
+ *  - Reset: reset() in the middle forgets everything, including the
+ *    columns in progress
+ *
+ * Each runs for several shapes of history: the AnalogGraphHistory sketch's
+ * (128 columns, 3 levels, ZoomFactor 4), more samples per column, a
+ * ZoomFactor of 2 and 3, one level, one column, and 255 columns.
+ *
+ * The header is included straight from AnalogGraphHistory, so the results
+ * are for the exact code that runs on the Arduino. It prints PASS or FAIL for
+ * each check and exits with 1 if any failed.
+ *
+ * To build and run (from this folder):
+ *  g++ -std=c++11 -O2 -I. MinMaxHistoryCheck.cpp -o MinMaxHistoryCheck
+ *  ./MinMaxHistoryCheck
+ *
+ * By Jon E. Froehlich
+ * @jonfroehlich
+ * http://makeabilitylab.io
+ *
+ */
+#include <Arduino.h>  // the host stand-in in this folder (needs -I.)
+
+#include "../AnalogGraphHistory/MinMaxHistory.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <functional>
+#include <random>
+#include <vector>
+
+int _numFailures = 0;
+std::mt19937 _rng(18);
+
+void check(bool passed, const char* name) {
+  printf("%-9s %s\n", name, passed ? "PASS" : "FAIL");
+  if (!passed) {
+    _numFailures++;
+  }
+}
+
+// Compares every column of history with the ones computed from samples
+template<typename History>
+bool matchesSamples(const History& history, const std::vector<int>& samples) {
+  bool passed = true;
+  for (uint8_t level = 0; level < History::getNumLevels() && passed; level++) {
+    long samplesPerColumn = history.getSamplesPerColumn(level);
+    long numFinished = samples.size() / samplesPerColumn;
+    long expectedColumns = std::min(numFinished, (long)History::getCapacity());
+    passed = history.getNumColumns(level) == expectedColumns;
+
+    for (long age = 0; age < expectedColumns && passed; age++) {
+      // The column age columns old covers these samples
+      auto end = samples.begin() + (numFinished - age) * samplesPerColumn;
+      auto start = end - samplesPerColumn;
+      long sum = 0;
+      for (auto it = start; it != end; ++it) {
+        sum += *it;
+      }
+      HistoryColumn column = history.getColumn(level, age);
+      passed = column.min == *std::min_element(start, end) && column.max == *std::max_element(start, end) &&
+               column.mean == sum / samplesPerColumn;
+    }
+  }
+  return passed;
+}
+
+// The number of levels that finish a column with the numSamples-th sample
+template<typename History>
+uint8_t expectedLevels(const History& history, long numSamples) {
+  uint8_t levels = 0;
+  while (levels < History::getNumLevels() && numSamples % history.getSamplesPerColumn(levels) == 0) {
+    levels++;
+  }
+  return levels;
+}
+
+// Adds numSamples samples from next(i), checking the whole history each
+// time a column finishes. If resetAt >= 0, resets after that many samples
+template<uint8_t NumColumns, uint8_t NumLevels, uint8_t ZoomFactor>
+bool runHistory(uint16_t samplesPerColumn, const std::function<int(long)>& next, long resetAt = -1) {
+  typedef MinMaxHistory<NumColumns, NumLevels, ZoomFactor> History;
+  History history(samplesPerColumn);
+
+  // Enough samples to fill every level twice over
+  long numSamples = 2 * NumColumns * history.getSamplesPerColumn(NumLevels - 1) + 7;
+  std::vector<int> samples;
+  bool passed = history.getNumColumns(0) == 0;
+  for (long i = 0; i < numSamples && passed; i++) {
+    if (i == resetAt) {
+      history.reset();
+      samples.clear();
+      passed = matchesSamples(history, samples);
+    }
+    samples.push_back(next(i));
+    uint8_t numLevels = history.add(samples.back());
+    passed = passed && numLevels == expectedLevels(history, samples.size());
+    if (numLevels > 0) {
+      passed = passed && matchesSamples(history, samples);
+    }
+  }
+  return passed;
+}
+
+bool runShapes(const std::function<int(long)>& next, long resetAt = -1) {
+  bool passed = runHistory<128, 3, 4>(1, next, resetAt);
+  passed = runHistory<32, 3, 4>(5, next, resetAt) && passed;
+  passed = runHistory<16, 5, 2>(3, next, resetAt) && passed;
+  passed = runHistory<20, 4, 3>(1, next, resetAt) && passed;
+  passed = runHistory<40, 1, 4>(2, next, resetAt) && passed;
+  passed = runHistory<1, 4, 4>(1, next, resetAt) && passed;
+  passed = runHistory<255, 2, 4>(1, next, resetAt) && passed;
+  return passed;
+}
+
+int main() {
+  check(runShapes([](long /* i */){ return (int)(_rng() % 1024); }), "Random");
+  check(runShapes([](long i){ return i % 1009 == 500 ? 1023 : 0; }), "Spike");
+  check(runShapes([](long /* i */){ return (int)(_rng() % 2001) - 1000; }), "Negative");
+  check(runShapes([](long /* i */){ return (int)(_rng() % 1024); }, 333), "Reset");
+
+  if (_numFailures > 0) {
+    printf("%d checks FAILED\n", _numFailures);
+    return 1;
+  }
+  printf("All checks passed\n");
+  return 0;
+}
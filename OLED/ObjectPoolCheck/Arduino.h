@@ -0,0 +1,35 @@
+/**
+ * Just enough of Arduino.h for ObjectPool.hpp to compile on a desktop
+ * computer, with a Print that keeps what's printed in a string. Only used
+ * by ObjectPoolCheck.cpp; don't copy this into a sketch folder.
+ *
+ * By Jon E. Froehlich
+ * @jonfroehlich
+ * http://makeabilitylab.io
+ *
+ */
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <string>
+
+class __FlashStringHelper;
+#define F(text) (reinterpret_cast<const __FlashStringHelper*>(text))
+
+class Print{
+
+  public:
+    std::string text;
+
+    size_t print(const char* str) { text += str; return strlen(str); }
+    size_t print(const __FlashStringHelper* str) { return print(reinterpret_cast<const char*>(str)); }
+    size_t print(int n) { return print(std::to_string(n).c_str()); }
+    size_t print(unsigned long n) { return print(std::to_string(n).c_str()); }
+    size_t println(const __FlashStringHelper* str) { return print(str) + print("\r\n"); }
+};
+
+#endif
@@ -0,0 +1,199 @@
+/**
+ * Checks ObjectPool.hpp on a desktop computer (Linux or Mac). It runs:
+ *
+ *  - Acquire: fills a pool, each object in its own slot, then acquire()
+ *    returns NULL when it's full
+ *  - Release: release() calls the (virtual) destructor and frees the slot for
+ *    the next acquire(), and refuses objects that aren't in use in the pool
+ *  - Subclass: a pool of a base class holds two subclasses of different
+ *    sizes (like Balls and Rectangles in a pool of Shapes), and virtual
+ *    functions work on them
+ *  - Churn: 100,000 random acquires and releases, checking the count, the
+ *    high-water mark, and that no two objects in use share a slot or
+ *    overwrite each other
+ *  - Report: printReport()'s output
+ *
+ * The header is included straight from CollisionTest, so the results are
+ * for the exact code that runs on the Arduino. It prints PASS or FAIL for
+ * each check and exits with 1 if any failed.
+ *
+ * To build and run (from this folder):
+ *  g++ -std=c++11 -O2 -I. ObjectPoolCheck.cpp -o ObjectPoolCheck
+ *  ./ObjectPoolCheck
+ *
+ * By Jon E. Froehlich
+ * @jonfroehlich
+ * http://makeabilitylab.io
+ *
+ */
+#include <Arduino.h>  // the host stand-in in this folder (needs -I.)
+
+#include "../CollisionTest/ObjectPool.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <random>
+#include <set>
+#include <vector>
+
+int _numFailures = 0;
+int _numDestroyed = 0;
+std::mt19937 _rng(5);
+
+void check(bool passed, const char* name) {
+  printf("%-10s %s\n", name, passed ? "PASS" : "FAIL");
+  if (!passed) {
+    _numFailures++;
+  }
+}
+
+// Stand-ins for Shape, Rectangle, and Ball: a base class with a virtual
+// destructor and two subclasses of different sizes
+class TestShape{
+
+  public:
+    int x, y;
+
+    TestShape(int x, int y) : x(x), y(y) {}
+    virtual ~TestShape() { _numDestroyed++; }
+    virtual int getArea() const { return 0; }
+};
+
+class TestRectangle : public TestShape{
+
+  public:
+    int width, height;
+
+    TestRectangle(int x, int y, int width, int height) : TestShape(x, y), width(width), height(height) {}
+    int getArea() const override { return width * height; }
+};
+
+class TestBall : public TestRectangle{
+
+  public:
+    int xSpeed, ySpeed;
+
+    TestBall(int x, int y, int radius) : TestRectangle(x - radius, y - radius, 2 * radius, 2 * radius),
+                                         xSpeed(1), ySpeed(-1) {}
+    int getArea() const override { return 3 * width * width / 4; }
+};
+
+const size_t TEST_SHAPE_SIZE = sizeof(TestBall) > sizeof(TestRectangle) ? sizeof(TestBall) : sizeof(TestRectangle);
+
+void checkAcquire() {
+  ObjectPool<TestRectangle, 5> pool;
+  std::set<TestRectangle*> objects;
+  bool passed = pool.getCount() == 0 && pool.getCapacity() == 5 && pool.getHighWater() == 0;
+  for (int i = 0; i < 5; i++) {
+    TestRectangle* rectangle = pool.acquire(i, 2 * i, 3, 4);
+    passed = passed && rectangle != NULL && rectangle->x == i && rectangle->y == 2 * i &&
+             rectangle->getArea() == 12 && pool.contains(rectangle);
+    objects.insert(rectangle);
+  }
+  passed = passed && objects.size() == 5 && pool.acquire(0, 0, 1, 1) == NULL &&
+           pool.getCount() == 5 && pool.getHighWater() == 5;
+  check(passed, "Acquire");
+}
+
+void checkRelease() {
+  ObjectPool<TestRectangle, 3> pool;
+  TestRectangle* a = pool.acquire(1, 1, 1, 1);
+  TestRectangle* b = pool.acquire(2, 2, 2, 2);
+  pool.acquire(3, 3, 3, 3);
+
+  _numDestroyed = 0;
+  bool passed = pool.release(b) && _numDestroyed == 1 && pool.getCount() == 2 && !pool.contains(b);
+
+  // The freed slot is the next one used
+  TestRectangle* c = pool.acquire(4, 4, 4, 4);
+  passed = passed && c == b && c->x == 4 && pool.getHighWater() == 3;
+
+  // Releasing twice, or something that isn't from the pool, does nothing
+  TestRectangle outside(0, 0, 1, 1);
+  TestRectangle* inside = reinterpret_cast<TestRectangle*>(reinterpret_cast<uint8_t*>(a) + 1);
+  _numDestroyed = 0;
+  passed = passed && pool.release(a) && !pool.release(a) && !pool.release(&outside) &&
+           !pool.release(inside) && !pool.release(NULL) && _numDestroyed == 1 && pool.getCount() == 2;
+
+  pool.resetHighWater();
+  passed = passed && pool.getHighWater() == 2;
+  check(passed, "Release");
+}
+
+void checkSubclasses() {
+  ObjectPool<TestShape, 4, TEST_SHAPE_SIZE> pool;
+  TestShape* ball = pool.acquire<TestBall>(10, 10, 2);
+  TestShape* rectangle = pool.acquire<TestRectangle>(0, 0, 3, 5);
+  TestShape* shape = pool.acquire(7, 8);
+
+  bool passed = ball->getArea() == 12 && rectangle->getArea() == 15 && shape->getArea() == 0 &&
+                ball->x == 8 && static_cast<TestBall*>(ball)->ySpeed == -1 &&
+                ObjectPool<TestShape, 4, TEST_SHAPE_SIZE>::SLOT_SIZE >= sizeof(TestBall);
+
+  // release() on a TestShape* runs the subclass's destructor too
+  _numDestroyed = 0;
+  passed = passed && pool.release(ball) && _numDestroyed == 1;
+  TestShape* ball2 = pool.acquire<TestBall>(20, 20, 3);
+  passed = passed && ball2 == ball && ball2->getArea() == 27 && rectangle->getArea() == 15;
+  check(passed, "Subclass");
+}
+
+void checkChurn() {
+  const int capacity = 40;
+  ObjectPool<TestShape, capacity, TEST_SHAPE_SIZE> pool;
+  std::vector<TestShape*> inUse;
+  int highWater = 0;
+  bool passed = true;
+  for (int i = 0; i < 100000; i++) {
+    bool isAcquiring = inUse.empty() || (_rng() % 100 < 52 && (int)inUse.size() < capacity);
+    if (isAcquiring) {
+      TestShape* shape = _rng() % 2 == 0 ? pool.acquire<TestBall>(i, i, 4)
+                                         : pool.acquire<TestRectangle>(i, -i, 2, 3);
+      passed = passed && shape != NULL;
+      inUse.push_back(shape);
+    } else {
+      size_t index = _rng() % inUse.size();
+      passed = passed && pool.release(inUse[index]);
+      inUse.erase(inUse.begin() + index);
+    }
+    highWater = std::max(highWater, (int)inUse.size());
+  }
+
+  // Each object kept its own values, so none shared a slot
+  std::set<TestShape*> unique(inUse.begin(), inUse.end());
+  for (TestShape* shape : inUse) {
+    passed = passed && pool.contains(shape) && (shape->y == shape->x || shape->y == -shape->x);
+  }
+  passed = passed && unique.size() == inUse.size() && pool.getCount() == inUse.size() &&
+           pool.getHighWater() == highWater;
+  check(passed, "Churn");
+}
+
+void checkReport() {
+  ObjectPool<TestRectangle, 6> pool;
+  pool.acquire(0, 0, 1, 1);
+  pool.release(pool.acquire(0, 0, 1, 1));
+
+  Print out;
+  pool.printReport(out, F("Rectangles"));
+  size_t slotSize = ObjectPool<TestRectangle, 6>::SLOT_SIZE;
+  std::string expected = "Rectangles: 1 of 6 used (high water 2), " + std::to_string(slotSize) +
+                         " bytes each, " + std::to_string(6 * slotSize) + " bytes\r\n";
+  check(out.text == expected, "Report");
+  printf("%s", out.text.c_str());
+}
+
+int main() {
+  checkAcquire();
+  checkRelease();
+  checkSubclasses();
+  checkChurn();
+  checkReport();
+
+  if (_numFailures > 0) {
+    printf("%d checks FAILED\n", _numFailures);
+    return 1;
+  }
+  printf("All checks passed\n");
+  return 0;
+}
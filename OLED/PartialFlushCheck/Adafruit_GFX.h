@@ -0,0 +1,115 @@
+/**
+ * A stand-in for the Adafruit GFX library with just the shapes that
+ * PartialFlushCheck.cpp draws. Like the real library, every shape is drawn
+ * with the virtual drawPixel(), drawFastHLine(), and drawFastVLine(), which
+ * is what PartialFlushSSD1306 relies on. Only used by PartialFlushCheck.cpp.
+ *
+ * By Jon E. Froehlich
+ * @jonfroehlich
+ * http://makeabilitylab.io
+ *
+ */
+#ifndef HOST_ADAFRUIT_GFX_H
+#define HOST_ADAFRUIT_GFX_H
+
+#include <Arduino.h>
+
+class Adafruit_GFX{
+
+  protected:
+    const int16_t WIDTH, HEIGHT;  // the display's size without rotation
+    int16_t _width, _height;      // the display's size with rotation
+    uint8_t rotation;
+
+  public:
+    Adafruit_GFX(int16_t w, int16_t h)
+      : WIDTH(w), HEIGHT(h), _width(w), _height(h), rotation(0) {
+    }
+
+    virtual ~Adafruit_GFX() {}
+
+    virtual void drawPixel(int16_t x, int16_t y, uint16_t color) = 0;
+
+    virtual void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+      for (int16_t i = 0; i < h; i++) {
+        drawPixel(x, y + i, color);
+      }
+    }
+
+    virtual void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+      for (int16_t i = 0; i < w; i++) {
+        drawPixel(x + i, y, color);
+      }
+    }
+
+    virtual void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+      for (int16_t i = x; i < x + w; i++) {
+        drawFastVLine(i, y, h, color);
+      }
+    }
+
+    virtual void fillScreen(uint16_t color) {
+      fillRect(0, 0, _width, _height, color);
+    }
+
+    void drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+      drawFastHLine(x, y, w, color);
+      drawFastHLine(x, y + h - 1, w, color);
+      drawFastVLine(x, y, h, color);
+      drawFastVLine(x + w - 1, y, h, color);
+    }
+
+    void drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) {
+      int16_t dx = abs(x1 - x0), sx = x0 < x1 ? 1 : -1;
+      int16_t dy = -abs(y1 - y0), sy = y0 < y1 ? 1 : -1;
+      int16_t err = dx + dy;
+      while (true) {
+        drawPixel(x0, y0, color);
+        if (x0 == x1 && y0 == y1) {
+          break;
+        }
+        int16_t e2 = 2 * err;
+        if (e2 >= dy) { err += dy; x0 += sx; }
+        if (e2 <= dx) { err += dx; y0 += sy; }
+      }
+    }
+
+    void drawCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color) {
+      int16_t f = 1 - r, ddFx = 1, ddFy = -2 * r, x = 0, y = r;
+      drawPixel(x0, y0 + r, color);
+      drawPixel(x0, y0 - r, color);
+      drawPixel(x0 + r, y0, color);
+      drawPixel(x0 - r, y0, color);
+      while (x < y) {
+        if (f >= 0) { y--; ddFy += 2; f += ddFy; }
+        x++; ddFx += 2; f += ddFx;
+        drawPixel(x0 + x, y0 + y, color);
+        drawPixel(x0 - x, y0 + y, color);
+        drawPixel(x0 + x, y0 - y, color);
+        drawPixel(x0 - x, y0 - y, color);
+        drawPixel(x0 + y, y0 + x, color);
+        drawPixel(x0 - y, y0 + x, color);
+        drawPixel(x0 + y, y0 - x, color);
+        drawPixel(x0 - y, y0 - x, color);
+      }
+    }
+
+    void fillCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color) {
+      for (int16_t x = -r; x <= r; x++) {
+        int16_t h = (int16_t)sqrt((double)(r * r - x * x));
+        drawFastVLine(x0 + x, y0 - h, 2 * h + 1, color);
+      }
+    }
+
+    void setRotation(uint8_t r) {
+      rotation = r & 3;
+      _width = rotation % 2 == 0 ? WIDTH : HEIGHT;
+      _height = rotation % 2 == 0 ? HEIGHT : WIDTH;
+    }
+
+    uint8_t getRotation() const { return rotation; }
+    int16_t width() const { return _width; }
+    int16_t height() const { return _height; }
+};
+
+#endif
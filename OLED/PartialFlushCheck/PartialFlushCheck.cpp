@@ -0,0 +1,169 @@
+/**
+ * Checks PartialFlushSSD1306.hpp on a desktop computer (Linux or Mac). The
+ * stand-in Wire.h in this folder sends display() to a model of the SSD1306's
+ * display RAM, so after every frame we can check that what's "on the screen"
+ * is exactly what's in the framebuffer. For each display size and rotation,
+ * it runs:
+ *
+ *  - Ball: clears the screen and draws a bouncing ball and a status bar each
+ *    frame, like BallBounce and FpsTest
+ *  - Random: draws random lines, rectangles, and circles (partly off the
+ *    screen, in white, black, and inverse), only sometimes clearing the
+ *    screen or filling it, and sometimes changing the buffer directly with
+ *    markDirty()
+ *
+ * For each, it prints PASS if the screen matched the framebuffer after every
+ * frame, and the average bytes sent over I2C per frame compared with
+ * Adafruit_SSD1306's display(). At 400 kHz, each byte takes ~22.5 us.
+ * It exits with 1 if any check failed.
+ *
+ * The header is included straight from its sketch folder, so the results are
+ * for the exact code that runs on the Arduino. The other headers in this
+ * folder are stand-ins for the Arduino, Wire, Adafruit GFX, and Adafruit
+ * SSD1306 libraries.
+ *
+ * To build and run (from this folder):
+ *  g++ -std=c++11 -O2 -I. PartialFlushCheck.cpp -o PartialFlushCheck
+ *  ./PartialFlushCheck
+ *
+ * By Jon E. Froehlich
+ * @jonfroehlich
+ * http://makeabilitylab.io
+ *
+ */
+#include <Arduino.h>  // the host stand-ins in this folder (needs -I.)
+#include <Wire.h>
+
+#include "../FpsTest/PartialFlushSSD1306.hpp"
+
+#include <cstdio>
+#include <random>
+
+TwoWire Wire;
+
+const int NUM_FRAMES = 500;
+const uint16_t COLORS[] = { SSD1306_WHITE, SSD1306_BLACK, SSD1306_INVERSE };
+
+int _numFailures = 0;
+
+bool screenMatchesBuffer(PartialFlushSSD1306& display, uint8_t screenWidth, uint8_t screenHeight) {
+  const uint8_t* buffer = display.getBuffer();
+  for (int page = 0; page < screenHeight / 8; page++) {
+    for (int column = 0; column < screenWidth; column++) {
+      if (Wire.ram[page][column] != buffer[page * screenWidth + column]) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+void drawBallFrame(PartialFlushSSD1306& display, int frame) {
+  const int radius = 5;
+  int w = display.width() - 2 * radius;
+  int h = display.height() - 2 * radius;
+  int x = frame * 3 % (2 * w);
+  int y = frame * 2 % (2 * h);
+  x = radius + (x < w ? x : 2 * w - x);
+  y = radius + (y < h ? y : 2 * h - y);
+
+  display.clearDisplay();
+  display.fillRect(display.width() - 50, 0, 50, 8, SSD1306_BLACK);  // status bar background
+  for (int i = 0; i < 40; i++) {
+    display.drawPixel(display.width() - 48 + i, (frame + i) % 7, SSD1306_WHITE);  // "text"
+  }
+  display.drawCircle(x, y, radius, SSD1306_WHITE);
+}
+
+void drawRandomFrame(PartialFlushSSD1306& display, std::mt19937& rng) {
+  auto rand = [&](int lo, int hi) { return std::uniform_int_distribution<int>(lo, hi)(rng); };
+  int w = display.width();
+  int h = display.height();
+
+  int action = rand(0, 9);
+  if (action < 5) {
+    display.clearDisplay();
+  } else if (action == 5) {
+    display.fillScreen(COLORS[rand(0, 2)]);
+  } else if (action == 6) {
+    // Change the buffer directly, and mark it
+    int x = rand(0, w - 1), y = rand(0, h - 1);
+    display.drawPixel(x, y, SSD1306_INVERSE);  // where, in the buffer, this pixel is
+    uint8_t* buffer = display.getBuffer();
+    for (int i = 0; i < w * h / 8; i++) {
+      if (rand(0, 200) == 0) {
+        buffer[i] ^= rand(1, 255);
+      }
+    }
+    display.markAllDirty();
+  }
+
+  int numShapes = rand(1, 5);
+  for (int i = 0; i < numShapes; i++) {
+    uint16_t color = COLORS[rand(0, 2)];
+    int x = rand(-20, w + 20), y = rand(-20, h + 20);
+    int sw = rand(-3, 40), sh = rand(-3, 40);
+    switch (rand(0, 7)) {
+      case 0: display.drawPixel(x, y, color); break;
+      case 1: display.drawFastHLine(x, y, sw, color); break;
+      case 2: display.drawFastVLine(x, y, sh, color); break;
+      case 3: display.drawRect(x, y, sw, sh, color); break;
+      case 4: display.fillRect(x, y, sw, sh, color); break;
+      case 5: display.drawLine(x, y, rand(-20, w + 20), rand(-20, h + 20), color); break;
+      case 6: display.drawCircle(x, y, rand(0, 20), color); break;
+      case 7: display.fillCircle(x, y, rand(0, 20), color); break;
+    }
+  }
+}
+
+void runCheck(const char* name, uint8_t screenWidth, uint8_t screenHeight, uint8_t rotation) {
+  PartialFlushSSD1306 display(screenWidth, screenHeight, &Wire);
+  display.begin(SSD1306_SWITCHCAPVCC, 0x3D);
+  display.setRotation(rotation);
+
+  // How many bytes Adafruit_SSD1306's display() sends
+  unsigned long bytesBefore = Wire.bytesSent;
+  display.Adafruit_SSD1306::display();
+  unsigned long fullFrameBytes = Wire.bytesSent - bytesBefore;
+  display.markAllDirty();
+  display.display();
+
+  std::mt19937 rng(rotation * 1000 + screenHeight);
+  bool isBall = name[0] == 'B';
+  bool passed = true;
+  bytesBefore = Wire.bytesSent;
+  for (int frame = 0; frame < NUM_FRAMES; frame++) {
+    if (isBall) {
+      drawBallFrame(display, frame);
+    } else {
+      drawRandomFrame(display, rng);
+    }
+    display.display();
+    passed = passed && screenMatchesBuffer(display, screenWidth, screenHeight);
+  }
+  passed = passed && Wire.numTooLong == 0;
+  double bytesPerFrame = (Wire.bytesSent - bytesBefore) / (double)NUM_FRAMES;
+
+  printf("%-6s %dx%d rot=%d: %s  %6.1f bytes/frame vs %lu (%.1f%%)\n", name, screenWidth, screenHeight,
+         rotation, passed ? "PASS" : "FAIL", bytesPerFrame, fullFrameBytes, 100 * bytesPerFrame / fullFrameBytes);
+  if (!passed) {
+    _numFailures++;
+  }
+}
+
+int main() {
+  const uint8_t heights[] = { 64, 32 };
+  for (uint8_t screenHeight : heights) {
+    for (uint8_t rotation = 0; rotation < 4; rotation++) {
+      runCheck("Ball", 128, screenHeight, rotation);
+      runCheck("Random", 128, screenHeight, rotation);
+    }
+  }
+
+  if (_numFailures > 0) {
+    printf("%d checks FAILED\n", _numFailures);
+    return 1;
+  }
+  printf("All checks passed\n");
+  return 0;
+}
@@ -16,6 +16,16 @@
  * Adafruit OLED tutorials:
  * https://learn.adafruit.com/monochrome-oled-breakouts
  * 
+ * Uses PartialFlushSSD1306.hpp (in this folder) rather than Adafruit_SSD1306 so
+ * that display() only sends the parts of the screen that changed (the ball,
+ * paddles, and scores) rather than the whole screen each frame. The scores and
+ * fps are drawn with FastText.hpp (also in this folder), which writes them
+ * straight into the framebuffer a byte per column rather than pixel by pixel.
+ *
+ * The game runs on GameLoop.hpp (also in this folder): updateGame() moves the
+ * ball and paddles every GAME_STEP_MS and drawGame() draws whenever something
+ * moved, so the ball is the same speed however long display() takes.
+ * 
  * Code based on:
  * https://makeabilitylab.github.io/p5js/Games/Pong/
  *  
@@ -26,20 +36,30 @@
  */
 #include <Wire.h>
 #include <SPI.h>
-#include <Shape.hpp>;
-#include <ParallaxJoystick.hpp>;
+#include <Shape.hpp>
+#include <ParallaxJoystick.hpp>
 
 #include <Adafruit_GFX.h>
 #include <Adafruit_SSD1306.h>
+#include "PartialFlushSSD1306.hpp"
+#include "FastText.hpp"
+#include "GameLoop.hpp"
 
 #define SCREEN_WIDTH 128 // OLED _display width, in pixels
 #define SCREEN_HEIGHT 64 // OLED _display height, in pixels
 
 // Declaration for an SSD1306 _display connected to I2C (SDA, SCL pins)
 #define OLED_RESET     4 // Reset pin # (or -1 if sharing Arduino reset pin)
-Adafruit_SSD1306 _display(SCREEN_WIDTH, SCREEN_HEIGHT, &Wire, OLED_RESET);
+PartialFlushSSD1306 _display(SCREEN_WIDTH, SCREEN_HEIGHT, &Wire, OLED_RESET);
+
+// 30 ms keeps the speed Pong had when it moved once per frame (a 5 ms delay
+// plus ~25 ms for a full display())
+const int GAME_STEP_MS = 30;
+GameLoop _gameLoop(GAME_STEP_MS);
+
+// Print frame-time stats over Serial this often (0 for never)
+const unsigned long PRINT_FRAME_STATS_MS = 0;
 
-const int DELAY_LOOP_MS = 5;
 const int JOYSTICK_UPDOWN_PIN = A1;
 const int JOYSTICK_LEFTRIGHT_PIN = A0;
 const int SERVE_BUTTON_INPUT_PIN = 5;
@@ -95,12 +115,14 @@ enum Players _gameWinner = LEFT_PLAYER;
 
 //Shape _shape(20, 20, 20, 20);
 
-// for tracking fps
-float _fps = 0;
-unsigned long _frameCount = 0;
-unsigned long _fpsStartTimeStamp = 0;
 const boolean _drawFps = false; // change to show/hide fps display
 
+// The scores (up to 2 chars) at a quarter and three quarters across the top and
+// "XX.XX fps" in the bottom-right corner (the number is a 5-char field)
+TextField _leftScoreField(SCREEN_WIDTH / 4, 0, 2);
+TextField _rightScoreField((int)(SCREEN_WIDTH * 0.75), 0, 2);
+TextField _fpsField(SCREEN_WIDTH - FastText::getTextWidth(9), SCREEN_HEIGHT - FastText::CHAR_HEIGHT, 5, TEXT_ALIGN_RIGHT);
+
 void setup() {
   Serial.begin(9600);
 
@@ -125,54 +147,26 @@ void setup() {
   if (random(0, 2) >= 1) {
     _ballServer = RIGHT_PLAYER;
   }
-  _fpsStartTimeStamp = millis();
+  _gameLoop.begin();
 }
 
 void loop() {
-
-  _display.clearDisplay();
-
-  int16_t x1, y1;
-  uint16_t w, h;
-  if (_curGameState == NEW_GAME || _curGameState == BALL_SERVE) {
-
-    int yText = 0;
-    if (_ballServer == LEFT_PLAYER) {
-      _display.getTextBounds(STR_PLAYER1_SERVE, 0, 0, &x1, &y1, &w, &h);
-      yText = _display.height() / 2 - h / 2;
-      _display.setCursor(_display.width() / 2 - w / 2, yText);
-      _display.print(STR_PLAYER1_SERVE);
-    } else {
-      _display.getTextBounds(STR_PLAYER2_SERVE, 0, 0, &x1, &y1, &w, &h);
-      yText = _display.height() / 2 - h / 2;
-      _display.setCursor(_display.width() / 2 - w / 2, yText);
-      _display.print(STR_PLAYER2_SERVE);
-    }
-
-    if(GAME_OVER_SCORE - _leftPlayerScore == 1 || GAME_OVER_SCORE - _rightPlayerScore == 1){
-      yText = yText + h + 2;
-      _display.getTextBounds(STR_GAME_POINT, 0, 0, &x1, &y1, &w, &h);
-      _display.setCursor(_display.width() / 2 - w / 2, yText);
-      _display.print(STR_GAME_POINT);
-    }else{
-      yText = yText + h + 2;
-      _display.getTextBounds("Play to 3 pts", 0, 0, &x1, &y1, &w, &h);
-      _display.setCursor(_display.width() / 2 - w / 2, yText);
-      _display.print(STR_PLAY_TO);
-      _display.print(GAME_OVER_SCORE);
-      _display.print(" pts");
-    }
+  while (_gameLoop.step()) {
+    updateGame();
   }
 
-  // Draw fps
-  if (_drawFps && _curGameState == PLAYING) {
-    drawFrameRate();
+  if (_gameLoop.shouldDraw()) {
+    drawGame();
+    _gameLoop.endDraw();
   }
-  calcFrameRate();
 
-  // draw scores
-  drawScores();
+  _gameLoop.printStatsEvery(Serial, PRINT_FRAME_STATS_MS);
+}
 
+/**
+ * Reads the controls and moves the ball and paddles one step
+ */
+void updateGame() {
   _ball.update();
 
   int ballServeButtonVal = digitalRead(SERVE_BUTTON_INPUT_PIN);
@@ -202,9 +196,6 @@ void loop() {
   if (_curGameState == PLAYING) {
     // If we're here, then we're actively playing a game
 
-    // Draw the court
-    drawCourt();
-
     // Check for ball bounce off top and bottom of screen
     if (_ball.checkYBounce(0, _display.height() - 1)) {
       _ball.reverseYSpeed();
@@ -258,8 +249,6 @@ void loop() {
       _ballServer = LEFT_PLAYER;
     }
   } else if (_curGameState == GAME_OVER) {
-    drawGameOver();
-
     // Check to see if ball serve button is pressed
     // If so, go into a "new game" state
     if (ballServeButtonVal == LOW) {
@@ -295,33 +284,86 @@ void loop() {
     }
   }
 
+  //Serial.println((String)"x:" + _ball.getX() + " y:" + _ball.getY() + " xSpeed:" + _ball.getXSpeed() + " ySpeed:" + _ball.getYSpeed());
+}
+
+/**
+ * Draws the current game state and renders it to the screen
+ */
+void drawGame() {
+  _display.clearDisplay();
+
+  int16_t x1, y1;
+  uint16_t w, h;
+  if (_curGameState == NEW_GAME || _curGameState == BALL_SERVE) {
+
+    int yText = 0;
+    if (_ballServer == LEFT_PLAYER) {
+      _display.getTextBounds(STR_PLAYER1_SERVE, 0, 0, &x1, &y1, &w, &h);
+      yText = _display.height() / 2 - h / 2;
+      _display.setCursor(_display.width() / 2 - w / 2, yText);
+      _display.print(STR_PLAYER1_SERVE);
+    } else {
+      _display.getTextBounds(STR_PLAYER2_SERVE, 0, 0, &x1, &y1, &w, &h);
+      yText = _display.height() / 2 - h / 2;
+      _display.setCursor(_display.width() / 2 - w / 2, yText);
+      _display.print(STR_PLAYER2_SERVE);
+    }
+
+    if(GAME_OVER_SCORE - _leftPlayerScore == 1 || GAME_OVER_SCORE - _rightPlayerScore == 1){
+      yText = yText + h + 2;
+      _display.getTextBounds(STR_GAME_POINT, 0, 0, &x1, &y1, &w, &h);
+      _display.setCursor(_display.width() / 2 - w / 2, yText);
+      _display.print(STR_GAME_POINT);
+    }else{
+      yText = yText + h + 2;
+      _display.getTextBounds("Play to 3 pts", 0, 0, &x1, &y1, &w, &h);
+      _display.setCursor(_display.width() / 2 - w / 2, yText);
+      _display.print(STR_PLAY_TO);
+      _display.print(GAME_OVER_SCORE);
+      _display.print(" pts");
+    }
+  }
+
+  // Draw fps
+  if (_drawFps && _curGameState == PLAYING) {
+    drawFrameRate();
+  }
+
+  // draw scores
+  drawScores();
+
+  if (_curGameState == PLAYING) {
+    // Draw the court
+    drawCourt();
+  } else if (_curGameState == GAME_OVER) {
+    drawGameOver();
+  }
+
   _ball.draw(_display);
   _leftPaddle.draw(_display);
   _rightPaddle.draw(_display);
 
   // Render buffer to screen
   _display.display();
-
-  if (DELAY_LOOP_MS > 0) {
-    delay(DELAY_LOOP_MS);
-  }
-
-
-  //Serial.println((String)"x:" + _ball.getX() + " y:" + _ball.getY() + " xSpeed:" + _ball.getXSpeed() + " ySpeed:" + _ball.getYSpeed());
 }
 
 /**
  * Draw the scores to the display
  */
 void drawScores(){
-  //_display.getTextBounds((String)("" + _leftPlayerScore), 0, 0, &x1, &y1, &w, &h);
-  //_display.setCursor(_display.width() / 4 - w / 2, 0);
-  _display.setCursor(_display.width() / 4, 0);
-  _display.print(_leftPlayerScore);
-
-  //_display.getTextBounds((String)("" + _rightPlayerScore), 0, 0, &x1, &y1, &w, &h);
-  _display.setCursor((int)(_display.width() * 0.75), 0);
-  _display.print(_rightPlayerScore);
+  _leftScoreField.draw(_display, _leftPlayerScore);
+  markDirty(_leftScoreField);
+
+  _rightScoreField.draw(_display, _rightPlayerScore);
+  markDirty(_rightScoreField);
+}
+
+/**
+ * FastText writes to the framebuffer directly, so tell the display the field changed
+ */
+void markDirty(const TextField& field){
+  _display.markDirty(field.getX(), field.getY(), field.getWidth(), field.getHeight());
 }
 
 /**
@@ -397,30 +439,12 @@ void drawGameOver() {
   }
 }
 
-/**
-   Call this every frame to calculate frame rate
-*/
-void calcFrameRate() {
-  unsigned long elapsedTime = millis() - _fpsStartTimeStamp;
-  _frameCount++;
-  if (elapsedTime > 1000) {
-    _fps = _frameCount / (elapsedTime / 1000.0);
-    _fpsStartTimeStamp = millis();
-    _frameCount = 0;
-  }
-}
-
 /**
    Draw frame rate
 */
 void drawFrameRate() {
-  // Draw frame count
-  int16_t x1, y1;
-  uint16_t w, h;
-  _display.getTextBounds("XX.XX fps", 0, 0, &x1, &y1, &w, &h);
-
   // Draw fps in bottom right corner
-  _display.setCursor(_display.width() - w, _display.height()-h);
-  _display.print(_fps);
-  _display.print(" fps");
+  _fpsField.draw(_display, _gameLoop.getFps());
+  int16_t labelWidth = FastText::drawText(_display, _fpsField.getX() + _fpsField.getWidth(), _fpsField.getY(), " fps");
+  _display.markDirty(_fpsField.getX(), _fpsField.getY(), _fpsField.getWidth() + labelWidth, _fpsField.getHeight());
 }
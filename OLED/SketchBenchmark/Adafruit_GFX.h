@@ -0,0 +1,482 @@
+/**
+ * A stand-in for the Adafruit GFX library that draws the same pixels as the
+ * real one: the lines, circles, rounded rectangles, triangles, bitmaps, and
+ * text below use the library's algorithms, and go through drawPixel(),
+ * drawFastVLine(), drawFastHLine(), and fillRect() the same way. So the
+ * frames SketchRunner saves, and the calls it counts, are what a sketch
+ * would get on a real display.
+ *
+ * Text uses the built-in 6x8 font (glcdfont.c); only its printable ASCII
+ * characters (' ' to '~') are here, and the others draw as blanks. Custom
+ * fonts (setFont()) aren't supported.
+ *
+ * Only used by SketchRunner.cpp and the sketches it builds.
+ *
+ * By Jon E. Froehlich
+ * @jonfroehlich
+ * http://makeabilitylab.io
+ *
+ */
+#ifndef HOST_ADAFRUIT_GFX_H
+#define HOST_ADAFRUIT_GFX_H
+
+#include <Arduino.h>
+
+// The built-in font's printable characters, 5 bytes (columns, top row in the lowest bit) each
+static const uint8_t HOST_GFX_FONT[] PROGMEM = {
+  0x00, 0x00, 0x00, 0x00, 0x00,  // ' '
+  0x00, 0x00, 0x5F, 0x00, 0x00,  // !
+  0x00, 0x07, 0x00, 0x07, 0x00,  // "
+  0x14, 0x7F, 0x14, 0x7F, 0x14,  // #
+  0x24, 0x2A, 0x7F, 0x2A, 0x12,  // $
+  0x23, 0x13, 0x08, 0x64, 0x62,  // %
+  0x36, 0x49, 0x56, 0x20, 0x50,  // &
+  0x00, 0x08, 0x07, 0x03, 0x00,  // '
+  0x00, 0x1C, 0x22, 0x41, 0x00,  // (
+  0x00, 0x41, 0x22, 0x1C, 0x00,  // )
+  0x2A, 0x1C, 0x7F, 0x1C, 0x2A,  // *
+  0x08, 0x08, 0x3E, 0x08, 0x08,  // +
+  0x00, 0x80, 0x70, 0x30, 0x00,  // ,
+  0x08, 0x08, 0x08, 0x08, 0x08,  // -
+  0x00, 0x00, 0x60, 0x60, 0x00,  // .
+  0x20, 0x10, 0x08, 0x04, 0x02,  // /
+  0x3E, 0x51, 0x49, 0x45, 0x3E,  // 0
+  0x00, 0x42, 0x7F, 0x40, 0x00,  // 1
+  0x72, 0x49, 0x49, 0x49, 0x46,  // 2
+  0x21, 0x41, 0x49, 0x4D, 0x33,  // 3
+  0x18, 0x14, 0x12, 0x7F, 0x10,  // 4
+  0x27, 0x45, 0x45, 0x45, 0x39,  // 5
+  0x3C, 0x4A, 0x49, 0x49, 0x31,  // 6
+  0x41, 0x21, 0x11, 0x09, 0x07,  // 7
+  0x36, 0x49, 0x49, 0x49, 0x36,  // 8
+  0x46, 0x49, 0x49, 0x29, 0x1E,  // 9
+  0x00, 0x00, 0x14, 0x00, 0x00,  // :
+  0x00, 0x40, 0x34, 0x00, 0x00,  // ;
+  0x00, 0x08, 0x14, 0x22, 0x41,  // <
+  0x14, 0x14, 0x14, 0x14, 0x14,  // =
+  0x00, 0x41, 0x22, 0x14, 0x08,  // >
+  0x02, 0x01, 0x59, 0x09, 0x06,  // ?
+  0x3E, 0x41, 0x5D, 0x59, 0x4E,  // @
+  0x7C, 0x12, 0x11, 0x12, 0x7C,  // A
+  0x7F, 0x49, 0x49, 0x49, 0x36,  // B
+  0x3E, 0x41, 0x41, 0x41, 0x22,  // C
+  0x7F, 0x41, 0x41, 0x41, 0x3E,  // D
+  0x7F, 0x49, 0x49, 0x49, 0x41,  // E
+  0x7F, 0x09, 0x09, 0x09, 0x01,  // F
+  0x3E, 0x41, 0x41, 0x51, 0x73,  // G
+  0x7F, 0x08, 0x08, 0x08, 0x7F,  // H
+  0x00, 0x41, 0x7F, 0x41, 0x00,  // I
+  0x20, 0x40, 0x41, 0x3F, 0x01,  // J
+  0x7F, 0x08, 0x14, 0x22, 0x41,  // K
+  0x7F, 0x40, 0x40, 0x40, 0x40,  // L
+  0x7F, 0x02, 0x1C, 0x02, 0x7F,  // M
+  0x7F, 0x04, 0x08, 0x10, 0x7F,  // N
+  0x3E, 0x41, 0x41, 0x41, 0x3E,  // O
+  0x7F, 0x09, 0x09, 0x09, 0x06,  // P
+  0x3E, 0x41, 0x51, 0x21, 0x5E,  // Q
+  0x7F, 0x09, 0x19, 0x29, 0x46,  // R
+  0x26, 0x49, 0x49, 0x49, 0x32,  // S
+  0x03, 0x01, 0x7F, 0x01, 0x03,  // T
+  0x3F, 0x40, 0x40, 0x40, 0x3F,  // U
+  0x1F, 0x20, 0x40, 0x20, 0x1F,  // V
+  0x3F, 0x40, 0x38, 0x40, 0x3F,  // W
+  0x63, 0x14, 0x08, 0x14, 0x63,  // X
+  0x03, 0x04, 0x78, 0x04, 0x03,  // Y
+  0x61, 0x59, 0x49, 0x4D, 0x43,  // Z
+  0x00, 0x7F, 0x41, 0x41, 0x41,  // [
+  0x02, 0x04, 0x08, 0x10, 0x20,  // backslash
+  0x00, 0x41, 0x41, 0x41, 0x7F,  // ]
+  0x04, 0x02, 0x01, 0x02, 0x04,  // ^
+  0x40, 0x40, 0x40, 0x40, 0x40,  // _
+  0x00, 0x03, 0x07, 0x08, 0x00,  // `
+  0x20, 0x54, 0x54, 0x78, 0x40,  // a
+  0x7F, 0x28, 0x44, 0x44, 0x38,  // b
+  0x38, 0x44, 0x44, 0x44, 0x28,  // c
+  0x38, 0x44, 0x44, 0x28, 0x7F,  // d
+  0x38, 0x54, 0x54, 0x54, 0x18,  // e
+  0x00, 0x08, 0x7E, 0x09, 0x02,  // f
+  0x18, 0xA4, 0xA4, 0x9C, 0x78,  // g
+  0x7F, 0x08, 0x04, 0x04, 0x78,  // h
+  0x00, 0x44, 0x7D, 0x40, 0x00,  // i
+  0x20, 0x40, 0x40, 0x3D, 0x00,  // j
+  0x7F, 0x10, 0x28, 0x44, 0x00,  // k
+  0x00, 0x41, 0x7F, 0x40, 0x00,  // l
+  0x7C, 0x04, 0x78, 0x04, 0x78,  // m
+  0x7C, 0x08, 0x04, 0x04, 0x78,  // n
+  0x38, 0x44, 0x44, 0x44, 0x38,  // o
+  0xFC, 0x18, 0x24, 0x24, 0x18,  // p
+  0x18, 0x24, 0x24, 0x18, 0xFC,  // q
+  0x7C, 0x08, 0x04, 0x04, 0x08,  // r
+  0x48, 0x54, 0x54, 0x54, 0x24,  // s
+  0x04, 0x04, 0x3F, 0x44, 0x24,  // t
+  0x3C, 0x40, 0x40, 0x20, 0x7C,  // u
+  0x1C, 0x20, 0x40, 0x20, 0x1C,  // v
+  0x3C, 0x40, 0x30, 0x40, 0x3C,  // w
+  0x44, 0x28, 0x10, 0x28, 0x44,  // x
+  0x4C, 0x90, 0x90, 0x90, 0x7C,  // y
+  0x44, 0x64, 0x54, 0x4C, 0x44,  // z
+  0x00, 0x08, 0x36, 0x41, 0x00,  // {
+  0x00, 0x00, 0x77, 0x00, 0x00,  // |
+  0x00, 0x41, 0x36, 0x08, 0x00,  // }
+  0x02, 0x01, 0x02, 0x04, 0x02   // ~
+};
+
+class Adafruit_GFX : public Print{
+
+  private:
+    // Adafruit_GFX::drawCircleHelper(): the quarter circles of a rounded rectangle
+    void drawCircleHelper(int16_t x0, int16_t y0, int16_t r, uint8_t cornerName, uint16_t color) {
+      int16_t f = 1 - r, ddFx = 1, ddFy = -2 * r, x = 0, y = r;
+      while (x < y) {
+        if (f >= 0) { y--; ddFy += 2; f += ddFy; }
+        x++; ddFx += 2; f += ddFx;
+        if (cornerName & 0x4) { drawPixel(x0 + x, y0 + y, color); drawPixel(x0 + y, y0 + x, color); }
+        if (cornerName & 0x2) { drawPixel(x0 + x, y0 - y, color); drawPixel(x0 + y, y0 - x, color); }
+        if (cornerName & 0x8) { drawPixel(x0 - y, y0 + x, color); drawPixel(x0 - x, y0 + y, color); }
+        if (cornerName & 0x1) { drawPixel(x0 - y, y0 - x, color); drawPixel(x0 - x, y0 - y, color); }
+      }
+    }
+
+    // Adafruit_GFX::fillCircleHelper(): the halves of a filled circle or rounded rectangle
+    void fillCircleHelper(int16_t x0, int16_t y0, int16_t r, uint8_t corners, int16_t delta, uint16_t color) {
+      int16_t f = 1 - r, ddFx = 1, ddFy = -2 * r, x = 0, y = r, px = x, py = y;
+      delta++;
+      while (x < y) {
+        if (f >= 0) { y--; ddFy += 2; f += ddFy; }
+        x++; ddFx += 2; f += ddFx;
+        if (x < (y + 1)) {
+          if (corners & 1) drawFastVLine(x0 + x, y0 - y, 2 * y + delta, color);
+          if (corners & 2) drawFastVLine(x0 - x, y0 - y, 2 * y + delta, color);
+        }
+        if (y != py) {
+          if (corners & 1) drawFastVLine(x0 + py, y0 - px, 2 * px + delta, color);
+          if (corners & 2) drawFastVLine(x0 - py, y0 - px, 2 * px + delta, color);
+          py = y;
+        }
+        px = x;
+      }
+    }
+
+    // Adafruit_GFX::writeLine() (Bresenham's, stepping along the longer axis)
+    void writeLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) {
+      bool steep = abs(y1 - y0) > abs(x1 - x0);
+      int16_t t;
+      if (steep) { t = x0; x0 = y0; y0 = t; t = x1; x1 = y1; y1 = t; }
+      if (x0 > x1) { t = x0; x0 = x1; x1 = t; t = y0; y0 = y1; y1 = t; }
+      int16_t dx = x1 - x0, dy = abs(y1 - y0), err = dx / 2;
+      int16_t yStep = y0 < y1 ? 1 : -1;
+      for (; x0 <= x1; x0++) {
+        if (steep) {
+          drawPixel(y0, x0, color);
+        } else {
+          drawPixel(x0, y0, color);
+        }
+        err -= dy;
+        if (err < 0) {
+          y0 += yStep;
+          err += dx;
+        }
+      }
+    }
+
+    // Adafruit_GFX::charBounds() for the built-in font
+    void charBounds(unsigned char c, int16_t* x, int16_t* y, int16_t* minX, int16_t* minY,
+                    int16_t* maxX, int16_t* maxY) {
+      if (c == '\n') {
+        *x = 0;
+        *y += _textSizeY * 8;
+      } else if (c != '\r') {
+        if (_wrap && (*x + _textSizeX * 6) > _width) {
+          *x = 0;
+          *y += _textSizeY * 8;
+        }
+        int16_t x2 = *x + _textSizeX * 6 - 1, y2 = *y + _textSizeY * 8 - 1;
+        if (x2 > *maxX) *maxX = x2;
+        if (y2 > *maxY) *maxY = y2;
+        if (*x < *minX) *minX = *x;
+        if (*y < *minY) *minY = *y;
+        *x += _textSizeX * 6;
+      }
+    }
+
+  protected:
+    const int16_t WIDTH, HEIGHT;  // the display's size without rotation
+    int16_t _width, _height;      // the display's size with rotation
+    uint8_t rotation;
+
+    int16_t _cursorX, _cursorY;
+    uint8_t _textSizeX, _textSizeY;
+    uint16_t _textColor, _textBgColor;
+    bool _wrap;
+
+  public:
+    Adafruit_GFX(int16_t w, int16_t h)
+      : WIDTH(w), HEIGHT(h), _width(w), _height(h), rotation(0), _cursorX(0), _cursorY(0),
+        _textSizeX(1), _textSizeY(1), _textColor(0xFFFF), _textBgColor(0xFFFF), _wrap(true) {
+    }
+
+    virtual void drawPixel(int16_t x, int16_t y, uint16_t color) = 0;
+
+    virtual void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+      writeLine(x, y, x, y + h - 1, color);
+    }
+
+    virtual void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+      writeLine(x, y, x + w - 1, y, color);
+    }
+
+    virtual void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+      for (int16_t i = x; i < x + w; i++) {
+        drawFastVLine(i, y, h, color);
+      }
+    }
+
+    virtual void fillScreen(uint16_t color) {
+      fillRect(0, 0, _width, _height, color);
+    }
+
+    virtual void drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) {
+      if (x0 == x1) {
+        if (y0 > y1) { int16_t t = y0; y0 = y1; y1 = t; }
+        drawFastVLine(x0, y0, y1 - y0 + 1, color);
+      } else if (y0 == y1) {
+        if (x0 > x1) { int16_t t = x0; x0 = x1; x1 = t; }
+        drawFastHLine(x0, y0, x1 - x0 + 1, color);
+      } else {
+        writeLine(x0, y0, x1, y1, color);
+      }
+    }
+
+    virtual void drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+      drawFastHLine(x, y, w, color);
+      drawFastHLine(x, y + h - 1, w, color);
+      drawFastVLine(x, y, h, color);
+      drawFastVLine(x + w - 1, y, h, color);
+    }
+
+    void drawCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color) {
+      int16_t f = 1 - r, ddFx = 1, ddFy = -2 * r, x = 0, y = r;
+      drawPixel(x0, y0 + r, color);
+      drawPixel(x0, y0 - r, color);
+      drawPixel(x0 + r, y0, color);
+      drawPixel(x0 - r, y0, color);
+      while (x < y) {
+        if (f >= 0) { y--; ddFy += 2; f += ddFy; }
+        x++; ddFx += 2; f += ddFx;
+        drawPixel(x0 + x, y0 + y, color);
+        drawPixel(x0 - x, y0 + y, color);
+        drawPixel(x0 + x, y0 - y, color);
+        drawPixel(x0 - x, y0 - y, color);
+        drawPixel(x0 + y, y0 + x, color);
+        drawPixel(x0 - y, y0 + x, color);
+        drawPixel(x0 + y, y0 - x, color);
+        drawPixel(x0 - y, y0 - x, color);
+      }
+    }
+
+    void fillCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color) {
+      drawFastVLine(x0, y0 - r, 2 * r + 1, color);
+      fillCircleHelper(x0, y0, r, 3, 0, color);
+    }
+
+    void drawRoundRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, uint16_t color) {
+      int16_t maxRadius = (w < h ? w : h) / 2;
+      if (r > maxRadius) r = maxRadius;
+      drawFastHLine(x + r, y, w - 2 * r, color);
+      drawFastHLine(x + r, y + h - 1, w - 2 * r, color);
+      drawFastVLine(x, y + r, h - 2 * r, color);
+      drawFastVLine(x + w - 1, y + r, h - 2 * r, color);
+      drawCircleHelper(x + r, y + r, r, 1, color);
+      drawCircleHelper(x + w - r - 1, y + r, r, 2, color);
+      drawCircleHelper(x + w - r - 1, y + h - r - 1, r, 4, color);
+      drawCircleHelper(x + r, y + h - r - 1, r, 8, color);
+    }
+
+    void fillRoundRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, uint16_t color) {
+      int16_t maxRadius = (w < h ? w : h) / 2;
+      if (r > maxRadius) r = maxRadius;
+      fillRect(x + r, y, w - 2 * r, h, color);
+      fillCircleHelper(x + w - r - 1, y + r, r, 1, h - 2 * r - 1, color);
+      fillCircleHelper(x + r, y + r, r, 2, h - 2 * r - 1, color);
+    }
+
+    void drawTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color) {
+      drawLine(x0, y0, x1, y1, color);
+      drawLine(x1, y1, x2, y2, color);
+      drawLine(x2, y2, x0, y0, color);
+    }
+
+    // Adafruit_GFX::fillTriangle(): sorted by y, then filled a row at a time
+    void fillTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color) {
+      int16_t a, b, y, last, t;
+      if (y0 > y1) { t = y0; y0 = y1; y1 = t; t = x0; x0 = x1; x1 = t; }
+      if (y1 > y2) { t = y2; y2 = y1; y1 = t; t = x2; x2 = x1; x1 = t; }
+      if (y0 > y1) { t = y0; y0 = y1; y1 = t; t = x0; x0 = x1; x1 = t; }
+
+      if (y0 == y2) {  // all on the same row
+        a = b = x0;
+        if (x1 < a) a = x1; else if (x1 > b) b = x1;
+        if (x2 < a) a = x2; else if (x2 > b) b = x2;
+        drawFastHLine(a, y0, b - a + 1, color);
+        return;
+      }
+
+      int16_t dx01 = x1 - x0, dy01 = y1 - y0, dx02 = x2 - x0, dy02 = y2 - y0, dx12 = x2 - x1, dy12 = y2 - y1;
+      int32_t sa = 0, sb = 0;
+      last = y1 == y2 ? y1 : y1 - 1;
+      for (y = y0; y <= last; y++) {
+        a = x0 + sa / dy01;
+        b = x0 + sb / dy02;
+        sa += dx01;
+        sb += dx02;
+        if (a > b) { t = a; a = b; b = t; }
+        drawFastHLine(a, y, b - a + 1, color);
+      }
+      sa = (int32_t)dx12 * (y - y1);
+      sb = (int32_t)dx02 * (y - y0);
+      for (; y <= y2; y++) {
+        a = x1 + sa / dy12;
+        b = x0 + sb / dy02;
+        sa += dx12;
+        sb += dx02;
+        if (a > b) { t = a; a = b; b = t; }
+        drawFastHLine(a, y, b - a + 1, color);
+      }
+    }
+
+    // Rows of (w + 7) / 8 bytes, left pixel in the highest bit; only the pixels that are on are drawn
+    void drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w, int16_t h, uint16_t color) {
+      int16_t byteWidth = (w + 7) / 8;
+      uint8_t b = 0;
+      for (int16_t j = 0; j < h; j++, y++) {
+        for (int16_t i = 0; i < w; i++) {
+          if (i & 7) {
+            b <<= 1;
+          } else {
+            b = pgm_read_byte(&bitmap[j * byteWidth + i / 8]);
+          }
+          if (b & 0x80) {
+            drawPixel(x + i, y, color);
+          }
+        }
+      }
+    }
+
+    // The same, but the pixels that are off are drawn in bg
+    void drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w, int16_t h, uint16_t color, uint16_t bg) {
+      int16_t byteWidth = (w + 7) / 8;
+      uint8_t b = 0;
+      for (int16_t j = 0; j < h; j++, y++) {
+        for (int16_t i = 0; i < w; i++) {
+          if (i & 7) {
+            b <<= 1;
+          } else {
+            b = pgm_read_byte(&bitmap[j * byteWidth + i / 8]);
+          }
+          drawPixel(x + i, y, (b & 0x80) ? color : bg);
+        }
+      }
+    }
+
+    void drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color, uint16_t bg, uint8_t size) {
+      drawChar(x, y, c, color, bg, size, size);
+    }
+
+    void drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color, uint16_t bg, uint8_t sizeX, uint8_t sizeY) {
+      if (x >= _width || y >= _height || (x + 6 * sizeX - 1) < 0 || (y + 8 * sizeY - 1) < 0) {
+        return;
+      }
+      for (int8_t i = 0; i < 5; i++) {
+        uint8_t line = c >= ' ' && c <= '~' ? pgm_read_byte(&HOST_GFX_FONT[(c - ' ') * 5 + i]) : 0;
+        for (int8_t j = 0; j < 8; j++, line >>= 1) {
+          if (line & 1) {
+            if (sizeX == 1 && sizeY == 1) {
+              drawPixel(x + i, y + j, color);
+            } else {
+              fillRect(x + i * sizeX, y + j * sizeY, sizeX, sizeY, color);
+            }
+          } else if (bg != color) {
+            if (sizeX == 1 && sizeY == 1) {
+              drawPixel(x + i, y + j, bg);
+            } else {
+              fillRect(x + i * sizeX, y + j * sizeY, sizeX, sizeY, bg);
+            }
+          }
+        }
+      }
+      if (bg != color) {
+        if (sizeX == 1 && sizeY == 1) {
+          drawFastVLine(x + 5, y, 8, bg);
+        } else {
+          fillRect(x + 5 * sizeX, y, sizeX, 8 * sizeY, bg);
+        }
+      }
+    }
+
+    using Print::write;
+    size_t write(uint8_t c) override {
+      if (c == '\n') {
+        _cursorX = 0;
+        _cursorY += _textSizeY * 8;
+      } else if (c != '\r') {
+        if (_wrap && (_cursorX + _textSizeX * 6) > _width) {
+          _cursorX = 0;
+          _cursorY += _textSizeY * 8;
+        }
+        drawChar(_cursorX, _cursorY, c, _textColor, _textBgColor, _textSizeX, _textSizeY);
+        _cursorX += _textSizeX * 6;
+      }
+      return 1;
+    }
+
+    void getTextBounds(const char* text, int16_t x, int16_t y, int16_t* x1, int16_t* y1, uint16_t* w, uint16_t* h) {
+      int16_t minX = _width, minY = _height, maxX = -1, maxY = -1;
+      *x1 = x;
+      *y1 = y;
+      *w = *h = 0;
+      while (*text != '\0') {
+        charBounds(*text++, &x, &y, &minX, &minY, &maxX, &maxY);
+      }
+      if (maxX >= minX) {
+        *x1 = minX;
+        *w = maxX - minX + 1;
+      }
+      if (maxY >= minY) {
+        *y1 = minY;
+        *h = maxY - minY + 1;
+      }
+    }
+
+    void getTextBounds(const __FlashStringHelper* text, int16_t x, int16_t y, int16_t* x1, int16_t* y1,
+                       uint16_t* w, uint16_t* h) {
+      getTextBounds(reinterpret_cast<const char*>(text), x, y, x1, y1, w, h);
+    }
+
+    void getTextBounds(const String& text, int16_t x, int16_t y, int16_t* x1, int16_t* y1, uint16_t* w, uint16_t* h) {
+      getTextBounds(text.c_str(), x, y, x1, y1, w, h);
+    }
+
+    void setCursor(int16_t x, int16_t y) { _cursorX = x; _cursorY = y; }
+    void setTextSize(uint8_t size) { setTextSize(size, size); }
+    void setTextSize(uint8_t sizeX, uint8_t sizeY) { _textSizeX = sizeX > 0 ? sizeX : 1; _textSizeY = sizeY > 0 ? sizeY : 1; }
+    void setTextColor(uint16_t color) { _textColor = _textBgColor = color; }
+    void setTextColor(uint16_t color, uint16_t bg) { _textColor = color; _textBgColor = bg; }
+    void setTextWrap(bool wrap) { _wrap = wrap; }
+    void cp437(bool = true) {}
+
+    void setRotation(uint8_t r) {
+      rotation = r & 3;
+      _width = rotation % 2 == 0 ? WIDTH : HEIGHT;
+      _height = rotation % 2 == 0 ? HEIGHT : WIDTH;
+    }
+
+    virtual void invertDisplay(bool) {}
+
+    int16_t getCursorX() const { return _cursorX; }
+    int16_t getCursorY() const { return _cursorY; }
+    uint8_t getRotation() const { return rotation; }
+    int16_t width() const { return _width; }
+    int16_t height() const { return _height; }
+};
+
+#endif
@@ -0,0 +1,81 @@
+/**
+ * A stand-in for the Adafruit LIS3DH library (I2C only). Rather than reading
+ * an accelerometer, read() takes x, y, and z (raw counts, like the real
+ * library's) from SketchRunner's input script as "lis3dh.x", "lis3dh.y", and
+ * "lis3dh.z". Without a script, the board lies flat: x and y are 0 and z is
+ * 1 g at the current range.
+ *
+ * Reading the real sensor's 6 bytes over I2C isn't modeled (Wire.h's
+ * requestFrom() gets nothing), so reads don't add to the I2C byte counts.
+ *
+ * Only used by SketchRunner.cpp and the sketches it builds.
+ *
+ * By Jon E. Froehlich
+ * @jonfroehlich
+ * http://makeabilitylab.io
+ *
+ */
+#ifndef HOST_ADAFRUIT_LIS3DH_H
+#define HOST_ADAFRUIT_LIS3DH_H
+
+#include <Arduino.h>
+#include <Wire.h>
+#include <Adafruit_Sensor.h>
+
+typedef enum {
+  LIS3DH_RANGE_16_G = 0b11,
+  LIS3DH_RANGE_8_G = 0b10,
+  LIS3DH_RANGE_4_G = 0b01,
+  LIS3DH_RANGE_2_G = 0b00
+} lis3dh_range_t;
+
+class Adafruit_LIS3DH{
+
+  private:
+    lis3dh_range_t _range;
+
+    // Raw counts per g at each range (the real library's divisors)
+    float getCountsPerG() const {
+      switch (_range) {
+        case LIS3DH_RANGE_16_G: return 1365;
+        case LIS3DH_RANGE_8_G: return 4096;
+        case LIS3DH_RANGE_4_G: return 8190;
+        default: return 16380;
+      }
+    }
+
+  public:
+    int16_t x, y, z;
+    float x_g, y_g, z_g;
+
+    Adafruit_LIS3DH(TwoWire* = &Wire) : _range(LIS3DH_RANGE_2_G), x(0), y(0), z(0), x_g(0), y_g(0), z_g(0) {}
+
+    bool begin(uint8_t = 0x18, uint8_t = 0x33) {
+      return true;
+    }
+
+    void setRange(lis3dh_range_t range) { _range = range; }
+    lis3dh_range_t getRange() { return _range; }
+
+    void read() {
+      float countsPerG = getCountsPerG();
+      x = (int16_t)hostReadInput("lis3dh.x", 0);
+      y = (int16_t)hostReadInput("lis3dh.y", 0);
+      z = (int16_t)hostReadInput("lis3dh.z", (long)countsPerG);
+      x_g = x / countsPerG;
+      y_g = y / countsPerG;
+      z_g = z / countsPerG;
+    }
+
+    bool getEvent(sensors_event_t* event) {
+      memset(event, 0, sizeof(sensors_event_t));
+      read();
+      event->timestamp = millis();
+      event->acceleration.x = x_g * SENSORS_GRAVITY_STANDARD;
+      event->acceleration.y = y_g * SENSORS_GRAVITY_STANDARD;
+      event->acceleration.z = z_g * SENSORS_GRAVITY_STANDARD;
+      return true;
+    }
+};
+
+#endif
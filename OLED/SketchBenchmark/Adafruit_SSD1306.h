@@ -0,0 +1,289 @@
+/**
+ * A stand-in for the Adafruit SSD1306 library (I2C only), for running sketches
+ * under SketchRunner.cpp. The framebuffer layout, rotation, clipping, and the
+ * bytes that begin(), display(), and the other commands send over I2C are the
+ * same as the real library's, so Wire.h's model of the display's RAM ends up
+ * with what a real screen would show.
+ *
+ * It also counts, for SketchRunner's per-frame stats:
+ *  - numDrawCalls: calls to drawPixel(), drawFastHLine(), and drawFastVLine(),
+ *    which Adafruit_GFX builds everything else on
+ *  - numPixelWrites: framebuffer pixels those calls set or cleared (pixels
+ *    off the screen aren't counted)
+ *
+ * Unlike the real library, begin() doesn't draw the Adafruit splash screen
+ * into the framebuffer, so a sketch that calls display() before drawing
+ * anything shows a blank screen rather than the logo.
+ *
+ * Only used by SketchRunner.cpp and the sketches it builds.
+ *
+ * By Jon E. Froehlich
+ * @jonfroehlich
+ * http://makeabilitylab.io
+ *
+ */
+#ifndef HOST_ADAFRUIT_SSD1306_H
+#define HOST_ADAFRUIT_SSD1306_H
+
+#include <Arduino.h>
+#include <Wire.h>
+#include <Adafruit_GFX.h>
+
+#define SSD1306_BLACK 0
+#define SSD1306_WHITE 1
+#define SSD1306_INVERSE 2
+#define BLACK SSD1306_BLACK
+#define WHITE SSD1306_WHITE
+#define INVERSE SSD1306_INVERSE
+
+#define SSD1306_MEMORYMODE 0x20
+#define SSD1306_COLUMNADDR 0x21
+#define SSD1306_PAGEADDR 0x22
+#define SSD1306_SETCONTRAST 0x81
+#define SSD1306_CHARGEPUMP 0x8D
+#define SSD1306_SEGREMAP 0xA0
+#define SSD1306_DISPLAYALLON_RESUME 0xA4
+#define SSD1306_NORMALDISPLAY 0xA6
+#define SSD1306_INVERTDISPLAY 0xA7
+#define SSD1306_SETMULTIPLEX 0xA8
+#define SSD1306_DISPLAYOFF 0xAE
+#define SSD1306_DISPLAYON 0xAF
+#define SSD1306_COMSCANDEC 0xC8
+#define SSD1306_SETDISPLAYOFFSET 0xD3
+#define SSD1306_SETDISPLAYCLOCKDIV 0xD5
+#define SSD1306_SETPRECHARGE 0xD9
+#define SSD1306_SETCOMPINS 0xDA
+#define SSD1306_SETVCOMDETECT 0xDB
+#define SSD1306_SETSTARTLINE 0x40
+#define SSD1306_DEACTIVATE_SCROLL 0x2E
+#define SSD1306_EXTERNALVCC 0x01
+#define SSD1306_SWITCHCAPVCC 0x02
+
+class Adafruit_SSD1306 : public Adafruit_GFX{
+
+  public:
+    static unsigned long numDrawCalls;
+    static unsigned long numPixelWrites;
+
+  private:
+    TwoWire* _wire;
+    uint8_t _i2cAddress;
+    uint8_t* _buffer;
+    uint8_t _vccState;
+    uint8_t _contrast;
+    uint32_t _wireClock;
+    uint32_t _restoreClock;
+
+    // Sets a pixel in the SSD1306's own (unrotated) coordinates, which must be on the screen
+    void setPixel(int16_t x, int16_t y, uint16_t color) {
+      uint8_t& b = _buffer[x + (y / 8) * WIDTH];
+      uint8_t bit = 1 << (y & 7);
+      switch (color) {
+        case SSD1306_WHITE: b |= bit; break;
+        case SSD1306_BLACK: b &= ~bit; break;
+        case SSD1306_INVERSE: b ^= bit; break;
+        default: return;
+      }
+      numPixelWrites++;
+    }
+
+    void rotate(int16_t& x, int16_t& y) {
+      int16_t t;
+      switch (rotation) {
+        case 1: t = x; x = WIDTH - y - 1; y = t; break;
+        case 2: x = WIDTH - x - 1; y = HEIGHT - y - 1; break;
+        case 3: t = x; x = y; y = HEIGHT - t - 1; break;
+      }
+    }
+
+    // Clips the line to the (rotated) screen, then sets its pixels
+    void drawLineInternal(int16_t x, int16_t y, int16_t length, bool isHorizontal, uint16_t color) {
+      int16_t along = isHorizontal ? x : y;
+      int16_t across = isHorizontal ? y : x;
+      int16_t alongMax = isHorizontal ? width() : height();
+      int16_t acrossMax = isHorizontal ? height() : width();
+      if (across < 0 || across >= acrossMax) {
+        return;
+      }
+      if (along < 0) {
+        length += along;
+        along = 0;
+      }
+      if (along + length > alongMax) {
+        length = alongMax - along;
+      }
+      for (int16_t i = 0; i < length; i++) {
+        int16_t px = isHorizontal ? along + i : across;
+        int16_t py = isHorizontal ? across : along + i;
+        rotate(px, py);
+        setPixel(px, py, color);
+      }
+    }
+
+    // Adafruit_SSD1306::ssd1306_commandList(): as few transmissions as fit in the Wire buffer
+    void commandList(const uint8_t* commands, uint8_t numCommands) {
+      _wire->beginTransmission(_i2cAddress);
+      _wire->write((uint8_t)0x00);  // Co = 0, D/C = 0
+      uint16_t bytesOut = 1;
+      while (numCommands--) {
+        if (bytesOut >= BUFFER_LENGTH) {
+          _wire->endTransmission();
+          _wire->beginTransmission(_i2cAddress);
+          _wire->write((uint8_t)0x00);
+          bytesOut = 1;
+        }
+        _wire->write(*commands++);
+        bytesOut++;
+      }
+      _wire->endTransmission();
+    }
+
+    void command1(uint8_t c) {
+      _wire->beginTransmission(_i2cAddress);
+      _wire->write((uint8_t)0x00);
+      _wire->write(c);
+      _wire->endTransmission();
+    }
+
+  public:
+    Adafruit_SSD1306(uint8_t w, uint8_t h, TwoWire* twi = &Wire, int8_t = -1,
+                     uint32_t clkDuring = 400000UL, uint32_t clkAfter = 100000UL)
+      : Adafruit_GFX(w, h), _wire(twi), _i2cAddress(0), _buffer(NULL), _vccState(SSD1306_SWITCHCAPVCC),
+        _contrast(0x8F), _wireClock(clkDuring), _restoreClock(clkAfter) {
+    }
+
+    ~Adafruit_SSD1306() {
+      delete[] _buffer;
+    }
+
+    // Adafruit_SSD1306::begin()'s init sequence
+    bool begin(uint8_t vccState = SSD1306_SWITCHCAPVCC, uint8_t i2caddr = 0, bool = true, bool = true) {
+      if (_buffer == NULL) {
+        _buffer = new uint8_t[WIDTH * ((HEIGHT + 7) / 8)];
+      }
+      clearDisplay();
+
+      _vccState = vccState;
+      _i2cAddress = i2caddr != 0 ? i2caddr : (HEIGHT == 32 ? 0x3C : 0x3D);
+      _wire->begin();
+      _wire->setClock(_wireClock);
+
+      const uint8_t init1[] = { SSD1306_DISPLAYOFF, SSD1306_SETDISPLAYCLOCKDIV, 0x80, SSD1306_SETMULTIPLEX };
+      commandList(init1, sizeof(init1));
+      command1(HEIGHT - 1);
+
+      const uint8_t init2[] = { SSD1306_SETDISPLAYOFFSET, 0x00, SSD1306_SETSTARTLINE | 0x0, SSD1306_CHARGEPUMP };
+      commandList(init2, sizeof(init2));
+      command1(vccState == SSD1306_EXTERNALVCC ? 0x10 : 0x14);
+
+      const uint8_t init3[] = { SSD1306_MEMORYMODE, 0x00, SSD1306_SEGREMAP | 0x1, SSD1306_COMSCANDEC };
+      commandList(init3, sizeof(init3));
+
+      uint8_t comPins = 0x02;
+      _contrast = 0x8F;
+      if (WIDTH == 128 && HEIGHT == 64) {
+        comPins = 0x12;
+        _contrast = vccState == SSD1306_EXTERNALVCC ? 0x9F : 0xCF;
+      } else if (WIDTH == 96 && HEIGHT == 16) {
+        comPins = 0x02;
+        _contrast = vccState == SSD1306_EXTERNALVCC ? 0x10 : 0xAF;
+      }
+      command1(SSD1306_SETCOMPINS);
+      command1(comPins);
+      command1(SSD1306_SETCONTRAST);
+      command1(_contrast);
+
+      command1(SSD1306_SETPRECHARGE);
+      command1(vccState == SSD1306_EXTERNALVCC ? 0x22 : 0xF1);
+      const uint8_t init5[] = { SSD1306_SETVCOMDETECT, 0x40, SSD1306_DISPLAYALLON_RESUME,
+                                SSD1306_NORMALDISPLAY, SSD1306_DEACTIVATE_SCROLL, SSD1306_DISPLAYON };
+      commandList(init5, sizeof(init5));
+
+      _wire->setClock(_restoreClock);
+      return true;
+    }
+
+    void drawPixel(int16_t x, int16_t y, uint16_t color) override {
+      numDrawCalls++;
+      if (x < 0 || x >= width() || y < 0 || y >= height()) {
+        return;
+      }
+      rotate(x, y);
+      setPixel(x, y, color);
+    }
+
+    // Like the real library, lines are set directly rather than a pixel at a time through drawPixel()
+    void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override {
+      numDrawCalls++;
+      drawLineInternal(x, y, w, true, color);
+    }
+
+    void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override {
+      numDrawCalls++;
+      drawLineInternal(x, y, h, false, color);
+    }
+
+    void clearDisplay() {
+      memset(_buffer, 0, WIDTH * ((HEIGHT + 7) / 8));
+    }
+
+    uint8_t* getBuffer() {
+      return _buffer;
+    }
+
+    bool getPixel(int16_t x, int16_t y) {
+      if (x < 0 || x >= width() || y < 0 || y >= height()) {
+        return false;
+      }
+      rotate(x, y);
+      return (_buffer[x + (y / 8) * WIDTH] & (1 << (y & 7))) != 0;
+    }
+
+    // Adafruit_SSD1306::display(): the whole framebuffer, every time
+    void display() {
+      _wire->setClock(_wireClock);
+      const uint8_t commands[] = { SSD1306_PAGEADDR, 0, 0xFF, SSD1306_COLUMNADDR, 0 };
+      commandList(commands, sizeof(commands));
+      command1(WIDTH - 1);
+
+      uint16_t count = WIDTH * ((HEIGHT + 7) / 8);
+      uint8_t* ptr = _buffer;
+      _wire->beginTransmission(_i2cAddress);
+      _wire->write((uint8_t)0x40);  // Co = 0, D/C = 1
+      uint16_t bytesOut = 1;
+      while (count--) {
+        if (bytesOut >= BUFFER_LENGTH) {
+          _wire->endTransmission();
+          _wire->beginTransmission(_i2cAddress);
+          _wire->write((uint8_t)0x40);
+          bytesOut = 1;
+        }
+        _wire->write(*ptr++);
+        bytesOut++;
+      }
+      _wire->endTransmission();
+      _wire->setClock(_restoreClock);
+    }
+
+    void ssd1306_command(uint8_t c) {
+      _wire->setClock(_wireClock);
+      command1(c);
+      _wire->setClock(_restoreClock);
+    }
+
+    void invertDisplay(bool i) override {
+      ssd1306_command(i ? SSD1306_INVERTDISPLAY : SSD1306_NORMALDISPLAY);
+    }
+
+    void dim(bool dim) {
+      ssd1306_command(SSD1306_SETCONTRAST);
+      ssd1306_command(dim ? 0 : _contrast);
+    }
+
+    // Scrolling is done by the panel, which the model in Wire.h doesn't do
+    void startscrollright(uint8_t, uint8_t) {}
+    void startscrollleft(uint8_t, uint8_t) {}
+    void stopscroll() { ssd1306_command(SSD1306_DEACTIVATE_SCROLL); }
+};
+
+#endif
@@ -0,0 +1,33 @@
+/**
+ * A stand-in for the Adafruit Unified Sensor library: just the event type
+ * that Adafruit_LIS3DH.h fills in. Only used by SketchRunner.cpp and the
+ * sketches it builds.
+ *
+ * By Jon E. Froehlich
+ * @jonfroehlich
+ * http://makeabilitylab.io
+ *
+ */
+#ifndef HOST_ADAFRUIT_SENSOR_H
+#define HOST_ADAFRUIT_SENSOR_H
+
+#include <Arduino.h>
+
+#define SENSORS_GRAVITY_STANDARD 9.80665F
+
+typedef struct {
+  float x;
+  float y;
+  float z;
+} sensors_vec_t;
+
+typedef struct {
+  int32_t version;
+  int32_t sensor_id;
+  int32_t type;
+  int32_t reserved0;
+  int32_t timestamp;
+  sensors_vec_t acceleration;
+} sensors_event_t;
+
+#endif
@@ -0,0 +1,319 @@
+/**
+ * A stand-in for the Arduino core, so sketches can run on a desktop computer
+ * (Linux or Mac) under SketchRunner.cpp. Time is simulated: millis() and
+ * micros() only move when the sketch calls delay(), sends bytes over I2C (at
+ * the Wire clock), or finishes a loop(). Inputs come from a script (see
+ * SketchRunner.cpp), so a run is the same every time.
+ *
+ * Differences from an Uno to keep in mind:
+ *  - int is 32 bits here, not 16, so code that relies on int overflowing
+ *    won't behave the same
+ *  - random() is avr-libc's generator, so a seed gives the same numbers as
+ *    on an AVR
+ *  - String is a small version of Arduino's (built on std::string) with
+ *    just the commonly used parts
+ *
+ * Only used by SketchRunner.cpp and the sketches it builds; don't copy this
+ * into a sketch folder.
+ *
+ * By Jon E. Froehlich
+ * @jonfroehlich
+ * http://makeabilitylab.io
+ *
+ */
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <stdio.h>
+#include <type_traits>
+#include <string>
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+#define HIGH 0x1
+#define LOW 0x0
+
+#define INPUT 0x0
+#define OUTPUT 0x1
+#define INPUT_PULLUP 0x2
+
+#define PI 3.1415926535897932384626433832795
+#define HALF_PI 1.5707963267948966192313216916398
+#define TWO_PI 6.283185307179586476925286766559
+#define DEG_TO_RAD 0.017453292519943295769236907684886
+#define RAD_TO_DEG 57.295779513082320876798154814105
+
+#define DEC 10
+#define HEX 16
+#define OCT 8
+#define BIN 2
+
+// An Uno's pins
+#define LED_BUILTIN 13
+#define A0 14
+#define A1 15
+#define A2 16
+#define A3 17
+#define A4 18
+#define A5 19
+#define A6 20
+#define A7 21
+
+// Like Arduino's macros, these work for any mix of types
+template<typename A, typename B>
+inline auto min(A a, B b) -> typename std::remove_reference<decltype(a < b ? a : b)>::type { return b < a ? b : a; }
+template<typename A, typename B>
+inline auto max(A a, B b) -> typename std::remove_reference<decltype(a < b ? a : b)>::type { return a < b ? b : a; }
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+#define sq(x) ((x) * (x))
+#define radians(deg) ((deg) * DEG_TO_RAD)
+#define degrees(rad) ((rad) * RAD_TO_DEG)
+
+// Desktop computers read constants from flash like any other memory
+#define PROGMEM
+#define pgm_read_byte(addr) (*(const uint8_t*)(addr))
+#define pgm_read_word(addr) (*(const uint16_t*)(addr))
+class __FlashStringHelper;
+#define F(text) (reinterpret_cast<const __FlashStringHelper*>(text))
+
+// Implemented by SketchRunner.cpp
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+void pinMode(uint8_t pin, uint8_t mode);
+int digitalRead(uint8_t pin);
+void digitalWrite(uint8_t pin, uint8_t value);
+int analogRead(uint8_t pin);
+void analogWrite(uint8_t pin, int value);
+void tone(uint8_t pin, unsigned int frequency, unsigned long durationMs = 0);
+void noTone(uint8_t pin);
+long random(long howBig);
+long random(long howSmall, long howBig);
+void randomSeed(unsigned long seed);
+void yield();
+
+// Also implemented by SketchRunner.cpp, for the other stand-ins (not in the real core)
+void hostAdvanceNanos(double ns);                          // moves simulated time forward
+long hostReadInput(const char* name, long defaultValue);  // an input from the script, like "lis3dh.x"
+
+inline long map(long x, long inMin, long inMax, long outMin, long outMax) {
+  return (x - inMin) * (outMax - outMin) / (inMax - inMin) + outMin;
+}
+
+// Arduino's String class: the parts sketches commonly use
+class String{
+
+  private:
+    std::string _text;
+
+    static std::string fromNumber(unsigned long n, uint8_t base, bool isNegative) {
+      char digits[8 * sizeof(long) + 2];
+      char* str = &digits[sizeof(digits) - 1];
+      *str = '\0';
+      do {
+        char c = n % base;
+        n /= base;
+        *--str = c < 10 ? c + '0' : c + 'a' - 10;
+      } while (n);
+      if (isNegative) {
+        *--str = '-';
+      }
+      return str;
+    }
+
+  public:
+    String(const char* text = "") : _text(text != NULL ? text : "") {}
+    String(const __FlashStringHelper* text) : _text(reinterpret_cast<const char*>(text)) {}
+    explicit String(char c) : _text(1, c) {}
+    String(int n, uint8_t base = 10) : _text(fromNumber(n < 0 && base == 10 ? -(long)n : (unsigned int)n, base, n < 0 && base == 10)) {}
+    String(unsigned int n, uint8_t base = 10) : _text(fromNumber(n, base, false)) {}
+    String(long n, uint8_t base = 10) : _text(fromNumber(n < 0 && base == 10 ? 0UL - (unsigned long)n : (unsigned long)n, base, n < 0 && base == 10)) {}
+    String(unsigned long n, uint8_t base = 10) : _text(fromNumber(n, base, false)) {}
+    String(double n, uint8_t decimalPlaces = 2) {
+      char text[40];
+      snprintf(text, sizeof(text), "%.*f", decimalPlaces, n);
+      _text = text;
+    }
+
+    const char* c_str() const { return _text.c_str(); }
+    unsigned int length() const { return _text.length(); }
+    char charAt(unsigned int i) const { return i < _text.length() ? _text[i] : 0; }
+    char operator[](unsigned int i) const { return charAt(i); }
+    bool equals(const String& other) const { return _text == other._text; }
+    bool operator==(const String& other) const { return equals(other); }
+    bool operator!=(const String& other) const { return !equals(other); }
+    long toInt() const { return atol(_text.c_str()); }
+    float toFloat() const { return atof(_text.c_str()); }
+
+    int indexOf(char c, unsigned int from = 0) const {
+      size_t i = _text.find(c, from);
+      return i == std::string::npos ? -1 : (int)i;
+    }
+
+    String substring(unsigned int from, unsigned int to = (unsigned int)-1) const {
+      if (from > _text.length()) {
+        return String();
+      }
+      return String(_text.substr(from, to > from ? to - from : 0).c_str());
+    }
+
+    String& operator+=(const String& other) { _text += other._text; return *this; }
+    String& operator+=(const char* other) { _text += other; return *this; }
+    String& operator+=(char c) { _text += c; return *this; }
+    bool concat(const String& other) { _text += other._text; return true; }
+
+    // Any mix of Strings, text, and numbers, like (String)"x:" + x
+    template<typename T>
+    friend String operator+(const String& lhs, const T& rhs) {
+      String result(lhs);
+      result += String(rhs);
+      return result;
+    }
+
+    friend String operator+(const String& lhs, char c) {
+      String result(lhs);
+      result += c;
+      return result;
+    }
+};
+
+// Arduino's Print class, which Serial and the displays share
+class Print{
+
+  private:
+    size_t printNumber(unsigned long n, uint8_t base) {
+      char digits[8 * sizeof(long) + 1];
+      char* str = &digits[sizeof(digits) - 1];
+      *str = '\0';
+      if (base < 2) {
+        base = 10;
+      }
+      do {
+        char c = n % base;
+        n /= base;
+        *--str = c < 10 ? c + '0' : c + 'A' - 10;
+      } while (n);
+      return write(str);
+    }
+
+    // Print::printFloat(), in floats like on an AVR (where double is the same as float)
+    size_t printFloat(float number, uint8_t digits) {
+      if (isnan(number)) return write("nan");
+      if (isinf(number)) return write("inf");
+      if (number > 4294967040.0f) return write("ovf");
+      if (number < -4294967040.0f) return write("ovf");
+
+      size_t n = 0;
+      if (number < 0.0f) {
+        n += write('-');
+        number = -number;
+      }
+      float rounding = 0.5f;
+      for (uint8_t i = 0; i < digits; ++i) {
+        rounding /= 10.0f;
+      }
+      number += rounding;
+
+      unsigned long intPart = (unsigned long)number;
+      float remainder = number - (float)intPart;
+      n += printNumber(intPart, 10);
+      if (digits > 0) {
+        n += write('.');
+      }
+      while (digits-- > 0) {
+        remainder *= 10.0f;
+        unsigned int toPrint = (unsigned int)remainder;
+        n += printNumber(toPrint, 10);
+        remainder -= toPrint;
+      }
+      return n;
+    }
+
+  public:
+    virtual ~Print() {}
+
+    virtual size_t write(uint8_t c) = 0;
+
+    size_t write(const char* str) {
+      size_t n = 0;
+      while (*str != '\0') {
+        n += write((uint8_t)*str++);
+      }
+      return n;
+    }
+
+    size_t write(const uint8_t* buffer, size_t size) {
+      size_t n = 0;
+      while (size--) {
+        n += write(*buffer++);
+      }
+      return n;
+    }
+
+    size_t print(const __FlashStringHelper* str) { return write(reinterpret_cast<const char*>(str)); }
+    size_t print(const char* str) { return write(str); }
+    size_t print(const String& str) { return write(str.c_str()); }
+    size_t print(char c) { return write((uint8_t)c); }
+    size_t print(unsigned char b, int base = DEC) { return print((unsigned long)b, base); }
+    size_t print(int n, int base = DEC) { return print((long)n, base); }
+    size_t print(unsigned int n, int base = DEC) { return print((unsigned long)n, base); }
+    size_t print(double n, int digits = 2) { return printFloat((float)n, digits); }
+
+    size_t print(long n, int base = DEC) {
+      if (base == 0) {
+        return write((uint8_t)n);
+      }
+      if (base == 10 && n < 0) {
+        return write('-') + printNumber(0UL - (unsigned long)n, 10);
+      }
+      return printNumber((unsigned long)n, base);
+    }
+
+    size_t print(unsigned long n, int base = DEC) {
+      return base == 0 ? write((uint8_t)n) : printNumber(n, base);
+    }
+
+    size_t println() { return write("\r\n"); }
+    size_t println(const String& str) { return print(str) + println(); }
+
+    template<typename T>
+    size_t println(T value) { return print(value) + println(); }
+
+    template<typename T>
+    size_t println(T value, int format) { return print(value, format) + println(); }
+};
+
+// Serial output goes to the terminal if SketchRunner was run with --serial
+class HardwareSerial : public Print{
+
+  public:
+    bool echo;
+
+    HardwareSerial() : echo(false) {}
+
+    void begin(unsigned long) {}
+    void end() {}
+    int available() { return 0; }
+    int read() { return -1; }
+    int peek() { return -1; }
+    void flush() {}
+    operator bool() { return true; }
+
+    using Print::write;
+    size_t write(uint8_t c) override {
+      if (echo) {
+        putchar(c);
+      }
+      return 1;
+    }
+};
+
+extern HardwareSerial Serial;
+
+#endif
@@ -0,0 +1,52 @@
+/**
+ * A stand-in for ParallaxJoystick.hpp from the MakeabilityLab_Arduino_Library.
+ * read() reads the joystick's two analog pins, which come from SketchRunner's
+ * input script like any analogRead().
+ *
+ * The real library can flip the up/down axis when the joystick is mounted
+ * sideways (JoystickYDirection). Here the pins are read as they are, which is
+ * enough to move the paddles and the player's ball around in a benchmark.
+ *
+ * Only used by SketchRunner.cpp and the sketches it builds.
+ *
+ * By Jon E. Froehlich
+ * @jonfroehlich
+ * http://makeabilitylab.io
+ *
+ */
+#ifndef HOST_PARALLAX_JOYSTICK_HPP
+#define HOST_PARALLAX_JOYSTICK_HPP
+
+#include <Arduino.h>
+
+enum JoystickYDirection{
+  UP,
+  RIGHT
+};
+
+class ParallaxJoystick{
+
+  private:
+    const int _upDownPin;
+    const int _leftRightPin;
+    const int _maxAnalogValue;
+    int _upDownVal;
+    int _leftRightVal;
+
+  public:
+    ParallaxJoystick(int upDownPin, int leftRightPin, int maxAnalogValue, JoystickYDirection /* yDirection */)
+      : _upDownPin(upDownPin), _leftRightPin(leftRightPin), _maxAnalogValue(maxAnalogValue),
+        _upDownVal(maxAnalogValue / 2), _leftRightVal(maxAnalogValue / 2) {
+    }
+
+    void read() {
+      _upDownVal = analogRead(_upDownPin);
+      _leftRightVal = analogRead(_leftRightPin);
+    }
+
+    int getUpDownVal() const { return _upDownVal; }
+    int getLeftRightVal() const { return _leftRightVal; }
+    int getMaxAnalogValue() const { return _maxAnalogValue; }
+};
+
+#endif
@@ -0,0 +1,13 @@
+/**
+ * A stand-in for the Arduino SPI library. The sketches SketchRunner.cpp builds
+ * include it but only talk I2C, so it's empty.
+ *
+ * By Jon E. Froehlich
+ * @jonfroehlich
+ * http://makeabilitylab.io
+ *
+ */
+#ifndef HOST_SPI_H
+#define HOST_SPI_H
+
+#endif
@@ -0,0 +1,186 @@
+/**
+ * A stand-in for Shape.hpp from the MakeabilityLab_Arduino_Library, with the
+ * parts Pong and CollisionTest use: Shape, Rectangle, Circle, and Ball. A
+ * shape is a bounding box (x and y are its top-left corner) that draws itself
+ * with Adafruit_GFX's drawRect()/fillRect() or drawCircle()/fillCircle().
+ *
+ * Circles overlap circles if their centers are closer than their radii, and
+ * rectangles if the closest point of the rectangle is inside the circle; two
+ * rectangles overlap if their boxes do. The real library's math may differ
+ * by a pixel at the edges, so the frames of sketches that use it are close
+ * to, not exactly, what they'd draw on a real display.
+ *
+ * Only used by SketchRunner.cpp and the sketches it builds.
+ *
+ * By Jon E. Froehlich
+ * @jonfroehlich
+ * http://makeabilitylab.io
+ *
+ */
+#ifndef HOST_SHAPE_HPP
+#define HOST_SHAPE_HPP
+
+#include <Arduino.h>
+#include <Adafruit_SSD1306.h>
+
+class Circle;
+
+class Shape{
+
+  protected:
+    int _x, _y;
+    int _width, _height;
+    bool _drawFill;
+    bool _drawBoundingBox;
+
+  public:
+    Shape(int x, int y, int width, int height)
+      : _x(x), _y(y), _width(width), _height(height), _drawFill(false), _drawBoundingBox(false) {
+    }
+
+    virtual ~Shape() {}
+
+    int getX() const { return _x; }
+    int getY() const { return _y; }
+    int getWidth() const { return _width; }
+    int getHeight() const { return _height; }
+    int getLeft() const { return _x; }
+    int getTop() const { return _y; }
+    int getRight() const { return _x + _width; }
+    int getBottom() const { return _y + _height; }
+
+    void setX(int x) { _x = x; }
+    void setY(int y) { _y = y; }
+    void setLocation(int x, int y) { _x = x; _y = y; }
+    virtual void setDimensions(int width, int height) { _width = width; _height = height; }
+    void setDrawFill(bool drawFill) { _drawFill = drawFill; }
+    void setDrawBoundingBox(bool drawBoundingBox) { _drawBoundingBox = drawBoundingBox; }
+
+    /**
+     * Moves the shape back inside the rectangle (x, y, width, height) if any of it is outside
+     */
+    void forceInside(int x, int y, int width, int height) {
+      if (_x < x) {
+        _x = x;
+      } else if (getRight() > x + width) {
+        _x = x + width - _width;
+      }
+      if (_y < y) {
+        _y = y;
+      } else if (getBottom() > y + height) {
+        _y = y + height - _height;
+      }
+    }
+
+    virtual const Circle* asCircle() const { return NULL; }
+
+    virtual bool overlaps(const Shape& shape) const;
+
+    virtual void draw(Adafruit_SSD1306& display) {
+      if (_drawBoundingBox) {
+        display.drawRect(_x, _y, _width, _height, SSD1306_WHITE);
+      }
+    }
+};
+
+class Rectangle : public Shape{
+
+  public:
+    Rectangle(int x, int y, int width, int height) : Shape(x, y, width, height) {}
+
+    void draw(Adafruit_SSD1306& display) override {
+      if (_drawFill) {
+        display.fillRect(_x, _y, _width, _height, SSD1306_WHITE);
+      } else {
+        display.drawRect(_x, _y, _width, _height, SSD1306_WHITE);
+      }
+      Shape::draw(display);
+    }
+};
+
+class Circle : public Shape{
+
+  protected:
+    int _radius;
+
+  public:
+    // x and y are the circle's center
+    Circle(int x, int y, int radius) : Shape(x - radius, y - radius, radius * 2, radius * 2), _radius(radius) {}
+
+    int getRadius() const { return _radius; }
+    int getCenterX() const { return _x + _radius; }
+    int getCenterY() const { return _y + _radius; }
+
+    void setCenter(int x, int y) { setLocation(x - _radius, y - _radius); }
+
+    void setDimensions(int width, int height) override {
+      _radius = min(width, height) / 2;
+      Shape::setDimensions(_radius * 2, _radius * 2);
+    }
+
+    const Circle* asCircle() const override { return this; }
+
+    bool overlaps(const Shape& shape) const override {
+      const Circle* circle = shape.asCircle();
+      if (circle != NULL) {
+        long dx = getCenterX() - circle->getCenterX();
+        long dy = getCenterY() - circle->getCenterY();
+        long radii = _radius + circle->getRadius();
+        return dx * dx + dy * dy <= radii * radii;
+      }
+
+      // The point of the rectangle closest to the center
+      long dx = getCenterX() - constrain(getCenterX(), shape.getLeft(), shape.getRight());
+      long dy = getCenterY() - constrain(getCenterY(), shape.getTop(), shape.getBottom());
+      return dx * dx + dy * dy <= (long)_radius * _radius;
+    }
+
+    void draw(Adafruit_SSD1306& display) override {
+      if (_drawFill) {
+        display.fillCircle(getCenterX(), getCenterY(), _radius, SSD1306_WHITE);
+      } else {
+        display.drawCircle(getCenterX(), getCenterY(), _radius, SSD1306_WHITE);
+      }
+      Shape::draw(display);
+    }
+};
+
+inline bool Shape::overlaps(const Shape& shape) const {
+  if (shape.asCircle() != NULL) {
+    return shape.overlaps(*this);
+  }
+  return getLeft() <= shape.getRight() && getRight() >= shape.getLeft() &&
+         getTop() <= shape.getBottom() && getBottom() >= shape.getTop();
+}
+
+class Ball : public Circle{
+
+  protected:
+    int _xSpeed, _ySpeed;
+
+  public:
+    Ball(int x, int y, int radius) : Circle(x, y, radius), _xSpeed(0), _ySpeed(0) {}
+
+    int getXSpeed() const { return _xSpeed; }
+    int getYSpeed() const { return _ySpeed; }
+    void setSpeed(int xSpeed, int ySpeed) { _xSpeed = xSpeed; _ySpeed = ySpeed; }
+    void reverseXSpeed() { _xSpeed = -_xSpeed; }
+    void reverseYSpeed() { _ySpeed = -_ySpeed; }
+
+    /**
+     * Returns true if the ball is at or past yMin or yMax
+     */
+    bool checkYBounce(int yMin, int yMax) const {
+      return getTop() <= yMin || getBottom() >= yMax;
+    }
+
+    /**
+     * Moves the ball by its speed
+     */
+    void update() {
+      _x += _xSpeed;
+      _y += _ySpeed;
+    }
+};
+
+#endif
@@ -0,0 +1,508 @@
+/**
+ * Runs an OLED sketch on a desktop computer (Linux or Mac), without an
+ * Arduino or a display, and measures what each frame costs. run_benchmarks.py
+ * (in this folder) turns a sketch's .ino into C++ and builds it with this file
+ * and the stand-in libraries in this folder:
+ *
+ *  - Arduino.h: simulated time and scripted inputs (see below)
+ *  - Wire.h: counts and logs every byte sent over I2C and sends what goes to
+ *    the display to a model of the SSD1306's display RAM (what's on screen)
+ *  - Adafruit_GFX.h and Adafruit_SSD1306.h: the same drawing algorithms and
+ *    I2C traffic as the real libraries, counting draw calls and pixels
+ *  - Adafruit_LIS3DH.h: an accelerometer that reads from the input script
+ *  - Shape.hpp and ParallaxJoystick.hpp: the parts of the MakeabilityLab
+ *    Arduino library that Pong and CollisionTest use
+ *
+ * It calls setup() and then loop() until the sketch has drawn the number of
+ * frames asked for. A frame is a loop() that sent anything to the display's
+ * RAM. For each frame it counts:
+ *
+ *  - Draw calls: drawPixel(), drawFastHLine(), and drawFastVLine() calls,
+ *    which Adafruit_GFX builds everything else on (e.g., a 5 px circle is 33)
+ *  - Pixel writes: framebuffer pixels those calls set or cleared
+ *  - Pixels changed: pixels on the screen that differ from the last frame
+ *  - I2C bytes: bytes sent over I2C, including addresses (1,102 for a full
+ *    128x64 display() from Adafruit_SSD1306)
+ *
+ * Time is simulated, so a run takes the same time and gives the same result
+ * every run. It moves forward when the sketch calls delay() or
+ * delayMicroseconds(), by how long each I2C transmission takes at the Wire
+ * clock, by ~112 us per analogRead() (like an Uno), and by --loop-us after
+ * each loop() for the sketch's own code. So, the fps it reports is how fast
+ * the sketch would run if it were limited by I2C, which it usually is.
+ *
+ * Inputs come from a script (--inputs), one change per line:
+ *
+ *    # time_ms  input     value
+ *    0          A0        512
+ *    1500       D5        0
+ *    2000       lis3dh.x  sine 0 4000 1000    (mean, amplitude, period_ms)
+ *
+ * where A0-A7 are analogRead() pins, D<n> are digitalRead() pins, and
+ * lis3dh.x, .y, and .z are the accelerometer. Each input keeps its value
+ * until its next line. Inputs that aren't in the script read 512 (analog),
+ * HIGH (digital pins set to INPUT_PULLUP) or LOW (other digital pins).
+ *
+ * Options:
+ *  --frames N       frames to run (default 100)
+ *  --inputs FILE    the input script
+ *  --loop-us US     simulated time each loop() takes, not counting delays
+ *                   and I2C (default 100)
+ *  --max-ms MS      stop with an error if the sketch hasn't finished by this
+ *                   simulated time, e.g., if it waits for an input that never
+ *                   comes (default 600000)
+ *  --pbm DIR        save the screen after frames as PBM images in DIR
+ *  --pbm-every K    only save (and compare) every Kth frame (default 1)
+ *  --golden DIR     compare the screen after those frames with the PBMs in
+ *                   DIR (saved earlier with --pbm) and exit with 1 if any differ
+ *  --i2c-log FILE   write every I2C transmission to FILE, one per line
+ *  --csv FILE       write each frame's counts to FILE
+ *  --serial         print what the sketch prints to Serial
+ *
+ * It ends with a summary and a "Summary key=value ..." line (for
+ * run_benchmarks.py).
+ *
+ * By Jon E. Froehlich
+ * @jonfroehlich
+ * http://makeabilitylab.io
+ *
+ */
+#include <Arduino.h>  // the host stand-ins in this folder (needs -I.)
+#include <Wire.h>
+#include <Adafruit_SSD1306.h>
+
+#include <map>
+#include <string>
+#include <vector>
+
+TwoWire Wire;
+HardwareSerial Serial;
+unsigned long Adafruit_SSD1306::numDrawCalls = 0;
+unsigned long Adafruit_SSD1306::numPixelWrites = 0;
+
+// The sketch's
+void setup();
+void loop();
+
+const double ANALOG_READ_NANOS = 112000;  // an Uno's analogRead() takes ~112 us
+const double DIGITAL_READ_NANOS = 4000;
+
+// Simulated time
+double _nowNanos = 0;
+double _maxNanos = 600000 * 1e6;
+
+// A change to one input from the script
+struct InputChange{
+  double timeMs;
+  bool isSine;
+  double value;     // the value, or the sine's mean
+  double amplitude;
+  double periodMs;
+};
+
+std::map<std::string, std::vector<InputChange> > _inputs;
+uint8_t _pinModes[64];
+
+uint32_t _randomState = 1;
+
+// Per-frame counts, for the summary
+struct FrameStats{
+  unsigned long timeMs;
+  double frameMs;
+  unsigned long numLoops;
+  unsigned long drawCalls;
+  unsigned long pixelWrites;
+  unsigned long pixelsChanged;
+  unsigned long i2cBytes;
+  unsigned long displayBytes;
+};
+
+void hostAdvanceNanos(double ns) {
+  _nowNanos += ns;
+  if (_nowNanos > _maxNanos) {
+    fprintf(stderr, "Error: the sketch was still running after %.0f ms (see --max-ms)\n", _maxNanos / 1e6);
+    exit(2);
+  }
+}
+
+long hostReadInput(const char* name, long defaultValue) {
+  std::map<std::string, std::vector<InputChange> >::const_iterator it = _inputs.find(name);
+  if (it == _inputs.end()) {
+    return defaultValue;
+  }
+
+  // The last change at or before now
+  double nowMs = _nowNanos / 1e6;
+  const InputChange* change = NULL;
+  for (size_t i = 0; i < it->second.size() && it->second[i].timeMs <= nowMs; i++) {
+    change = &it->second[i];
+  }
+  if (change == NULL) {
+    return defaultValue;
+  }
+  if (!change->isSine) {
+    return lround(change->value);
+  }
+  double phase = TWO_PI * (nowMs - change->timeMs) / change->periodMs;
+  return lround(change->value + change->amplitude * sin(phase));
+}
+
+unsigned long millis() {
+  return (uint32_t)(_nowNanos / 1e6);
+}
+
+unsigned long micros() {
+  return (uint32_t)(_nowNanos / 1e3);
+}
+
+void delay(unsigned long ms) {
+  hostAdvanceNanos(ms * 1e6);
+}
+
+void delayMicroseconds(unsigned int us) {
+  hostAdvanceNanos(us * 1e3);
+}
+
+void yield() {
+  hostAdvanceNanos(1000);
+}
+
+void pinMode(uint8_t pin, uint8_t mode) {
+  if (pin < sizeof(_pinModes)) {
+    _pinModes[pin] = mode;
+  }
+}
+
+int digitalRead(uint8_t pin) {
+  hostAdvanceNanos(DIGITAL_READ_NANOS);
+  char name[8];
+  snprintf(name, sizeof(name), "D%u", pin);
+  bool isPullup = pin < sizeof(_pinModes) && _pinModes[pin] == INPUT_PULLUP;
+  return hostReadInput(name, isPullup ? HIGH : LOW) != 0 ? HIGH : LOW;
+}
+
+void digitalWrite(uint8_t, uint8_t) {}
+
+int analogRead(uint8_t pin) {
+  hostAdvanceNanos(ANALOG_READ_NANOS);
+  char name[8];
+  snprintf(name, sizeof(name), "A%u", pin >= A0 ? pin - A0 : pin);
+  return constrain(hostReadInput(name, 512), 0L, 1023L);
+}
+
+void analogWrite(uint8_t, int) {}
+void tone(uint8_t, unsigned int, unsigned long) {}
+void noTone(uint8_t) {}
+
+// avr-libc's random(), so a seed gives the same numbers as on an AVR
+long random(long howBig) {
+  if (howBig == 0) {
+    return 0;
+  }
+  int32_t x = _randomState == 0 ? 123459876L : (int32_t)_randomState;
+  int32_t hi = x / 127773L;
+  int32_t lo = x % 127773L;
+  x = 16807L * lo - 2836L * hi;
+  if (x < 0) {
+    x += 0x7FFFFFFFL;
+  }
+  _randomState = x;
+  return (long)((uint32_t)x % ((uint32_t)0x7FFFFFFFUL + 1)) % howBig;
+}
+
+long random(long howSmall, long howBig) {
+  if (howSmall >= howBig) {
+    return howSmall;
+  }
+  return random(howBig - howSmall) + howSmall;
+}
+
+void randomSeed(unsigned long seed) {
+  if (seed != 0) {
+    _randomState = (uint32_t)seed;
+  }
+}
+
+bool loadInputs(const char* path) {
+  FILE* file = fopen(path, "r");
+  if (file == NULL) {
+    fprintf(stderr, "Error: can't open %s\n", path);
+    return false;
+  }
+  char line[256];
+  int lineNumber = 0;
+  while (fgets(line, sizeof(line), file) != NULL) {
+    lineNumber++;
+    char* comment = strchr(line, '#');
+    if (comment != NULL) {
+      *comment = '\0';
+    }
+    char name[32], value[32];
+    InputChange change = { 0, false, 0, 0, 0 };
+    int numFields = sscanf(line, "%lf %31s %31s %lf %lf %lf", &change.timeMs, name, value,
+                           &change.value, &change.amplitude, &change.periodMs);
+    if (numFields <= 0) {
+      continue;
+    }
+    if (strcmp(value, "sine") == 0 && numFields == 6 && change.periodMs > 0) {
+      change.isSine = true;
+    } else if (numFields == 3) {
+      change.value = atof(value);
+    } else {
+      fprintf(stderr, "Error: %s:%d should be 'time_ms input value' or "
+              "'time_ms input sine mean amplitude period_ms'\n", path, lineNumber);
+      fclose(file);
+      return false;
+    }
+    std::vector<InputChange>& changes = _inputs[name];
+    if (!changes.empty() && changes.back().timeMs > change.timeMs) {
+      fprintf(stderr, "Error: %s:%d is earlier than the line before it for %s\n", path, lineNumber, name);
+      fclose(file);
+      return false;
+    }
+    changes.push_back(change);
+  }
+  fclose(file);
+  return true;
+}
+
+// What's on the screen, from the model of the display's RAM
+bool isScreenPixelOn(int x, int y) {
+  if (!Wire.isDisplayOn) {
+    return false;
+  }
+  bool isOn = (Wire.ram[y / 8][x] >> (y & 7)) & 1;
+  return isOn != Wire.isInverted;
+}
+
+// A plain (text) PBM, a row of 0s and 1s per line, so the golden images diff nicely
+std::string getScreenPbm(int width, int height) {
+  std::string pbm = "P1\n" + std::to_string(width) + " " + std::to_string(height) + "\n";
+  for (int y = 0; y < height; y++) {
+    for (int x = 0; x < width; x++) {
+      pbm += isScreenPixelOn(x, y) ? '1' : '0';
+    }
+    pbm += '\n';
+  }
+  return pbm;
+}
+
+bool readFile(const std::string& path, std::string& contents) {
+  FILE* file = fopen(path.c_str(), "rb");
+  if (file == NULL) {
+    return false;
+  }
+  char chunk[4096];
+  size_t numRead;
+  contents.clear();
+  while ((numRead = fread(chunk, 1, sizeof(chunk), file)) > 0) {
+    contents.append(chunk, numRead);
+  }
+  fclose(file);
+  return true;
+}
+
+bool writeFile(const std::string& path, const std::string& contents) {
+  FILE* file = fopen(path.c_str(), "wb");
+  if (file == NULL) {
+    fprintf(stderr, "Error: can't write %s\n", path.c_str());
+    return false;
+  }
+  fwrite(contents.data(), 1, contents.size(), file);
+  fclose(file);
+  return true;
+}
+
+int countPixelsChanged(const uint8_t before[TwoWire::MAX_PAGES][TwoWire::MAX_COLUMNS]) {
+  int count = 0;
+  for (int page = 0; page < TwoWire::MAX_PAGES; page++) {
+    for (int column = 0; column < TwoWire::MAX_COLUMNS; column++) {
+      count += __builtin_popcount(before[page][column] ^ Wire.ram[page][column]);
+    }
+  }
+  return count;
+}
+
+void printUsage() {
+  fprintf(stderr, "Usage: sketch [--frames N] [--inputs FILE] [--loop-us US] [--max-ms MS] [--pbm DIR]\n"
+                  "              [--pbm-every K] [--golden DIR] [--i2c-log FILE] [--csv FILE] [--serial]\n");
+}
+
+int main(int argc, char* argv[]) {
+  unsigned long numFrames = 100;
+  double loopNanos = 100000;
+  int pbmEvery = 1;
+  const char* inputsPath = NULL;
+  const char* pbmDir = NULL;
+  const char* goldenDir = NULL;
+  const char* i2cLogPath = NULL;
+  const char* csvPath = NULL;
+
+  for (int i = 1; i < argc; i++) {
+    std::string arg = argv[i];
+    bool hasValue = i + 1 < argc;
+    if (arg == "--serial") {
+      Serial.echo = true;
+    } else if (arg == "--frames" && hasValue) {
+      numFrames = strtoul(argv[++i], NULL, 10);
+    } else if (arg == "--inputs" && hasValue) {
+      inputsPath = argv[++i];
+    } else if (arg == "--loop-us" && hasValue) {
+      loopNanos = atof(argv[++i]) * 1e3;
+    } else if (arg == "--max-ms" && hasValue) {
+      _maxNanos = atof(argv[++i]) * 1e6;
+    } else if (arg == "--pbm" && hasValue) {
+      pbmDir = argv[++i];
+    } else if (arg == "--pbm-every" && hasValue) {
+      pbmEvery = max(1, atoi(argv[++i]));
+    } else if (arg == "--golden" && hasValue) {
+      goldenDir = argv[++i];
+    } else if (arg == "--i2c-log" && hasValue) {
+      i2cLogPath = argv[++i];
+    } else if (arg == "--csv" && hasValue) {
+      csvPath = argv[++i];
+    } else {
+      printUsage();
+      return 2;
+    }
+  }
+
+  if (inputsPath != NULL && !loadInputs(inputsPath)) {
+    return 2;
+  }
+  if (i2cLogPath != NULL && (Wire.log = fopen(i2cLogPath, "w")) == NULL) {
+    fprintf(stderr, "Error: can't write %s\n", i2cLogPath);
+    return 2;
+  }
+  FILE* csv = NULL;
+  if (csvPath != NULL) {
+    if ((csv = fopen(csvPath, "w")) == NULL) {
+      fprintf(stderr, "Error: can't write %s\n", csvPath);
+      return 2;
+    }
+    fprintf(csv, "frame,time_ms,frame_ms,loops,draw_calls,pixel_writes,pixels_changed,i2c_bytes,display_bytes\n");
+  }
+
+  setup();
+  unsigned long setupBytes = Wire.bytesSent;
+  double setupMs = _nowNanos / 1e6;
+
+  // A loop() that doesn't send anything to the display is part of the next frame
+  std::vector<FrameStats> frames;
+  uint8_t lastScreen[TwoWire::MAX_PAGES][TwoWire::MAX_COLUMNS];
+  memcpy(lastScreen, Wire.ram, sizeof(lastScreen));
+  double lastFrameNanos = _nowNanos;
+  unsigned long numLoops = 0;
+  unsigned long drawCalls = Adafruit_SSD1306::numDrawCalls;
+  unsigned long pixelWrites = Adafruit_SSD1306::numPixelWrites;
+  unsigned long i2cBytes = Wire.bytesSent;
+  unsigned long displayBytes = Wire.displayBytesSent;
+  int numMismatches = 0;
+  int numMissing = 0;
+
+  while (frames.size() < numFrames) {
+    unsigned long loopDisplayBytes = Wire.displayBytesSent;
+    loop();
+    hostAdvanceNanos(loopNanos);
+    numLoops++;
+    if (Wire.displayBytesSent == loopDisplayBytes) {
+      continue;
+    }
+
+    FrameStats frame;
+    frame.timeMs = millis();
+    frame.frameMs = (_nowNanos - lastFrameNanos) / 1e6;
+    frame.numLoops = numLoops;
+    frame.drawCalls = Adafruit_SSD1306::numDrawCalls - drawCalls;
+    frame.pixelWrites = Adafruit_SSD1306::numPixelWrites - pixelWrites;
+    frame.pixelsChanged = countPixelsChanged(lastScreen);
+    frame.i2cBytes = Wire.bytesSent - i2cBytes;
+    frame.displayBytes = Wire.displayBytesSent - displayBytes;
+    frames.push_back(frame);
+    memcpy(lastScreen, Wire.ram, sizeof(lastScreen));
+    lastFrameNanos = _nowNanos;
+    numLoops = 0;
+    drawCalls = Adafruit_SSD1306::numDrawCalls;
+    pixelWrites = Adafruit_SSD1306::numPixelWrites;
+    i2cBytes = Wire.bytesSent;
+    displayBytes = Wire.displayBytesSent;
+
+    unsigned long frameNumber = frames.size();
+    if (csv != NULL) {
+      fprintf(csv, "%lu,%lu,%.3f,%lu,%lu,%lu,%lu,%lu,%lu\n", frameNumber, frame.timeMs, frame.frameMs,
+              frame.numLoops, frame.drawCalls, frame.pixelWrites, frame.pixelsChanged,
+              frame.i2cBytes, frame.displayBytes);
+    }
+
+    if (frameNumber % pbmEvery == 0 && (pbmDir != NULL || goldenDir != NULL)) {
+      char fileName[32];
+      snprintf(fileName, sizeof(fileName), "frame_%05lu.pbm", frameNumber);
+      std::string pbm = getScreenPbm(TwoWire::MAX_COLUMNS, TwoWire::MAX_PAGES * 8);
+      if (pbmDir != NULL) {
+        writeFile(std::string(pbmDir) + "/" + fileName, pbm);
+      }
+      if (goldenDir != NULL) {
+        std::string golden;
+        if (!readFile(std::string(goldenDir) + "/" + fileName, golden)) {
+          numMissing++;
+        } else if (golden != pbm) {
+          if (numMismatches == 0) {
+            printf("Frame %lu doesn't match %s/%s\n", frameNumber, goldenDir, fileName);
+          }
+          numMismatches++;
+        }
+      }
+    }
+  }
+
+  if (csv != NULL) {
+    fclose(csv);
+  }
+  if (Wire.log != NULL) {
+    fclose(Wire.log);
+  }
+
+  // Per-frame averages and maximums
+  FrameStats mean = { 0, 0, 0, 0, 0, 0, 0, 0 };
+  FrameStats most = { 0, 0, 0, 0, 0, 0, 0, 0 };
+  for (size_t i = 0; i < frames.size(); i++) {
+    mean.frameMs += frames[i].frameMs;
+    mean.drawCalls += frames[i].drawCalls;
+    mean.pixelWrites += frames[i].pixelWrites;
+    mean.pixelsChanged += frames[i].pixelsChanged;
+    mean.i2cBytes += frames[i].i2cBytes;
+    most.frameMs = max(most.frameMs, frames[i].frameMs);
+    most.drawCalls = max(most.drawCalls, frames[i].drawCalls);
+    most.pixelWrites = max(most.pixelWrites, frames[i].pixelWrites);
+    most.pixelsChanged = max(most.pixelsChanged, frames[i].pixelsChanged);
+    most.i2cBytes = max(most.i2cBytes, frames[i].i2cBytes);
+  }
+  double n = max((size_t)1, frames.size());
+  double fps = mean.frameMs > 0 ? frames.size() * 1000.0 / mean.frameMs : 0;
+
+  printf("Setup: %.1f ms, %lu I2C bytes\n", setupMs, setupBytes);
+  printf("%lu frames in %.1f ms (simulated): %.1f fps\n", (unsigned long)frames.size(), mean.frameMs, fps);
+  printf("                  mean per frame      max\n");
+  printf("  Frame time (ms) %14.2f %8.2f\n", mean.frameMs / n, most.frameMs);
+  printf("  Draw calls      %14.1f %8lu\n", mean.drawCalls / n, most.drawCalls);
+  printf("  Pixel writes    %14.1f %8lu\n", mean.pixelWrites / n, most.pixelWrites);
+  printf("  Pixels changed  %14.1f %8lu\n", mean.pixelsChanged / n, most.pixelsChanged);
+  printf("  I2C bytes       %14.1f %8lu\n", mean.i2cBytes / n, most.i2cBytes);
+  if (Wire.numTooLong > 0) {
+    printf("Warning: %lu I2C transmissions were longer than %d bytes (lost on a real board)\n",
+           Wire.numTooLong, BUFFER_LENGTH);
+  }
+  if (goldenDir != NULL) {
+    if (numMismatches > 0 || numMissing > 0) {
+      printf("Golden: FAIL (%d frames differ, %d missing in %s)\n", numMismatches, numMissing, goldenDir);
+    } else {
+      printf("Golden: PASS\n");
+    }
+  }
+  printf("Summary frames=%lu fps=%.2f frame_ms=%.3f draw_calls=%.1f pixel_writes=%.1f "
+         "pixels_changed=%.1f i2c_bytes=%.1f too_long=%lu golden_mismatches=%d\n",
+         (unsigned long)frames.size(), fps, mean.frameMs / n, mean.drawCalls / n, mean.pixelWrites / n,
+         mean.pixelsChanged / n, mean.i2cBytes / n, Wire.numTooLong, numMismatches + numMissing);
+
+  return numMismatches > 0 || numMissing > 0 ? 1 : 0;
+}
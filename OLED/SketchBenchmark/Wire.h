@@ -0,0 +1,217 @@
+/**
+ * A stand-in for the Arduino Wire library. Rather than talking to a real I2C
+ * bus, it:
+ *  - Counts (and, if SketchRunner was run with --i2c-log, logs) every byte
+ *    a sketch sends
+ *  - Moves simulated time forward by how long each transmission would take
+ *    at the clock set with setClock() (9 bits per byte, plus start and stop)
+ *  - Sends what's written to an SSD1306 (at 0x3C or 0x3D) to a model of its
+ *    display RAM, so SketchRunner can save what would be on the screen
+ *
+ * The SSD1306 model handles the addressing commands (horizontal, vertical,
+ * and page addressing modes, column and page addresses), display on/off, and
+ * inverse; the other commands are parsed (so their arguments aren't taken
+ * for commands) but ignored. Like an AVR, a transmission can be at most
+ * BUFFER_LENGTH bytes; longer ones are counted in numTooLong and dropped.
+ *
+ * Only used by SketchRunner.cpp and the sketches it builds.
+ *
+ * By Jon E. Froehlich
+ * @jonfroehlich
+ * http://makeabilitylab.io
+ *
+ */
+#ifndef HOST_WIRE_H
+#define HOST_WIRE_H
+
+#include <Arduino.h>
+
+#define BUFFER_LENGTH 32
+
+class TwoWire{
+
+  public:
+    static const uint8_t MAX_PAGES = 8;
+    static const uint8_t MAX_COLUMNS = 128;
+
+    // The SSD1306's display RAM and settings (what's on the screen)
+    uint8_t ram[MAX_PAGES][MAX_COLUMNS];
+    bool isDisplayOn;
+    bool isInverted;
+
+    unsigned long bytesSent;      // including the address byte of each transmission
+    unsigned long displayBytesSent;
+    unsigned long numTransmissions;
+    unsigned long numTooLong;     // transmissions longer than BUFFER_LENGTH (lost on a real board)
+    FILE* log;                    // each transmission as a line of hex, if not NULL
+
+  private:
+    uint8_t _address;
+    uint8_t _message[BUFFER_LENGTH];
+    uint8_t _messageLength;
+    bool _overflow;
+    uint32_t _clockHz;
+
+    uint8_t _addressingMode;  // 0 horizontal, 1 vertical, 2 page
+    uint8_t _columnStart, _columnEnd, _pageStart, _pageEnd;
+    uint8_t _column, _page;
+
+    // Commands can be split across transmissions, so keep partial ones
+    uint8_t _command[7];
+    uint8_t _commandLength;
+
+    static uint8_t getCommandLength(uint8_t command) {
+      switch (command) {
+        case 0x20: case 0x81: case 0x8D: case 0xA8: case 0xD3: case 0xD5: case 0xD9: case 0xDA: case 0xDB:
+          return 2;
+        case 0x21: case 0x22: case 0xA3:
+          return 3;
+        case 0x29: case 0x2A:
+          return 6;
+        case 0x26: case 0x27:
+          return 7;
+        default:
+          return 1;
+      }
+    }
+
+    void runCommand(uint8_t value) {
+      _command[_commandLength++] = value;
+      if (_commandLength < getCommandLength(_command[0])) {
+        return;
+      }
+      uint8_t command = _command[0];
+      if (command == 0x20) {
+        _addressingMode = _command[1] & 0x03;
+      } else if (command == 0x21) {
+        _columnStart = _command[1] & 0x7F;
+        _columnEnd = _command[2] & 0x7F;
+        _column = _columnStart;
+      } else if (command == 0x22) {
+        _pageStart = _command[1] & 0x07;
+        _pageEnd = _command[2] & 0x07;
+        _page = _pageStart;
+      } else if (command >= 0xB0 && command <= 0xB7) {
+        _page = command & 0x07;     // page addressing mode
+      } else if (command <= 0x0F) {
+        _column = (_column & 0xF0) | command;
+      } else if (command >= 0x10 && command <= 0x17) {
+        _column = ((command & 0x07) << 4) | (_column & 0x0F);
+      } else if (command == 0xAE || command == 0xAF) {
+        isDisplayOn = command == 0xAF;
+      } else if (command == 0xA6 || command == 0xA7) {
+        isInverted = command == 0xA7;
+      }
+      _commandLength = 0;
+    }
+
+    void writeRam(uint8_t value) {
+      ram[_page][_column] = value;
+      if (_addressingMode == 2) {
+        _column = (_column + 1) & 0x7F;
+      } else if (_addressingMode == 1) {
+        if (_page == _pageEnd) {
+          _page = _pageStart;
+          _column = _column == _columnEnd ? _columnStart : _column + 1;
+        } else {
+          _page++;
+        }
+      } else if (_column == _columnEnd) {
+        _column = _columnStart;
+        _page = _page == _pageEnd ? _pageStart : _page + 1;
+      } else {
+        _column = (_column + 1) & 0x7F;
+      }
+    }
+
+  public:
+    TwoWire() : isDisplayOn(false), isInverted(false), bytesSent(0), displayBytesSent(0),
+                numTransmissions(0), numTooLong(0), log(NULL), _address(0), _messageLength(0),
+                _overflow(false), _clockHz(100000), _addressingMode(2),
+                _columnStart(0), _columnEnd(MAX_COLUMNS - 1), _pageStart(0), _pageEnd(MAX_PAGES - 1),
+                _column(0), _page(0), _commandLength(0) {
+      // Start with garbage on the screen, like a real display at power-up
+      for (int page = 0; page < MAX_PAGES; page++) {
+        for (int column = 0; column < MAX_COLUMNS; column++) {
+          ram[page][column] = (page * 37 + column * 11) ^ 0x5A;
+        }
+      }
+    }
+
+    void begin() {}
+    void end() {}
+
+    void setClock(uint32_t clockHz) {
+      _clockHz = clockHz > 0 ? clockHz : 100000;
+    }
+
+    uint32_t getClock() const {
+      return _clockHz;
+    }
+
+    void beginTransmission(uint8_t address) {
+      _address = address;
+      _messageLength = 0;
+      _overflow = false;
+    }
+
+    size_t write(uint8_t value) {
+      if (_messageLength >= BUFFER_LENGTH) {
+        _overflow = true;
+        return 0;
+      }
+      _message[_messageLength++] = value;
+      return 1;
+    }
+
+    size_t write(const uint8_t* data, size_t length) {
+      for (size_t i = 0; i < length; i++) {
+        write(data[i]);
+      }
+      return length;
+    }
+
+    // Returns 1 (data too long), like the real Wire, if the message didn't fit
+    uint8_t endTransmission(bool = true) {
+      if (_overflow) {
+        numTooLong++;
+        return 1;
+      }
+
+      // The address and each byte take 9 clocks (8 bits and an ack), plus start and stop
+      numTransmissions++;
+      bytesSent += 1 + _messageLength;
+      hostAdvanceNanos(((1 + _messageLength) * 9 + 2) * 1e9 / _clockHz);
+
+      if (log != NULL) {
+        fprintf(log, "%10lu us %02X:", micros(), _address);
+        for (uint8_t i = 0; i < _messageLength; i++) {
+          fprintf(log, " %02X", _message[i]);
+        }
+        fprintf(log, "\n");
+      }
+
+      if ((_address != 0x3C && _address != 0x3D) || _messageLength == 0) {
+        return 0;
+      }
+      displayBytesSent += 1 + _messageLength;
+      bool isData = (_message[0] & 0x40) != 0;
+      for (uint8_t i = 1; i < _messageLength; i++) {
+        if (isData) {
+          writeRam(_message[i]);
+        } else {
+          runCommand(_message[i]);
+        }
+      }
+      return 0;
+    }
+
+    // No devices answer, so reads get nothing
+    uint8_t requestFrom(uint8_t, uint8_t, bool = true) { return 0; }
+    int available() { return 0; }
+    int read() { return -1; }
+};
+
+extern TwoWire Wire;
+
+#endif
@@ -0,0 +1,246 @@
+# Builds OLED sketches for a desktop computer (Linux or Mac) with
+# SketchRunner.cpp and the stand-in libraries in this folder, runs each for a
+# number of frames with scripted inputs, and prints a table of what a frame
+# costs: draw calls, pixels written and changed, and bytes sent over I2C,
+# plus the fps the I2C traffic allows (see SketchRunner.cpp).
+#
+# Like the Arduino IDE, it turns each .ino into C++ first: it concatenates
+# the sketch's .ino files (the one named after the folder first, then the rest
+# in alphabetical order), adds #include <Arduino.h>, and declares each
+# function before the first function definition so they can be called before
+# they're defined. #line directives keep compiler errors pointing at the .ino.
+#
+# Screens are compared with the golden PBM images in golden/<sketch> (every
+# --pbm-every frames), so a change that alters what a sketch draws fails. If
+# you meant to change it, save new golden images with --update-golden and
+# check that they look right (any image viewer opens PBMs).
+#
+# Pong and CollisionTest use the MakeabilityLab Arduino library (Shape.hpp and
+# ParallaxJoystick.hpp). This folder has stand-ins for both, which the golden
+# images were made with; pass the real library's src folder with --library to
+# use it instead. A sketch that includes a header that's in neither is skipped.
+#
+# Sketches are built with -Wall, and a warning counts as a failure (it's
+# printed with the file and line). It exits with 1 if a sketch didn't build,
+# had warnings, didn't finish, or didn't match its golden images.
+#
+# Only needs Python 3 and g++. For example, from this folder:
+# > python3 run_benchmarks.py
+# > python3 run_benchmarks.py --library ~/Arduino/libraries/MakeabilityLab_Arduino_Library/src
+# > python3 run_benchmarks.py --frames 500 BallBounce
+#
+# By Jon E. Froehlich
+# @jonfroehlich
+# http://makeabilitylab.io
+#
+
+import argparse
+import os
+import re
+import subprocess
+import sys
+
+THIS_DIR = os.path.dirname(os.path.abspath(__file__))
+REPO_DIR = os.path.dirname(os.path.dirname(THIS_DIR))
+
+# name: (sketch folder from the top of the repo, input script in inputs/)
+SKETCHES = {
+    'BallBounce': ('OLED/BallBounce', None),
+    'Pong': ('OLED/Pong', 'Pong.txt'),
+    'CollisionTest': ('OLED/CollisionTest', 'CollisionTest.txt'),
+    'AccelGraphSingleVal': ('Sensors/Accelerometers/LIS3DH/AccelGraphSingleVal', 'AccelGraphSingleVal.txt'),
+}
+
+COLUMNS = [
+    ('fps', 'fps', '%.1f'),
+    ('frame_ms', 'ms/frame', '%.2f'),
+    ('draw_calls', 'draw calls', '%.1f'),
+    ('pixel_writes', 'px written', '%.1f'),
+    ('pixels_changed', 'px changed', '%.1f'),
+    ('i2c_bytes', 'I2C bytes', '%.1f'),
+]
+
+KEYWORDS = {'if', 'else', 'for', 'while', 'switch', 'return', 'do', 'sizeof', 'catch'}
+
+# A function definition at the top level: its return type, name, and parameters
+FUNCTION_RE = re.compile(r'^[ \t]*((?:[A-Za-z_][\w:<>,]*[\s\*&]+)+)([A-Za-z_]\w*)\s*\(([^()]*)\)\s*(?:const\s*)?\{',
+                         re.MULTILINE)
+
+
+def strip_comments_and_strings(code):
+    """Returns code with comments, strings, and characters replaced by spaces (keeping line breaks)"""
+    def blank(match):
+        return re.sub(r'[^\n]', ' ', match.group(0))
+    return re.sub(r'//[^\n]*|/\*.*?\*/|"(?:\\.|[^"\\\n])*"|\'(?:\\.|[^\'\\\n])*\'', blank, code, flags=re.DOTALL)
+
+
+def get_prototypes(code):
+    """Returns (prototypes, offset of the first function definition) for the top-level functions in code"""
+    stripped = strip_comments_and_strings(code)
+
+    # Skip preprocessor lines and anything inside braces (classes, functions, initializers)
+    depths = []
+    depth = 0
+    for c in stripped:
+        depths.append(depth)
+        if c == '{':
+            depth += 1
+        elif c == '}':
+            depth -= 1
+
+    prototypes = []
+    first_offset = None
+    for match in FUNCTION_RE.finditer(stripped):
+        return_type = ' '.join(match.group(1).split())
+        name = match.group(2)
+        if depths[match.start()] != 0 or name in KEYWORDS or return_type.split()[-1] in KEYWORDS:
+            continue
+        line_start = stripped.rfind('\n', 0, match.start()) + 1
+        if stripped[line_start:match.start()].strip().startswith('#'):
+            continue
+        if return_type.startswith(('class ', 'struct ', 'enum ', 'union ', 'typedef ')):
+            continue
+        params = re.sub(r'\s*=[^,]*', '', ' '.join(match.group(3).split()))  # no default arguments
+        prototypes.append('%s %s(%s);' % (return_type, name, params))
+        if first_offset is None:
+            first_offset = line_start
+    return prototypes, first_offset
+
+
+def preprocess(sketch_dir, name):
+    """Returns the sketch's .ino files as C++, like the Arduino IDE's preprocessor"""
+    ino_files = sorted(f for f in os.listdir(sketch_dir) if f.endswith('.ino'))
+    main_ino = name + '.ino'
+    if main_ino in ino_files:
+        ino_files.remove(main_ino)
+        ino_files.insert(0, main_ino)
+
+    code = ''
+    for ino_file in ino_files:
+        path = os.path.join(sketch_dir, ino_file).replace('\\', '/')
+        with open(os.path.join(sketch_dir, ino_file), encoding='utf-8', errors='replace') as f:
+            code += '#line 1 "%s"\n' % path + f.read().replace('\r\n', '\n') + '\n'
+
+    prototypes, first_offset = get_prototypes(code)
+    if first_offset is None:
+        return '#include <Arduino.h>\n' + code
+
+    # Start the rest with a #line for the .ino line it came from
+    before = code[:first_offset]
+    last_line = before.rfind('#line 1 "')
+    path = before[last_line + 9:before.index('"', last_line + 9)]
+    line_number = before.count('\n', last_line)
+    return ('#include <Arduino.h>\n' + before + '\n'.join(prototypes) + '\n' +
+            '#line %d "%s"\n' % (line_number, path) + code[first_offset:])
+
+
+def build(name, sketch_dir, build_dir, libraries):
+    """Builds the sketch, returning (the program's path or None, whether it was only missing a library,
+    the compiler's warnings)"""
+    os.makedirs(build_dir, exist_ok=True)
+    cpp_path = os.path.join(build_dir, name + '.cpp')
+    program_path = os.path.join(build_dir, name)
+    with open(cpp_path, 'w') as f:
+        f.write(preprocess(sketch_dir, name))
+
+    # A --library folder comes first, so its headers are used over the stand-ins here
+    command = ['g++', '-std=c++11', '-O2', '-Wall']
+    command += ['-I' + library for library in libraries]
+    command += ['-I' + THIS_DIR, '-I' + sketch_dir]
+    command += [cpp_path, os.path.join(THIS_DIR, 'SketchRunner.cpp'), '-o', program_path]
+    result = subprocess.run(command, stdout=subprocess.PIPE, stderr=subprocess.STDOUT, universal_newlines=True)
+    if result.returncode != 0:
+        missing = re.search(r'fatal error: (\S+): No such file', result.stdout)
+        if missing:
+            print("%s: skipped, %s isn't in this folder or a --library folder" % (name, missing.group(1)))
+            return None, True, []
+        errors = [line for line in result.stdout.splitlines() if 'error' in line]
+        print("%s: didn't build: %s" % (name, errors[0] if errors else result.stdout.strip()))
+        return None, False, []
+
+    warnings = [line for line in result.stdout.splitlines() if 'warning:' in line]
+    for warning in warnings:
+        print("%s: %s" % (name, warning))
+    return program_path, False, warnings
+
+
+def run(name, program_path, input_path, args):
+    """Runs the sketch, returning the values from its Summary line or None (after printing why) if it failed"""
+    golden_dir = os.path.join(THIS_DIR, 'golden', name)
+    command = [program_path, '--frames', str(args.frames), '--pbm-every', str(args.pbm_every)]
+    if input_path is not None:
+        command += ['--inputs', input_path]
+    if args.update_golden:
+        os.makedirs(golden_dir, exist_ok=True)
+        for f in os.listdir(golden_dir):
+            if f.endswith('.pbm'):
+                os.remove(os.path.join(golden_dir, f))
+        command += ['--pbm', golden_dir]
+    elif os.path.isdir(golden_dir):
+        command += ['--golden', golden_dir]
+    if args.csv:
+        command += ['--csv', os.path.join(os.path.dirname(program_path), name + '.csv')]
+
+    result = subprocess.run(command, stdout=subprocess.PIPE, stderr=subprocess.STDOUT, universal_newlines=True)
+    if args.verbose:
+        print(result.stdout)
+    summary = None
+    for line in result.stdout.splitlines():
+        if line.startswith('Summary '):
+            summary = dict(item.split('=', 1) for item in line.split()[1:])
+    if summary is None:
+        print("%s: didn't finish: %s" % (name, result.stdout.strip().splitlines()[-1:]))
+        return None
+    if result.returncode != 0:
+        print("%s: the screen didn't match golden/%s (%s frames)" % (name, name, summary['golden_mismatches']))
+    return summary
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Runs OLED sketches headless and reports what each frame costs")
+    parser.add_argument('sketches', nargs='*', help="sketch names (%s) or folders; all four if none"
+                        % ', '.join(sorted(SKETCHES)))
+    parser.add_argument('--frames', type=int, default=200, help="frames to run each sketch for")
+    parser.add_argument('--pbm-every', type=int, default=50, help="compare (or save) every Nth frame's screen")
+    parser.add_argument('--library', action='append', default=[], help="a folder of headers the sketches include")
+    parser.add_argument('--update-golden', action='store_true', help="save the screens as the new golden images")
+    parser.add_argument('--csv', action='store_true', help="also save each frame's counts in build/<sketch>.csv")
+    parser.add_argument('--verbose', action='store_true', help="print each sketch's full summary")
+    args = parser.parse_args()
+
+    sketches = []
+    for sketch in args.sketches or sorted(SKETCHES):
+        if sketch in SKETCHES:
+            folder, inputs = SKETCHES[sketch]
+            input_path = os.path.join(THIS_DIR, 'inputs', inputs) if inputs else None
+            sketches.append((sketch, os.path.join(REPO_DIR, folder), input_path))
+        elif os.path.isdir(sketch):
+            folder = os.path.abspath(sketch)
+            sketches.append((os.path.basename(folder), folder, None))
+        else:
+            sys.exit("%s isn't one of the sketches or a folder" % sketch)
+
+    results = []
+    num_failed = 0
+    for name, sketch_dir, input_path in sketches:
+        program_path, is_skipped, warnings = build(name, sketch_dir, os.path.join(THIS_DIR, 'build'), args.library)
+        if is_skipped:
+            continue
+        summary = run(name, program_path, input_path, args) if program_path else None
+        if summary is None or summary['golden_mismatches'] != '0' or warnings:
+            num_failed += 1
+        if summary is not None:
+            results.append((name, summary))
+
+    print()
+    name_width = max([len('Sketch')] + [len(name) for name, _ in results])
+    print('  '.join(['Sketch'.ljust(name_width)] + [title.rjust(10) for _, title, _ in COLUMNS]))
+    for name, summary in results:
+        print('  '.join([name.ljust(name_width)] + [(fmt % float(summary[key])).rjust(10) for key, _, fmt in COLUMNS]))
+    if args.update_golden:
+        print("\nSaved golden images in golden/")
+    sys.exit(1 if num_failed > 0 else 0)
+
+
+if __name__ == '__main__':
+    main()
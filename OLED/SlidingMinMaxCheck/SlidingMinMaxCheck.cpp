@@ -0,0 +1,126 @@
+/**
+ * Checks SlidingMinMax.hpp on a desktop computer (Linux or Mac) against a
+ * brute-force scan of the window. For each capacity and window size below,
+ * it adds values one at a time and, after every add(), compares getMin(),
+ * getMax(), getCount(), and get(age) for every age with the last windowSize
+ * values added. It runs:
+ *
+ *  - Random: random values, with lots of repeats
+ *  - Rising, Falling: long runs that only go up or down, so one of the queues
+ *    holds the whole window and its front + count wraps past the end of the
+ *    buffer (and past 255 when Capacity is over 128)
+ *  - Sawtooth: rising runs of different lengths, then a drop
+ *  - Reset: reset() in the middle of a run empties the window
+ *
+ * Capacities go from 1 to 255 (the largest a uint8_t allows), each with a
+ * window of 1, about half the capacity, and the whole capacity, plus a
+ * window asked for larger than the capacity (which must be clamped to it).
+ *
+ * The header is included straight from AnalogGraphScrolling (the other copy
+ * is identical), so the results are for the exact code that runs on the
+ * Arduino. It prints PASS or FAIL for each check and exits with 1 if any
+ * failed.
+ *
+ * To build and run (from this folder):
+ *  g++ -std=c++11 -O2 -I. SlidingMinMaxCheck.cpp -o SlidingMinMaxCheck
+ *  ./SlidingMinMaxCheck
+ *
+ * By Jon E. Froehlich
+ * @jonfroehlich
+ * http://makeabilitylab.io
+ *
+ */
+#include <Arduino.h>  // the host stand-in in this folder (needs -I.)
+
+#include "../AnalogGraphScrolling/SlidingMinMax.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <deque>
+#include <functional>
+#include <random>
+
+const long NUM_VALUES = 5000;  // values added per pattern and window size
+
+int _numFailures = 0;
+std::mt19937 _rng(17);
+
+void check(bool passed, const char* name) {
+  printf("%-9s %s\n", name, passed ? "PASS" : "FAIL");
+  if (!passed) {
+    _numFailures++;
+  }
+}
+
+// Adds NUM_VALUES values from next(i) to a window of windowSize, comparing it
+// with a brute-force scan after each one. If resetAt >= 0, resets the window
+// after that many values
+template<uint8_t Capacity>
+bool runPattern(uint8_t windowSize, const std::function<int(long)>& next, long resetAt = -1) {
+  SlidingMinMax<int, Capacity> window(windowSize);
+  uint8_t expectedSize = std::max(1, std::min((int)windowSize, (int)Capacity));
+  bool passed = window.getWindowSize() == expectedSize && window.getCount() == 0;
+
+  std::deque<int> values;  // newest first
+  for (long i = 0; i < NUM_VALUES && passed; i++) {
+    if (i == resetAt) {
+      window.reset();
+      values.clear();
+      passed = window.getCount() == 0;
+    }
+    int value = next(i);
+    window.add(value);
+    values.push_front(value);
+    if (values.size() > expectedSize) {
+      values.pop_back();
+    }
+
+    passed = passed && window.getCount() == values.size() &&
+             window.getMin() == *std::min_element(values.begin(), values.end()) &&
+             window.getMax() == *std::max_element(values.begin(), values.end());
+    for (size_t age = 0; age < values.size() && passed; age++) {
+      passed = window.get(age) == values[age];
+    }
+  }
+  return passed;
+}
+
+// Runs next() through windows of 1, about half, and all of Capacity, and one
+// asked for more than Capacity
+template<uint8_t Capacity>
+bool runWindowSizes(const std::function<int(long)>& next, long resetAt = -1) {
+  bool passed = runPattern<Capacity>(1, next, resetAt);
+  passed = runPattern<Capacity>(Capacity / 2 + 1, next, resetAt) && passed;
+  passed = runPattern<Capacity>(Capacity, next, resetAt) && passed;
+  if (Capacity < 255) {
+    passed = runPattern<Capacity>(Capacity + 1, next, resetAt) && passed;
+  }
+  return passed;
+}
+
+bool runCapacities(const std::function<int(long)>& next, long resetAt = -1) {
+  bool passed = runWindowSizes<1>(next, resetAt);
+  passed = runWindowSizes<2>(next, resetAt) && passed;
+  passed = runWindowSizes<7>(next, resetAt) && passed;
+  passed = runWindowSizes<64>(next, resetAt) && passed;
+  passed = runWindowSizes<128>(next, resetAt) && passed;
+  passed = runWindowSizes<129>(next, resetAt) && passed;
+  passed = runWindowSizes<200>(next, resetAt) && passed;
+  passed = runWindowSizes<255>(next, resetAt) && passed;
+  return passed;
+}
+
+int main() {
+  check(runCapacities([](long /* i */){ return (int)(_rng() % 21) - 10; }), "Random");
+  check(runCapacities([](long i){ return (int)i; }), "Rising");
+  check(runCapacities([](long i){ return (int)-i; }), "Falling");
+  check(runCapacities([](long i){ return (int)(i % (97 + i / 1000)); }), "Sawtooth");
+  check(runCapacities([](long i){ return (int)(i % 300); }, 2345), "Reset");
+
+  if (_numFailures > 0) {
+    printf("%d checks FAILED\n", _numFailures);
+    return 1;
+  }
+  printf("All checks passed\n");
+  return 0;
+}
@@ -0,0 +1,22 @@
+/**
+ * Just enough of Arduino.h for SpatialGrid.hpp to compile on a desktop
+ * computer. Only used by SpatialGridBenchmark.cpp; don't copy this into a
+ * sketch folder.
+ *
+ * By Jon E. Froehlich
+ * @jonfroehlich
+ * http://makeabilitylab.io
+ *
+ */
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <algorithm>
+using std::min;
+using std::max;
+
+#endif
@@ -0,0 +1,372 @@
+/**
+ * Checks SpatialGrid.hpp against checking every pair of shapes (brute force)
+ * on a desktop computer (Linux or Mac) and measures how many pairs each one
+ * tests per frame as the number of shapes grows. It runs:
+ *
+ *  - Pairs: scenes of 1 to 254 moving shapes on a 128x64 screen (some off
+ *    its edges). Every frame, forEachCandidatePair() followed by overlaps()
+ *    must find exactly the pairs brute force does, each pair once
+ *  - Query: forEachCandidate() for a probe shape that isn't in the grid
+ *    must find every shape whose box overlaps or touches the probe's
+ *  - Ids: add() returns NONE when the grid is full, remove() frees an id for
+ *    the next add(), and removed shapes are no longer found
+ *  - Time: for 6 to 254 shapes of two sizes (2-8 pixels, like particles,
+ *    and 3-25 pixels, like CollisionTest's), moving every frame. Reports the
+ *    pairs each approach tests with overlaps() per frame, the pairs that
+ *    actually overlap, and the time per frame on this computer (including
+ *    the update() calls), which is only useful for comparing them. Then the
+ *    same for a "player" ball moving among shapes that stay put, like
+ *    CollisionTest's: one query per frame against each shape in turn
+ *    (brute force) or forEachCandidate(). Each grid holds just the number
+ *    of shapes timed, like a sketch's would
+ *
+ * The shapes here are a stand-in for Shape.hpp (which is in the
+ * MakeabilityLab_Arduino_Library, not this repo) with the same bounding box
+ * (getRight() is x + width): half are balls, which overlap by distance, and
+ * half are rectangles. Their overlaps() isn't inlined, as Shape's (a
+ * virtual function) can't be. SpatialGrid.hpp is included straight from the
+ * CollisionTest folder, so the results are for the exact code that runs on
+ * the Arduino. It prints PASS or FAIL for each check and exits with 1 if any
+ * failed.
+ *
+ * To build and run (from this folder):
+ *  g++ -std=c++11 -O2 -I. SpatialGridBenchmark.cpp -o SpatialGridBenchmark
+ *  ./SpatialGridBenchmark
+ *
+ * By Jon E. Froehlich
+ * @jonfroehlich
+ * http://makeabilitylab.io
+ *
+ */
+#include <Arduino.h>  // the host stand-in in this folder (needs -I.)
+
+#include "../CollisionTest/SpatialGrid.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <set>
+#include <utility>
+#include <vector>
+
+const int SCREEN_WIDTH = 128;
+const int SCREEN_HEIGHT = 64;
+const int MAX_SHAPES = 254;
+const int NUM_FRAMES = 200;
+const int NUM_TIMING_FRAMES = 2000;
+const int NUM_QUERY_FRAMES = 200000;
+
+int _numFailures = 0;
+std::mt19937 _rng(7);
+
+void check(bool passed, const char* name) {
+  printf("%-8s %s\n", name, passed ? "PASS" : "FAIL");
+  if (!passed) {
+    _numFailures++;
+  }
+}
+
+int randomInt(int low, int high) {
+  return std::uniform_int_distribution<int>(low, high)(_rng);
+}
+
+// A moving ball or rectangle, like Shape.hpp's
+class TestShape{
+
+  public:
+    int x, y, width, height;
+    int xSpeed, ySpeed;
+    bool isBall;
+    int index;
+
+    int getLeft() const { return x; }
+    int getTop() const { return y; }
+    int getRight() const { return x + width; }
+    int getBottom() const { return y + height; }
+
+    __attribute__((noinline)) bool overlaps(const TestShape& other) const {
+      if (isBall && other.isBall) {
+        int dx = (2 * x + width) - (2 * other.x + other.width);
+        int dy = (2 * y + height) - (2 * other.y + other.height);
+        int radii = width + other.width;
+        return dx * dx + dy * dy <= radii * radii;
+      }
+      return getLeft() <= other.getRight() && getRight() >= other.getLeft() &&
+             getTop() <= other.getBottom() && getBottom() >= other.getTop();
+    }
+
+    // Moves by its speed, bouncing a little past the screen's edges
+    void move() {
+      x += xSpeed;
+      y += ySpeed;
+      if (x < -10 || x + width > SCREEN_WIDTH + 10) {
+        xSpeed = -xSpeed;
+      }
+      if (y < -10 || y + height > SCREEN_HEIGHT + 10) {
+        ySpeed = -ySpeed;
+      }
+    }
+};
+
+typedef SpatialGrid<TestShape, MAX_SHAPES> Grid;
+typedef std::set<std::pair<int, int> > PairSet;
+
+std::vector<TestShape> makeShapes(int numShapes, int minSize, int maxSize) {
+  std::vector<TestShape> shapes(numShapes);
+  for (int i = 0; i < numShapes; i++) {
+    TestShape& shape = shapes[i];
+    shape.isBall = i % 2 == 0;
+    shape.width = randomInt(minSize, maxSize);
+    shape.height = shape.isBall ? shape.width : randomInt(minSize, maxSize);
+    shape.x = randomInt(-5, SCREEN_WIDTH - shape.width + 5);
+    shape.y = randomInt(-5, SCREEN_HEIGHT - shape.height + 5);
+    shape.xSpeed = randomInt(-2, 2);
+    shape.ySpeed = randomInt(-2, 2);
+    shape.index = i;
+  }
+  return shapes;
+}
+
+PairSet bruteForcePairs(const std::vector<TestShape>& shapes, long& numTested) {
+  PairSet pairs;
+  for (size_t i = 0; i < shapes.size(); i++) {
+    for (size_t j = i + 1; j < shapes.size(); j++) {
+      numTested++;
+      if (shapes[i].overlaps(shapes[j])) {
+        pairs.insert(std::make_pair(i, j));
+      }
+    }
+  }
+  return pairs;
+}
+
+// Returns false if a pair was found twice
+bool gridPairs(const Grid& grid, PairSet& pairs, long& numTested) {
+  bool isEachOnce = true;
+  PairSet candidates;
+  grid.forEachCandidatePair([&](TestShape& a, TestShape& b){
+    numTested++;
+    std::pair<int, int> pair(min(a.index, b.index), max(a.index, b.index));
+    isEachOnce = isEachOnce && candidates.insert(pair).second && a.index != b.index;
+    if (a.overlaps(b)) {
+      pairs.insert(pair);
+    }
+  });
+  return isEachOnce;
+}
+
+void checkPairs() {
+  bool passed = true;
+  const int counts[] = { 1, 2, 6, 40, 120, MAX_SHAPES };
+  for (int numShapes : counts) {
+    std::vector<TestShape> shapes = makeShapes(numShapes, 2, 30);
+    Grid grid(SCREEN_WIDTH, SCREEN_HEIGHT);
+    for (TestShape& shape : shapes) {
+      passed = grid.add(shape) == shape.index && passed;
+    }
+    for (int frame = 0; frame < NUM_FRAMES; frame++) {
+      long numTested = 0;
+      PairSet expected = bruteForcePairs(shapes, numTested);
+      PairSet found;
+      passed = passed && gridPairs(grid, found, numTested) && found == expected;
+
+      for (TestShape& shape : shapes) {
+        shape.move();
+        if (frame % 50 == 49) {
+          shape.width = randomInt(2, 30);  // resizing works too
+          shape.height = shape.isBall ? shape.width : randomInt(2, 30);
+        }
+        grid.update(shape.index);
+      }
+    }
+  }
+  check(passed, "Pairs");
+}
+
+void checkQuery() {
+  bool passed = true;
+  std::vector<TestShape> shapes = makeShapes(100, 2, 25);
+  Grid grid(SCREEN_WIDTH, SCREEN_HEIGHT);
+  for (TestShape& shape : shapes) {
+    grid.add(shape);
+  }
+
+  TestShape probe = { 0, 0, 0, 0, 0, 0, false, -1 };
+  for (int i = 0; i < 2000; i++) {
+    probe.width = randomInt(0, 40);
+    probe.height = randomInt(0, 40);
+    probe.x = randomInt(-50, SCREEN_WIDTH + 10);
+    probe.y = randomInt(-50, SCREEN_HEIGHT + 10);
+
+    std::set<int> expected;
+    for (const TestShape& shape : shapes) {
+      if (shape.getLeft() <= probe.getRight() && shape.getRight() >= probe.getLeft() &&
+          shape.getTop() <= probe.getBottom() && shape.getBottom() >= probe.getTop()) {
+        expected.insert(shape.index);
+      }
+    }
+    std::set<int> found;
+    grid.forEachCandidate(probe, [&](TestShape& shape){
+      passed = passed && found.insert(shape.index).second;
+    });
+    passed = passed && found == expected;
+  }
+  check(passed, "Query");
+}
+
+void checkIds() {
+  std::vector<TestShape> shapes = makeShapes(4, 5, 5);
+  for (TestShape& shape : shapes) {
+    shape.x = 10;
+    shape.y = 10;
+  }
+
+  SpatialGrid<TestShape, 3> grid(SCREEN_WIDTH, SCREEN_HEIGHT);
+  bool passed = grid.add(shapes[0]) == 0 && grid.add(shapes[1]) == 1 && grid.add(shapes[2]) == 2 &&
+                grid.add(shapes[3]) == grid.NONE && grid.getCount() == 3 && grid.getCellSize() == 16;
+
+  grid.remove(1);
+  grid.remove(1);
+  int numFound = 0;
+  grid.forEachCandidate(shapes[0], [&](TestShape& shape){
+    numFound++;
+    passed = passed && &shape != &shapes[1];
+  });
+  passed = passed && numFound == 2 && grid.getCount() == 2 && grid.get(1) == NULL;
+  passed = passed && grid.add(shapes[3]) == 1 && grid.get(1) == &shapes[3];
+
+  grid.clear();
+  numFound = 0;
+  grid.forEachCandidatePair([&](TestShape&, TestShape&){ numFound++; });
+  passed = passed && numFound == 0 && grid.getCount() == 0;
+  check(passed, "Ids");
+}
+
+// Times numShapes shapes of each size in a grid that holds just that many (like a sketch's)
+template<uint8_t numShapes>
+void timePairs() {
+  const int sizes[][2] = { { 2, 8 }, { 3, 25 } };
+  for (const int* size : sizes) {
+    {
+      std::vector<TestShape> shapes = makeShapes(numShapes, size[0], size[1]);
+      SpatialGrid<TestShape, numShapes> grid(SCREEN_WIDTH, SCREEN_HEIGHT);
+      for (TestShape& shape : shapes) {
+        grid.add(shape);
+      }
+
+      // Brute force and the grid each run on the same motion
+      std::vector<TestShape> start = shapes;
+      long numBruteTested = 0;
+      long numOverlapping = 0;
+      auto startTime = std::chrono::steady_clock::now();
+      for (int frame = 0; frame < NUM_TIMING_FRAMES; frame++) {
+        for (TestShape& shape : shapes) {
+          shape.move();
+        }
+        for (size_t i = 0; i < shapes.size(); i++) {
+          for (size_t j = i + 1; j < shapes.size(); j++) {
+            numBruteTested++;
+            numOverlapping += shapes[i].overlaps(shapes[j]);
+          }
+        }
+      }
+      double bruteNs = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - startTime).count();
+
+      shapes = start;
+      long numGridTested = 0;
+      long numGridOverlapping = 0;
+      startTime = std::chrono::steady_clock::now();
+      for (int frame = 0; frame < NUM_TIMING_FRAMES; frame++) {
+        for (TestShape& shape : shapes) {
+          shape.move();
+          grid.update(shape.index);
+        }
+        grid.forEachCandidatePair([&](TestShape& a, TestShape& b){
+          numGridTested++;
+          numGridOverlapping += a.overlaps(b);
+        });
+      }
+      double gridNs = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - startTime).count();
+      if (numGridOverlapping != numOverlapping) {
+        check(false, "Time");
+      }
+
+      char sizeName[16];
+      snprintf(sizeName, sizeof(sizeName), "%d-%dpx", size[0], size[1]);
+      printf("Time     %-7s %6d %12.1f %12.1f %12.1f %12.3f %12.3f\n", sizeName, numShapes,
+             numBruteTested / (double)NUM_TIMING_FRAMES, numGridTested / (double)NUM_TIMING_FRAMES,
+             numOverlapping / (double)NUM_TIMING_FRAMES,
+             bruteNs / 1000 / NUM_TIMING_FRAMES, gridNs / 1000 / NUM_TIMING_FRAMES);
+    }
+  }
+}
+
+// Times finding the shapes a moving ball overlaps, among numShapes that don't move (like CollisionTest)
+template<uint8_t numShapes>
+void timeQuery() {
+  std::vector<TestShape> shapes = makeShapes(numShapes, 3, 25);
+  SpatialGrid<TestShape, numShapes> grid(SCREEN_WIDTH, SCREEN_HEIGHT);
+  for (TestShape& shape : shapes) {
+    grid.add(shape);
+  }
+  TestShape start = { 0, 0, 6, 6, 3, 1, true, -1 };
+
+  TestShape player = start;
+  long numBruteOverlapping = 0;
+  auto startTime = std::chrono::steady_clock::now();
+  for (int frame = 0; frame < NUM_QUERY_FRAMES; frame++) {
+    player.move();
+    for (const TestShape& shape : shapes) {
+      numBruteOverlapping += shape.overlaps(player);
+    }
+  }
+  double bruteNs = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - startTime).count();
+
+  player = start;
+  long numGridTested = 0;
+  long numGridOverlapping = 0;
+  startTime = std::chrono::steady_clock::now();
+  for (int frame = 0; frame < NUM_QUERY_FRAMES; frame++) {
+    player.move();
+    grid.forEachCandidate(player, [&](TestShape& shape){
+      numGridTested++;
+      numGridOverlapping += shape.overlaps(player);
+    });
+  }
+  double gridNs = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - startTime).count();
+  if (numGridOverlapping != numBruteOverlapping) {
+    check(false, "Time");
+  }
+
+  printf("Time     %-7s %6d %12.1f %12.1f %12.1f %12.3f %12.3f\n", "player", numShapes, (double)numShapes,
+         numGridTested / (double)NUM_QUERY_FRAMES, numBruteOverlapping / (double)NUM_QUERY_FRAMES,
+         bruteNs / 1000 / NUM_QUERY_FRAMES, gridNs / 1000 / NUM_QUERY_FRAMES);
+}
+
+int main() {
+  checkPairs();
+  checkQuery();
+  checkIds();
+
+  printf("Time     %-7s %6s %12s %12s %12s %12s %12s\n", "size", "shapes", "brute pairs",
+         "grid pairs", "overlapping", "brute us", "grid us");
+  timePairs<6>();
+  timePairs<16>();
+  timePairs<32>();
+  timePairs<64>();
+  timePairs<128>();
+  timePairs<MAX_SHAPES>();
+  timeQuery<6>();
+  timeQuery<16>();
+  timeQuery<32>();
+  timeQuery<64>();
+  timeQuery<128>();
+  timeQuery<MAX_SHAPES>();
+
+  if (_numFailures > 0) {
+    printf("%d checks FAILED\n", _numFailures);
+    return 1;
+  }
+  printf("All checks passed\n");
+  return 0;
+}
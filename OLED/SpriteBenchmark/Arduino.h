@@ -0,0 +1,32 @@
+/**
+ * Just enough of Arduino.h for SpriteEngine.hpp to compile on a desktop
+ * computer. Only used by SpriteBenchmark.cpp; don't copy this into a
+ * sketch folder.
+ *
+ * By Jon E. Froehlich
+ * @jonfroehlich
+ * http://makeabilitylab.io
+ *
+ */
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include <algorithm>
+using std::min;
+using std::max;
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+// Desktop computers read constants from flash like any other memory. The
+// reads are counted, so SpriteBenchmark can report how many each sprite takes
+extern unsigned long numProgmemReads;
+#define PROGMEM
+#define pgm_read_byte(addr) (numProgmemReads++, *(const uint8_t*)(addr))
+
+#endif
@@ -0,0 +1,312 @@
+/**
+ * Checks SpriteEngine.hpp against Adafruit GFX's drawBitmap() on a desktop
+ * computer (Linux or Mac) and measures what drawing a sprite costs. The
+ * stand-in Adafruit_GFX.h in this folder draws bitmaps the same way as the
+ * real library (a pixel at a time). It runs:
+ *
+ *  - Blit: every dino frame from Sprites.h (in this folder) at every x and y
+ *    where any of it is on screen, over a random background. SPRITE_OR must
+ *    match drawBitmap(..., WHITE) and SPRITE_OPAQUE must match a black
+ *    fillRect() followed by drawBitmap()
+ *  - Packed: every frame of the assets sprite_packer.py made for the
+ *    sketches (MotherDino.h, ChildDino.h, and ChildDinoRun.h), drawn with
+ *    PackedAnimation the same way, must match SpriteBlitter::draw() of the
+ *    same frame from Sprites.h
+ *  - List: a SpriteList's drawing order after add(), remove(),
+ *    bringToFront(), and sendToBack(), and animate()'s timing, for bitmap
+ *    and packed sprites
+ *  - Time: a frame of each dino drawn with drawBitmap(), SpriteBlitter::draw(),
+ *    and PackedAnimation::draw() at a y that's a multiple of 8 and one that
+ *    isn't. Reports the calls into the SSD1306 library per sprite (a few
+ *    microseconds each on an Arduino), the bytes of flash each reads (the
+ *    stand-in pgm_read_byte() counts them), and the time per sprite on this
+ *    computer, which is only useful for comparing them. Then the flash the
+ *    dinos take, unpacked and packed
+ *
+ * drawBitmap() needs the usual row-by-row bitmaps, so this converts Sprites.h
+ * (which is in the SSD1306's vertical layout) back to rows. The other headers
+ * are included straight from the sketch folders, so the results are for the
+ * exact code that runs on the Arduino. It prints PASS or FAIL for each check
+ * and exits with 1 if any failed.
+ *
+ * To build and run (from this folder):
+ *  g++ -std=c++11 -O2 -I. SpriteBenchmark.cpp -o SpriteBenchmark
+ *  ./SpriteBenchmark
+ *
+ * By Jon E. Froehlich
+ * @jonfroehlich
+ * http://makeabilitylab.io
+ *
+ */
+#include <Arduino.h>  // the host stand-ins in this folder (needs -I.)
+#include <Wire.h>
+
+#include "../DinoJumpGame/SpriteEngine.hpp"
+#include "../DinoJumpGame/ChildDinoRun.h"
+#include "../DinoSpriteAnimationDemo2/MotherDino.h"
+#include "../DinoSpriteAnimationDemo2/ChildDino.h"
+#include "Sprites.h"
+
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+TwoWire Wire;
+unsigned long numProgmemReads = 0;
+
+const int SCREEN_WIDTH = 128;
+const int SCREEN_HEIGHT = 64;
+const int BUFFER_SIZE = SCREEN_WIDTH * SCREEN_HEIGHT / 8;
+const int NUM_TIMING_SPRITES = 20000;
+
+int _numFailures = 0;
+std::mt19937 _rng(11);
+
+void check(bool passed, const char* name) {
+  printf("%-8s %s\n", name, passed ? "PASS" : "FAIL");
+  if (!passed) {
+    _numFailures++;
+  }
+}
+
+void fillRandom(Adafruit_SSD1306& display) {
+  uint8_t* buffer = display.getBuffer();
+  for (int i = 0; i < BUFFER_SIZE; i++) {
+    buffer[i] = _rng();
+  }
+}
+
+bool buffersMatch(Adafruit_SSD1306& a, Adafruit_SSD1306& b) {
+  return memcmp(a.getBuffer(), b.getBuffer(), BUFFER_SIZE) == 0;
+}
+
+// A sprite in both layouts
+struct TestSprite{
+  const char* name;
+  const uint8_t* vertical;
+  std::vector<uint8_t> rows;  // for drawBitmap()
+  uint8_t width;
+  uint8_t height;
+};
+
+// Converts a vertical bitmap (a byte per column per page) to rows (a bit per column, left in the highest bit)
+std::vector<uint8_t> toRows(const uint8_t* vertical, uint8_t width, uint8_t height) {
+  int byteWidth = (width + 7) / 8;
+  std::vector<uint8_t> rows(byteWidth * height, 0);
+  for (int y = 0; y < height; y++) {
+    for (int x = 0; x < width; x++) {
+      if (vertical[(y / 8) * width + x] & (1 << (y % 8))) {
+        rows[y * byteWidth + x / 8] |= 0x80 >> (x % 8);
+      }
+    }
+  }
+  return rows;
+}
+
+std::vector<TestSprite> getTestSprites() {
+  std::vector<TestSprite> sprites;
+  for (int i = 0; i < NUM_MOTHER_DINO_SPRITES; i++) {
+    const uint8_t* bitmap = epd_bitmap_mother_dino_array[i];
+    sprites.push_back({ "mother dino", bitmap, toRows(bitmap, MOTHER_SPRITE_WIDTH, MOTHER_SPRITE_HEIGHT),
+                        MOTHER_SPRITE_WIDTH, MOTHER_SPRITE_HEIGHT });
+  }
+  for (int i = 0; i < NUM_CHILD_DINO_SPRITES; i++) {
+    const uint8_t* bitmap = epd_bitmap_child_dino_array[i];
+    sprites.push_back({ "child dino", bitmap, toRows(bitmap, CHILD_SPRITE_WIDTH, CHILD_SPRITE_HEIGHT),
+                        CHILD_SPRITE_WIDTH, CHILD_SPRITE_HEIGHT });
+  }
+  return sprites;
+}
+
+void checkBlit(const std::vector<TestSprite>& sprites, Adafruit_SSD1306& fast, Adafruit_SSD1306& gfx) {
+  bool passed = true;
+  for (const TestSprite& sprite : sprites) {
+    for (int y = -sprite.height; y <= SCREEN_HEIGHT; y++) {
+      for (int x = -sprite.width; x <= SCREEN_WIDTH; x += 3) {
+        for (int mode = SPRITE_OR; mode <= SPRITE_OPAQUE; mode++) {
+          fillRandom(fast);
+          memcpy(gfx.getBuffer(), fast.getBuffer(), BUFFER_SIZE);
+          SpriteBlitter::draw(fast, x, y, sprite.vertical, sprite.width, sprite.height, (SpriteDrawMode)mode);
+          if (mode == SPRITE_OPAQUE) {
+            gfx.fillRect(x, y, sprite.width, sprite.height, SSD1306_BLACK);
+          }
+          gfx.drawBitmap(x, y, sprite.rows.data(), sprite.width, sprite.height, SSD1306_WHITE);
+          passed = passed && buffersMatch(fast, gfx);
+        }
+      }
+    }
+  }
+  check(passed, "Blit");
+}
+
+void checkPacked(Adafruit_SSD1306& fast, Adafruit_SSD1306& gfx) {
+  struct PackedTest{
+    const uint8_t* asset;
+    const uint8_t* const* frames;  // the same frames, unpacked
+  };
+  const uint8_t* childRunFrames[] = { epd_bitmap_child_dino3, epd_bitmap_child_dino5 };
+  const PackedTest tests[] = { { mother_dino, epd_bitmap_mother_dino_array },
+                               { child_dino, epd_bitmap_child_dino_array },
+                               { child_dino_run, childRunFrames } };
+
+  bool passed = PackedAnimation(mother_dino).getNumFrames() == NUM_MOTHER_DINO_SPRITES &&
+                PackedAnimation(child_dino).getNumFrames() == NUM_CHILD_DINO_SPRITES &&
+                PackedAnimation(child_dino_run).getNumFrames() == 2;
+  for (const PackedTest& test : tests) {
+    PackedAnimation animation(test.asset);
+    for (int frame = 0; frame < animation.getNumFrames(); frame++) {
+      for (int y = -animation.getHeight(); y <= SCREEN_HEIGHT; y++) {
+        for (int x = -animation.getWidth(); x <= SCREEN_WIDTH; x += 3) {
+          for (int mode = SPRITE_OR; mode <= SPRITE_OPAQUE; mode++) {
+            fillRandom(fast);
+            memcpy(gfx.getBuffer(), fast.getBuffer(), BUFFER_SIZE);
+            animation.draw(fast, x, y, frame, (SpriteDrawMode)mode);
+            SpriteBlitter::draw(gfx, x, y, test.frames[frame], animation.getWidth(), animation.getHeight(),
+                                (SpriteDrawMode)mode);
+            passed = passed && buffersMatch(fast, gfx);
+          }
+        }
+      }
+    }
+  }
+  check(passed, "Packed");
+}
+
+void checkList(const std::vector<TestSprite>& sprites, Adafruit_SSD1306& fast, Adafruit_SSD1306& gfx) {
+  bool passed = true;
+
+  // Three overlapping opaque sprites, so the order they're drawn in shows
+  Sprite a(sprites[0].vertical, sprites[0].width, sprites[0].height);
+  Sprite b(sprites[5].vertical, sprites[5].width, sprites[5].height);
+  Sprite c(sprites[6].vertical, sprites[6].width, sprites[6].height);
+  Sprite* all[] = { &a, &b, &c };
+  for (int i = 0; i < 3; i++) {
+    all[i]->setLocation(10 + 7 * i, 3 + 5 * i);
+    all[i]->setDrawMode(SPRITE_OPAQUE);
+  }
+
+  SpriteList<3> list;
+  passed = passed && list.add(a) && list.add(b) && list.add(c) && !list.add(c);
+
+  // The expected order after each change, as indexes into all
+  const int orders[][3] = { { 0, 1, 2 }, { 1, 2, 0 }, { 0, 1, 2 }, { 0, 2, -1 } };
+  for (int step = 0; step < 4; step++) {
+    if (step == 1) {
+      list.bringToFront(a);
+    } else if (step == 2) {
+      list.sendToBack(a);
+    } else if (step == 3) {
+      passed = passed && list.remove(b) && !list.remove(b);
+    }
+
+    fillRandom(fast);
+    memcpy(gfx.getBuffer(), fast.getBuffer(), BUFFER_SIZE);
+    list.draw(fast);
+    for (int i = 0; i < 3 && orders[step][i] >= 0; i++) {
+      all[orders[step][i]]->draw(gfx);
+    }
+    passed = passed && buffersMatch(fast, gfx) && list.getCount() == (step < 3 ? 3 : 2);
+  }
+
+  // Animation: 5 frames, 100 ms each
+  Sprite animated(epd_bitmap_child_dino_array, NUM_CHILD_DINO_SPRITES, CHILD_SPRITE_WIDTH, CHILD_SPRITE_HEIGHT, 100);
+  passed = passed && !animated.animate(99) && animated.getFrame() == 0;
+  passed = passed && animated.animate(100) && animated.getFrame() == 1;
+  passed = passed && !animated.animate(150) && animated.animate(200) && animated.getFrame() == 2;
+  for (int i = 3; i <= 5; i++) {
+    animated.animate(i * 100);
+  }
+  passed = passed && animated.getFrame() == 0 && animated.getBitmap() == epd_bitmap_child_dino_array[0];
+  animated.setFrame(7);
+  passed = passed && animated.getFrame() == 2;
+
+  // A packed sprite animates and draws like the same frames unpacked
+  Sprite packed(PackedAnimation(child_dino), 100);
+  Sprite unpacked(epd_bitmap_child_dino_array, NUM_CHILD_DINO_SPRITES, CHILD_SPRITE_WIDTH, CHILD_SPRITE_HEIGHT, 100);
+  passed = passed && packed.getWidth() == CHILD_SPRITE_WIDTH && packed.getHeight() == CHILD_SPRITE_HEIGHT &&
+           packed.getNumFrames() == NUM_CHILD_DINO_SPRITES && packed.getBitmap() == NULL;
+  packed.setLocation(-3, 13);
+  unpacked.setLocation(-3, 13);
+  for (int i = 1; i <= 7; i++) {
+    packed.animate(i * 100);
+    unpacked.animate(i * 100);
+    fast.clearDisplay();
+    gfx.clearDisplay();
+    packed.draw(fast);
+    unpacked.draw(gfx);
+    passed = passed && packed.getFrame() == unpacked.getFrame() && buffersMatch(fast, gfx);
+  }
+
+  // Invisible sprites aren't drawn
+  fast.clearDisplay();
+  animated.setVisible(false);
+  animated.draw(fast);
+  gfx.clearDisplay();
+  passed = passed && buffersMatch(fast, gfx);
+
+  check(passed, "List");
+}
+
+void timeSprites(const std::vector<TestSprite>& sprites, Adafruit_SSD1306& display) {
+  // Frame 2 of each is packed as a delta, so it's the slowest to unpack
+  const int frames[] = { 2, NUM_MOTHER_DINO_SPRITES + 2 };
+  const PackedAnimation animations[] = { PackedAnimation(mother_dino), PackedAnimation(child_dino) };
+  const char* methods[] = { "drawBitmap", "SpriteBlitter::draw", "PackedAnimation::draw" };
+  for (int i = 0; i < 2; i++) {
+    const TestSprite& sprite = sprites[frames[i]];
+    for (int y = 8; y <= 11; y += 3) {
+      for (int method = 0; method < 3; method++) {
+        display.clearDisplay();
+        display.numDrawCalls = 0;
+        numProgmemReads = 0;
+        auto startTime = std::chrono::steady_clock::now();
+        for (int j = 0; j < NUM_TIMING_SPRITES; j++) {
+          int x = j % (SCREEN_WIDTH - sprite.width);
+          if (method == 0) {
+            display.drawBitmap(x, y, sprite.rows.data(), sprite.width, sprite.height, SSD1306_WHITE);
+          } else if (method == 1) {
+            SpriteBlitter::draw(display, x, y, sprite.vertical, sprite.width, sprite.height);
+          } else {
+            animations[i].draw(display, x, y, 2);
+          }
+        }
+        double elapsedNs = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - startTime).count();
+
+        printf("Time     %-11s %2dx%-2d y=%-2d %-22s %6.1f draw calls %6.1f bytes read %7.1f ns/sprite\n",
+               sprite.name, sprite.width, sprite.height, y, methods[method],
+               display.numDrawCalls / (double)NUM_TIMING_SPRITES,
+               numProgmemReads / (double)NUM_TIMING_SPRITES,
+               elapsedNs / NUM_TIMING_SPRITES);
+      }
+    }
+  }
+
+  // Flash used by the dinos' frames
+  printf("Flash    mother dino %4d bytes unpacked %4d packed\n",
+         NUM_MOTHER_DINO_SPRITES * SpriteBlitter::getNumBytes(MOTHER_SPRITE_WIDTH, MOTHER_SPRITE_HEIGHT),
+         (int)sizeof(mother_dino));
+  printf("Flash    child dino  %4d bytes unpacked %4d packed\n",
+         NUM_CHILD_DINO_SPRITES * SpriteBlitter::getNumBytes(CHILD_SPRITE_WIDTH, CHILD_SPRITE_HEIGHT),
+         (int)sizeof(child_dino));
+}
+
+int main() {
+  Adafruit_SSD1306 fast(SCREEN_WIDTH, SCREEN_HEIGHT, &Wire);
+  Adafruit_SSD1306 gfx(SCREEN_WIDTH, SCREEN_HEIGHT, &Wire);
+  fast.begin(SSD1306_SWITCHCAPVCC, 0x3D);
+  gfx.begin(SSD1306_SWITCHCAPVCC, 0x3D);
+
+  std::vector<TestSprite> sprites = getTestSprites();
+  checkBlit(sprites, fast, gfx);
+  checkPacked(fast, gfx);
+  checkList(sprites, fast, gfx);
+  timeSprites(sprites, gfx);
+
+  if (_numFailures > 0) {
+    printf("%d checks FAILED\n", _numFailures);
+    return 1;
+  }
+  printf("All checks passed\n");
+  return 0;
+}
@@ -0,0 +1,145 @@
+/**
+ * A stand-in for the Arduino Wire library that, rather than talking to a real
+ * I2C bus, sends everything to a model of the SSD1306's display RAM. So, after
+ * display(), we can check that the "screen" matches the framebuffer. It also
+ * counts the bytes sent, which is what limits the frame rate on a real display.
+ *
+ * Only handles horizontal addressing mode (0x20 0x00), column address
+ * (0x21), and page address (0x22). Others are ignored. Only used by
+ * SpriteBenchmark.cpp.
+ *
+ * By Jon E. Froehlich
+ * @jonfroehlich
+ * http://makeabilitylab.io
+ *
+ */
+#ifndef HOST_WIRE_H
+#define HOST_WIRE_H
+
+#include <Arduino.h>
+
+#define BUFFER_LENGTH 32
+
+class TwoWire{
+
+  public:
+    static const uint8_t MAX_PAGES = 8;
+    static const uint8_t MAX_COLUMNS = 128;
+
+    // The SSD1306's display RAM (what's on the screen)
+    uint8_t ram[MAX_PAGES][MAX_COLUMNS];
+    unsigned long bytesSent;  // including the address byte of each transmission
+    unsigned long numTooLong; // transmissions longer than BUFFER_LENGTH (lost on a real board)
+
+  private:
+    uint8_t _message[BUFFER_LENGTH];
+    uint8_t _messageLength;
+    bool _overflow;
+
+    uint8_t _columnStart, _columnEnd, _pageStart, _pageEnd;
+    uint8_t _column, _page;
+
+    // Commands can be split across transmissions, so keep partial ones
+    uint8_t _command[3];
+    uint8_t _commandLength;
+
+    static uint8_t commandLength(uint8_t command) {
+      switch (command) {
+        case 0x20: return 2;
+        case 0x21: return 3;
+        case 0x22: return 3;
+        default: return 1;
+      }
+    }
+
+    void runCommand(uint8_t value) {
+      _command[_commandLength++] = value;
+      if (_commandLength < commandLength(_command[0])) {
+        return;
+      }
+      switch (_command[0]) {
+        case 0x21:
+          _columnStart = _command[1] & 0x7F;
+          _columnEnd = _command[2] & 0x7F;
+          _column = _columnStart;
+          break;
+        case 0x22:
+          _pageStart = _command[1] & 0x07;
+          _pageEnd = _command[2] & 0x07;
+          _page = _pageStart;
+          break;
+      }
+      _commandLength = 0;
+    }
+
+    void writeRam(uint8_t value) {
+      ram[_page][_column] = value;
+      if (_column == _columnEnd) {
+        _column = _columnStart;
+        _page = _page == _pageEnd ? _pageStart : _page + 1;
+      } else {
+        _column = (_column + 1) & 0x7F;
+      }
+    }
+
+  public:
+    TwoWire() : bytesSent(0), numTooLong(0), _messageLength(0), _overflow(false),
+                _columnStart(0), _columnEnd(MAX_COLUMNS - 1), _pageStart(0), _pageEnd(MAX_PAGES - 1),
+                _column(0), _page(0), _commandLength(0) {
+      // Start with garbage on the screen, like a real display at power-up
+      for (int page = 0; page < MAX_PAGES; page++) {
+        for (int column = 0; column < MAX_COLUMNS; column++) {
+          ram[page][column] = (page * 37 + column * 11) ^ 0x5A;
+        }
+      }
+    }
+
+    void begin() {}
+    void setClock(uint32_t) {}
+
+    void beginTransmission(uint8_t) {
+      _messageLength = 0;
+      _overflow = false;
+    }
+
+    size_t write(uint8_t value) {
+      if (_messageLength >= BUFFER_LENGTH) {
+        _overflow = true;
+        return 0;
+      }
+      _message[_messageLength++] = value;
+      return 1;
+    }
+
+    size_t write(const uint8_t* data, size_t length) {
+      for (size_t i = 0; i < length; i++) {
+        write(data[i]);
+      }
+      return length;
+    }
+
+    // Returns 1 (data too long), like the real Wire, if the message didn't fit
+    uint8_t endTransmission() {
+      if (_overflow) {
+        numTooLong++;
+        return 1;
+      }
+      bytesSent += 1 + _messageLength;
+      if (_messageLength == 0) {
+        return 0;
+      }
+      bool isData = _message[0] == 0x40;
+      for (uint8_t i = 1; i < _messageLength; i++) {
+        if (isData) {
+          writeRam(_message[i]);
+        } else {
+          runCommand(_message[i]);
+        }
+      }
+      return 0;
+    }
+};
+
+extern TwoWire Wire;
+
+#endif
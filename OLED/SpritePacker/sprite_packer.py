@@ -0,0 +1,327 @@
+# Packs sprite frames from PNG files into a compressed PROGMEM asset for
+# PackedAnimation in SpriteEngine.hpp (see DinoSpriteAnimationDemo2).
+#
+# Each frame is converted to the SSD1306's "vertical" layout (for each page
+# of 8 rows, one byte per column with the top row in the lowest bit) and then
+# packed three ways:
+#  - Frames that are the same as an earlier one are stored once
+#  - Each frame is run-length encoded (RLE), so runs of empty bytes (or any
+#    repeated byte) take 1 or 2 bytes
+#  - A frame can instead be stored as the XOR of it and an earlier "key"
+#    frame, which is mostly zeros when the two differ in just a few pixels
+#    (like the legs of a running dino). The packer picks whichever is smaller
+#
+# Deltas are only ever from key frames (never from other deltas), so drawing
+# any frame reads at most two streams (so, at worst, a little over 2 bytes of
+# the asset per byte of sprite). The packer lists how many bytes each frame
+# reads in the header it makes.
+#
+# Asset format (all multi-byte numbers are little-endian):
+#  [0] width, [1] height, [2] number of frames
+#  [3 + 2i] the offset of frame i from the start of the asset
+#  Each frame: the 2-byte offset of its key frame (0 if it is a key frame),
+#  then its RLE bytes. Each RLE run starts with a count byte c:
+#    0x00 - 0x7F: the next c + 1 bytes, as is
+#    0x80 - 0xBF: (c & 0x3F) + 1 zeros
+#    0xC0 - 0xFF: the next byte, (c & 0x3F) + 1 times
+#
+# A pixel is on if it is dark (luminance < 128) and not transparent, which
+# matches image2cpp's defaults. Frames come from one PNG per frame or from a
+# sprite sheet with the frames side by side (use --frame-width).
+#
+# Only needs Python 3 (no libraries). For example, from this folder:
+# > python3 sprite_packer.py --name mother_dino ../DinoSpriteAnimationDemo/Dino1.png
+#     ../DinoSpriteAnimationDemo/Dino2.png ... > ../DinoSpriteAnimationDemo2/MotherDino.h
+# > python3 sprite_packer.py --name child_dino --frame-width 20
+#     ../DinoSpriteAnimationDemo/ChildDinoSheet.png > ../DinoSpriteAnimationDemo2/ChildDino.h
+#
+# By Jon E. Froehlich
+# @jonfroehlich
+# http://makeabilitylab.io
+#
+
+import argparse
+import os
+import struct
+import sys
+import zlib
+
+MAX_RUN = 64           # longest zero or repeat run
+MAX_LITERAL_RUN = 128  # longest run of bytes stored as is
+HEADER_SIZE = 3
+
+
+def read_png(path):
+    """Returns (width, height, pixels) for a PNG, where pixels[y][x] is True if on"""
+    with open(path, 'rb') as f:
+        data = f.read()
+    if data[:8] != b'\x89PNG\r\n\x1a\n':
+        sys.exit("%s is not a PNG" % path)
+
+    pos = 8
+    compressed = b''
+    palette = None
+    transparency = None
+    while pos < len(data):
+        length, chunk_type = struct.unpack('>I4s', data[pos:pos + 8])
+        chunk = data[pos + 8:pos + 8 + length]
+        pos += 12 + length
+        if chunk_type == b'IHDR':
+            width, height, bit_depth, color_type, _, _, interlace = struct.unpack('>IIBBBBB', chunk)
+        elif chunk_type == b'PLTE':
+            palette = chunk
+        elif chunk_type == b'tRNS':
+            transparency = chunk
+        elif chunk_type == b'IDAT':
+            compressed += chunk
+        elif chunk_type == b'IEND':
+            break
+
+    if interlace != 0:
+        sys.exit("%s is interlaced, which isn't supported" % path)
+    channels = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}[color_type]
+    if bit_depth != 8 and not (color_type in (0, 3) and bit_depth in (1, 2, 4)):
+        sys.exit("%s has %d-bit color type %d, which isn't supported" % (path, bit_depth, color_type))
+
+    # Undo each row's filter (see the PNG spec)
+    raw = zlib.decompress(compressed)
+    row_size = (width * channels * bit_depth + 7) // 8
+    pixel_size = max(1, channels * bit_depth // 8)
+    rows = []
+    previous = bytearray(row_size)
+    for y in range(height):
+        start = y * (row_size + 1)
+        filter_type = raw[start]
+        row = bytearray(raw[start + 1:start + 1 + row_size])
+        for i in range(row_size):
+            left = row[i - pixel_size] if i >= pixel_size else 0
+            up = previous[i]
+            up_left = previous[i - pixel_size] if i >= pixel_size else 0
+            if filter_type == 1:
+                row[i] = (row[i] + left) & 0xFF
+            elif filter_type == 2:
+                row[i] = (row[i] + up) & 0xFF
+            elif filter_type == 3:
+                row[i] = (row[i] + (left + up) // 2) & 0xFF
+            elif filter_type == 4:
+                estimate = left + up - up_left
+                distances = (abs(estimate - left), abs(estimate - up), abs(estimate - up_left))
+                if distances[0] <= distances[1] and distances[0] <= distances[2]:
+                    row[i] = (row[i] + left) & 0xFF
+                elif distances[1] <= distances[2]:
+                    row[i] = (row[i] + up) & 0xFF
+                else:
+                    row[i] = (row[i] + up_left) & 0xFF
+        rows.append(row)
+        previous = row
+
+    def get_rgba(row, x):
+        if bit_depth < 8:
+            per_byte = 8 // bit_depth
+            shift = 8 - bit_depth * (x % per_byte + 1)
+            value = (row[x // per_byte] >> shift) & ((1 << bit_depth) - 1)
+            if color_type == 0:
+                gray = value * 255 // ((1 << bit_depth) - 1)
+                return (gray, gray, gray, 255)
+        else:
+            value = row[x * channels]
+        if color_type == 3:
+            alpha = transparency[value] if transparency is not None and value < len(transparency) else 255
+            return tuple(palette[value * 3:value * 3 + 3]) + (alpha,)
+        if color_type == 0:
+            return (value, value, value, 255)
+        if color_type == 4:
+            return (value, value, value, row[x * 2 + 1])
+        pixel = row[x * channels:x * channels + channels]
+        return (pixel[0], pixel[1], pixel[2], pixel[3] if channels == 4 else 255)
+
+    pixels = []
+    for row in rows:
+        line = []
+        for x in range(width):
+            r, g, b, a = get_rgba(row, x)
+            line.append(a >= 128 and (299 * r + 587 * g + 114 * b) // 1000 < 128)
+        pixels.append(line)
+    return width, height, pixels
+
+
+def to_vertical(pixels, left, width, height):
+    """Returns the vertical layout bytes of the width x height frame starting at column left"""
+    frame = []
+    for page in range((height + 7) // 8):
+        for x in range(left, left + width):
+            value = 0
+            for bit in range(8):
+                y = page * 8 + bit
+                if y < height and pixels[y][x]:
+                    value |= 1 << bit
+            frame.append(value)
+    return frame
+
+
+def rle_encode(data):
+    """Encodes data with the runs described at the top of this file"""
+    encoded = []
+    literals = []
+
+    def flush_literals():
+        while literals:
+            chunk = literals[:MAX_LITERAL_RUN]
+            del literals[:MAX_LITERAL_RUN]
+            encoded.append(len(chunk) - 1)
+            encoded.extend(chunk)
+
+    i = 0
+    while i < len(data):
+        run = 1
+        while i + run < len(data) and run < MAX_RUN and data[i + run] == data[i]:
+            run += 1
+
+        # Zeros get a run of their own (just the count byte), but other bytes
+        # need 3 in a row (2 would cost the same as leaving them as is)
+        if data[i] == 0:
+            flush_literals()
+            encoded.append(0x80 | (run - 1))
+        elif run >= 3:
+            flush_literals()
+            encoded.extend([0xC0 | (run - 1), data[i]])
+        else:
+            literals.extend(data[i:i + run])
+        i += run
+    flush_literals()
+    return encoded
+
+
+def rle_decode(encoded, num_bytes):
+    """The reverse of rle_encode(), to check the packer"""
+    data = []
+    i = 0
+    while len(data) < num_bytes:
+        count = encoded[i]
+        i += 1
+        if count < 0x80:
+            data.extend(encoded[i:i + count + 1])
+            i += count + 1
+        elif count < 0xC0:
+            data.extend([0] * ((count & 0x3F) + 1))
+        else:
+            data.extend([encoded[i]] * ((count & 0x3F) + 1))
+            i += 1
+    return data
+
+
+def pack(frames, width, height):
+    """Returns (asset bytes, a description of each frame)"""
+    unique_frames = []  # (frame, key index into unique_frames or None, RLE bytes)
+    frame_indexes = []  # into unique_frames, for each frame
+    for frame in frames:
+        if frame in [unique[0] for unique in unique_frames]:
+            frame_indexes.append([unique[0] for unique in unique_frames].index(frame))
+            continue
+
+        # The smallest of a key frame and a delta from each earlier key frame
+        best_key = None
+        best_encoded = rle_encode(frame)
+        for i, (other, key, _) in enumerate(unique_frames):
+            if key is None:
+                delta = rle_encode([a ^ b for a, b in zip(frame, other)])
+                if len(delta) < len(best_encoded):
+                    best_key, best_encoded = i, delta
+        frame_indexes.append(len(unique_frames))
+        unique_frames.append((frame, best_key, best_encoded))
+
+    # The frame offsets, then the unique frames in order
+    offsets = []
+    offset = HEADER_SIZE + 2 * len(frames)
+    for _, _, encoded in unique_frames:
+        offsets.append(offset)
+        offset += 2 + len(encoded)
+    if offset > 0xFFFF:
+        sys.exit("The packed frames take %d bytes, more than the 64 KB an asset can be" % offset)
+
+    asset = [width, height, len(frames)]
+    for index in frame_indexes:
+        asset.extend([offsets[index] & 0xFF, offsets[index] >> 8])
+    for frame, key, encoded in unique_frames:
+        key_offset = 0 if key is None else offsets[key]
+        asset.extend([key_offset & 0xFF, key_offset >> 8])
+        asset.extend(encoded)
+
+    # Check that every frame unpacks to what went in
+    descriptions = []
+    num_bytes = len(frames[0])
+    for i, index in enumerate(frame_indexes):
+        frame, key, encoded = unique_frames[index]
+        unpacked = rle_decode(encoded, num_bytes)
+        if key is not None:
+            unpacked = [a ^ b for a, b in zip(unpacked, rle_decode(unique_frames[key][2], num_bytes))]
+        assert unpacked == frames[i], "frame %d doesn't unpack to what went in" % i
+
+        num_bytes_read = len(encoded) + (0 if key is None else len(unique_frames[key][2]))
+        first = frame_indexes.index(index)
+        if first < i:
+            kind = "same as frame %d" % first
+        elif key is None:
+            kind = "key frame"
+        else:
+            kind = "delta from frame %d" % frame_indexes.index(key)
+        descriptions.append((kind, len(encoded), num_bytes_read))
+    return asset, descriptions
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Packs PNG sprite frames into a PROGMEM asset for SpriteEngine.hpp")
+    parser.add_argument('pngs', nargs='+', help="one PNG per frame, or sprite sheets (see --frame-width)")
+    parser.add_argument('--name', required=True, help="the name of the C array")
+    parser.add_argument('--frame-width', type=int, help="split each PNG into frames this wide, left to right")
+    parser.add_argument('--frames', help="which frames to keep, in order (e.g., 2,4), counting from 0")
+    args = parser.parse_args()
+
+    frames = []
+    width = height = None
+    for path in args.pngs:
+        png_width, png_height, pixels = read_png(path)
+        frame_width = args.frame_width or png_width
+        if png_width % frame_width != 0:
+            sys.exit("%s is %d pixels wide, which isn't a multiple of %d" % (path, png_width, frame_width))
+        if (width, height) not in ((None, None), (frame_width, png_height)):
+            sys.exit("%s's frames are %dx%d but earlier ones are %dx%d" %
+                     (path, frame_width, png_height, width, height))
+        width, height = frame_width, png_height
+        for left in range(0, png_width, frame_width):
+            frames.append(to_vertical(pixels, left, width, height))
+
+    if args.frames:
+        frames = [frames[int(i)] for i in args.frames.split(',')]
+    if width > 255 or height > 255 or len(frames) > 255:
+        sys.exit("Sprites can be at most 255x255 with 255 frames")
+
+    asset, descriptions = pack(frames, width, height)
+
+    raw_size = len(frames) * len(frames[0])
+    lines = []
+    lines.append("// '%s', %dx%dpx, %d frames, packed by OLED/SpritePacker/sprite_packer.py from:" %
+                 (args.name, width, height, len(frames)))
+    for path in args.pngs:
+        lines.append("//   %s" % os.path.basename(path))
+    if args.frames:
+        lines.append("//   (frames %s)" % args.frames)
+    lines.append("// Don't edit by hand; change the PNGs and run the packer again. Draw it with")
+    lines.append("// PackedAnimation from SpriteEngine.hpp. %d bytes (%d bytes unpacked)" % (len(asset), raw_size))
+    lines.append("//")
+    lines.append("// Bytes read to unpack each frame (%d per frame unpacked):" % len(frames[0]))
+    for i, (kind, size, num_bytes_read) in enumerate(descriptions):
+        lines.append("//   %d: %-20s %4d" % (i, kind, num_bytes_read))
+    lines.append("const unsigned char %s [] PROGMEM = {" % args.name)
+    for i in range(0, len(asset), 16):
+        chunk = ', '.join('0x%02x' % b for b in asset[i:i + 16])
+        lines.append('\t' + chunk + (',' if i + 16 < len(asset) else ''))
+    lines.append("};")
+    print('\n'.join(lines))
+
+    print("%s: %d frames of %dx%d, %d bytes unpacked, %d packed" %
+          (args.name, len(frames), width, height, raw_size, len(asset)), file=sys.stderr)
+
+
+if __name__ == '__main__':
+    main()
@@ -54,6 +54,7 @@
 // https://github.com/adafruit/Adafruit_VS1053_Library/blob/master/Adafruit_VS1053.cpp
 #include <Adafruit_VS1053.h> 
 #include "VS1053_Pins.h"
+#include "SoundLevelMeter.hpp"
 
 Adafruit_VS1053_FilePlayer _musicPlayer = 
   Adafruit_VS1053_FilePlayer(VS1053_RESET, VS1053_CS, VS1053_DCS, VS1053_DREQ, CARDCS);
@@ -81,12 +82,12 @@ const int MAX_MIC_LEVEL = MAX_ANALOG_IN;
 
 // Microphone variables
 const int SOUND_LEVEL_LED_PIN = 11;
-const int MIC_SAMPLE_WINDOW_MS = 40; // Sample window width in ms (50 ms = 20Hz). 
-unsigned long _startSampleTimeMs = -1;
-unsigned int _signalMax = 0;
-unsigned int _signalMin = MAX_ANALOG_IN;
-unsigned int _numMicSamples = 0;
-long _cumulativeMicLevel = 0;
+
+// The number of mic samples per window (see SoundLevelMeter.hpp). Since each
+// loop() takes one sample, a window's length in ms depends on how busy loop() is
+const uint16_t MIC_SAMPLE_WINDOW_SIZE = 200;
+SoundLevelMeter _soundLevelMeter(MIC_SAMPLE_WINDOW_SIZE);
+int _volumePotVal = 0;
 long _totalMicSamples = 0;
 long _startSamplingMicTimeMs = -1;
 
@@ -166,14 +167,10 @@ void setup() {
     // https://www.arduino.cc/reference/en/language/variables/data-types/string/functions/c_str/
     _musicPlayer.startPlayingFile(_soundFiles[_curSoundFileIndex].c_str());
   }
-
-  _startSampleTimeMs = millis();
 }
 
 void loop() {
   
-  int volumePotVal = analogRead(VOLUME_POT_PIN);
-  //volumePotVal = 20;
   // File is playing in the background
   // if (!_musicPlayer.stopped()) {
   //   Serial.print(".");
@@ -185,59 +182,46 @@ void loop() {
     _startSamplingMicTimeMs = millis();
   }
   int micLevel = analogRead(MIC_INPUT_PIN);
-  micLevel = analogRead(MIC_INPUT_PIN);
-  _cumulativeMicLevel += micLevel;
-  _numMicSamples++;
   _totalMicSamples++;
   interrupts();
-  //Serial.println(micLevel);
-
-  // Serial.print(_numMicSamples);
-  // Serial.print(", ");
-  // Serial.println(micLevel);
-
-  //Serial.println(micLevel);
-  if(micLevel > _signalMax){
-    _signalMax = micLevel;
-  }else if(micLevel < _signalMin){
-    _signalMin = micLevel;
-  }
 
   // For more on some basic Arduino-based sound processing, see the example code here:
   // See: https://learn.adafruit.com/adafruit-i2s-mems-microphone-breakout/arduino-wiring-and-test
-  if(millis() - _startSampleTimeMs > MIC_SAMPLE_WINDOW_MS){
-    long peakToPeak = _signalMax - _signalMin;
+  if(_soundLevelMeter.add(micLevel)){
+    int peakToPeak = _soundLevelMeter.getPeakToPeak();
 
     // TODO maybe change min here when music is not playing?
     int ledBrightnessVal = map(peakToPeak, 0, MAX_MIC_LEVEL, 0, MAX_ANALOG_OUT);
-    long avgMicLevel = _cumulativeMicLevel / _numMicSamples;
 
     // Comment out this Serial.print block when not debugging
-    Serial.print(_numMicSamples);
+    Serial.print(_soundLevelMeter.getMin());
     Serial.print(", ");
-    Serial.print(_signalMin);
+    Serial.print(_soundLevelMeter.getMax());
     Serial.print(", ");
-    Serial.print(_signalMax);
+    Serial.print(_soundLevelMeter.getMean());
     Serial.print(", ");
-    Serial.print(avgMicLevel);
+    Serial.print(_soundLevelMeter.getRms());
     Serial.print(", ");
     Serial.print(peakToPeak);
     Serial.print(", ");
-    Serial.print(volumePotVal);
+    Serial.print(_volumePotVal);
     Serial.print(", ");
     Serial.println(ledBrightnessVal);
     analogWrite(SOUND_LEVEL_LED_PIN, ledBrightnessVal);
 
-    _signalMax = 0;
-    _signalMin = MAX_ANALOG_IN;
-    _startSampleTimeMs = millis();
-    _numMicSamples = 0;
-    _cumulativeMicLevel = 0;
-  }
+    // The volume only needs to follow the pot about as often as the LED
+    // updates, so we read it once per window rather than every loop. The
+    // mic samples are then all back-to-back reads of the mic pin, which
+    // keeps the ADC from carrying over charge from the pot's pin
+    _volumePotVal = analogRead(VOLUME_POT_PIN);
 
-  // TODO switch from linear mapping to logarithmic if using a linear pot
-  uint8_t soundVolume = (uint8_t)map(volumePotVal, 0, MAX_ANALOG_IN, 0, 255);
-  _musicPlayer.setVolume(soundVolume, soundVolume);
+    // TODO switch from linear mapping to logarithmic if using a linear pot
+    uint8_t soundVolume = (uint8_t)map(_volumePotVal, 0, MAX_ANALOG_IN, 0, 255);
+    _musicPlayer.setVolume(soundVolume, soundVolume);
+
+    // Throw away the first mic reading after switching pins
+    analogRead(MIC_INPUT_PIN);
+  }
 
   // Check prev/next buttons
   _btnNext.read();
@@ -0,0 +1,203 @@
+/**
+ * Measures sound levels from a microphone (e.g., an electret mic with an
+ * amp like the MAX4466 or MAX9814) over windows of a fixed number of samples.
+ *
+ * Our earlier sound sketches collected samples for a fixed number of
+ * milliseconds (MIC_SAMPLE_WINDOW_MS), so the number of samples per window
+ * changed with whatever else loop() was doing, and so did the levels. Here, a
+ * window is always windowSize samples, and the statistics are updated with
+ * each sample (no buffer), so each add() is just a few additions.
+ *
+ * Samples must be 10-bit (0 - 1023, like analogRead on an Uno), and a
+ * window holds at most MAX_WINDOW_SIZE (4096) samples. That keeps the sum
+ * of squares (at most 1023^2 * 4096) in 32 bits, which is much faster than
+ * 64-bit math on an 8-bit AVR.
+ *
+ * For each window, you get:
+ *  - the min, max, and peak-to-peak (max - min) of the samples
+ *  - the mean (the mic's DC offset, usually about half of the ADC range)
+ *  - the RMS (root mean square) around the mean, which measures loudness
+ *    more steadily than peak-to-peak
+ *
+ * It also keeps an envelope of the peak-to-peak level for LED fades (like a
+ * VU meter): it rises toward louder windows by the attack fraction and falls
+ * toward quieter windows by the decay fraction. An attack of 1 jumps straight
+ * to the new peak; a decay of 0.1 falls 10% of the way each window.
+ *
+ * Usage:
+ *  SoundLevelMeter _soundLevelMeter(400);          // 400 samples per window
+ *
+ *  loop(){
+ *    if(_soundLevelMeter.add(analogRead(A0))){      // true when a window is done
+ *      int peakToPeak = _soundLevelMeter.getPeakToPeak();
+ *      float ledVal = _soundLevelMeter.getEnvelope();
+ *    }
+ *  }
+ *
+ * By Jon E. Froehlich
+ * @jonfroehlich
+ * http://makeabilitylab.io
+ *
+ */
+#ifndef SOUND_LEVEL_METER_HPP
+#define SOUND_LEVEL_METER_HPP
+
+#include <Arduino.h>
+
+class SoundLevelMeter{
+
+  public:
+    static const uint16_t MAX_WINDOW_SIZE = 4096;
+
+  private:
+    const uint16_t _windowSize;
+    const float _attack;
+    const float _decay;
+
+    // The window in progress. The sums are of each sample minus _reference
+    // (the previous window's mean) so they stay small
+    uint16_t _sampleCount;
+    int _windowMin;
+    int _windowMax;
+    int _reference;
+    int32_t _sum;
+    uint32_t _sumSquares;
+
+    // The last finished window
+    int _min;
+    int _max;
+    float _mean;
+    float _rms;
+    float _envelope;
+
+  public:
+    /**
+     * Creates a sound level meter with windowSize (1 - MAX_WINDOW_SIZE) samples
+     * per window. attack and decay (0 - 1) set how fast the envelope follows
+     * louder and quieter windows
+     */
+    SoundLevelMeter(uint16_t windowSize, float attack = 1, float decay = 0.1)
+      : _windowSize(windowSize < 1 ? 1 : windowSize > MAX_WINDOW_SIZE ? MAX_WINDOW_SIZE : windowSize),
+        _attack(attack), _decay(decay) {
+      reset();
+    }
+
+    /**
+     * Adds a 10-bit sample (e.g., from analogRead). Returns true if it finished a
+     * window, and the get methods now return that window's levels
+     */
+    bool add(int sample) {
+      if (_sampleCount == 0) {
+        _windowMin = sample;
+        _windowMax = sample;
+      } else if (sample > _windowMax) {
+        _windowMax = sample;
+      } else if (sample < _windowMin) {
+        _windowMin = sample;
+      }
+
+      int32_t deviation = (int32_t)sample - _reference;
+      uint16_t absDeviation = deviation < 0 ? -deviation : deviation;
+      _sum += deviation;
+      _sumSquares += (uint32_t)absDeviation * absDeviation;
+      _sampleCount++;
+
+      if (_sampleCount < _windowSize) {
+        return false;
+      }
+
+      // Finish the window
+      float meanDeviation = _sum / (float)_sampleCount;
+      float variance = _sumSquares / (float)_sampleCount - meanDeviation * meanDeviation;
+      _mean = _reference + meanDeviation;
+      _rms = variance > 0 ? sqrt(variance) : 0;
+      _min = _windowMin;
+      _max = _windowMax;
+
+      float peakToPeak = _max - _min;
+      _envelope += (peakToPeak - _envelope) * (peakToPeak > _envelope ? _attack : _decay);
+
+      // Start the next window
+      _reference = lround(_mean);
+      _sampleCount = 0;
+      _sum = 0;
+      _sumSquares = 0;
+      return true;
+    }
+
+    /**
+     * Returns the smallest sample in the last window
+     */
+    int getMin() const {
+      return _min;
+    }
+
+    /**
+     * Returns the largest sample in the last window
+     */
+    int getMax() const {
+      return _max;
+    }
+
+    /**
+     * Returns max - min of the last window
+     */
+    int getPeakToPeak() const {
+      return _max - _min;
+    }
+
+    /**
+     * Returns the mean of the last window (the mic's DC offset)
+     */
+    float getMean() const {
+      return _mean;
+    }
+
+    /**
+     * Returns the RMS of the last window around its mean. For a sine wave,
+     * this is ~0.35 of the peak-to-peak
+     */
+    float getRms() const {
+      return _rms;
+    }
+
+    /**
+     * Returns the peak-to-peak envelope (see attack and decay in the constructor)
+     */
+    float getEnvelope() const {
+      return _envelope;
+    }
+
+    /**
+     * Returns the number of samples per window
+     */
+    uint16_t getWindowSize() const {
+      return _windowSize;
+    }
+
+    /**
+     * Returns the number of samples in the window in progress
+     */
+    uint16_t getSampleCount() const {
+      return _sampleCount;
+    }
+
+    /**
+     * Starts over, forgetting the window in progress, the last window, and the envelope
+     */
+    void reset() {
+      _sampleCount = 0;
+      _windowMin = 0;
+      _windowMax = 0;
+      _reference = 0;
+      _sum = 0;
+      _sumSquares = 0;
+      _min = 0;
+      _max = 0;
+      _mean = 0;
+      _rms = 0;
+      _envelope = 0;
+    }
+};
+
+#endif
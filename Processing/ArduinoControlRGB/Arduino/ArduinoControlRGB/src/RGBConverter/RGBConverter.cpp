@@ -11,6 +11,35 @@
  */
 #include "RGBConverter.h"
 
+// Fixed-point constants. Hue math is done in "sixths" of the color wheel,
+// where the high word is the sector (0-5) and the low word is the position
+// within that sector, so 1/3 of the wheel is exactly 2 << 16.
+#define HUE6_ONE    0x10000UL
+#define HUE6_FULL   0x60000UL
+#define ONE_255_16  16711680UL // 255 << 16, i.e., 1.0 scaled by 255 and 65536
+
+/**
+ * Returns floor(x / 255) for x in [0, 65280] using only adds and shifts.
+ */
+static inline byte div255(uint16_t x) {
+    return (x + 1 + (x >> 8)) >> 8;
+}
+
+/**
+ * Computes one RGB channel of an HSV color without branching on the hue
+ * sector. k is the hue in sixths of the color wheel offset by 5, 3, or 1
+ * sectors for red, green, and blue, respectively. The channel is
+ * v * (1 - s * w) where w = clamp(min(k, 4 - k), 0, 1), which gives the
+ * same v, p, q, and t values as the switch in hsvToRgbFixed.
+ */
+static inline byte hsvChannelFixed(uint32_t k, byte s, byte v) {
+    if (k >= HUE6_FULL) k -= HUE6_FULL;
+    uint32_t w = k < 4 * HUE6_ONE ? 4 * HUE6_ONE - k : 0;
+    if (k < w) w = k;
+    if (w > HUE6_ONE) w = HUE6_ONE;
+    return div255(((uint32_t)v * (ONE_255_16 - w * s)) >> 16);
+}
+
 /**
  * Converts an RGB color value to HSL. Conversion formula
  * adapted from http://en.wikipedia.org/wiki/HSL_color_space.
@@ -167,3 +196,222 @@ double RGBConverter::hue2rgb(double p, double q, double t) {
     if(t < 2/3.0) return p + (q - p) * (2/3.0 - t) * 6;
     return p;
 }
+
+/**
+ * Converts an RGB color value to HSL using fixed-point math.
+ * Assumes r, g, and b are contained in the set [0, 255] and
+ * returns h in [0, 65535] and s and l in [0, 255].
+ *
+ * @param   Number  r       The red color value
+ * @param   Number  g       The green color value
+ * @param   Number  b       The blue color value
+ * @return  Array           The HSL representation
+ */
+void RGBConverter::rgbToHslFixed(byte r, byte g, byte b, uint16_t hsl[]) {
+    byte max = threeway_max(r, g, b);
+    byte min = threeway_min(r, g, b);
+    uint16_t sum = (uint16_t)max + min;
+    byte d = max - min;
+
+    hsl[2] = (sum + 1) >> 1;
+
+    if (d == 0) {
+        hsl[0] = hsl[1] = 0; // achromatic
+    } else {
+        // Same as d / (2 - max - min) or d / (max + min) but scaled to [0, 255]
+        uint16_t den = sum > 255 ? 510 - sum : sum;
+        hsl[1] = (fraction16(d, den) * 255 + 0x8000) >> 16;
+        hsl[0] = hueFixed(r, g, b, max, d);
+    }
+}
+
+/**
+ * Converts an HSL color value to RGB using fixed-point math.
+ * Assumes h is in [0, 65535] and s and l are in [0, 255] and
+ * returns r, g, and b in the set [0, 255].
+ *
+ * @param   Number  h       The hue
+ * @param   Number  s       The saturation
+ * @param   Number  l       The lightness
+ * @return  Array           The RGB representation
+ */
+void RGBConverter::hslToRgbFixed(uint16_t h, byte s, byte l, byte rgb[]) {
+    if (s == 0) {
+        rgb[0] = rgb[1] = rgb[2] = l; // achromatic
+        return;
+    }
+
+    // q and p are scaled by 255 * 255, so both fit in a uint16_t
+    uint16_t q = l < 128 ? (uint16_t)l * (255 + s) :
+                           (uint16_t)(((uint32_t)l + s) * 255 - (uint16_t)l * s);
+    uint16_t p = (uint16_t)((uint32_t)l * 510 - q);
+
+    uint32_t h6 = (uint32_t)h * 6;
+    rgb[0] = hue2rgbFixed(p, q, h6 + 2 * HUE6_ONE);
+    rgb[1] = hue2rgbFixed(p, q, h6);
+    rgb[2] = hue2rgbFixed(p, q, h6 + 4 * HUE6_ONE); // same as h - 1/3, wrapped
+}
+
+/**
+ * Converts an RGB color value to HSV using fixed-point math.
+ * Assumes r, g, and b are contained in the set [0, 255] and
+ * returns h in [0, 65535] and s and v in [0, 255].
+ *
+ * @param   Number  r       The red color value
+ * @param   Number  g       The green color value
+ * @param   Number  b       The blue color value
+ * @return  Array           The HSV representation
+ */
+void RGBConverter::rgbToHsvFixed(byte r, byte g, byte b, uint16_t hsv[]) {
+    byte max = threeway_max(r, g, b);
+    byte min = threeway_min(r, g, b);
+    byte d = max - min;
+
+    hsv[2] = max;
+
+    if (d == 0) {
+        hsv[0] = hsv[1] = 0; // achromatic
+    } else {
+        hsv[1] = (fraction16(d, max) * 255 + 0x8000) >> 16;
+        hsv[0] = hueFixed(r, g, b, max, d);
+    }
+}
+
+/**
+ * Converts an HSV color value to RGB using fixed-point math.
+ * Assumes h is in [0, 65535] and s and v are in [0, 255] and
+ * returns r, g, and b in the set [0, 255].
+ *
+ * @param   Number  h       The hue
+ * @param   Number  s       The saturation
+ * @param   Number  v       The value
+ * @return  Array           The RGB representation
+ */
+void RGBConverter::hsvToRgbFixed(uint16_t h, byte s, byte v, byte rgb[]) {
+    uint32_t h6 = (uint32_t)h * 6;
+    byte i = h6 >> 16;
+    uint16_t f = h6 & 0xFFFF;
+
+    // Same as p = v * (1 - s), q = v * (1 - f * s), and t = v * (1 - (1 - f) * s)
+    // with v and s scaled by 255 and f by 65536. Every product fits in 32 bits.
+    byte p = div255((uint16_t)v * (255 - s));
+    byte q = div255(((uint32_t)v * (ONE_255_16 - (uint32_t)f * s)) >> 16);
+    byte t = div255(((uint32_t)v * (ONE_255_16 - (HUE6_ONE - f) * s)) >> 16);
+
+    switch(i){
+        case 0: rgb[0] = v, rgb[1] = t, rgb[2] = p; break;
+        case 1: rgb[0] = q, rgb[1] = v, rgb[2] = p; break;
+        case 2: rgb[0] = p, rgb[1] = v, rgb[2] = t; break;
+        case 3: rgb[0] = p, rgb[1] = q, rgb[2] = v; break;
+        case 4: rgb[0] = t, rgb[1] = p, rgb[2] = v; break;
+        case 5: rgb[0] = v, rgb[1] = p, rgb[2] = q; break;
+    }
+}
+
+/**
+ * Converts an array of HSV colors to packed GRB bytes using fixed-point math.
+ * Assumes each h is in [0, 65535] and each s and v is in [0, 255].
+ *
+ * Rather than switching on the hue sector like hsvToRgbFixed, each channel
+ * is computed with the same branch-free formula, which keeps the loop body
+ * straight-line code that host compilers can vectorize. The math is the
+ * same, so the output matches hsvToRgbFixed exactly.
+ *
+ * @param   Array   h           The hues
+ * @param   Array   s           The saturations
+ * @param   Array   v           The values
+ * @return  Array   grb         The packed GRB representation
+ * @param   Number  numPixels   The number of pixels to convert
+ */
+void RGBConverter::hsvToGrbFixed(const uint16_t h[], const byte s[], const byte v[],
+                                 byte grb[], uint16_t numPixels) {
+    for (uint16_t i = 0; i < numPixels; i++) {
+        uint32_t h6 = (uint32_t)h[i] * 6;
+        grb[3 * i + 0] = hsvChannelFixed(h6 + 3 * HUE6_ONE, s[i], v[i]);
+        grb[3 * i + 1] = hsvChannelFixed(h6 + 5 * HUE6_ONE, s[i], v[i]);
+        grb[3 * i + 2] = hsvChannelFixed(h6 + 1 * HUE6_ONE, s[i], v[i]);
+    }
+}
+
+byte RGBConverter::threeway_max(byte a, byte b, byte c) {
+    return max(a, max(b, c));
+}
+
+byte RGBConverter::threeway_min(byte a, byte b, byte c) {
+    return min(a, min(b, c));
+}
+
+/**
+ * Fixed-point version of hue2rgb. p and q are scaled by 255 * 255 and t is
+ * in sixths of the color wheel (see HUE6_ONE), which turns the 1/6, 1/2, and
+ * 2/3 breakpoints into the integers 1, 3, and 4.
+ */
+byte RGBConverter::hue2rgbFixed(uint16_t p, uint16_t q, uint32_t t) {
+    if(t >= HUE6_FULL) t -= HUE6_FULL;
+    if(t < HUE6_ONE) return div255(p + (((uint32_t)(q - p) * t) >> 16));
+    if(t < 3 * HUE6_ONE) return div255(q);
+    if(t < 4 * HUE6_ONE) return div255(p + (((uint32_t)(q - p) * (4 * HUE6_ONE - t)) >> 16));
+    return div255(p);
+}
+
+/**
+ * Computes the hue shared by HSV and HSL in [0, 65535] given the rgb value,
+ * its max component, and the difference between its max and min components
+ * (which must be non-zero).
+ *
+ * Each sector starts at round(k * 65536 / 6), which is within 1/3 of the
+ * exact value, and hueFraction() rounds to within 1/2, so the hue is always
+ * within 1 of the double version's h * 65536.
+ */
+uint16_t RGBConverter::hueFixed(byte r, byte g, byte b, byte max, byte d) {
+    if (max == r) {
+        // 1 - fraction, wrapped around the color wheel
+        return g >= b ? hueFraction(g - b, d) : (uint16_t)(0 - hueFraction(b - g, d));
+    } else if (max == g) {
+        return b >= r ? 21845 + hueFraction(b - r, d) : 21845 - hueFraction(r - b, d);
+    } else {
+        return r >= g ? 43691 + hueFraction(r - g, d) : 43691 - hueFraction(g - r, d);
+    }
+}
+
+/**
+ * Returns round(num * 65536 / (6 * den)), i.e., num / den of one sixth of
+ * the color wheel, for 0 <= num <= den and den > 0. Uses the same
+ * shift-and-subtract division as fraction16 with one extra quotient bit
+ * for rounding.
+ */
+uint16_t RGBConverter::hueFraction(byte num, byte den) {
+    uint16_t den6 = 6 * den;
+    uint16_t rem = num;
+    uint16_t quotient = 0;
+    for (byte bit = 0; bit < 17; bit++) {
+        rem <<= 1;
+        quotient <<= 1;
+        if (rem >= den6) {
+            rem -= den6;
+            quotient |= 1;
+        }
+    }
+    return (quotient + 1) >> 1;
+}
+
+/**
+ * Returns floor(num * 65536 / den) for 0 <= num <= den and den > 0 using
+ * shift-and-subtract (restoring) division, one quotient bit per step.
+ * This avoids pulling in the compiler's 32-bit divide routine on AVR.
+ */
+uint32_t RGBConverter::fraction16(uint16_t num, uint16_t den) {
+    if (num >= den) return HUE6_ONE;
+
+    uint16_t rem = num;
+    uint16_t quotient = 0;
+    for (byte bit = 0; bit < 16; bit++) {
+        rem <<= 1;
+        quotient <<= 1;
+        if (rem >= den) {
+            rem -= den;
+            quotient |= 1;
+        }
+    }
+    return quotient;
+}
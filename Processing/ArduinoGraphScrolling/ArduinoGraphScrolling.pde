@@ -2,6 +2,12 @@
  * This example parses a single floating point value off of serial [0,1] and plots it to the screen
  * Unlike ArduinoGraph, the graph scrolls automatically
  *
+ * Every value gets its own pixel column, so no value is ever skipped (and no spike
+ * is lost); the graph just shows the last width values. We don't need a min/max
+ * history like OLED/AnalogGraphHistory's MinMaxHistory.hpp, which is for showing
+ * more samples than there are columns on an Arduino with little RAM. At 9600 baud,
+ * 640 columns is already several seconds of data
+ *
  * By Jon Froehlich
  * http://makeabilitylab.io
  * 
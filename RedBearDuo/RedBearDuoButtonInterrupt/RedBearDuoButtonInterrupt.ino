@@ -3,6 +3,12 @@
  * toggle() whenever a RISING or FALLING edge is observed. Toggle turns on/off 
  * the internal RedBear Duo LED (which is on D7).
  * 
+ * Each button change is also passed to loop() through a lock-free queue
+ * (SpscQueue.hpp, in this folder) and printed to Serial. We don't print
+ * from toggle() itself because an interrupt should be as short as possible.
+ * Unlike a single volatile variable, the queue doesn't lose changes that
+ * happen faster than loop() runs.
+ * 
  * 
  * By Jon Froehlich for CSE590
  * http://makeabilitylab.io
@@ -21,6 +27,8 @@
  */
 SYSTEM_MODE(MANUAL);
 
+#include "SpscQueue.hpp"
+
 // This is the internal LED pin on the Duo
 const int LED_OUTPUT_PIN = D7; 
 
@@ -29,19 +37,48 @@ const int LED_OUTPUT_PIN = D7;
 // https://docs.particle.io/reference/firmware/photon/#interrupts
 const int BUTTON_INPUT_PIN = D8; 
 
+// A button change recorded by the interrupt
+struct ButtonEvent {
+  unsigned long timestampMs;
+  int buttonState;
+};
+
+// Written only by toggle() and read only by loop()
+SpscQueue<ButtonEvent, 16> _buttonEvents;
+unsigned long _lastDropCount = 0;
+
 void toggle(void); // function declaration for interrupt
 
 void setup() {
   pinMode(LED_OUTPUT_PIN, OUTPUT);
   pinMode(BUTTON_INPUT_PIN, INPUT_PULLDOWN);
+  Serial.begin(9600);
   attachInterrupt(BUTTON_INPUT_PIN, toggle, CHANGE); //CHANGE, RISING or FALLING
 }
 
 void loop() {
-  // intentionally empty
+  ButtonEvent buttonEvent;
+  while(_buttonEvents.pop(buttonEvent)){
+    Serial.print(buttonEvent.timestampMs);
+    Serial.print(" ms: button ");
+    Serial.println(buttonEvent.buttonState == HIGH ? "pressed" : "released");
+  }
+
+  // The queue only fills up if loop() can't keep up (e.g., a very bouncy button)
+  unsigned long dropCount = _buttonEvents.getDropCount();
+  if(dropCount != _lastDropCount){
+    Serial.print("Missed ");
+    Serial.print(dropCount - _lastDropCount);
+    Serial.println(" button changes");
+    _lastDropCount = dropCount;
+  }
 }
 
 void toggle(){
-  digitalWrite(LED_OUTPUT_PIN, digitalRead(BUTTON_INPUT_PIN));
+  int buttonState = digitalRead(BUTTON_INPUT_PIN);
+  digitalWrite(LED_OUTPUT_PIN, buttonState);
+
+  ButtonEvent buttonEvent = { millis(), buttonState };
+  _buttonEvents.push(buttonEvent);
 }
 
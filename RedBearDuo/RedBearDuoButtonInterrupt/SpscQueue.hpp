@@ -0,0 +1,200 @@
+/**
+ * A fixed-size queue for passing data from an interrupt (or a timer callback,
+ * or another core) to loop() without locks and without losing data between
+ * reads. It is a single-producer, single-consumer (SPSC) queue: exactly one
+ * side calls push() and exactly one side calls pop().
+ *
+ * This replaces the common "volatile flag" pattern, where the ISR sets a
+ * volatile boolean and loop() clears it. With a flag, anything the ISR
+ * produces before loop() gets to it is overwritten and lost. With the queue,
+ * up to Capacity items wait in order, and if the queue does fill up, the
+ * new items are dropped and counted so you can tell (see getDropCount()).
+ *
+ * How it works: the producer only writes _head and the consumer only writes
+ * _tail, so neither needs to disable interrupts. The producer stores the item
+ * *before* publishing the new _head (a "release" store) and the consumer reads
+ * _head (an "acquire" load) *before* reading the item, so the consumer never
+ * sees a slot before its data is written. This uses the GCC __atomic builtins,
+ * which compile to:
+ *
+ *   AVR (Uno, Leonardo):       plain loads/stores; the compiler just can't reorder them
+ *   ARM (Zero, Feather M0,
+ *        RedBear Duo):         loads/stores with a memory barrier (dmb)
+ *   ESP32 (dual core):         loads/stores with a memory barrier, so it also works
+ *                              between tasks on different cores
+ *
+ * Capacity must be a power of 2. On AVR, the indices are single bytes (so the
+ * 8-bit CPU reads them in one instruction), which limits Capacity to 128.
+ *
+ * Usage:
+ *  #include "SpscQueue.hpp"
+ *
+ *  SpscQueue<int, 16> _queue;
+ *
+ *  void onInterrupt(){
+ *    _queue.push(analogRead(A0)); // returns false (and counts a drop) if full
+ *  }
+ *
+ *  loop(){
+ *    int val;
+ *    while(_queue.pop(val)){
+ *      // process val
+ *    }
+ *  }
+ *
+ * By Jon E. Froehlich
+ * @jonfroehlich
+ * http://makeabilitylab.io
+ *
+ */
+#ifndef SPSC_QUEUE_HPP
+#define SPSC_QUEUE_HPP
+
+#include <Arduino.h>
+
+template<typename T, uint16_t Capacity>
+class SpscQueue{
+
+#if defined(__AVR__)
+  typedef uint8_t Index;
+  static_assert(Capacity <= 128, "On AVR, Capacity can be at most 128");
+#else
+  typedef uint32_t Index;
+#endif
+
+  static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0,
+                "Capacity must be a power of 2");
+
+  private:
+    static const Index INDEX_MASK = Capacity - 1;
+
+    T _buffer[Capacity];
+
+    // Free-running counts of items pushed and popped. They are only masked
+    // when indexing _buffer, so _head - _tail is the number of items waiting
+    // (even after they wrap around) and all Capacity slots can be used
+    Index _head;  // written only by the producer
+    Index _tail;  // written only by the consumer
+
+    // Statistics, written only by the producer
+    Index _highWaterMark;
+    volatile uint32_t _dropCount;
+
+    static Index loadAcquire(const Index& index) {
+      return __atomic_load_n(&index, __ATOMIC_ACQUIRE);
+    }
+
+    static void storeRelease(Index& index, Index value) {
+      __atomic_store_n(&index, value, __ATOMIC_RELEASE);
+    }
+
+  public:
+    SpscQueue() : _head(0), _tail(0), _highWaterMark(0), _dropCount(0) {
+    }
+
+    /**
+     * Adds an item to the queue. Call this only from the producer side
+     * (e.g., the ISR). Returns false and counts a drop if the queue is full
+     */
+    bool push(const T& item) {
+      Index head = _head;
+      Index used = head - loadAcquire(_tail);
+      if (used >= Capacity) {
+        _dropCount = _dropCount + 1;
+        return false;
+      }
+
+      _buffer[head & INDEX_MASK] = item;
+      storeRelease(_head, head + 1);
+
+      used++;
+      if (used > _highWaterMark) {
+        __atomic_store_n(&_highWaterMark, used, __ATOMIC_RELAXED);
+      }
+      return true;
+    }
+
+    /**
+     * Removes the oldest item from the queue and copies it into item. Call
+     * this only from the consumer side (e.g., loop()). Returns false if the
+     * queue is empty
+     */
+    bool pop(T& item) {
+      Index tail = _tail;
+      if (tail == loadAcquire(_head)) {
+        return false;
+      }
+
+      item = _buffer[tail & INDEX_MASK];
+      storeRelease(_tail, tail + 1);
+      return true;
+    }
+
+    /**
+     * Copies the oldest item into item without removing it. Call this only
+     * from the consumer side. Returns false if the queue is empty
+     */
+    bool peek(T& item) const {
+      Index tail = _tail;
+      if (tail == loadAcquire(_head)) {
+        return false;
+      }
+
+      item = _buffer[tail & INDEX_MASK];
+      return true;
+    }
+
+    /**
+     * Returns the number of items waiting in the queue. If the other side is
+     * running, this may be out of date by the time you use it
+     */
+    uint16_t available() const {
+      return (Index)(loadAcquire(_head) - loadAcquire(_tail));
+    }
+
+    /**
+     * Returns true if the queue is empty
+     */
+    bool isEmpty() const {
+      return available() == 0;
+    }
+
+    /**
+     * Returns true if the queue is full (the next push() will be dropped)
+     */
+    bool isFull() const {
+      return available() >= Capacity;
+    }
+
+    /**
+     * Returns the most items that have been waiting in the queue at once.
+     * If this gets close to getCapacity(), the consumer is falling behind
+     */
+    uint16_t getHighWaterMark() const {
+      return __atomic_load_n(&_highWaterMark, __ATOMIC_RELAXED);
+    }
+
+    /**
+     * Returns the number of items dropped because the queue was full
+     */
+    uint32_t getDropCount() const {
+      // On 8-bit AVR, the producer can change the count halfway through
+      // our read, so read it until we get the same value twice
+      uint32_t dropCount = _dropCount;
+      uint32_t lastDropCount;
+      do {
+        lastDropCount = dropCount;
+        dropCount = _dropCount;
+      } while (dropCount != lastDropCount);
+      return dropCount;
+    }
+
+    /**
+     * Returns the number of items the queue can hold
+     */
+    static uint16_t getCapacity() {
+      return Capacity;
+    }
+};
+
+#endif
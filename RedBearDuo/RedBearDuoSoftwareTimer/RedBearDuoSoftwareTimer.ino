@@ -2,6 +2,10 @@
  * This example counts seconds and toggles an LED on/off every second
  * using a software timer
  * 
+ * The timer callback runs in its own thread, so rather than printing from
+ * it (or sharing volatile variables with loop()), it passes each second's
+ * count to loop() through a lock-free queue (SpscQueue.hpp, in this folder).
+ * 
  * 
  * By Jon Froehlich for CSE590
  * http://makeabilitylab.io
@@ -19,6 +23,8 @@
  */
 SYSTEM_MODE(MANUAL);
 
+#include "SpscQueue.hpp"
+
 // This is the internal LED pin on the Duo
 const int LED_OUTPUT_PIN = D7; 
 
@@ -27,8 +33,14 @@ const int LED_OUTPUT_PIN = D7;
 //   the main program. To make sure variables shared between an ISR and the 
 //   main program are updated correctly, declare them as volatile."
 // See: https://docs.particle.io/reference/firmware/photon/#interrupts
-volatile int _ledState = LOW;
-volatile int _seconds = 0;
+//
+// volatile makes each read and write happen, but a single variable still
+// can't hold more than one value at a time. If loop() is slow, it misses
+// updates. So we only use _ledState and _seconds in timer_callback() and
+// send the counts to loop() through a queue instead
+int _ledState = LOW;
+int _seconds = 0;
+SpscQueue<int, 8> _secondsQueue;
 
 void timer_callback(void); // function declaration for interrupt
 
@@ -41,12 +53,15 @@ void setup() {
 }
 
 void loop() {
-  // intentionally empty
+  int seconds;
+  while(_secondsQueue.pop(seconds)){
+    Serial.println(seconds);
+  }
 }
 
 // called automatically by software timer
 void timer_callback(){
   _ledState = !_ledState;
   digitalWrite(LED_OUTPUT_PIN, _ledState);
-  Serial.println(++_seconds);
+  _secondsQueue.push(++_seconds);
 }
@@ -0,0 +1,21 @@
+/**
+ * Just enough of Arduino.h for SpscQueue.hpp to compile on a desktop
+ * computer. Only used by SpscQueueCheck.cpp; don't copy this into a sketch
+ * folder.
+ *
+ * By Jon E. Froehlich
+ * @jonfroehlich
+ * http://makeabilitylab.io
+ *
+ */
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+#endif
@@ -0,0 +1,207 @@
+/**
+ * Checks SpscQueue.hpp on a desktop computer (Linux or Mac), with a
+ * producer thread standing in for the ISR and a consumer thread standing in
+ * for loop(). It runs:
+ *
+ *  - Basics: one thread fills a queue, push() fails and counts a drop when
+ *    it's full, peek() and pop() return items in order, and the high-water
+ *    mark and available() are right, including after the indices pass
+ *    Capacity many times
+ *  - Spin: for capacities 2 to 1024, the producer pushes 500,000 items,
+ *    waiting while the queue is full, and the consumer pops them as fast as
+ *    it can. Every item must arrive once, in order, with its whole payload
+ *    (seven 32-bit words written before the push), and nothing is dropped
+ *  - Drop: the same, but the producer never waits, like an ISR, and the
+ *    consumer is slow. The items that arrive must be in order and whole,
+ *    and the number that arrived plus getDropCount() must equal the number
+ *    pushed
+ *
+ * On a desktop, the threads run on different cores at the same time, which
+ * is a harder test of the acquire/release ordering than an ISR on a single
+ * core Arduino. For an even stronger check, build with ThreadSanitizer
+ * (-fsanitize=thread), which reports any access to the same memory from
+ * both threads that isn't ordered by the queue's atomics.
+ *
+ * The header is included straight from RedBearDuoButtonInterrupt (the other
+ * copies are identical), so the results are for the exact code that runs on
+ * the board. It prints PASS or FAIL for each check and exits with 1 if any
+ * failed.
+ *
+ * To build and run (from this folder):
+ *  g++ -std=c++11 -O2 -I. -pthread SpscQueueCheck.cpp -o SpscQueueCheck
+ *  ./SpscQueueCheck
+ *
+ *  g++ -std=c++11 -O1 -g -I. -pthread -fsanitize=thread SpscQueueCheck.cpp -o SpscQueueCheckTsan
+ *  ./SpscQueueCheckTsan
+ *
+ * By Jon E. Froehlich
+ * @jonfroehlich
+ * http://makeabilitylab.io
+ *
+ */
+#include <Arduino.h>  // the host stand-in in this folder (needs -I.)
+
+#include "../RedBearDuoButtonInterrupt/SpscQueue.hpp"
+
+#include <atomic>
+#include <cstdio>
+#include <memory>
+#include <thread>
+
+const uint32_t NUM_ITEMS = 500000;
+const int PAYLOAD_WORDS = 6;
+
+int _numFailures = 0;
+
+void check(bool passed, const char* name) {
+  printf("%-7s %s\n", name, passed ? "PASS" : "FAIL");
+  if (!passed) {
+    _numFailures++;
+  }
+}
+
+// An item bigger than one word, so a slot read before its data is fully
+// written shows up as a payload that doesn't match its sequence number
+struct Item{
+  uint32_t sequence;
+  uint32_t payload[PAYLOAD_WORDS];
+
+  static Item make(uint32_t sequence) {
+    Item item;
+    item.sequence = sequence;
+    for (int i = 0; i < PAYLOAD_WORDS; i++) {
+      item.payload[i] = sequence * 2654435761u + i;
+    }
+    return item;
+  }
+
+  bool isWhole() const {
+    for (int i = 0; i < PAYLOAD_WORDS; i++) {
+      if (payload[i] != sequence * 2654435761u + i) {
+        return false;
+      }
+    }
+    return true;
+  }
+};
+
+void checkBasics() {
+  SpscQueue<int, 4> queue;
+  bool passed = queue.isEmpty() && !queue.isFull() && queue.getCapacity() == 4;
+  for (int i = 0; i < 4; i++) {
+    passed = passed && queue.push(i);
+  }
+  passed = passed && queue.isFull() && !queue.push(99) && queue.getDropCount() == 1 &&
+           queue.available() == 4 && queue.getHighWaterMark() == 4;
+
+  int value = -1;
+  passed = passed && queue.peek(value) && value == 0 && queue.available() == 4;
+  for (int i = 0; i < 4; i++) {
+    passed = passed && queue.pop(value) && value == i;
+  }
+  passed = passed && !queue.pop(value) && !queue.peek(value) && queue.isEmpty();
+
+  // Wrap the indices around the buffer many times, 3 items at a time
+  for (int i = 0; i < 1000; i++) {
+    for (int j = 0; j < 3; j++) {
+      passed = passed && queue.push(3 * i + j);
+    }
+    passed = passed && queue.available() == 3;
+    for (int j = 0; j < 3; j++) {
+      passed = passed && queue.pop(value) && value == 3 * i + j;
+    }
+  }
+  passed = passed && queue.getDropCount() == 1 && queue.getHighWaterMark() == 4;
+  check(passed, "Basics");
+}
+
+/**
+ * Runs a producer and a consumer thread on one queue. If isDropping, the
+ * producer pushes whether or not there's room and the consumer pauses
+ * now and then; otherwise, the producer waits for room. Returns false if
+ * any item arrived out of order, twice, or torn, or if the counts are wrong
+ */
+template<uint16_t Capacity>
+bool runThreads(bool isDropping) {
+  std::unique_ptr<SpscQueue<Item, Capacity> > queuePointer(new SpscQueue<Item, Capacity>());
+  SpscQueue<Item, Capacity>& queue = *queuePointer;
+
+  std::atomic<bool> isProducerDone(false);
+  uint32_t numPushed = 0;
+
+  std::thread producer([&](){
+    for (uint32_t sequence = 0; sequence < NUM_ITEMS; sequence++) {
+      if (!isDropping) {
+        while (queue.isFull()) {
+          std::this_thread::yield();
+        }
+      }
+      if (queue.push(Item::make(sequence))) {
+        numPushed++;
+      }
+      if (isDropping && sequence % 100 == 0) {
+        std::this_thread::yield();  // interrupts come and go
+      }
+    }
+    isProducerDone.store(true, std::memory_order_release);
+  });
+
+  bool isInOrder = true;
+  uint32_t numPopped = 0;
+  int64_t lastSequence = -1;
+  Item item;
+  while (true) {
+    // Read the done flag before popping, so an empty queue after it's set
+    // means every item has been seen
+    bool isDone = isProducerDone.load(std::memory_order_acquire);
+    bool gotItem = false;
+    while (queue.pop(item)) {
+      gotItem = true;
+      isInOrder = isInOrder && item.isWhole() && (int64_t)item.sequence > lastSequence &&
+                  (isDropping || item.sequence == lastSequence + 1);
+      lastSequence = item.sequence;
+      numPopped++;
+      if (isDropping && numPopped % 64 == 0) {
+        std::this_thread::yield();  // a slow loop()
+      }
+    }
+    if (isDone && !gotItem) {
+      break;
+    }
+    if (!gotItem) {
+      std::this_thread::yield();  // let the producer run on a single core computer
+    }
+  }
+  producer.join();
+
+  uint32_t numDropped = queue.getDropCount();
+  bool passed = isInOrder && numPopped == numPushed && numPushed + numDropped == NUM_ITEMS &&
+                queue.getHighWaterMark() <= Capacity && (isDropping || numDropped == 0);
+  printf("%-7s capacity %4u: %7u received, %7u dropped, high water %4u\n",
+         isDropping ? "Drop" : "Spin", Capacity, numPopped, numDropped, queue.getHighWaterMark());
+  return passed;
+}
+
+template<uint16_t Capacity>
+bool runBoth() {
+  bool passed = runThreads<Capacity>(false);
+  return runThreads<Capacity>(true) && passed;
+}
+
+int main() {
+  checkBasics();
+
+  bool passed = runBoth<2>();
+  passed = runBoth<4>() && passed;
+  passed = runBoth<16>() && passed;
+  passed = runBoth<128>() && passed;
+  passed = runBoth<1024>() && passed;
+  check(passed, "Threads");
+
+  if (_numFailures > 0) {
+    printf("%d checks FAILED\n", _numFailures);
+    return 1;
+  }
+  printf("All checks passed\n");
+  return 0;
+}
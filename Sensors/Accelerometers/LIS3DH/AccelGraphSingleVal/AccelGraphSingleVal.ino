@@ -8,6 +8,15 @@
  *  - turn on/off the status bar at the top by setting _drawStatusBar to false
  *  - graph points rather than lines by setting _drawGraphPrimitive = POINTS
  *
+ *  Uses FastScrollingGraph.hpp (in this folder), which scrolls the graph by
+ *  moving the framebuffer's columns left and only draws the newest value. It
+ *  only redraws the whole graph when the auto-scaled range changes. The range
+ *  fits just the values on screen, so it recovers after a spike scrolls off.
+ *
+ *  The status bar uses FastText.hpp (also in this folder). Its labels are drawn
+ *  once and its numbers are TextFields, which only redraw the characters that
+ *  changed (usually a digit or two) rather than erasing and redrawing the bar.
+ *
  *  Adafruit Gfx Library:
  *  https://learn.adafruit.com/adafruit-gfx-graphics-library/overview 
  *
@@ -30,6 +39,8 @@
 
 #include <Adafruit_GFX.h>
 #include <Adafruit_SSD1306.h>
+#include "FastScrollingGraph.hpp"
+#include "FastText.hpp"
 
 #define SCREEN_WIDTH 128 // OLED display width, in pixels
 #define SCREEN_HEIGHT 64 // OLED display height, in pixels
@@ -42,21 +53,26 @@ Adafruit_SSD1306 display(SCREEN_WIDTH, SCREEN_HEIGHT, &Wire, OLED_RESET);
 #define LIS3DH_CS 10
 Adafruit_LIS3DH lis = Adafruit_LIS3DH();
 
-int _minSensorVal = 32767; // adaptive value, will be set automatically when sensor values read
-int _maxSensorVal = -32767; // adaptive value, will be set automatically when sensor values read
 const int DELAY_LOOP_MS = 0; // change to slow down how often to read and graph value
 
-int _circularBuffer[SCREEN_WIDTH]; //fast way to store values (rather than an ArrayList with remove calls)
-int _curWriteIndex = 0; // tracks where we are in the circular buffer
-
 // for tracking fps
 unsigned long _totalFrameCount = 0;
 unsigned long _startTimeStamp = 0;
 
 // status bar
-boolean _drawStatusBar = true; // change to show/hide status bar
+const boolean _drawStatusBar = true; // change to show/hide status bar
+const int STATUS_BAR_HEIGHT = 8;     // the top page (8 rows) of the screen
 boolean _drawAxis = true;
-int _graphHeight = SCREEN_HEIGHT;
+
+// The sensor value goes after its label (up to "MAG: ") and "XX.XX fps" in the
+// top-right corner. Both are updated in place, so the bar is never erased
+TextField _sensorValField(FastText::getTextWidth(5), 0, 6);
+TextField _fpsField(SCREEN_WIDTH - FastText::getTextWidth(9), 0, 5, TEXT_ALIGN_RIGHT);
+
+// The graph fills the screen below the status bar. Its range automatically
+// fits the sensor values on screen
+const int GRAPH_Y = _drawStatusBar ? STATUS_BAR_HEIGHT : 0;
+FastScrollingGraph _graph(0, GRAPH_Y, SCREEN_WIDTH, SCREEN_HEIGHT - GRAPH_Y);
 
 enum GraphPrimitive{
   POINTS,
@@ -108,8 +124,13 @@ void setup() {
   Serial.print(2 << lis.getRange());
   Serial.println("G");
 
+  display.clearDisplay();
   if(_drawStatusBar){
-    _graphHeight = SCREEN_HEIGHT - 10;
+    drawStatusBarLabels();
+  }
+  _graph.setStyle(_drawGraphPrimitive == POINTS ? GRAPH_POINTS : GRAPH_LINES);
+  if(_drawAxis){
+    _graph.setAxis(0);
   }
 }
 
@@ -146,34 +167,22 @@ void loop() {
       break;
   }
 
-  _circularBuffer[_curWriteIndex++] = sensorVal;
+  // We don't clear the display each frame: the graph scrolls what's
+  // already there and the status bar only redraws the digits that changed
+  _graph.addData(sensorVal);
 
-  if(sensorVal < _minSensorVal){
-    _minSensorVal = sensorVal;
-  }
-
-  if(sensorVal > _maxSensorVal){
-    _maxSensorVal = sensorVal;
-  }
-      
-  if(_curWriteIndex >= display.width()){
-    _curWriteIndex = 0;
-  }
-
-  display.clearDisplay();
+  // Scroll the line graph and draw the new value (with the axis dots)
+  _graph.draw(display);
 
   // Draw the status bar
   if(_drawStatusBar){
     drawStatusBar(sensorVal);
   }
 
-  // Draw the axis
+  // Draw the axis label
   if(_drawAxis){
-    drawAxis();
+    drawAxisLabel();
   }
-  
-  // Draw the line graph
-  drawLineGraph();
 
   // Render buffer to screen
   display.display();
@@ -184,116 +193,47 @@ void loop() {
   }
 }
 
-void drawStatusBar(int sensorVal){
-  // Draw current val
-  display.setCursor(0, 0);
-
+// Draw the parts of the status bar that never change (once, in setup)
+void drawStatusBarLabels(){
   switch(_graphData){
     case X_DATA:
-      display.print("X: ");
+      FastText::drawText(display, 0, 0, "X: ");
       break;
     case Y_DATA:
-      display.print("Y: ");
+      FastText::drawText(display, 0, 0, "Y: ");
       break;
     case Z_DATA:
-      display.print("Z: ");
+      FastText::drawText(display, 0, 0, "Z: ");
       break;
     case MAG:
-      display.print("MAG: ");     
+      FastText::drawText(display, 0, 0, "MAG: ");
       break;
   }
-  
-  display.print(sensorVal);
+
+  FastText::drawText(display, _fpsField.getX() + _fpsField.getWidth(), 0, " fps");
+}
+
+void drawStatusBar(int sensorVal){
+  // Draw current val
+  _sensorValField.update(display, sensorVal);
 
   if(_totalFrameCount > 0){
-    int16_t  x1, y1;
-    uint16_t w, h;
     unsigned long elapsedTime = millis() - _startTimeStamp;
     float fps = _totalFrameCount / (elapsedTime / 1000.0);
-    display.getTextBounds("XX.XX fps", 0, 0, &x1, &y1, &w, &h);
-    display.setCursor(display.width() - w, 0);
-    display.print(fps);
-    display.print(" fps");
+    _fpsField.update(display, fps);
   }
 }
 
-// Draw the axis
-void drawAxis(){
-  int y = getYPixelFromSensorVal(0);
-
-  // draw dotted line
-  for(int x = 0; x < display.width(); x += 5){
-    display.drawPixel(x, y, SSD1306_WHITE);
+// Draw the axis label. The graph draws the dotted axis line itself. The
+// label's black background covers the graph as it scrolls underneath
+void drawAxisLabel(){
+  if(0 < _graph.getMinValue() || 0 > _graph.getMaxValue()){
+    return;
   }
 
-  display.setCursor(0, y - 9);
-  display.print("0");
-}
-
-// Draw the line graph
-void drawLineGraph(){
-  int xPos = 0; 
-  int lastSensorVal = 0;
-  for (int i = _curWriteIndex; i < display.width(); i++){
-    // draw the line
-    if(_drawGraphPrimitive == POINTS){
-      int sensorVal = _circularBuffer[i];
-      drawValue(xPos, sensorVal);
-    }else{
-      if(xPos > 0){
-        int x1 = xPos - 1;
-        int x2 = xPos;
-        int sensorVal1 = _circularBuffer[i - 1];
-        int sensorVal2 = _circularBuffer[i];
-        lastSensorVal = sensorVal2;
-        drawLine(x1, sensorVal1, x2, sensorVal2);
-      }
-    }
-    
-    xPos++;
-  }
-  
-  for(int i = 0; i < _curWriteIndex; i++){
-    //draw the line
-    if(_drawGraphPrimitive == POINTS){
-      int sensorVal = _circularBuffer[i];
-      drawValue(xPos, sensorVal);
-    }else{
-      int x1 = xPos - 1;
-      int x2 = xPos;
-      int sensorVal1 = 0;
-      if(i == 0){
-        sensorVal1 = lastSensorVal;
-      }else{
-        sensorVal1 = _circularBuffer[i - 1];
-      }
-      
-      int sensorVal2 = _circularBuffer[i];
-      drawLine(x1, sensorVal1, x2, sensorVal2);
-    }
-    
-    xPos++;;
-  }
-}
-
-// Draws a line between two sensor values at the given x positions
-void drawLine(int x1, int sensorVal1, int x2, int sensorVal2){
-  int y1 = getYPixelFromSensorVal(sensorVal1);
-  int y2 = getYPixelFromSensorVal(sensorVal2);
-
-  display.drawLine(x1, y1, x2, y2, SSD1306_WHITE);
-}
-
-// Get the y-pixel position for the sensor value
-int getYPixelFromSensorVal(int sensorVal){
-  int lineHeight = map(sensorVal, _minSensorVal, _maxSensorVal, 0, _graphHeight);
-  int yPixel = display.height() - lineHeight;
-  return yPixel;
-}
-
-// Draws the value at the x pixel position
-void drawValue(int xPos, int sensorVal){
-  int lineHeight = map(sensorVal, _minSensorVal, _maxSensorVal, 0, _graphHeight);
-  int yPos = display.height() - lineHeight;
-  display.drawPixel(xPos, yPos, SSD1306_WHITE);
+  // The label goes above the axis unless that would be in the status bar
+  // (which isn't redrawn each frame), in which case it goes below
+  int y = _graph.getYPixelForValue(0);
+  int labelY = y - 9 >= GRAPH_Y ? y - 9 : y + 2;
+  FastText::drawChar(display, 0, labelY, '0');
 }
@@ -0,0 +1,172 @@
+/**
+ * Keeps the last windowSize values (e.g., the points on a scrolling graph)
+ * and their min and max, updated in constant time per value.
+ *
+ * Auto-scaling a graph to all-time extremes means one spike flattens it
+ * forever, but rescanning the window for its min and max after every value
+ * costs windowSize comparisons. Instead, SlidingMinMax keeps two "monotonic"
+ * queues of positions in the window: for the min, the values that could
+ * still become the min once older values leave (each one smaller than the
+ * ones after it), and likewise for the max. A new value removes the ones it
+ * beats from the back of each queue, and the oldest value leaves from the
+ * front when the window is full. Each value is added and removed at most
+ * once, so add() is O(1) on average and getMin()/getMax() are always O(1).
+ *
+ * Memory is fixed by Capacity: the values plus two bytes per value for the
+ * queues (e.g., 512 bytes for SlidingMinMax<int, 128>).
+ *
+ * Usage:
+ *  #include "SlidingMinMax.hpp"
+ *
+ *  SlidingMinMax<int, 128> _window(128);  // type, capacity, window size
+ *
+ *  loop(){
+ *    _window.add(analogRead(A0));
+ *    int minVal = _window.getMin();       // over just the last 128 values
+ *    int maxVal = _window.getMax();
+ *  }
+ *
+ * By Jon E. Froehlich
+ * @jonfroehlich
+ * http://makeabilitylab.io
+ *
+ */
+#ifndef SLIDING_MIN_MAX_HPP
+#define SLIDING_MIN_MAX_HPP
+
+#include <Arduino.h>
+
+template<typename T, uint8_t Capacity>
+class SlidingMinMax{
+
+  static_assert(Capacity >= 1, "Capacity must be at least 1");
+
+  private:
+    // A queue of positions in _values, oldest first, in a circular buffer
+    struct SlotQueue{
+      uint8_t slots[Capacity];
+      uint8_t front;
+      uint8_t count;
+    };
+
+    const uint8_t _windowSize;
+
+    // The window, in a circular buffer of _windowSize values
+    T _values[Capacity];
+    uint8_t _newest;
+    uint8_t _count;
+
+    SlotQueue _minQueue;  // values increase from front to back
+    SlotQueue _maxQueue;  // values decrease from front to back
+
+    uint8_t wrap(uint8_t index) const {
+      return index >= _windowSize ? index - _windowSize : index;
+    }
+
+    // The indexes are 16-bit since front + count can pass 255 when Capacity
+    // is over 128
+    static uint8_t back(const SlotQueue& queue) {
+      uint16_t index = queue.front + queue.count - 1;
+      return queue.slots[index >= Capacity ? index - Capacity : index];
+    }
+
+    static void pushBack(SlotQueue& queue, uint8_t slot) {
+      uint16_t index = queue.front + queue.count;
+      queue.slots[index >= Capacity ? index - Capacity : index] = slot;
+      queue.count++;
+    }
+
+    static void popFront(SlotQueue& queue, uint8_t slot) {
+      if (queue.count > 0 && queue.slots[queue.front] == slot) {
+        queue.front = queue.front + 1 >= Capacity ? 0 : queue.front + 1;
+        queue.count--;
+      }
+    }
+
+  public:
+    /**
+     * Creates a window of the last windowSize values (at most Capacity)
+     */
+    SlidingMinMax(uint8_t windowSize)
+      : _windowSize(windowSize < 1 ? 1 : (windowSize > Capacity ? (uint8_t)Capacity : windowSize)) {
+      reset();
+    }
+
+    /**
+     * Adds a value to the window. If the window is full, the oldest value leaves
+     */
+    void add(const T& value) {
+      uint8_t slot = _count > 0 ? wrap(_newest + 1) : 0;
+      if (_count == _windowSize) {
+        // The oldest value is in slot and can only be at the front of the queues
+        popFront(_minQueue, slot);
+        popFront(_maxQueue, slot);
+      } else {
+        _count++;
+      }
+      _values[slot] = value;
+      _newest = slot;
+
+      // Values the new one beats can never be the min (or max) again
+      while (_minQueue.count > 0 && !(_values[back(_minQueue)] < value)) {
+        _minQueue.count--;
+      }
+      pushBack(_minQueue, slot);
+
+      while (_maxQueue.count > 0 && !(value < _values[back(_maxQueue)])) {
+        _maxQueue.count--;
+      }
+      pushBack(_maxQueue, slot);
+    }
+
+    /**
+     * Returns the smallest value in the window. The window must not be empty
+     */
+    T getMin() const {
+      return _values[_minQueue.slots[_minQueue.front]];
+    }
+
+    /**
+     * Returns the largest value in the window. The window must not be empty
+     */
+    T getMax() const {
+      return _values[_maxQueue.slots[_maxQueue.front]];
+    }
+
+    /**
+     * Returns the value added age values ago (0 is the newest). age must be
+     * less than getCount()
+     */
+    T get(uint8_t age) const {
+      int index = (int)_newest - age;
+      if (index < 0) {
+        index += _windowSize;
+      }
+      return _values[index];
+    }
+
+    /**
+     * Returns the number of values in the window (up to the window size)
+     */
+    uint8_t getCount() const {
+      return _count;
+    }
+
+    uint8_t getWindowSize() const {
+      return _windowSize;
+    }
+
+    /**
+     * Empties the window
+     */
+    void reset() {
+      _newest = 0;
+      _count = 0;
+      _minQueue.front = 0;
+      _minQueue.count = 0;
+      _maxQueue.front = 0;
+      _maxQueue.count = 0;
+    }
+};
+
+#endif
@@ -18,6 +18,7 @@
 #include <Wire.h>
 #include <Adafruit_TCS34725.h>
 #include <ColorName.hpp>
+#include "ColorTables.hpp"
 
 // Change this to based on whether you are using a common anode or common cathode
 // RGB LED. See: https://makeabilitylab.github.io/physcomp/arduino/rgb-led
@@ -35,9 +36,11 @@ const boolean USE_GAMMA_CORRECTION = true;
 
 Adafruit_TCS34725 _colorSensor = Adafruit_TCS34725(TCS34725_INTEGRATIONTIME_50MS, TCS34725_GAIN_4X);
 
-// our RGB -> eye-recognized gamma color
+// our RGB -> eye-recognized gamma color (gamma 2.5)
 // See: https://learn.adafruit.com/chameleon-scarf/code
-byte _gammaTable[256];
+// The table is computed at compile time and stored in flash, so it costs
+// no RAM and no startup time
+typedef GammaTable<byte, 25> Gamma;
 
 
 
@@ -88,17 +91,6 @@ void setup() {
   pinMode(RGB_GREEN_PIN, OUTPUT);
   pinMode(RGB_BLUE_PIN, OUTPUT);
 
-  // Gamma table code from: https://learn.adafruit.com/chameleon-scarf/code
-  // Corrects color output based on human perception
-  for (int i = 0; i < 256; i++) {
-    float x = i;
-    x /= 255;
-    x = pow(x, 2.5);
-    x *= 255;
-
-    _gammaTable[i] = x;
-  }
-
 }
 
 void loop() {
@@ -145,13 +137,13 @@ void setRgbLedColor(int red, int green, int blue)
   } else {
 
     if (COMMON_ANODE == true) {
-      gammaRed = MAX_COLOR_VALUE - _gammaTable[red];
-      gammaGreen = MAX_COLOR_VALUE - _gammaTable[green];
-      gammaBlue = MAX_COLOR_VALUE - _gammaTable[blue];
+      gammaRed = MAX_COLOR_VALUE - Gamma::get(red);
+      gammaGreen = MAX_COLOR_VALUE - Gamma::get(green);
+      gammaBlue = MAX_COLOR_VALUE - Gamma::get(blue);
     } else {
-      gammaRed = _gammaTable[red];
-      gammaGreen = _gammaTable[green];
-      gammaBlue = _gammaTable[blue];
+      gammaRed = Gamma::get(red);
+      gammaGreen = Gamma::get(green);
+      gammaBlue = Gamma::get(blue);
     }
     
     analogWrite(RGB_RED_PIN, gammaRed);
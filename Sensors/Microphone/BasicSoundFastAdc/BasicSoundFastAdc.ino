@@ -1,59 +1,63 @@
 
 /* 
- * This code extends BasicSound.ino by experimenting with FASTADC to speed up 
- * analogRead calls; however, FASTADC is disabled by default and the code works 
- * fine without it.
+ * This code extends BasicSound.ino by sampling the microphone much faster. Rather
+ * than calling analogRead in loop(), it uses FastAdcSampler.hpp (in this folder), 
+ * which runs the ADC in free-running mode and collects samples in the background
+ * with an interrupt at a steady ~19.2 kHz. Each loop() then processes all of the
+ * samples collected since the last loop, so no peaks are missed. This only works on
+ * AVR boards (e.g., Uno, Leonardo).
  * 
  * The other difference with BasicSound.ino is that we implemented a VUMeter fade 
  * so the maximum sensed microphone value is output to the mic and then faded downwards
- * until a new max is sensed.
+ * until a new max is sensed. The samples go into SoundLevelMeter.hpp (also in this
+ * folder), which measures the peak-to-peak level over each window of
+ * MIC_SAMPLE_WINDOW_SIZE samples and keeps the fading envelope for us.
  * 
  * Re: FASTADC
- * Some of my experiments on the Arduino Leonardo and using a pocket oscillocope measuring
- * the I/O frequency (square wave) on Pin 2:
+ * An earlier version of this sketch sped up analogRead by changing the ADC prescaler
+ * (FASTADC) instead. Some of my experiments with that on the Arduino Leonardo and using a 
+ * pocket oscillocope measuring the I/O frequency (square wave) on Pin 2:
  *  With FASTADC 1 and DEBUG 0, 6.5 kHz
  *  With FASTADC 0 and DEBUG 0, 2.93 kHz
  *  With FASTADC 1 and DEBUG 1, 1.53 kHz
  *  With FASTADC 0 and DEBUG 1, 1.19 kHz
  *  With FASTADC 0 and DEBUG 1 and INCLUDE_SAMPLING_RATE 1, 610 Hz
  *  
- * So, clearly printing to serial slows down sampling significantly
+ * So, clearly printing to serial slows down sampling significantly. With FastAdcSampler,
+ * the sample rate no longer depends on what loop() is doing: printing only risks
+ * overruns (samples dropped because the buffer filled up), which we count below.
  *
  * Based in part on:
  *  - https://learn.adafruit.com/adafruit-microphone-amplifier-breakout/measuring-sound-levels
  *  - FASTADC code from: https://forum.arduino.cc/index.php?topic=6549.0
  */
 
-// Set FASTADC to 1 if you want to speed up analogRead
-// Not necessary for a simple volume meter, however.
-#define FASTADC 0 
-
-// defines for setting and clearing register bits
-// This is relevant only if FASTADC is enabled
-#ifndef cbi
-#define cbi(sfr, bit) (_SFR_BYTE(sfr) &= ~_BV(bit))
-#endif
-#ifndef sbi
-#define sbi(sfr, bit) (_SFR_BYTE(sfr) |= _BV(bit))
-#endif
+// 128 samples at ~19.2 kHz is ~6.7 ms of sound, so loop() needs to run at
+// least that often to avoid overruns
+#define FAST_ADC_BUFFER_SIZE 128
+#include "FastAdcSampler.hpp"
+#include "SoundLevelMeter.hpp"
 
+const int MIC_INPUT_PIN = A0;
 const int LED_OUTPUT_PIN = 3;
 const int MAX_ANALOG_IN = 676; //1024 with 5V, 676 with 3.3V on Arduino Uno
 const int MAX_ANALOG_OUT = 255;
 
 float _samplesPerSecond = 0;
-unsigned long _numSamples = 0;
+unsigned long _lastSampleCount = 0;
 unsigned long _lastTimeStamp = 0;
 
 int _maxSoundLevel = 0; // the maximum sound level read
 
+// 384 samples at ~19.2 kHz is a 20 ms window. Because the sample rate is
+// steady, so is the window length, no matter what loop() is doing
+const uint16_t MIC_SAMPLE_WINDOW_SIZE = 384;
+
 // Because we are reading sound levels so quickly, it's useful
 // to *fade* the LED down from sound peaks (much like a typical VUMeter)
-// So, we capture max values with _fadeLedVal and then decrement
-// each time _fadeTimeMs threshold is passed
-int _fadeLedVal = 0;
-unsigned long _fadeTimeMs = 1; // amount of time to stay on a particular LED output val
-unsigned long _fadeTimestamp = 0; // last fade decrement timestamp
+// So, the meter's envelope jumps up to louder windows right away (attack = 1)
+// and falls 5% of the way to quieter ones each window (decay = 0.05)
+SoundLevelMeter _soundLevelMeter(MIC_SAMPLE_WINDOW_SIZE, 1, 0.05);
 
 const int DEBUG_LED_OUTPUT_PIN = 2;
 boolean _debugLedVal = true;
@@ -68,17 +72,12 @@ void setup() {
   Serial.begin(115200);
 #endif  
 
-  #if FASTADC
-   // set prescale to 16
-   sbi(ADCSRA,ADPS2) ;
-   cbi(ADCSRA,ADPS1) ;
-   cbi(ADCSRA,ADPS0) ;
-  #endif
-  
-  //_lastTimeStamp = millis();
   pinMode(LED_OUTPUT_PIN, OUTPUT);
   pinMode(DEBUG_LED_OUTPUT_PIN, OUTPUT);
 
+  // Start sampling the mic in the background at 16 MHz / 64 / 13 = ~19.2 kHz
+  FastAdcSampler::begin(MIC_INPUT_PIN, FastAdcSampler::PRESCALER_64);
+
   _lastTimeStamp = millis();
 }
 
@@ -88,34 +87,40 @@ void loop() {
   _debugLedVal = !_debugLedVal;
   
   
-  int soundLevel = analogRead(A0);
-  int ledVal = map(soundLevel, MAX_ANALOG_IN/2, MAX_ANALOG_IN, 0, MAX_ANALOG_OUT);
-  ledVal = constrain(ledVal, 0, MAX_ANALOG_OUT);
-
-  // set the new fadeLedVal if ledVal is bigger
-  if(ledVal >= _fadeLedVal){
-    _fadeLedVal = ledVal;
-    _fadeTimestamp = millis();
+  // Add all of the samples collected since the last loop to the meter
+  boolean finishedWindow = false;
+  uint16_t sample;
+  uint8_t pinIndex;
+  while(FastAdcSampler::read(sample, pinIndex)){
+    if(_soundLevelMeter.add(sample)){
+      finishedWindow = true;
+    }
   }
 
-  // decrement the fade if we surprassed the _fadeTimeMs threshold
-  if(millis() - _fadeTimestamp > _fadeTimeMs){
-    _fadeLedVal--;
-    _fadeTimestamp = millis();
+  if(!finishedWindow){
+    return;
   }
 
+  // The mic swings peak-to-peak from 0V to the reference voltage, so the
+  // largest peak-to-peak is MAX_ANALOG_IN
+  int soundLevel = _soundLevelMeter.getPeakToPeak();
+  int ledVal = map(soundLevel, 0, MAX_ANALOG_IN, 0, MAX_ANALOG_OUT);
+  ledVal = constrain(ledVal, 0, MAX_ANALOG_OUT);
+
+  int fadeLedVal = map(_soundLevelMeter.getEnvelope(), 0, MAX_ANALOG_IN, 0, MAX_ANALOG_OUT);
+  fadeLedVal = constrain(fadeLedVal, 0, MAX_ANALOG_OUT);
+
   // Write out the fade val
-  analogWrite(LED_OUTPUT_PIN, _fadeLedVal);
+  analogWrite(LED_OUTPUT_PIN, fadeLedVal);
   
   // The rest of this is just debugging
 #if DEBUG
-  _numSamples++;
-
   unsigned long timeDiff = millis() - _lastTimeStamp;
   if(timeDiff > 1000){
-    _samplesPerSecond = _numSamples / (float)((timeDiff)/1000.0);
+    unsigned long sampleCount = FastAdcSampler::getSampleCount();
+    _samplesPerSecond = (sampleCount - _lastSampleCount) / (float)((timeDiff)/1000.0);
     _lastTimeStamp = millis();
-    _numSamples = 0;
+    _lastSampleCount = sampleCount;
   }
 
   if(_maxSoundLevel < soundLevel){
@@ -125,11 +130,13 @@ void loop() {
   #if INCLUDE_SAMPLING_RATE
   Serial.print(_samplesPerSecond);
   Serial.print(", ");
+  Serial.print(FastAdcSampler::getOverrunCount());
+  Serial.print(", ");
   #endif
   Serial.print(soundLevel);
   Serial.print(", ");
   Serial.print(ledVal);
   Serial.print(", ");
-  Serial.println(_fadeLedVal);
+  Serial.println(fadeLedVal);
 #endif 
 }
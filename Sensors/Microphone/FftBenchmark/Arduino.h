@@ -0,0 +1,28 @@
+/**
+ * Just enough of Arduino.h for FixedFft.hpp to compile on a desktop computer.
+ * Only used by FftBenchmark.cpp; don't copy this into a sketch folder.
+ *
+ * By Jon E. Froehlich
+ * @jonfroehlich
+ * http://makeabilitylab.io
+ *
+ */
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#define PI 3.1415926535897932384626433832795
+
+#define PROGMEM
+#define pgm_read_word(addr) (*(const uint16_t*)(addr))
+
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+#endif
@@ -0,0 +1,199 @@
+/**
+ * Checks FixedFft.hpp against a double-precision reference on a desktop
+ * computer (Linux or Mac) and measures how fast it runs. For each FFT size
+ * (64, 128, 256, 512), it reports:
+ *
+ *  - Tone: a sine wave centered on a bin, at a loud (400), medium (40), and
+ *    quiet (4) amplitude on top of a 512 offset, like a mic on a 10-bit ADC.
+ *    The loudest bin must be the tone's bin and its magnitude must be within
+ *    5% (or 1 for the quiet tone) of the amplitude
+ *  - Match: how closely all of the bins match a double-precision FFT with the
+ *    same DC removal and Hann window, for a mix of three tones and noise.
+ *    Reports the largest difference and the SNR (signal power over error
+ *    power, in dB). Since getMagnitude() rounds to whole units, every bin must
+ *    be within 1 + 1% of the reference
+ *  - Bands: a tone at each band's center frequency must be loudest in that band
+ *  - Silence: a constant input must read 0 in every bin
+ *  - Time: microseconds per compute() on this computer. An Arduino is
+ *    thousands of times slower (see FixedFft.hpp for rough times), so this
+ *    is only useful for comparing sizes and changes to the code
+ *
+ * The header is included straight from its sketch folder, so the results are
+ * for the exact code that runs on the Arduino. It prints PASS or FAIL for each
+ * check and exits with 1 if any failed.
+ *
+ * To build and run (from this folder):
+ *  g++ -std=c++11 -O2 -I. FftBenchmark.cpp -o FftBenchmark
+ *  ./FftBenchmark
+ *
+ * By Jon E. Froehlich
+ * @jonfroehlich
+ * http://makeabilitylab.io
+ *
+ */
+#include <Arduino.h>  // the host stand-in in this folder (needs -I.)
+
+#include "../SoundSpectrumNeopixelStrand/FixedFft.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <complex>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+const float SAMPLE_RATE_HZ = 8000;
+const int ADC_OFFSET = 512;
+const int NUM_TIMING_RUNS = 20000;
+
+int _numFailures = 0;
+
+void check(bool passed, const char* name) {
+  printf(" %s:%s", name, passed ? "PASS" : "FAIL");
+  if (!passed) {
+    _numFailures++;
+  }
+}
+
+// The same steps as FixedFft::compute() in doubles: remove the mean, apply a
+// Hann window, DFT, and scale so a centered sine of amplitude A reads A
+std::vector<double> referenceMagnitudes(const std::vector<int16_t>& samples) {
+  int n = samples.size();
+  double mean = 0;
+  for (int i = 0; i < n; i++) {
+    mean += samples[i];
+  }
+  mean /= n;
+
+  std::vector<double> magnitudes(n / 2 + 1);
+  for (int k = 0; k <= n / 2; k++) {
+    std::complex<double> sum = 0;
+    for (int i = 0; i < n; i++) {
+      double window = 0.5 * (1 - cos(2 * PI * i / n));
+      sum += (samples[i] - mean) * window * std::polar(1.0, -2 * PI * k * i / n);
+    }
+    magnitudes[k] = std::abs(sum) * 4 / n;
+  }
+  return magnitudes;
+}
+
+template<uint16_t N>
+void computeFft(FixedFft<N>& fft, const std::vector<int16_t>& samples) {
+  for (uint16_t i = 0; i < N; i++) {
+    fft.setSample(i, samples[i]);
+  }
+  fft.compute();
+}
+
+std::vector<int16_t> makeTones(int n, const std::vector<double>& freqsHz,
+                               const std::vector<double>& amplitudes, double noise, unsigned seed) {
+  std::mt19937 rng(seed);
+  std::normal_distribution<double> gaussian(0, noise > 0 ? noise : 1);
+  std::vector<int16_t> samples(n);
+  for (int i = 0; i < n; i++) {
+    double value = ADC_OFFSET;
+    for (size_t t = 0; t < freqsHz.size(); t++) {
+      value += amplitudes[t] * sin(2 * PI * freqsHz[t] * i / SAMPLE_RATE_HZ + t);
+    }
+    if (noise > 0) {
+      value += gaussian(rng);
+    }
+    samples[i] = lround(value);
+  }
+  return samples;
+}
+
+template<uint16_t N>
+void runBenchmark() {
+  static FixedFft<N> fft;
+  printf("N=%-4d RAM=%-5d", N, (int)sizeof(fft));
+
+  // Tones centered on bin N / 8
+  const int toneBin = N / 8;
+  const double toneFreqHz = toneBin * SAMPLE_RATE_HZ / N;
+  const double toneAmplitudes[] = { 400, 40, 4 };
+  bool tonesPassed = true;
+  for (double amplitude : toneAmplitudes) {
+    computeFft(fft, makeTones(N, { toneFreqHz }, { amplitude }, 0, 0));
+    uint16_t loudestBin = 0;
+    for (uint16_t bin = 1; bin <= N / 2; bin++) {
+      if (fft.getMagnitude(bin) > fft.getMagnitude(loudestBin)) {
+        loudestBin = bin;
+      }
+    }
+    double error = fabs(fft.getMagnitude(toneBin) - amplitude);
+    tonesPassed = tonesPassed && loudestBin == toneBin && (error <= amplitude * 0.05 || error <= 1);
+  }
+  check(tonesPassed, "Tone");
+
+  // A mix of tones (not centered on bins) and noise against the reference
+  std::vector<int16_t> samples = makeTones(N, { 440, 1234.5, 3000 }, { 200, 60, 15 }, 2, N);
+  computeFft(fft, samples);
+  std::vector<double> reference = referenceMagnitudes(samples);
+  double signalPower = 0;
+  double errorPower = 0;
+  double maxError = 0;
+  bool matchPassed = true;
+  for (int bin = 1; bin <= N / 2; bin++) {
+    double error = fabs(fft.getMagnitude(bin) - reference[bin]);
+    signalPower += reference[bin] * reference[bin];
+    errorPower += error * error;
+    maxError = std::max(maxError, error);
+    matchPassed = matchPassed && error <= 1 + reference[bin] * 0.01;
+  }
+  printf(" MaxErr=%.2f SNR=%.1fdB", maxError, 10 * log10(signalPower / errorPower));
+  check(matchPassed, "Match");
+
+  // A tone in the middle of each band is loudest in that band
+  const uint8_t NUM_BANDS = 8;
+  SpectrumBands<NUM_BANDS> bands(N, SAMPLE_RATE_HZ, 100, 4000);
+  bool bandsPassed = true;
+  for (uint8_t band = 0; band < NUM_BANDS; band++) {
+    uint16_t firstBin = bands.getFirstBin(band);
+    uint16_t endBin = band + 1 < NUM_BANDS ? bands.getFirstBin(band + 1) : N / 2;
+    double centerFreqHz = (firstBin + endBin - 1) / 2.0 * SAMPLE_RATE_HZ / N;
+    computeFft(fft, makeTones(N, { centerFreqHz }, { 300 }, 0, 0));
+    bands.update(fft);
+    for (uint8_t other = 0; other < NUM_BANDS; other++) {
+      if (other != band && bands.getLevel(other) >= bands.getLevel(band)) {
+        bandsPassed = false;
+      }
+    }
+  }
+  check(bandsPassed, "Bands");
+
+  // Silence
+  computeFft(fft, std::vector<int16_t>(N, ADC_OFFSET));
+  bool silencePassed = true;
+  for (uint16_t bin = 0; bin <= N / 2; bin++) {
+    silencePassed = silencePassed && fft.getMagnitude(bin) == 0;
+  }
+  check(silencePassed, "Silence");
+
+  // Time per compute()
+  auto startTime = std::chrono::steady_clock::now();
+  unsigned long checksum = 0;
+  for (int run = 0; run < NUM_TIMING_RUNS; run++) {
+    for (uint16_t i = 0; i < N; i++) {
+      fft.setSample(i, samples[i]);
+    }
+    fft.compute();
+    checksum += fft.getMagnitude(run % (N / 2));
+  }
+  double elapsedUs = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - startTime).count();
+  printf(" Time=%.2fus (%lu)\n", elapsedUs / NUM_TIMING_RUNS, checksum % 10);
+}
+
+int main() {
+  runBenchmark<64>();
+  runBenchmark<128>();
+  runBenchmark<256>();
+  runBenchmark<512>();
+
+  if (_numFailures > 0) {
+    printf("%d checks FAILED\n", _numFailures);
+    return 1;
+  }
+  printf("All checks passed\n");
+  return 0;
+}
@@ -28,12 +28,16 @@
 // - strandtest_wheel: https://github.com/adafruit/Adafruit_NeoPixel/blob/master/examples/strandtest_wheel/strandtest_wheel.ino
 // - strandtest_nodelay: https://github.com/adafruit/Adafruit_NeoPixel/blob/master/examples/strandtest_nodelay/strandtest_nodelay.ino
 //
+// Uses SoundLevelMeter.hpp (in this folder) to measure the peak-to-peak sound
+// level over windows of MIC_SAMPLE_WINDOW_SIZE samples.
+//
 // By Jon E. Froehlich
 // @jonfroehlich
 // http://makeabilitylab.io
 //
 
 #include <Adafruit_NeoPixel.h> // https://github.com/adafruit/Adafruit_NeoPixel
+#include "SoundLevelMeter.hpp"
 
 const int NUM_NEOPIXELS = 30;       // Change this to match your strand length
 const int NEOPIXEL_PIN_OUTPUT = 6;  // Change this to match your output pin
@@ -59,11 +63,11 @@ Adafruit_NeoPixel _neopixelStrip = Adafruit_NeoPixel(NUM_NEOPIXELS, NEOPIXEL_PIN
 const int MIC_INPUT_PIN = A5;
 const int MAX_MIC_LEVEL = 1023;
 
-const int MIC_SAMPLE_WINDOW_MS = 40; // Sample window width in ms (50 ms = 20Hz)
+// The number of samples per window. How long a window takes depends on how fast
+// analogRead is on your board, so increase this if the level flickers
+const uint16_t MIC_SAMPLE_WINDOW_SIZE = 1000;
 
-unsigned long _startSampleTimeMs = -1;
-unsigned int _signalMax = 0;
-unsigned int _signalMin = MAX_ANALOG_INPUT;
+SoundLevelMeter _soundLevelMeter(MIC_SAMPLE_WINDOW_SIZE);
 
 void setup() {
   Serial.begin(115200);
@@ -76,22 +80,12 @@ void setup() {
   _neopixelStrip.show();             // Turn OFF all pixels ASAP
 
   pinMode(MIC_INPUT_PIN, INPUT);
-
-  _startSampleTimeMs = millis();
 }
 
 void loop() {
    // Read in current sound level from microphone
-  int micLevel = analogRead(MIC_INPUT_PIN);
-
-  if(micLevel > _signalMax){
-    _signalMax = micLevel;
-  }else if(micLevel < _signalMin){
-    _signalMin = micLevel;
-  }
-
-  if(millis() - _startSampleTimeMs > MIC_SAMPLE_WINDOW_MS){
-    unsigned int peakToPeak = _signalMax - _signalMin;
+  if(_soundLevelMeter.add(analogRead(MIC_INPUT_PIN))){
+    unsigned int peakToPeak = _soundLevelMeter.getPeakToPeak();
 
     const int neopixelSaturation = MAX_SATURATION_VALUE;
     const int neopixelBrightness = 150;
@@ -123,18 +117,14 @@ void loop() {
     // _neopixelStrip.fill(0, numNeoPixelsToIlluminate, NUM_NEOPIXELS); // clear others
     _neopixelStrip.show();
 
-    Serial.print(_signalMin);
+    Serial.print(_soundLevelMeter.getMin());
     Serial.print(", ");
-    Serial.print(_signalMax);
+    Serial.print(_soundLevelMeter.getMax());
     Serial.print(", ");
     Serial.print(peakToPeak);
     Serial.print(", ");
     Serial.println(numNeoPixelsToIlluminate);
     //Serial.print(", ");
     //Serial.println(hueVal);
-
-    _signalMax = 0;
-    _signalMin = MAX_ANALOG_INPUT;
-    _startSampleTimeMs = millis();
   }
 }
@@ -28,12 +28,16 @@
 // - strandtest_wheel: https://github.com/adafruit/Adafruit_NeoPixel/blob/master/examples/strandtest_wheel/strandtest_wheel.ino
 // - strandtest_nodelay: https://github.com/adafruit/Adafruit_NeoPixel/blob/master/examples/strandtest_nodelay/strandtest_nodelay.ino
 //
+// Uses SoundLevelMeter.hpp (in this folder) to measure the peak-to-peak sound
+// level over windows of MIC_SAMPLE_WINDOW_SIZE samples.
+//
 // By Jon E. Froehlich
 // @jonfroehlich
 // http://makeabilitylab.io
 //
 
 #include <Adafruit_NeoPixel.h> // https://github.com/adafruit/Adafruit_NeoPixel
+#include "SoundLevelMeter.hpp"
 
 const int NUM_NEOPIXELS = 30;       // Change this to match your strand length
 const int NEOPIXEL_PIN_OUTPUT = 6;  // Change this to match your output pin
@@ -59,16 +63,14 @@ Adafruit_NeoPixel _neopixelStrip = Adafruit_NeoPixel(NUM_NEOPIXELS, NEOPIXEL_PIN
 const int MIC_INPUT_PIN = A5;
 const int MAX_MIC_LEVEL = 1023;
 
-const int MIC_SAMPLE_WINDOW_MS = 40; // Sample window width in ms (50 ms = 20Hz)
-
-unsigned long _startSampleTimeMs = -1;
-unsigned int _signalMax = 0;
-unsigned int _signalMin = MAX_ANALOG_INPUT;
+// The number of samples per window. How long a window takes depends on how fast
+// analogRead is on your board, so increase this if the level flickers
+const uint16_t MIC_SAMPLE_WINDOW_SIZE = 1000;
 
-int _peakToPeakFader = 0;
-int _peakToPeakFadeStep = 1;
-unsigned long _startFadeTimeMs = -1;
-const int FADE_TIME_THRESHOLD_MS = 10;
+// The envelope jumps up to louder windows right away (attack = 1) and falls
+// 15% of the way to quieter ones each window (decay = 0.15), so the strand
+// fades down from peaks like a VU meter
+SoundLevelMeter _soundLevelMeter(MIC_SAMPLE_WINDOW_SIZE, 1, 0.15);
 
 void setup() {
   Serial.begin(115200);
@@ -81,74 +83,50 @@ void setup() {
   _neopixelStrip.show();             // Turn OFF all pixels ASAP
 
   pinMode(MIC_INPUT_PIN, INPUT);
-
-  _startSampleTimeMs = millis();
-  _startFadeTimeMs = millis();
 }
 
 void loop() {
    // Read in current sound level from microphone
-  int micLevel = analogRead(MIC_INPUT_PIN);
+  if(_soundLevelMeter.add(analogRead(MIC_INPUT_PIN))){
+    unsigned int peakToPeak = _soundLevelMeter.getPeakToPeak();
+    int peakToPeakFader = _soundLevelMeter.getEnvelope();
 
-  if(micLevel > _signalMax){
-    _signalMax = micLevel;
-  }else if(micLevel < _signalMin){
-    _signalMin = micLevel;
-  }
-
-  if(millis() - _startSampleTimeMs > MIC_SAMPLE_WINDOW_MS){
-    unsigned int peakToPeak = _signalMax - _signalMin;
-
-    if(_peakToPeakFader < peakToPeak){
-      _peakToPeakFader = peakToPeak;
-    }
-
-    Serial.print(_signalMin);
+    Serial.print(_soundLevelMeter.getMin());
     Serial.print(", ");
-    Serial.print(_signalMax);
+    Serial.print(_soundLevelMeter.getMax());
     Serial.print(", ");
     Serial.print(peakToPeak);
     Serial.print(", ");
-    Serial.println(_peakToPeakFader);
+    Serial.println(peakToPeakFader);
     //Serial.print(", ");
     //Serial.println(hueVal);
 
-    _signalMax = 0;
-    _signalMin = MAX_ANALOG_INPUT;
-    _startSampleTimeMs = millis();
-  }
-
-  const int neopixelSaturation = MAX_SATURATION_VALUE;
-  const int neopixelBrightness = 150;
+    const int neopixelSaturation = MAX_SATURATION_VALUE;
+    const int neopixelBrightness = 150;
 
-  //int hueVal = map(peakToPeak, 0, MAX_MIC_LEVEL, 0, MAX_HUE_VALUE * .8);
-  //uint32_t rgbColor = _neopixelStrip.ColorHSV(hueVal, saturation, brightness);
+    //int hueVal = map(peakToPeak, 0, MAX_MIC_LEVEL, 0, MAX_HUE_VALUE * .8);
+    //uint32_t rgbColor = _neopixelStrip.ColorHSV(hueVal, saturation, brightness);
 
-  unsigned int numNeoPixelsToIlluminate = map(_peakToPeakFader, 0, MAX_MIC_LEVEL, 0, NUM_NEOPIXELS);
-  numNeoPixelsToIlluminate = constrain(numNeoPixelsToIlluminate, 0, NUM_NEOPIXELS);
+    unsigned int numNeoPixelsToIlluminate = map(peakToPeakFader, 0, MAX_MIC_LEVEL, 0, NUM_NEOPIXELS);
+    numNeoPixelsToIlluminate = constrain(numNeoPixelsToIlluminate, 0, NUM_NEOPIXELS);
 
-  for(int pxl = 0; pxl < NUM_NEOPIXELS; pxl++){
-    const int hueVal = map(pxl, 0, NUM_NEOPIXELS, 0, MAX_HUE_VALUE * .8);
-    uint32_t rgbColor = _neopixelStrip.ColorHSV(hueVal, neopixelSaturation, neopixelBrightness);
-
-    // setPixelColor is an overloaded function that takes in the pixel index
-    // with zero-based indexing and red, green, blue or simply pixel index
-    // and a 32-bit type that merges red, green, blue values into a single number
-    //_neopixelStrip.setPixelColor(0, 255, 0, 0);
-    if(pxl < numNeoPixelsToIlluminate){
-      _neopixelStrip.setPixelColor(pxl, rgbColor);
-    }else{
-      _neopixelStrip.setPixelColor(pxl, 0);
-    }
-  }
-  
-  _neopixelStrip.show();
+    for(int pxl = 0; pxl < NUM_NEOPIXELS; pxl++){
+      const int hueVal = map(pxl, 0, NUM_NEOPIXELS, 0, MAX_HUE_VALUE * .8);
+      uint32_t rgbColor = _neopixelStrip.ColorHSV(hueVal, neopixelSaturation, neopixelBrightness);
 
-  if(millis() - _startSampleTimeMs > FADE_TIME_THRESHOLD_MS){
-    if(_peakToPeakFader > 0){
-      _peakToPeakFader -= _peakToPeakFadeStep;
+      // setPixelColor is an overloaded function that takes in the pixel index
+      // with zero-based indexing and red, green, blue or simply pixel index
+      // and a 32-bit type that merges red, green, blue values into a single number
+      //_neopixelStrip.setPixelColor(0, 255, 0, 0);
+      if(pxl < numNeoPixelsToIlluminate){
+        _neopixelStrip.setPixelColor(pxl, rgbColor);
+      }else{
+        _neopixelStrip.setPixelColor(pxl, 0);
+      }
     }
-    _startFadeTimeMs = millis();
+    
+    // Only update the strand once per window: show() takes ~1 ms for
+    // 30 pixels, which would otherwise slow down the sampling
+    _neopixelStrip.show();
   }
-  
 }
@@ -5,6 +5,9 @@
 * Tested on:
  *  - Adafruit nRF52840: https://learn.adafruit.com/introducing-the-adafruit-nrf52840-feather
  *
+ * Uses SoundLevelMeter.hpp (in this folder) to measure the peak-to-peak
+ * sound level over windows of MIC_SAMPLE_WINDOW_SIZE samples.
+ *
  * By Jon E. Froehlich
  * @jonfroehlich
  * http://makeabilitylab.io
@@ -12,6 +15,7 @@
  */
 
 #include <Adafruit_NeoPixel.h>    //  Library that provides NeoPixel functions
+#include "SoundLevelMeter.hpp"
 
 // Create a NeoPixel object called onePixel that addresses 1 pixel in pin 8
 Adafruit_NeoPixel _onePixel = Adafruit_NeoPixel(1, PIN_NEOPIXEL, NEO_GRB + NEO_KHZ800);
@@ -22,16 +26,16 @@ const int MAX_ANALOG_IN = 1023;
 const int MIC_INPUT_PIN = A0;
 const int MAX_MIC_LEVEL = 950;
 
-const int MIC_SAMPLE_WINDOW_MS = 50; // Sample window width in ms (50 ms = 20Hz)
+// The number of samples per window. How long a window takes depends on how fast
+// analogRead is on your board, so increase this if the level flickers
+const uint16_t MIC_SAMPLE_WINDOW_SIZE = 1000;
 
 const unsigned long MAX_HUE_VALUE = 65535; // Hue is a 16-bit number
 const unsigned int MAX_BRIGHTNESS_VALUE = 50;
 const unsigned int MAX_SATURATION_VALUE = 255;
 const unsigned int BRIGHTNESS_VALUE = MAX_BRIGHTNESS_VALUE;
 
-unsigned long _startSampleTimeMs = -1;
-unsigned int _signalMax = 0;
-unsigned int _signalMin = MAX_ANALOG_IN;
+SoundLevelMeter _soundLevelMeter(MIC_SAMPLE_WINDOW_SIZE);
 
 void setup() {
   pinMode(MIC_INPUT_PIN, INPUT);
@@ -40,23 +44,13 @@ void setup() {
   _onePixel.clear();             // Set NeoPixel color to black (0,0,0)
   _onePixel.setBrightness(30);   // Affects all subsequent settings
   _onePixel.show();              // Show
-
-  _startSampleTimeMs = millis();
 }
 
 void loop() {  
 
   // Read in current sound level from microphone
-  int micLevel = analogRead(MIC_INPUT_PIN);
-
-  if(micLevel > _signalMax){
-    _signalMax = micLevel;
-  }else if(micLevel < _signalMin){
-    _signalMin = micLevel;
-  }
-
-  if(millis() - _startSampleTimeMs > MIC_SAMPLE_WINDOW_MS){
-    unsigned int peakToPeak = _signalMax - _signalMin;
+  if(_soundLevelMeter.add(analogRead(MIC_INPUT_PIN))){
+    unsigned int peakToPeak = _soundLevelMeter.getPeakToPeak();
 
     int hueVal = map(peakToPeak, 0, MAX_MIC_LEVEL, 0, MAX_HUE_VALUE);
     int brightnessVal = map(peakToPeak,0, MAX_MIC_LEVEL, 5, MAX_BRIGHTNESS_VALUE);
@@ -70,16 +64,12 @@ void loop() {
     _onePixel.setBrightness(brightnessVal); 
     _onePixel.show();
 
-    // Serial.print(_signalMin);
+    // Serial.print(_soundLevelMeter.getMin());
     // Serial.print(", ");
-    // Serial.print(_signalMax);
+    // Serial.print(_soundLevelMeter.getMax());
     // Serial.print(", ");
     // Serial.print(peakToPeak);
     // Serial.print(", ");
     // Serial.println(rgbColor);
-
-    _signalMax = 0;
-    _signalMin = MAX_ANALOG_IN;
-    _startSampleTimeMs = millis();
   }
 }
\ No newline at end of file
@@ -2,11 +2,17 @@
  * Simple VUMeter using an electret microphone (with built-in amp) on A0
  * and an LED for output on Pin 3
  * 
+ * Uses SoundLevelMeter.hpp (in this folder) to measure the peak-to-peak
+ * sound level over windows of MIC_SAMPLE_WINDOW_SIZE samples. The LED shows the
+ * meter's envelope, which jumps up to loud sounds and fades back down.
+ * 
  * By Jon E. Froehlich
  * @jonfroehlich
  * http://makeabilitylab.io
  * 
  */
+#include "SoundLevelMeter.hpp"
+
 const int LED_OUTPUT_PIN = 3;
 
 // 1024 with 5V, 676 with 3.3V on Arduino Uno or Leonardo
@@ -14,7 +20,12 @@ const int MAX_ANALOG_IN = 676;
 const int MAX_ANALOG_OUT = 255;
 const int MIC_INPUT_PIN = A0;
 
-int _maxSoundLevel = 0;
+// analogRead takes ~112 us on an Uno, so 400 samples is ~45 ms (~22 Hz)
+const uint16_t MIC_SAMPLE_WINDOW_SIZE = 400;
+
+// Jump up to louder windows right away (attack = 1) and fall 10%
+// of the way to quieter ones each window (decay = 0.1)
+SoundLevelMeter _soundLevelMeter(MIC_SAMPLE_WINDOW_SIZE, 1, 0.1);
 
 void setup() {
   pinMode(LED_OUTPUT_PIN, OUTPUT);
@@ -24,13 +35,14 @@ void setup() {
 void loop() {  
 
   // Read in current sound level from microphone
-  int soundLevel = analogRead(MIC_INPUT_PIN);
+  if(_soundLevelMeter.add(analogRead(MIC_INPUT_PIN))){
 
-  // Since microphone works peak-to-peak from 0V to the reference voltage (either 3.3V or 5V)
-  // we only look at half of the amplitude from MAX_ANALOG_IN/2 to MAX_ANALOG_IN
-  int ledVal = map(soundLevel, MAX_ANALOG_IN/2, MAX_ANALOG_IN, 0, MAX_ANALOG_OUT);
-  ledVal = constrain(ledVal, 0, MAX_ANALOG_OUT);
+    // Since the microphone works peak-to-peak from 0V to the reference voltage
+    // (either 3.3V or 5V), the largest peak-to-peak is MAX_ANALOG_IN
+    int ledVal = map(_soundLevelMeter.getEnvelope(), 0, MAX_ANALOG_IN, 0, MAX_ANALOG_OUT);
+    ledVal = constrain(ledVal, 0, MAX_ANALOG_OUT);
 
-  // Set the LED brightness to current waveform amplitude
-  analogWrite(LED_OUTPUT_PIN, ledVal);
+    // Set the LED brightness to the current sound level
+    analogWrite(LED_OUTPUT_PIN, ledVal);
+  }
 }
@@ -1,24 +1,29 @@
 /*
  * Simple VUMeter using an electret microphone (with built-in amp) on A0
- * and an LED for output on Pin 3
+ * and six LEDs for output on PWM pins
  * 
  * We also have a version with an OLED called: SoundLevelSixLEDsWithOLED.ino
  * 
+ * Uses SoundLevelMeter.hpp (in this folder) to measure the peak-to-peak
+ * sound level over windows of MIC_SAMPLE_WINDOW_SIZE samples.
+ * 
  * By Jon E. Froehlich
  * @jonfroehlich
  * http://makeabilitylab.io
  * 
  */
-
+#include "SoundLevelMeter.hpp"
 
 // 1024 with 5V, 676 with 3.3V on Arduino Uno or Leonardo
-const int MIN_ANALOG_IN = 300;
+const int MAX_ANALOG_IN = 600; 
 
 const int MAX_ANALOG_OUT = 255;
 const int MIC_INPUT_PIN = A0;
 
+// analogRead takes ~112 us on an Uno, so 400 samples is ~45 ms (~22 Hz)
+const uint16_t MIC_SAMPLE_WINDOW_SIZE = 400;
 
-const int _micSampleWindow = 50; // Sample window width in ms (50 ms = 20Hz)
+SoundLevelMeter _soundLevelMeter(MIC_SAMPLE_WINDOW_SIZE);
 
 const int GREEN_LED1_OUTPUT_PIN = 5;
 const int GREEN_LED2_OUTPUT_PIN = 6;
@@ -43,41 +48,16 @@ void setup() {
     pinMode(ledPin, OUTPUT);
   }
   pinMode(MIC_INPUT_PIN, INPUT);
-
-  // SSD1306_SWITCHCAPVCC = generate display voltage from 3.3V internally
-  if(!_display.begin(SSD1306_SWITCHCAPVCC, 0x3D)) { // Address 0x3D for 128x64
-    Serial.println(F("SSD1306 allocation failed"));
-    for(;;); // Don't proceed, loop forever
-  }
-
-  _maxShapeSize = min(_display.width(), _display.height());
-
-  _display.clearDisplay();
-  _display.setTextSize(1);      // Normal 1:1 pixel scale
-  _display.setTextColor(SSD1306_WHITE); // Draw white text
-  _display.setCursor(0, 0);     // Start at top-left corner
-  _display.display();
 }
 
 void loop() {  
 
-  unsigned long startMillis= millis();  // Start of sample window
-  unsigned int peakToPeak = 0;   // peak-to-peak level
-  
-  unsigned int signalMax = 0;
-  unsigned int signalMin = MAX_ANALOG_IN;
-  
-  // collect data for 50 mS
-  while (millis() - startMillis < _micSampleWindow){
-    const int micInVal = analogRead(MIC_INPUT_PIN);
-    
-    if (micInVal > signalMax){
-      signalMax = micInVal;  // save just the max levels
-    }else if (micInVal < signalMin){
-      signalMin = micInVal;  // save just the min levels
-    }
+  // Keep sampling until we have a full window
+  if(!_soundLevelMeter.add(analogRead(MIC_INPUT_PIN))){
+    return;
   }
-  peakToPeak = signalMax - signalMin;  // max - min = peak-peak amplitude
+
+  int peakToPeak = _soundLevelMeter.getPeakToPeak();  // max - min = peak-peak amplitude
   peakToPeak = constrain(peakToPeak, 0, MAX_ANALOG_IN);
 
   // Translate peakToPeak voltage signal to a VU meter value
@@ -4,6 +4,9 @@
  * 
  * We also have a version without the OLED called: SoundLevelSixLEDs.ino
  * 
+ * Uses SoundLevelMeter.hpp (in this folder) to measure the peak-to-peak
+ * sound level over windows of MIC_SAMPLE_WINDOW_SIZE samples.
+ * 
  * Based on
  * https://learn.adafruit.com/adafruit-microphone-amplifier-breakout/measuring-sound-levels
  * 
@@ -16,6 +19,7 @@
 #include <Wire.h>
 #include <Adafruit_GFX.h>
 #include <Adafruit_SSD1306.h>
+#include "SoundLevelMeter.hpp"
 
 #define SCREEN_WIDTH 128 // OLED display width, in pixels
 #define SCREEN_HEIGHT 64 // OLED display height, in pixels
@@ -34,7 +38,10 @@ const int MIC_INPUT_PIN = A0;
 const int MIN_SHAPE_SIZE = 0;
 int _maxShapeSize = 0;
 
-const int sampleWindow = 50; // Sample window width in mS (50 ms = 20Hz)
+// analogRead takes ~112 us on an Uno, so 400 samples is ~45 ms (~22 Hz)
+const uint16_t MIC_SAMPLE_WINDOW_SIZE = 400;
+
+SoundLevelMeter _soundLevelMeter(MIC_SAMPLE_WINDOW_SIZE);
 
 const int GREEN_LED1_OUTPUT_PIN = 5;
 const int GREEN_LED2_OUTPUT_PIN = 6;
@@ -84,23 +91,13 @@ void setup() {
 
 void loop() {  
 
-  
-  unsigned int peakToPeak = 0;   // peak-to-peak level
-  unsigned int signalMax = 0;
-  unsigned int signalMin = MAX_ANALOG_IN;
-  
-  // collect data for 50 ms
-  unsigned long startMillis = millis();  // Start of sample window
-  while (millis() - startMillis < sampleWindow){
-    const int micInVal = analogRead(MIC_INPUT_PIN);
-    
-    if (micInVal > signalMax){
-      signalMax = micInVal;  // save just the max levels
-    }else if (micInVal < signalMin){
-      signalMin = micInVal;  // save just the min levels
-    }
+  // Collect a full window of samples. Drawing to the OLED is slow, so we
+  // sample in a tight loop here rather than one sample per loop()
+  while (!_soundLevelMeter.add(analogRead(MIC_INPUT_PIN))){
+    // keep sampling
   }
-  peakToPeak = signalMax - signalMin;  // max - min = peak-peak amplitude
+
+  int peakToPeak = _soundLevelMeter.getPeakToPeak();  // max - min = peak-peak amplitude
   peakToPeak = constrain(peakToPeak, 0, MAX_ANALOG_IN);
 
   // Translate peakToPeak voltage signal to a VU meter value
@@ -0,0 +1,108 @@
+// Outputs the microphone's frequency spectrum on a NeoPixel strand. Rather than
+// one volume level for the whole strand (see SoundLevelNeopixelStrand), the strand
+// is split into bands from bass (red, first pixels) to treble (purple, last
+// pixels), and each band's brightness shows how loud that range of frequencies is.
+//
+// Uses FixedFft.hpp (in this folder), an integer-only FFT that splits each
+// window of FFT_SIZE mic samples into frequency bins, which SpectrumBands then
+// groups into NUM_BANDS log-spaced bands. On AVR boards like the Uno, we use a
+// 64-point FFT to save RAM; on 32-bit boards like the Feather M0 or NRF52840,
+// 256 points for finer frequency resolution.
+//
+// The samples must be evenly spaced in time for the FFT to work, so we time each
+// analogRead() with micros() rather than reading as fast as the loop runs.
+//
+// See SoundLevelNeopixelStrand for notes on level shifting and NeoPixel best practices.
+//
+// By Jon E. Froehlich
+// @jonfroehlich
+// http://makeabilitylab.io
+//
+
+#include <Adafruit_NeoPixel.h> // https://github.com/adafruit/Adafruit_NeoPixel
+#include "FixedFft.hpp"
+
+const int NUM_NEOPIXELS = 30;       // Change this to match your strand length
+const int NEOPIXEL_PIN_OUTPUT = 6;  // Change this to match your output pin
+
+const unsigned long MAX_HUE_VALUE = 65535;  // Hue is a 16-bit number
+const unsigned int MAX_BRIGHTNESS_VALUE = 255;
+const unsigned int MAX_SATURATION_VALUE = 255;
+
+Adafruit_NeoPixel _neopixelStrip = Adafruit_NeoPixel(NUM_NEOPIXELS, NEOPIXEL_PIN_OUTPUT,
+                                                     NEO_GRB + NEO_KHZ800);
+
+// Sound spectrum stuff
+const int MIC_INPUT_PIN = A5;
+
+#if defined(__AVR__)
+const uint16_t FFT_SIZE = 64;       // 256 bytes of RAM, ~4 ms per FFT on an Uno (estimate)
+#else
+const uint16_t FFT_SIZE = 256;      // 1 KB of RAM, ~2 ms per FFT on a Feather M0 (estimate)
+#endif
+
+const float SAMPLE_RATE_HZ = 5000;  // Frequencies up to 2.5 kHz (half the sample rate)
+const unsigned long SAMPLE_PERIOD_US = 1000000 / SAMPLE_RATE_HZ;
+
+const uint8_t NUM_BANDS = 10;
+const float MIN_BAND_FREQ_HZ = 80;
+const float MAX_BAND_FREQ_HZ = SAMPLE_RATE_HZ / 2;
+
+// Band levels are amplitudes in analogRead units. We map them on a log scale
+// (like our ears) from MIN_LEVEL_DB (1 unit = 0 dB) to MAX_LEVEL_DB
+const float MIN_LEVEL_DB = 6;
+const float MAX_LEVEL_DB = 48;
+
+// Each loop, a band's brightness drops by at most this much, so short
+// sounds fade out rather than flicker
+const int BRIGHTNESS_FADE_STEP = 20;
+
+FixedFft<FFT_SIZE> _fft;
+SpectrumBands<NUM_BANDS> _bands(FFT_SIZE, SAMPLE_RATE_HZ, MIN_BAND_FREQ_HZ, MAX_BAND_FREQ_HZ);
+int _bandBrightness[NUM_BANDS];
+
+void setup() {
+  Serial.begin(115200);
+
+  _neopixelStrip.begin();            // Initialize NeoPixel strip object (REQUIRED)
+  _neopixelStrip.setBrightness(50);  // Set brightness to about 1/5 (max = 255)
+  _neopixelStrip.show();             // Turn OFF all pixels ASAP
+
+  pinMode(MIC_INPUT_PIN, INPUT);
+}
+
+void loop() {
+  // Read in FFT_SIZE evenly spaced samples from the microphone
+  unsigned long nextSampleTimeUs = micros();
+  for(uint16_t i = 0; i < FFT_SIZE; i++){
+    while((long)(micros() - nextSampleTimeUs) < 0){
+      // wait for the next sample time
+    }
+    _fft.setSample(i, analogRead(MIC_INPUT_PIN));
+    nextSampleTimeUs += SAMPLE_PERIOD_US;
+  }
+
+  _fft.compute();
+  _bands.update(_fft);
+
+  for(uint8_t band = 0; band < NUM_BANDS; band++){
+    uint16_t level = _bands.getLevel(band);
+    float levelDb = level > 0 ? 20 * log10(level) : 0;
+    int brightness = map(levelDb * 10, MIN_LEVEL_DB * 10, MAX_LEVEL_DB * 10, 0, MAX_BRIGHTNESS_VALUE);
+    brightness = constrain(brightness, 0, MAX_BRIGHTNESS_VALUE);
+
+    // Jump up to louder levels right away but fade down slowly
+    _bandBrightness[band] = max(brightness, _bandBrightness[band] - BRIGHTNESS_FADE_STEP);
+
+    Serial.print(level);
+    Serial.print(band < NUM_BANDS - 1 ? ", " : "\n");
+  }
+
+  for(int pxl = 0; pxl < NUM_NEOPIXELS; pxl++){
+    const uint8_t band = (long)pxl * NUM_BANDS / NUM_NEOPIXELS;
+    const uint16_t hueVal = map(band, 0, NUM_BANDS, 0, MAX_HUE_VALUE * .8);
+    uint32_t rgbColor = _neopixelStrip.ColorHSV(hueVal, MAX_SATURATION_VALUE, _bandBrightness[band]);
+    _neopixelStrip.setPixelColor(pxl, rgbColor);
+  }
+  _neopixelStrip.show();
+}
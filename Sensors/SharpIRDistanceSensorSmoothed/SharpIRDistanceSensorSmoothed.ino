@@ -22,6 +22,10 @@
  * Or another one by jeoendoggen
  * https://github.com/jeroendoggen/Arduino-GP2Y0A21YK-library
  * 
+ * Each reading is the average of 4 quick analogReads (see OversampledAnalogIn.hpp in 
+ * this folder), which adds a bit of resolution (11 bits) and averages out ADC noise
+ * before the moving average filter.
+ * 
  * By Jon E. Froehlich
  * @jonfroehlich
  * http://makeabilitylab.io
@@ -29,12 +33,19 @@
  */
 
 #include <MovingAverageFilter.hpp>
+#include "OversampledAnalogIn.hpp"
 
 // The Arduino Uno and Leonardo ADC is 10 bits (thus, 0 - 1023 values)
 #define MAX_ANALOG_INPUT_VAL 1023
 
 const int SHARPIR_INPUT_PIN = A0;
 
+// Oversampling by 4^1 = 4 readings adds 1 bit: 0 - 2046 rather than 0 - 1023.
+// (We stop at 1 bit so that 10 readings still sum to less than an int's max.)
+const int OVERSAMPLING_BITS = 1;
+const float OVERSAMPLING_SCALE = 1 << OVERSAMPLING_BITS;
+OversampledAnalogIn<OVERSAMPLING_BITS> _sharpIrInput(SHARPIR_INPUT_PIN);
+
 enum SharpIRModel{
   GP2Y0A21YK,
   GP2Y0A02YK0F
@@ -50,11 +61,14 @@ void setup() {
 
 void loop() {
 
-  int sharpInfraredVal = analogRead(SHARPIR_INPUT_PIN);
+  // Read the sensor with an extra bit of resolution and convert back to
+  // (fractional) 10-bit analogRead units for the distance formulas below
+  int oversampledVal = _sharpIrInput.read();
+  float sharpInfraredVal = oversampledVal / OVERSAMPLING_SCALE;
 
   // Get the smoothed version using a moving average filter
-  _movingAverageFilter.add(sharpInfraredVal);
-  float sharpInfraredValSmoothed = _movingAverageFilter.getAverageAsFloat();
+  _movingAverageFilter.add(oversampledVal);
+  float sharpInfraredValSmoothed = _movingAverageFilter.getAverageAsFloat() / OVERSAMPLING_SCALE;
   
   float distanceCm = convertInfraredValToDistanceInCm(sharpInfraredVal);
   float smoothedDistanceCm = convertInfraredValToDistanceInCm(sharpInfraredValSmoothed);
@@ -0,0 +1,282 @@
+/**
+ * Samples analog inputs in the background at a steady, fast rate on AVR
+ * boards (e.g., Uno, Nano, Leonardo) by running the ADC in free-running mode.
+ * Each time a conversion finishes, an interrupt stores the sample in a ring
+ * buffer and the next conversion starts on its own, so no samples are
+ * missed while loop() is busy (as long as it empties the buffer in time).
+ *
+ * Compared to calling analogRead() in a loop (see SpeedTest.ino), the sample
+ * rate is set by the ADC clock alone, so there's no jitter, and loop() is
+ * free to do other work. A conversion takes 13 ADC clocks, so on a 16 MHz board:
+ *
+ *   PRESCALER_16:  ~76.9 kHz (reduced accuracy: ~8 bits)
+ *   PRESCALER_32:  ~38.5 kHz
+ *   PRESCALER_64:  ~19.2 kHz
+ *   PRESCALER_128: ~9.6 kHz (the default ADC clock used by analogRead)
+ *
+ * With more than one pin, the pins are sampled round-robin, so each pin gets
+ * the rate above divided by the number of pins. Every sample is tagged with
+ * the index of its pin.
+ *
+ * If loop() falls behind and the buffer fills up, new samples are dropped
+ * and counted in getOverrunCount(). FAST_ADC_BUFFER_SIZE (a power of 2 up to
+ * 256; default 128) sets the buffer size; define it before including this file.
+ *
+ * Notes:
+ *  - Don't call analogRead() while the sampler is running; call end() first
+ *  - This file defines the ADC interrupt (ISR), so include it only once
+ *  - The reference voltage is AVcc (the default for analogRead)
+ *
+ * Usage:
+ *  #include "FastAdcSampler.hpp"
+ *
+ *  setup(){
+ *    FastAdcSampler::begin(A0, FastAdcSampler::PRESCALER_64);
+ *  }
+ *
+ *  loop(){
+ *    uint16_t sample;
+ *    uint8_t pinIndex;
+ *    while(FastAdcSampler::read(sample, pinIndex)){
+ *      // process sample
+ *    }
+ *  }
+ *
+ * See the ATmega328P datasheet, Section 24 (Analog-to-Digital Converter)
+ *
+ * By Jon E. Froehlich
+ * @jonfroehlich
+ * http://makeabilitylab.io
+ *
+ */
+#ifndef FAST_ADC_SAMPLER_HPP
+#define FAST_ADC_SAMPLER_HPP
+
+#include <Arduino.h>
+
+#if !defined(__AVR__)
+#error "FastAdcSampler.hpp uses the AVR ADC registers and only works on AVR boards (e.g., Uno, Nano, Leonardo)"
+#endif
+
+#include <util/atomic.h>
+
+#ifndef FAST_ADC_BUFFER_SIZE
+#define FAST_ADC_BUFFER_SIZE 128
+#endif
+
+class FastAdcSampler{
+
+  static_assert(FAST_ADC_BUFFER_SIZE >= 2 && FAST_ADC_BUFFER_SIZE <= 256 &&
+                (FAST_ADC_BUFFER_SIZE & (FAST_ADC_BUFFER_SIZE - 1)) == 0,
+                "FAST_ADC_BUFFER_SIZE must be a power of 2 between 2 and 256");
+
+  public:
+    // Values of the ADPS bits in ADCSRA
+    enum Prescaler {
+      PRESCALER_16 = 4,
+      PRESCALER_32 = 5,
+      PRESCALER_64 = 6,
+      PRESCALER_128 = 7
+    };
+
+    static const uint8_t MAX_PINS = 8;
+
+  private:
+    static const uint8_t BUFFER_MASK = FAST_ADC_BUFFER_SIZE - 1;
+    static const uint8_t PIN_INDEX_SHIFT = 10;  // samples are 10 bits; the pin index goes above them
+
+    static uint8_t _muxChannels[MAX_PINS];
+    static uint8_t _numPins;
+    static uint8_t _prescaler;
+
+    // Ring buffer of samples tagged with their pin index. The ISR only
+    // writes _head and loop() only writes _tail, and both are single bytes,
+    // so no locking is needed to read them
+    static volatile uint16_t _buffer[FAST_ADC_BUFFER_SIZE];
+    static volatile uint8_t _head;
+    static volatile uint8_t _tail;
+
+    static volatile uint8_t _resultPinIndex;   // pin index of the conversion in progress
+    static volatile uint8_t _muxPinIndex;      // pin index currently selected in ADMUX
+    static volatile unsigned long _sampleCount;
+    static volatile unsigned long _overrunCount;
+
+    // Converts an analog pin (A0 or 0) to its ADC multiplexer channel,
+    // the same way analogRead() does
+    static uint8_t pinToMuxChannel(uint8_t pin) {
+      if (pin >= A0) {
+        pin -= A0;
+      }
+#if defined(analogPinToChannel)
+      pin = analogPinToChannel(pin);
+#endif
+      return pin;
+    }
+
+    static void selectMuxChannel(uint8_t channel) {
+#if defined(ADCSRB) && defined(MUX5)
+      ADCSRB = (ADCSRB & ~_BV(MUX5)) | (((channel >> 3) & 0x01) << MUX5);
+#endif
+      ADMUX = _BV(REFS0) | (channel & 0x07);
+    }
+
+  public:
+    /**
+     * Starts sampling the given analog pins (e.g., { A0, A1 }) round-robin
+     */
+    static void begin(const uint8_t pins[], uint8_t numPins, uint8_t prescaler = PRESCALER_64) {
+      end();
+
+      _numPins = numPins < 1 ? 1 : numPins > MAX_PINS ? MAX_PINS : numPins;
+      for (uint8_t i = 0; i < _numPins; i++) {
+        _muxChannels[i] = pinToMuxChannel(pins[i]);
+      }
+      _prescaler = prescaler & 0x07;
+
+      _head = 0;
+      _tail = 0;
+      _sampleCount = 0;
+      _overrunCount = 0;
+
+      // In free-running mode, the next conversion starts as soon as one ends,
+      // so it uses the channel selected *before* the interrupt for the one that
+      // ended. The ISR keeps track of which pin each result belongs to.
+      _resultPinIndex = 0;
+      _muxPinIndex = 0;
+      selectMuxChannel(_muxChannels[0]);
+
+#if defined(ADTS0)
+      ADCSRB &= ~(_BV(ADTS2) | _BV(ADTS1) | _BV(ADTS0));  // auto trigger source: free running
+#endif
+      // Writing 1 to ADIF clears it, so a conversion left over from analogRead()
+      // doesn't fire the ISR as soon as ADIE is set
+      ADCSRA = _BV(ADEN) | _BV(ADSC) | _BV(ADATE) | _BV(ADIF) | _BV(ADIE) | _prescaler;
+    }
+
+    /**
+     * Starts sampling a single analog pin
+     */
+    static void begin(uint8_t pin, uint8_t prescaler = PRESCALER_64) {
+      begin(&pin, 1, prescaler);
+    }
+
+    /**
+     * Stops sampling and restores the ADC settings analogRead() uses
+     */
+    static void end() {
+      ADCSRA = _BV(ADEN) | PRESCALER_128;
+    }
+
+    /**
+     * Returns the number of samples waiting in the buffer
+     */
+    static uint8_t available() {
+      return (uint8_t)(_head - _tail) & BUFFER_MASK;
+    }
+
+    /**
+     * Gets the oldest sample (0 - 1023) and the index of the pin it came from
+     * (in the order given to begin()). Returns false if the buffer is empty
+     */
+    static bool read(uint16_t& sample, uint8_t& pinIndex) {
+      uint8_t tail = _tail;
+      if (tail == _head) {
+        return false;
+      }
+
+      uint16_t taggedSample = _buffer[tail];
+      _tail = (tail + 1) & BUFFER_MASK;
+
+      sample = taggedSample & ((1 << PIN_INDEX_SHIFT) - 1);
+      pinIndex = taggedSample >> PIN_INDEX_SHIFT;
+      return true;
+    }
+
+    /**
+     * Returns the oldest sample (0 - 1023) or -1 if the buffer is empty
+     */
+    static int read() {
+      uint16_t sample;
+      uint8_t pinIndex;
+      return read(sample, pinIndex) ? (int)sample : -1;
+    }
+
+    /**
+     * Returns the sample rate of each pin in Hz, based on the ADC clock
+     */
+    static float getSampleRateHz() {
+      return F_CPU / (float)(1 << _prescaler) / 13.0 / _numPins;
+    }
+
+    /**
+     * Returns the total number of conversions since begin() (including
+     * dropped ones). Compare this against millis() to measure the real rate
+     */
+    static unsigned long getSampleCount() {
+      unsigned long count;
+      ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+        count = _sampleCount;
+      }
+      return count;
+    }
+
+    /**
+     * Returns the number of samples dropped because the buffer was full
+     */
+    static unsigned long getOverrunCount() {
+      unsigned long count;
+      ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+        count = _overrunCount;
+      }
+      return count;
+    }
+
+    /**
+     * Returns the number of pins being sampled
+     */
+    static uint8_t getNumPins() {
+      return _numPins;
+    }
+
+    /**
+     * Called by the ADC interrupt when a conversion finishes. Don't call this yourself
+     */
+    static inline void handleConversion() {
+      uint16_t sample = ADC;
+      uint8_t pinIndex = _resultPinIndex;
+
+      // The conversion that just started uses the pin selected now, so
+      // select the one after it for the conversion after that
+      _resultPinIndex = _muxPinIndex;
+      if (_numPins > 1) {
+        _muxPinIndex = _muxPinIndex + 1 < _numPins ? _muxPinIndex + 1 : 0;
+        selectMuxChannel(_muxChannels[_muxPinIndex]);
+      }
+
+      _sampleCount++;
+      uint8_t nextHead = (_head + 1) & BUFFER_MASK;
+      if (nextHead == _tail) {
+        _overrunCount++;
+        return;
+      }
+      _buffer[_head] = sample | ((uint16_t)pinIndex << PIN_INDEX_SHIFT);
+      _head = nextHead;
+    }
+};
+
+uint8_t FastAdcSampler::_muxChannels[FastAdcSampler::MAX_PINS];
+uint8_t FastAdcSampler::_numPins = 1;
+uint8_t FastAdcSampler::_prescaler = FastAdcSampler::PRESCALER_128;
+volatile uint16_t FastAdcSampler::_buffer[FAST_ADC_BUFFER_SIZE];
+volatile uint8_t FastAdcSampler::_head = 0;
+volatile uint8_t FastAdcSampler::_tail = 0;
+volatile uint8_t FastAdcSampler::_resultPinIndex = 0;
+volatile uint8_t FastAdcSampler::_muxPinIndex = 0;
+volatile unsigned long FastAdcSampler::_sampleCount = 0;
+volatile unsigned long FastAdcSampler::_overrunCount = 0;
+
+ISR(ADC_vect) {
+  FastAdcSampler::handleConversion();
+}
+
+#endif
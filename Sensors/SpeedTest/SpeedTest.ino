@@ -1,7 +1,24 @@
 
-// See: https://forum.arduino.cc/index.php?topic=6549.0
+/*
+ * Measures how fast we can sample an analog input (A0) on an AVR board (e.g., Uno, Leonardo)
+ * and prints the results to Serial:
+ *
+ *  1. Calling analogRead() in a loop with the default ADC prescaler (128)
+ *  2. Calling analogRead() in a loop with the prescaler set to 16 ("FASTADC").
+ *     With this, we achieved a 44.7 kHz sampling frequency, but any other work in the
+ *     loop lowers the rate and makes it uneven.
+ *  3. Using FastAdcSampler.hpp (in this folder), which runs the ADC in free-running mode
+ *     and collects samples in a ring buffer with an interrupt. The rate is set by the ADC
+ *     clock alone, and we also report overruns (samples dropped because loop() didn't
+ *     empty the buffer in time)
+ *
+ * We also toggle pin 2 once per FastAdcSampler sample read, so you can check the
+ * rate with an oscilloscope.
+ *
+ * See: https://forum.arduino.cc/index.php?topic=6549.0
+ */
 
-#define FASTADC 1
+#include "FastAdcSampler.hpp"
 
 // defines for setting and clearing register bits
 #ifndef cbi
@@ -11,72 +28,78 @@
 #define sbi(sfr, bit) (_SFR_BYTE(sfr) |= _BV(bit))
 #endif
 
+const int LED_OUTPUT_PIN = 2;
+const int ANALOG_INPUT_PIN = A0;
+const int NUM_ANALOG_READS = 1000;
 
 boolean _ledVal = true;
-const int LED_OUTPUT_PIN = 2;
+
+// Returns how many analogRead() calls per second we can make
+float measureAnalogReadRate() {
+  unsigned long startTimestampUs = micros();
+  for (int i = 0; i < NUM_ANALOG_READS; i++) {
+    analogRead(ANALOG_INPUT_PIN);
+  }
+  unsigned long elapsedUs = micros() - startTimestampUs;
+  return NUM_ANALOG_READS * 1000000.0 / elapsedUs;
+}
+
+// Runs FastAdcSampler for one second with the given prescaler and prints the results
+void measureFastAdcSampler(uint8_t prescaler, const char* label) {
+  FastAdcSampler::begin(ANALOG_INPUT_PIN, prescaler);
+
+  unsigned long numRead = 0;
+  unsigned long startTimestampMs = millis();
+  while (millis() - startTimestampMs < 1000) {
+    uint16_t sample;
+    uint8_t pinIndex;
+    while (FastAdcSampler::read(sample, pinIndex)) {
+      numRead++;
+      digitalWrite(LED_OUTPUT_PIN, _ledVal);
+      _ledVal = !_ledVal;
+    }
+  }
+  unsigned long elapsedMs = millis() - startTimestampMs;
+  unsigned long sampleCount = FastAdcSampler::getSampleCount();
+  unsigned long overrunCount = FastAdcSampler::getOverrunCount();
+  FastAdcSampler::end();
+
+  Serial.print("FastAdcSampler, prescaler ");
+  Serial.print(label);
+  Serial.print(": expected ");
+  Serial.print(FastAdcSampler::getSampleRateHz());
+  Serial.print(" Hz, measured ");
+  Serial.print(sampleCount * 1000.0 / elapsedMs);
+  Serial.print(" Hz, read ");
+  Serial.print(numRead);
+  Serial.print(", overruns ");
+  Serial.println(overrunCount);
+}
 
 void setup() {
   pinMode(LED_OUTPUT_PIN, OUTPUT);
+  Serial.begin(115200);
+  while (!Serial); // wait for the Serial Monitor on the Leonardo
+
+  Serial.print("analogRead, prescaler 128: ");
+  Serial.print(measureAnalogReadRate());
+  Serial.println(" Hz");
+
+  // set prescale to 16
+  sbi(ADCSRA, ADPS2);
+  cbi(ADCSRA, ADPS1);
+  cbi(ADCSRA, ADPS0);
 
-  #if FASTADC
-   // set prescale to 16
-   sbi(ADCSRA,ADPS2) ;
-   cbi(ADCSRA,ADPS1) ;
-   cbi(ADCSRA,ADPS0) ;
-  #endif
+  Serial.print("analogRead, prescaler 16 (FASTADC): ");
+  Serial.print(measureAnalogReadRate());
+  Serial.println(" Hz");
 
-  // With FASTADC, achieved 44.7 KHz sampling frequency
-//  while(1){
-//    int analogVal = analogRead(A0);
-//    digitalWrite(LED_OUTPUT_PIN, 0);
-//    digitalWrite(LED_OUTPUT_PIN, 1);
-//  }
+  measureFastAdcSampler(FastAdcSampler::PRESCALER_128, "128");
+  measureFastAdcSampler(FastAdcSampler::PRESCALER_64, "64");
+  measureFastAdcSampler(FastAdcSampler::PRESCALER_32, "32");
+  measureFastAdcSampler(FastAdcSampler::PRESCALER_16, "16");
 }
 
 void loop() {
-  // put your main code here, to run repeatedly:
-//  int analogVal = analogRead(A0);
-  digitalWrite(LED_OUTPUT_PIN, _ledVal);
-  _ledVal = !_ledVal;
-  delay(10);
-//  while(1){
-//    int analogVal = analogRead(A0);
-//    digitalWrite(LED_OUTPUT_PIN, 0);
-//    digitalWrite(LED_OUTPUT_PIN, 1);
-//  }
+  // Nothing to do here; all of the measurements run once in setup()
 }
-
-
-
-//#define FASTADC 1
-//
-//// defines for setting and clearing register bits
-//#ifndef cbi
-//#define cbi(sfr, bit) (_SFR_BYTE(sfr) &= ~_BV(bit))
-//#endif
-//#ifndef sbi
-//#define sbi(sfr, bit) (_SFR_BYTE(sfr) |= _BV(bit))
-//#endif
-//
-//void setup() {
-// int start ;
-// int i ;
-// 
-//#if FASTADC
-// // set prescale to 16
-// sbi(ADCSRA,ADPS2) ;
-// cbi(ADCSRA,ADPS1) ;
-// cbi(ADCSRA,ADPS0) ;
-//#endif
-//
-// Serial.begin(9600) ;
-// Serial.print("ADCTEST: ") ;
-// start = millis() ;
-// for (i = 0 ; i < 1000 ; i++)
-//   analogRead(0) ;
-// Serial.print(millis() - start) ;
-// Serial.println(" msec (1000 calls)") ;
-//}
-//
-//void loop() {
-//}
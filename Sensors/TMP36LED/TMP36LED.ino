@@ -2,6 +2,11 @@
  * This example reads from a TMP36 sensor and changes the LED brightness accordingly
  * (brighter for higher temperatures)
  * 
+ * The TMP36 outputs 10 mV per degree C, so a single 10-bit analogRead (~4.9 mV per step)
+ * can only resolve about half a degree. We instead average 64 readings (see 
+ * OversampledAnalogIn.hpp in this folder), which gives 13-bit readings (~0.06 degrees
+ * per step) and averages out noise.
+ * 
  * By Jon Froehlich
  * http://makeabilitylab.io
  * 
@@ -11,11 +16,17 @@
  * 
  */
 
+#include "OversampledAnalogIn.hpp"
+
 const int LED_OUTPUT_PIN = 3;
 const int TMP36_INPUT_PIN = A0;
 
-// Set the min and max sensor values. The best way to figure out what to 
-// set these values is by experimentation with the sensor using
+// Oversampling by 4^3 = 64 readings adds 3 bits: 0 - 8184 rather than 0 - 1023
+const int OVERSAMPLING_BITS = 3;
+OversampledAnalogIn<OVERSAMPLING_BITS> _tmp36Input(TMP36_INPUT_PIN);
+
+// Set the min and max sensor values (as 10-bit analogRead values). The best way 
+// to figure out what to set these values is by experimentation with the sensor using
 // Serial Monitor or Serial Plotter. Also, consult a datasheet
 const int MIN_SENSOR_VAL = 0; 
 const int MAX_SENSOR_VAL = 500;
@@ -28,11 +39,11 @@ void setup() {
 
 void loop() {
 
-  // Read the variable resistor sensor value
-  int tmpSensorVal = analogRead(TMP36_INPUT_PIN);
+  // Read the sensor value (13 bits, takes ~7 ms)
+  int tmpSensorVal = _tmp36Input.read();
 
   // convert to voltage
-  float voltage = tmpSensorVal / 1023.0 * 5; // Uno runs on 5V
+  float voltage = tmpSensorVal / (float)_tmp36Input.getMaxValue() * 5; // Uno runs on 5V
 
   float temperatureC = (voltage - 0.5) * 100 ; // formula from adafruit
   float temperatureF = (temperatureC * 9.0 / 5.0) + 32.0;
@@ -47,7 +58,8 @@ void loop() {
   Serial.println(temperatureF);
 
   // Remap the value for output. 
-  int ledVal = map(tmpSensorVal, MIN_SENSOR_VAL, MAX_SENSOR_VAL, 0, 255);
+  int ledVal = map(tmpSensorVal, (long)MIN_SENSOR_VAL << OVERSAMPLING_BITS, 
+                   (long)MAX_SENSOR_VAL << OVERSAMPLING_BITS, 0, 255);
 
   // The map function does not constrain output outside of the provided range
   // so, we need to make sure that things are within range for the led
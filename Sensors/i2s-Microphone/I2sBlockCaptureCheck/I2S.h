@@ -0,0 +1,80 @@
+/**
+ * A stand-in for the SAMD I2S library. Rather than reading a microphone, it
+ * hands out whatever block the test queued with setNextBlock(), and the test
+ * calls receive() to run the onReceive() callback, like the I2S interrupt
+ * does when a block of data is ready. Only used by I2sBlockCaptureCheck.cpp.
+ *
+ * By Jon E. Froehlich
+ * @jonfroehlich
+ * http://makeabilitylab.io
+ *
+ */
+#ifndef HOST_I2S_H
+#define HOST_I2S_H
+
+#include <Arduino.h>
+
+#include <vector>
+
+typedef enum {
+  I2S_PHILIPS_MODE,
+  I2S_RIGHT_JUSTIFIED_MODE,
+  I2S_LEFT_JUSTIFIED_MODE
+} i2s_mode_t;
+
+class I2SClass{
+
+  private:
+    void (*_onReceive)(void);
+    std::vector<int32_t> _nextBlock;
+
+  public:
+    bool isStarted;
+    long sampleRate;
+
+    I2SClass() : _onReceive(NULL), isStarted(false), sampleRate(0) {}
+
+    int begin(int mode, long rate, int bitsPerSample) {
+      isStarted = mode == I2S_PHILIPS_MODE && bitsPerSample == 32;
+      sampleRate = rate;
+      return isStarted;
+    }
+
+    void end() {
+      isStarted = false;
+    }
+
+    void onReceive(void (*callback)(void)) {
+      _onReceive = callback;
+    }
+
+    int read() {
+      return 0;
+    }
+
+    // Copies as much of the queued block as fits and returns the bytes copied
+    int read(void* buffer, size_t size) {
+      size_t numBytes = _nextBlock.size() * sizeof(int32_t);
+      if (numBytes > size) {
+        numBytes = size - size % sizeof(int32_t);
+      }
+      memcpy(buffer, _nextBlock.data(), numBytes);
+      return numBytes;
+    }
+
+    // For the test: the slots the next read() returns
+    void setNextBlock(const std::vector<int32_t>& slots) {
+      _nextBlock = slots;
+    }
+
+    // For the test: runs the onReceive() callback, like the I2S interrupt
+    void receive() {
+      if (_onReceive != NULL) {
+        _onReceive();
+      }
+    }
+};
+
+extern I2SClass I2S;
+
+#endif
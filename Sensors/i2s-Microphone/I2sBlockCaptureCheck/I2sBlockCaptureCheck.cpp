@@ -0,0 +1,246 @@
+/**
+ * Checks I2sBlockCapture.hpp on a desktop computer (Linux or Mac) by feeding
+ * it synthetic blocks of PCM data, packed like the SPH0645's: 18-bit samples
+ * in the top of 32-bit slots, every other slot the unused channel (0 or -1).
+ * The I2S.h stand-in in this folder hands out the blocks and runs the receive
+ * callback like the I2S interrupt does. It runs:
+ *
+ *  - Sine: sine waves at several levels on top of a -6500 DC offset, at
+ *    1953.125 Hz, so each block of 64 samples is exactly 4 periods (over a
+ *    part of a period, RMS depends on where the block starts, by up to a
+ *    few percent for blocks this short). After the DC offset settles, peak and RMS must be within 1% of the
+ *    wave's and RMS dBFS within 0.2 dB of 20 * log10(amplitude / sqrt(2) /
+ *    131072). Every block must have exactly half its slots as samples
+ *  - FullScale: a full-scale square wave with no offset reads 0 dBFS peak
+ *    and RMS
+ *  - Silence: a steady DC offset reads peak 0 and MIN_DBFS; blocks that are
+ *    all 0 or -1 slots (and empty blocks) return false from update() and
+ *    leave the last measurements alone
+ *  - Partial: a block shorter than the buffer comes back from getBlock()
+ *    with its own length, and a longer one is cut at the buffer size
+ *  - Handoff: the interrupt fills the two buffers in turn while loop()
+ *    releases each block; a block that arrives while loop() still has the
+ *    last one is dropped and counted, and doesn't touch loop()'s buffer
+ *
+ * The header is included straight from VUMeterInterrupt (the other copies
+ * are identical), so the results are for the exact code that runs on the
+ * board. It prints PASS or FAIL for each check and exits with 1 if any
+ * failed.
+ *
+ * To build and run (from this folder):
+ *  g++ -std=c++11 -O2 -I. I2sBlockCaptureCheck.cpp -o I2sBlockCaptureCheck
+ *  ./I2sBlockCaptureCheck
+ *
+ * By Jon E. Froehlich
+ * @jonfroehlich
+ * http://makeabilitylab.io
+ *
+ */
+#include <Arduino.h>  // the host stand-in in this folder (needs -I.)
+
+#include "../VUMeterInterrupt/I2sBlockCapture.hpp"
+
+#include <cstdio>
+#include <vector>
+
+I2SClass I2S;
+
+const long SAMPLE_RATE = 31250;
+const int32_t DC_OFFSET = -6500;
+const uint16_t BLOCK_SLOTS = I2sBlockCapture::MAX_BLOCK_SLOTS;
+const int PERIOD_SAMPLES = 16;  // the sine wave's period, 1953.125 Hz at 31250 Hz
+
+int _numFailures = 0;
+
+void check(bool passed, const char* name) {
+  printf("%-9s %s\n", name, passed ? "PASS" : "FAIL");
+  if (!passed) {
+    _numFailures++;
+  }
+}
+
+// Packs an 18-bit sample into the top of a 32-bit slot, like the SPH0645
+int32_t toSlot(int32_t sample) {
+  return (int32_t)((uint32_t)sample << AudioBlockLevel::SAMPLE_SHIFT);
+}
+
+// A block of numSlots slots: samples from sampleAt(n) in the even slots and
+// the unused channel (alternating 0 and -1) in the odd ones. n counts on
+// from firstSample, so consecutive blocks continue the same wave
+template<typename SampleAt>
+std::vector<int32_t> makeBlock(uint16_t numSlots, long firstSample, SampleAt sampleAt) {
+  std::vector<int32_t> slots(numSlots);
+  for (uint16_t i = 0; i < numSlots; i++) {
+    slots[i] = i % 2 == 0 ? toSlot(sampleAt(firstSample + i / 2)) : (i % 4 == 1 ? 0 : -1);
+  }
+  return slots;
+}
+
+// Runs the "interrupt" with slots as the next block, then does what loop()
+// does with it. Returns the result of update(), or false if no block came
+bool receiveAndMeasure(const std::vector<int32_t>& slots, AudioBlockLevel& level) {
+  I2S.setNextBlock(slots);
+  I2S.receive();
+  uint16_t numSlots;
+  const int32_t* block = I2sBlockCapture::getBlock(numSlots);
+  if (block == NULL) {
+    return false;
+  }
+  bool isUpdated = level.update(block, numSlots);
+  I2sBlockCapture::releaseBlock();
+  return isUpdated;
+}
+
+void checkSine() {
+  const double amplitudes[] = { 100, 1000, 10000, 100000 };
+  const int numBlocks = 400;
+  bool passed = I2sBlockCapture::begin(SAMPLE_RATE) && I2S.isStarted;
+  for (double amplitude : amplitudes) {
+    AudioBlockLevel level;
+    auto sampleAt = [&](long n){
+      return DC_OFFSET + (int32_t)lround(amplitude * sin(2 * M_PI * n / PERIOD_SAMPLES));
+    };
+
+    double maxPeakError = 0, maxRmsError = 0, maxDbfsError = 0;
+    for (int i = 0; i < numBlocks; i++) {
+      bool isUpdated = receiveAndMeasure(makeBlock(BLOCK_SLOTS, (long)i * BLOCK_SLOTS / 2, sampleAt), level);
+      passed = passed && isUpdated && level.getNumSamples() == BLOCK_SLOTS / 2;
+      if (i >= numBlocks / 2) {
+        double rms = amplitude / sqrt(2);
+        maxPeakError = std::max(maxPeakError, fabs(level.getPeak() - amplitude) / amplitude);
+        maxRmsError = std::max(maxRmsError, fabs(level.getRms() - rms) / rms);
+        maxDbfsError = std::max(maxDbfsError, fabs(level.getRmsDbfs() - 20 * log10(rms / AudioBlockLevel::FULL_SCALE)));
+      }
+    }
+    printf("Sine      amplitude %6.0f: peak %7.3f%%, RMS %7.3f%%, RMS dBFS %6.3f dB off, DC offset %.1f\n",
+           amplitude, 100 * maxPeakError, 100 * maxRmsError, maxDbfsError, level.getDcOffset());
+    passed = passed && maxPeakError <= 0.01 && maxRmsError <= 0.01 && maxDbfsError <= 0.2 &&
+             fabs(level.getDcOffset() - DC_OFFSET) < 2;
+  }
+  I2sBlockCapture::end();
+  check(passed && !I2S.isStarted && I2sBlockCapture::getDroppedBlockCount() == 0, "Sine");
+}
+
+void checkFullScale() {
+  I2sBlockCapture::begin(SAMPLE_RATE);
+  AudioBlockLevel level;
+  auto sampleAt = [](long n){
+    return n % 8 < 4 ? AudioBlockLevel::FULL_SCALE - 1 : -(AudioBlockLevel::FULL_SCALE - 1);
+  };
+  bool passed = true;
+  for (int i = 0; i < 20; i++) {
+    passed = passed && receiveAndMeasure(makeBlock(BLOCK_SLOTS, (long)i * BLOCK_SLOTS / 2, sampleAt), level);
+  }
+  printf("FullScale peak %.4f dBFS, RMS %.4f dBFS\n", level.getPeakDbfs(), level.getRmsDbfs());
+  passed = passed && fabs(level.getPeakDbfs()) < 0.01 && fabs(level.getRmsDbfs()) < 0.01;
+  check(passed, "FullScale");
+}
+
+void checkSilence() {
+  I2sBlockCapture::begin(SAMPLE_RATE);
+  AudioBlockLevel level;
+  auto steady = [](long /* n */){ return DC_OFFSET; };
+  bool passed = receiveAndMeasure(makeBlock(BLOCK_SLOTS, 0, steady), level) &&
+                level.getPeak() == 0 && level.getRms() == 0 &&
+                level.getPeakDbfs() == AudioBlockLevel::MIN_DBFS &&
+                level.getRmsDbfs() == AudioBlockLevel::MIN_DBFS;
+
+  // A block with a sound, then blocks with no samples at all
+  auto loud = [](long n){ return DC_OFFSET + (n % 2 == 0 ? 500 : -500); };
+  passed = passed && receiveAndMeasure(makeBlock(BLOCK_SLOTS, 0, loud), level) && level.getPeak() == 500;
+  passed = passed && !receiveAndMeasure(std::vector<int32_t>(BLOCK_SLOTS, 0), level) &&
+           !receiveAndMeasure(std::vector<int32_t>(BLOCK_SLOTS, -1), level) &&
+           !receiveAndMeasure(std::vector<int32_t>(), level) &&
+           level.getPeak() == 500 && level.getNumSamples() == BLOCK_SLOTS / 2;
+
+  // A fresh meter doesn't start its DC offset from a block with no samples
+  AudioBlockLevel fresh;
+  passed = passed && !receiveAndMeasure(std::vector<int32_t>(BLOCK_SLOTS, 0), fresh) &&
+           receiveAndMeasure(makeBlock(BLOCK_SLOTS, 0, steady), fresh) && fresh.getDcOffset() == DC_OFFSET &&
+           I2sBlockCapture::getDroppedBlockCount() == 0;
+  check(passed, "Silence");
+}
+
+void checkPartial() {
+  I2sBlockCapture::begin(SAMPLE_RATE);
+  auto ramp = [](long n){ return (int32_t)n + 1; };
+  uint16_t numSlots = 0;
+
+  I2S.setNextBlock(makeBlock(10, 0, ramp));
+  I2S.receive();
+  const int32_t* block = I2sBlockCapture::getBlock(numSlots);
+  bool passed = block != NULL && numSlots == 10 && block[8] == toSlot(5);
+  I2sBlockCapture::releaseBlock();
+
+  I2S.setNextBlock(makeBlock(BLOCK_SLOTS + 40, 0, ramp));
+  I2S.receive();
+  block = I2sBlockCapture::getBlock(numSlots);
+  passed = passed && block != NULL && numSlots == BLOCK_SLOTS &&
+           block[BLOCK_SLOTS - 2] == toSlot(BLOCK_SLOTS / 2);
+  I2sBlockCapture::releaseBlock();
+  check(passed, "Partial");
+}
+
+void checkHandoff() {
+  bool passed = I2sBlockCapture::begin(SAMPLE_RATE);
+  uint16_t numSlots = 99;
+  passed = passed && !I2sBlockCapture::available() && I2sBlockCapture::getBlock(numSlots) == NULL &&
+           numSlots == 0 && I2sBlockCapture::getBlockCount() == 0;
+
+  // Each block is filled with its own number, so we can tell them apart
+  auto blockOf = [](int32_t value){ return std::vector<int32_t>(8, toSlot(value)); };
+  std::vector<const int32_t*> buffers;
+  for (int32_t i = 1; i <= 6; i++) {
+    I2S.setNextBlock(blockOf(i));
+    I2S.receive();
+    const int32_t* block = I2sBlockCapture::getBlock(numSlots);
+    passed = passed && I2sBlockCapture::available() && block != NULL && numSlots == 8 && block[7] == toSlot(i);
+    buffers.push_back(block);
+    I2sBlockCapture::releaseBlock();
+  }
+  for (size_t i = 2; i < buffers.size(); i++) {
+    passed = passed && buffers[i] == buffers[i - 2] && buffers[i] != buffers[i - 1];
+  }
+
+  // loop() holds block 7 while blocks 8 and 9 arrive: both are dropped
+  I2S.setNextBlock(blockOf(7));
+  I2S.receive();
+  const int32_t* held = I2sBlockCapture::getBlock(numSlots);
+  for (int32_t i = 8; i <= 9; i++) {
+    I2S.setNextBlock(blockOf(i));
+    I2S.receive();
+  }
+  const int32_t* stillHeld = I2sBlockCapture::getBlock(numSlots);
+  passed = passed && held == stillHeld && held[0] == toSlot(7) && held[7] == toSlot(7) &&
+           I2sBlockCapture::getBlockCount() == 9 && I2sBlockCapture::getDroppedBlockCount() == 2;
+  I2sBlockCapture::releaseBlock();
+
+  // The next block goes in the other buffer and isn't dropped
+  I2S.setNextBlock(blockOf(10));
+  I2S.receive();
+  const int32_t* next = I2sBlockCapture::getBlock(numSlots);
+  passed = passed && next != NULL && next != held && next[0] == toSlot(10) &&
+           I2sBlockCapture::getBlockCount() == 10 && I2sBlockCapture::getDroppedBlockCount() == 2;
+  I2sBlockCapture::releaseBlock();
+  passed = passed && !I2sBlockCapture::available();
+
+  // begin() starts the counts over
+  I2sBlockCapture::begin(SAMPLE_RATE);
+  passed = passed && I2sBlockCapture::getBlockCount() == 0 && I2sBlockCapture::getDroppedBlockCount() == 0;
+  check(passed, "Handoff");
+}
+
+int main() {
+  checkSine();
+  checkFullScale();
+  checkSilence();
+  checkPartial();
+  checkHandoff();
+
+  if (_numFailures > 0) {
+    printf("%d checks FAILED\n", _numFailures);
+    return 1;
+  }
+  printf("All checks passed\n");
+  return 0;
+}
@@ -0,0 +1,332 @@
+/**
+ * An integer-only FFT (Fast Fourier Transform) for splitting sound into
+ * frequency bands, e.g., to drive a spectrum analyzer on a NeoPixel strip.
+ * It uses 16-bit fixed-point math (no floats), so it's fast on boards
+ * without a floating point unit like the Arduino Uno and Adafruit Feather M0.
+ *
+ * FixedFft<N> transforms N samples at a time, where N is a power of 2 from
+ * 64 to 512. Each sample takes 4 bytes of RAM (real and imaginary parts), so
+ * on an Uno (2 KB of RAM), stick to 64 or 128. Estimated times per
+ * transform (not measured on a board; time compute() with micros() to
+ * see yours):
+ *
+ *   Arduino Uno (16 MHz AVR), N = 64:       ~4 ms (estimate)
+ *   Feather M0 (48 MHz Cortex-M0+), N = 256: ~2 ms (estimate)
+ *
+ * compute() does the whole pipeline: it removes the DC offset (e.g., the
+ * ~512 a mic reads at rest), scales the samples up to use all 16 bits, applies
+ * a Hann window (to reduce leakage between bins), and runs an in-place
+ * radix-2 FFT. Bin k is the frequency k * sampleRate / N, up to N / 2.
+ *
+ * SpectrumBands<NumBands> groups the bins into log-spaced bands (each band
+ * covers the same number of octaves), which matches how we hear pitch much
+ * better than equal-width bins do.
+ *
+ * Usage:
+ *  FixedFft<128> _fft;
+ *  SpectrumBands<8> _bands(128, SAMPLE_RATE_HZ, 100, 4000); // 8 bands, 100 Hz - 4 kHz
+ *
+ *  loop(){
+ *    for(int i = 0; i < 128; i++){
+ *      _fft.setSample(i, analogRead(A0)); // at SAMPLE_RATE_HZ
+ *    }
+ *    _fft.compute();
+ *    _bands.update(_fft);
+ *    int bassLevel = _bands.getLevel(0);   // in the same units as the samples
+ *  }
+ *
+ * See: https://en.wikipedia.org/wiki/Cooley%E2%80%93Tukey_FFT_algorithm
+ *
+ * By Jon E. Froehlich
+ * @jonfroehlich
+ * http://makeabilitylab.io
+ *
+ */
+#ifndef FIXED_FFT_HPP
+#define FIXED_FFT_HPP
+
+#include <Arduino.h>
+
+// sin(2 * pi * i / 512) for i = 0 - 128 (a quarter wave) scaled so 32767 = 1.0
+const int16_t FIXED_FFT_SINE_TABLE[129] PROGMEM = {
+  0, 402, 804, 1206, 1608, 2009, 2410, 2811, 3212, 3612, 4011, 4410,
+  4808, 5205, 5602, 5998, 6393, 6786, 7179, 7571, 7962, 8351, 8739, 9126,
+  9512, 9896, 10278, 10659, 11039, 11417, 11793, 12167, 12539, 12910, 13279, 13645,
+  14010, 14372, 14732, 15090, 15446, 15800, 16151, 16499, 16846, 17189, 17530, 17869,
+  18204, 18537, 18868, 19195, 19519, 19841, 20159, 20475, 20787, 21096, 21403, 21705,
+  22005, 22301, 22594, 22884, 23170, 23452, 23731, 24007, 24279, 24547, 24811, 25072,
+  25329, 25582, 25832, 26077, 26319, 26556, 26790, 27019, 27245, 27466, 27683, 27896,
+  28105, 28310, 28510, 28706, 28898, 29085, 29268, 29447, 29621, 29791, 29956, 30117,
+  30273, 30424, 30571, 30714, 30852, 30985, 31113, 31237, 31356, 31470, 31580, 31685,
+  31785, 31880, 31971, 32057, 32137, 32213, 32285, 32351, 32412, 32469, 32521, 32567,
+  32609, 32646, 32678, 32705, 32728, 32745, 32757, 32765, 32767
+};
+
+template<uint16_t N>
+class FixedFft{
+
+  static_assert(N >= 64 && N <= 512 && (N & (N - 1)) == 0,
+                "N must be a power of 2 between 64 and 512");
+
+  private:
+    static const uint16_t TABLE_SIZE = 512;         // the full circle in FIXED_FFT_SINE_TABLE units
+    static const uint16_t TABLE_STRIDE = TABLE_SIZE / N;
+    static const int16_t MAX_SCALED_SAMPLE = 16383; // headroom so the butterflies can't overflow
+
+    int16_t _real[N];
+    int16_t _imag[N];
+    uint8_t _scaleShift;  // how many bits compute() scaled the samples up by
+
+    // Returns sin(2 * pi * phase / 512) scaled so 32767 = 1.0
+    static int16_t sine(uint16_t phase) {
+      phase &= TABLE_SIZE - 1;
+      uint16_t quarter = TABLE_SIZE / 4;
+      if (phase < quarter) {
+        return pgm_read_word(&FIXED_FFT_SINE_TABLE[phase]);
+      } else if (phase < 2 * quarter) {
+        return pgm_read_word(&FIXED_FFT_SINE_TABLE[2 * quarter - phase]);
+      } else if (phase < 3 * quarter) {
+        return -(int16_t)pgm_read_word(&FIXED_FFT_SINE_TABLE[phase - 2 * quarter]);
+      }
+      return -(int16_t)pgm_read_word(&FIXED_FFT_SINE_TABLE[TABLE_SIZE - phase]);
+    }
+
+    static int16_t cosine(uint16_t phase) {
+      return sine(phase + TABLE_SIZE / 4);
+    }
+
+    // Multiplies two values where 32767 = 1.0, rounding to nearest
+    static int16_t multiply(int16_t a, int16_t b) {
+      return ((int32_t)a * b + 16384) >> 15;
+    }
+
+    static uint16_t squareRoot(uint32_t value) {
+      uint32_t root = 0;
+      uint32_t bit = 1UL << 30;
+      while (bit > value) {
+        bit >>= 2;
+      }
+      while (bit != 0) {
+        if (value >= root + bit) {
+          value -= root + bit;
+          root = (root >> 1) + bit;
+        } else {
+          root >>= 1;
+        }
+        bit >>= 2;
+      }
+      return root;
+    }
+
+    void removeDcAndScale() {
+      int32_t sum = 0;
+      for (uint16_t i = 0; i < N; i++) {
+        sum += _real[i];
+      }
+      int16_t mean = sum / (int32_t)N;
+
+      int16_t maxMagnitude = 0;
+      for (uint16_t i = 0; i < N; i++) {
+        int32_t sample = (int32_t)_real[i] - mean;
+        if (sample > MAX_SCALED_SAMPLE) {
+          sample = MAX_SCALED_SAMPLE;
+        } else if (sample < -MAX_SCALED_SAMPLE) {
+          sample = -MAX_SCALED_SAMPLE;
+        }
+        _real[i] = sample;
+        if (sample < 0) {
+          sample = -sample;
+        }
+        if (sample > maxMagnitude) {
+          maxMagnitude = sample;
+        }
+      }
+
+      // Scale up quiet sounds so the FFT's rounding doesn't swamp them
+      // (block floating point). getMagnitude() undoes this
+      _scaleShift = 0;
+      while (maxMagnitude > 0 && (maxMagnitude << 1) <= MAX_SCALED_SAMPLE) {
+        maxMagnitude <<= 1;
+        _scaleShift++;
+      }
+    }
+
+    void applyHannWindow() {
+      for (uint16_t i = 0; i < N; i++) {
+        int16_t window = (32768L - cosine(i * TABLE_STRIDE)) >> 1;
+        _real[i] = multiply(_real[i] << _scaleShift, window);
+        _imag[i] = 0;
+      }
+    }
+
+    void reverseBitOrder() {
+      uint16_t j = 0;
+      for (uint16_t i = 0; i < N - 1; i++) {
+        if (i < j) {
+          int16_t temp = _real[i];
+          _real[i] = _real[j];
+          _real[j] = temp;
+        }
+        uint16_t bit = N >> 1;
+        while (j & bit) {
+          j ^= bit;
+          bit >>= 1;
+        }
+        j |= bit;
+      }
+    }
+
+    // Radix-2 decimation in time. Each stage halves the values so
+    // they can't overflow, so the result is the DFT divided by N
+    void transform() {
+      for (uint16_t size = 2; size <= N; size <<= 1) {
+        uint16_t halfSize = size >> 1;
+        uint16_t phaseStep = TABLE_SIZE / size;
+        for (uint16_t k = 0; k < halfSize; k++) {
+          int16_t twiddleReal = cosine(k * phaseStep);
+          int16_t twiddleImag = -sine(k * phaseStep);
+          for (uint16_t i = k; i < N; i += size) {
+            uint16_t j = i + halfSize;
+            int16_t tempReal = ((int32_t)twiddleReal * _real[j] - (int32_t)twiddleImag * _imag[j] + 16384) >> 15;
+            int16_t tempImag = ((int32_t)twiddleReal * _imag[j] + (int32_t)twiddleImag * _real[j] + 16384) >> 15;
+            _real[j] = ((int32_t)_real[i] - tempReal) >> 1;
+            _imag[j] = ((int32_t)_imag[i] - tempImag) >> 1;
+            _real[i] = ((int32_t)_real[i] + tempReal) >> 1;
+            _imag[i] = ((int32_t)_imag[i] + tempImag) >> 1;
+          }
+        }
+      }
+    }
+
+  public:
+    FixedFft() : _scaleShift(0) {
+      memset(_real, 0, sizeof(_real));
+      memset(_imag, 0, sizeof(_imag));
+    }
+
+    /**
+     * Sets sample i (0 to N - 1), e.g., a raw analogRead() value. The samples
+     * can have any offset; compute() removes it
+     */
+    void setSample(uint16_t i, int16_t sample) {
+      _real[i] = sample;
+    }
+
+    /**
+     * Runs the FFT on the N samples. This overwrites them, so set all N
+     * again before calling compute() again
+     */
+    void compute() {
+      removeDcAndScale();
+      applyHannWindow();
+      reverseBitOrder();
+      transform();
+    }
+
+    /**
+     * Returns the amplitude of bin (0 to N / 2) in the same units as the
+     * samples. A sine wave with amplitude A centered on this bin reads ~A
+     * (it also spreads a little into the bins on either side)
+     */
+    uint16_t getMagnitude(uint16_t bin) const {
+      return getMaxMagnitude(bin, bin + 1);
+    }
+
+    /**
+     * Returns the largest amplitude in bins firstBin to endBin - 1
+     */
+    uint16_t getMaxMagnitude(uint16_t firstBin, uint16_t endBin) const {
+      uint32_t maxPower = 0;
+      for (uint16_t bin = firstBin; bin < endBin && bin <= N / 2; bin++) {
+        uint32_t power = (int32_t)_real[bin] * _real[bin] + (int32_t)_imag[bin] * _imag[bin];
+        if (power > maxPower) {
+          maxPower = power;
+        }
+      }
+
+      // The window halves the amplitude, and a real sine is split evenly
+      // between its positive and negative frequency, so multiply by 4
+      uint32_t magnitude = ((uint32_t)squareRoot(maxPower) << 2) + ((1UL << _scaleShift) >> 1);
+      magnitude >>= _scaleShift;
+      return magnitude > 65535 ? 65535 : magnitude;
+    }
+
+    /**
+     * Returns the center frequency of bin in Hz
+     */
+    static float getBinFrequencyHz(uint16_t bin, float sampleRateHz) {
+      return bin * sampleRateHz / N;
+    }
+
+    /**
+     * Returns the number of samples per transform
+     */
+    static uint16_t getSize() {
+      return N;
+    }
+};
+
+template<uint8_t NumBands>
+class SpectrumBands{
+
+  private:
+    uint16_t _firstBins[NumBands + 1];  // band b is bins _firstBins[b] to _firstBins[b + 1] - 1
+    uint16_t _levels[NumBands];
+
+  public:
+    /**
+     * Splits fftSize-point FFT bins into NumBands log-spaced bands from
+     * minFreqHz to maxFreqHz (at most sampleRateHz / 2). Every band gets at
+     * least one bin, so with small FFTs the lowest bands may be wider
+     */
+    SpectrumBands(uint16_t fftSize, float sampleRateHz, float minFreqHz, float maxFreqHz) {
+      uint16_t maxBin = fftSize / 2;
+      float freqRatio = maxFreqHz / minFreqHz;
+      for (uint8_t b = 0; b <= NumBands; b++) {
+        float edgeFreqHz = minFreqHz * pow(freqRatio, b / (float)NumBands);
+        long bin = lround(edgeFreqHz * fftSize / sampleRateHz);
+        bin = constrain(bin, 1, maxBin + 1);
+        if (b > 0 && bin <= _firstBins[b - 1]) {
+          bin = _firstBins[b - 1] + 1;
+        }
+        _firstBins[b] = bin;
+        if (b < NumBands) {
+          _levels[b] = 0;
+        }
+      }
+    }
+
+    /**
+     * Updates the band levels from an FFT after compute(). Each band's level
+     * is the amplitude of its loudest bin
+     */
+    template<uint16_t N>
+    void update(const FixedFft<N>& fft) {
+      for (uint8_t b = 0; b < NumBands; b++) {
+        _levels[b] = fft.getMaxMagnitude(_firstBins[b], _firstBins[b + 1]);
+      }
+    }
+
+    /**
+     * Returns the level of band (0 = lowest frequencies) in the same units as the samples
+     */
+    uint16_t getLevel(uint8_t band) const {
+      return _levels[band];
+    }
+
+    /**
+     * Returns the first FFT bin in band
+     */
+    uint16_t getFirstBin(uint8_t band) const {
+      return _firstBins[band];
+    }
+
+    /**
+     * Returns the number of bands
+     */
+    static uint8_t getNumBands() {
+      return NumBands;
+    }
+};
+
+#endif
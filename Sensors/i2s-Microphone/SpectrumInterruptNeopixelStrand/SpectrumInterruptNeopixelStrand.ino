@@ -0,0 +1,128 @@
+/**
+ * Outputs the frequency spectrum of an I2S microphone on a NeoPixel strand:
+ * the strand is split into bands from bass (red, first pixels) to treble
+ * (purple, last pixels), and each band's brightness shows how loud that range
+ * of frequencies is. This is the I2S version of
+ * Sensors/Microphone/SoundSpectrumNeopixelStrand.
+ *
+ * I2sBlockCapture.hpp (in this folder) collects the mic samples in the
+ * background, and we gather FFT_SIZE of them for each FFT (FixedFft.hpp, also
+ * in this folder). The interrupt keeps filling the other buffer while we run
+ * the FFT and update the strand, so all of that has to finish within one block
+ * (64 frames, ~4 ms at 15625 Hz) or blocks get dropped. We estimate the
+ * 256-point FFT at ~2 ms and show() at ~1 ms for 30 NeoPixels, which should
+ * fit, but those aren't measured, so we print any dropped blocks to check.
+ *
+ * Note: To use an i2s peripheral like an i2s microphone, you must use a microcontroller
+ * that has hardware I2S peripheral support such as the Cortex M-series chips like the Arduino Zero, Feather M0, 
+ * or single-board computers like the Raspberry Pi. This code is written for an
+ * Adafruit Feather M0 Express: https://www.adafruit.com/product/3403
+ * with the Adafruit i2s MEMs Microphone Breakout for the SPH0645LM4H
+ * https://www.adafruit.com/product/3421  
+ *
+ * By Jon E. Froehlich
+ * @jonfroehlich
+ * http://makeabilitylab.io
+ *
+ */
+
+#include <Adafruit_NeoPixel.h>    // https://github.com/adafruit/Adafruit_NeoPixel
+#include "I2sBlockCapture.hpp"
+#include "FixedFft.hpp"
+
+const int NUM_NEOPIXELS = 30;       // Change this to match your strand length
+const int NEOPIXEL_PIN_OUTPUT = 6;  // Change this to match your output pin
+
+const unsigned long MAX_HUE_VALUE = 65535;  // Hue is a 16-bit number
+const unsigned int MAX_BRIGHTNESS_VALUE = 255;
+const unsigned int MAX_SATURATION_VALUE = 255;
+
+Adafruit_NeoPixel _neopixelStrip = Adafruit_NeoPixel(NUM_NEOPIXELS, NEOPIXEL_PIN_OUTPUT,
+                                                     NEO_GRB + NEO_KHZ800);
+
+// Sound spectrum stuff
+const long SAMPLE_RATE = 15625;     // 48,000,000 / sampleRate must be a multiple of 64
+const uint16_t FFT_SIZE = 256;
+
+const uint8_t NUM_BANDS = 10;
+const float MIN_BAND_FREQ_HZ = 80;
+const float MAX_BAND_FREQ_HZ = 6000;
+
+// The FFT takes 16-bit samples, so we drop the 2 lowest of the mic's 18 bits
+// (the mic's noise is larger than that anyway)
+const uint8_t SLOT_TO_FFT_SAMPLE_SHIFT = 16;
+
+// Band levels are amplitudes in 16-bit sample units. We map them on a log
+// scale (like our ears) from MIN_LEVEL_DB (1 unit = 0 dB) to MAX_LEVEL_DB
+const float MIN_LEVEL_DB = 12;
+const float MAX_LEVEL_DB = 66;
+
+// Each FFT, a band's brightness drops by at most this much, so short
+// sounds fade out rather than flicker
+const int BRIGHTNESS_FADE_STEP = 20;
+
+FixedFft<FFT_SIZE> _fft;
+SpectrumBands<NUM_BANDS> _bands(FFT_SIZE, SAMPLE_RATE, MIN_BAND_FREQ_HZ, MAX_BAND_FREQ_HZ);
+int _bandBrightness[NUM_BANDS];
+uint16_t _numFftSamples = 0;
+unsigned long _lastDroppedBlockCount = 0;
+
+void setup() {
+  Serial.begin(115200);
+
+  _neopixelStrip.begin();            // Initialize NeoPixel strip object (REQUIRED)
+  _neopixelStrip.setBrightness(50);  // Set brightness to about 1/5 (max = 255)
+  _neopixelStrip.show();             // Turn OFF all pixels ASAP
+
+  if (!I2sBlockCapture::begin(SAMPLE_RATE)) { Serial.println("Failed to initialize I2S!"); while (1); } // do nothing
+}
+
+void loop() {
+  uint16_t numSlots;
+  const int32_t* block = I2sBlockCapture::getBlock(numSlots);
+  if (block == NULL) {
+    return;
+  }
+
+  // Copy the valid samples into the FFT (skipping the 0 or -1 slots of the unused channel)
+  for (uint16_t i = 0; i < numSlots && _numFftSamples < FFT_SIZE; i++) {
+    if (block[i] != 0 && block[i] != -1) {
+      _fft.setSample(_numFftSamples++, block[i] >> SLOT_TO_FFT_SAMPLE_SHIFT);
+    }
+  }
+  I2sBlockCapture::releaseBlock();    // Release right away so the interrupt can fill this buffer again
+
+  if (_numFftSamples < FFT_SIZE) {
+    return;
+  }
+  _numFftSamples = 0;
+
+  _fft.compute();
+  _bands.update(_fft);
+
+  for (uint8_t band = 0; band < NUM_BANDS; band++) {
+    uint16_t level = _bands.getLevel(band);
+    float levelDb = level > 0 ? 20 * log10(level) : 0;
+    int brightness = map(levelDb * 10, MIN_LEVEL_DB * 10, MAX_LEVEL_DB * 10, 0, MAX_BRIGHTNESS_VALUE);
+    brightness = constrain(brightness, 0, MAX_BRIGHTNESS_VALUE);
+
+    // Jump up to louder levels right away but fade down slowly
+    _bandBrightness[band] = max(brightness, _bandBrightness[band] - BRIGHTNESS_FADE_STEP);
+  }
+
+  for (int pxl = 0; pxl < NUM_NEOPIXELS; pxl++) {
+    const uint8_t band = (long)pxl * NUM_BANDS / NUM_NEOPIXELS;
+    const uint16_t hueVal = map(band, 0, NUM_BANDS, 0, MAX_HUE_VALUE * .8);
+    uint32_t rgbColor = _neopixelStrip.ColorHSV(hueVal, MAX_SATURATION_VALUE, _bandBrightness[band]);
+    _neopixelStrip.setPixelColor(pxl, rgbColor);
+  }
+  _neopixelStrip.show();
+
+  unsigned long droppedBlockCount = I2sBlockCapture::getDroppedBlockCount();
+  if (droppedBlockCount != _lastDroppedBlockCount) { // The FFT and show() took longer than a block
+    Serial.print("OVERFLOW: dropped ");
+    Serial.print(droppedBlockCount - _lastDroppedBlockCount);
+    Serial.println(" blocks");
+    _lastDroppedBlockCount = droppedBlockCount;
+  }
+}
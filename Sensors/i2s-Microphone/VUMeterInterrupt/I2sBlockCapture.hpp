@@ -0,0 +1,336 @@
+/**
+ * Captures audio from an I2S microphone like the Adafruit SPH0645LM4H breakout
+ * in blocks, and measures the sound level of each block.
+ *
+ * I2sBlockCapture reads the I2S data in the receive interrupt, ping-ponging
+ * between two buffers: while loop() works on one full block, the interrupt
+ * fills the other. The interrupt only copies data; all of the processing
+ * (and Serial printing) happens in loop(), so the interrupt stays short. If
+ * loop() hasn't released its block by the time the next one is full, the new
+ * block is dropped and counted (see getDroppedBlockCount()).
+ *
+ * AudioBlockLevel computes the peak, RMS, and dBFS of a block over every valid
+ * sample in it. The SPH0645 sends 18-bit signed samples in 32-bit slots, and
+ * the slots for the unused channel read as 0 or -1, so those are skipped. The
+ * mic also has a large DC offset (around -6500), so AudioBlockLevel tracks it
+ * over several blocks and subtracts it: peak and RMS measure just the sound.
+ *
+ * dBFS is relative to the largest 18-bit value (131072): 0 dBFS is as loud as
+ * the mic can report and quieter sounds are negative. A full-scale sine wave
+ * reads 0 dBFS peak and -3 dBFS RMS.
+ *
+ * Notes:
+ *  - This uses the I2S library for SAMD boards (e.g., Arduino Zero, Feather M0)
+ *  - This file defines static members, so include it only once
+ *  - Set I2S_CAPTURE_BUFFER_BYTES before including this file to change the
+ *    buffer size (default 512). Each block is as big as whatever the I2S
+ *    library has ready, up to that size.
+ *
+ * Usage:
+ *  #include "I2sBlockCapture.hpp"
+ *
+ *  AudioBlockLevel _level;
+ *
+ *  setup(){
+ *    I2sBlockCapture::begin(31250);
+ *  }
+ *
+ *  loop(){
+ *    uint16_t numSlots;
+ *    const int32_t* block = I2sBlockCapture::getBlock(numSlots);
+ *    if(block != NULL){
+ *      _level.update(block, numSlots);
+ *      I2sBlockCapture::releaseBlock();
+ *      // use _level.getPeak(), _level.getRmsDbfs(), etc.
+ *    }
+ *  }
+ *
+ * By Jon E. Froehlich
+ * @jonfroehlich
+ * http://makeabilitylab.io
+ *
+ */
+#ifndef I2S_BLOCK_CAPTURE_HPP
+#define I2S_BLOCK_CAPTURE_HPP
+
+#include <Arduino.h>
+#include <I2S.h>
+
+#ifndef I2S_CAPTURE_BUFFER_BYTES
+#define I2S_CAPTURE_BUFFER_BYTES 512
+#endif
+
+class AudioBlockLevel{
+
+  public:
+    static const int32_t FULL_SCALE = 131072;  // 2^17, the largest 18-bit signed value
+    static const uint8_t SAMPLE_SHIFT = 14;    // 32-bit slot -> 18-bit sample
+    static constexpr float MIN_DBFS = -120.0;  // what silence (0) reads as
+
+  private:
+    const uint8_t _dcShift;    // how slowly the DC offset follows the block means
+    int32_t _dcOffset;         // in 1/256ths of a sample
+    bool _hasDcOffset;
+
+    int32_t _peak;
+    float _rms;
+    uint16_t _numSamples;
+
+    static bool isValidSlot(int32_t slot) {
+      return slot != 0 && slot != -1;
+    }
+
+    static float toDbfs(float level) {
+      if (level <= 0) {
+        return MIN_DBFS;
+      }
+      float dbfs = 20 * log10(level / FULL_SCALE);
+      if (dbfs < MIN_DBFS) {
+        return MIN_DBFS;
+      }
+      return dbfs;
+    }
+
+  public:
+    /**
+     * Creates a level meter. Each block moves the DC offset estimate
+     * 1/2^dcShift of the way to that block's mean, so larger values
+     * follow the offset more slowly and affect low frequencies less
+     */
+    AudioBlockLevel(uint8_t dcShift = 5)
+      : _dcShift(dcShift), _dcOffset(0), _hasDcOffset(false),
+        _peak(0), _rms(0), _numSamples(0) {
+    }
+
+    /**
+     * Measures a block of raw 32-bit I2S slots. Returns false (and leaves
+     * the last measurements alone) if the block has no valid samples
+     */
+    bool update(const int32_t* slots, uint16_t numSlots) {
+      if (!_hasDcOffset) {
+        // Start the DC offset at the mean of the first block
+        int32_t sum = 0;
+        uint16_t numSamples = 0;
+        for (uint16_t i = 0; i < numSlots; i++) {
+          if (isValidSlot(slots[i])) {
+            sum += slots[i] >> SAMPLE_SHIFT;
+            numSamples++;
+          }
+        }
+        if (numSamples == 0) {
+          return false;
+        }
+        _dcOffset = (int32_t)((int64_t)sum * 256 / numSamples);
+        _hasDcOffset = true;
+      }
+
+      int32_t dcOffset = (_dcOffset + 128) >> 8;
+      int32_t sum = 0;
+      uint64_t sumSquares = 0;
+      int32_t peak = 0;
+      uint16_t numSamples = 0;
+
+      for (uint16_t i = 0; i < numSlots; i++) {
+        if (!isValidSlot(slots[i])) {
+          continue;
+        }
+        int32_t sample = slots[i] >> SAMPLE_SHIFT;
+        int32_t ac = sample - dcOffset;
+        sum += sample;
+        sumSquares += (int64_t)ac * ac;
+        if (ac < 0) {
+          ac = -ac;
+        }
+        if (ac > peak) {
+          peak = ac;
+        }
+        numSamples++;
+      }
+
+      if (numSamples == 0) {
+        return false;
+      }
+
+      _peak = peak;
+      _rms = sqrt((float)sumSquares / numSamples);
+      _numSamples = numSamples;
+
+      int32_t blockMean = (int32_t)((int64_t)sum * 256 / numSamples);
+      _dcOffset += (blockMean - _dcOffset) >> _dcShift;
+      return true;
+    }
+
+    /**
+     * Returns the largest distance from the DC offset in the last block (0 - 131072)
+     */
+    int32_t getPeak() const {
+      return _peak;
+    }
+
+    /**
+     * Returns the RMS (root mean square) level of the last block, with the DC offset removed
+     */
+    float getRms() const {
+      return _rms;
+    }
+
+    /**
+     * Returns the peak of the last block in dBFS (MIN_DBFS - 0)
+     */
+    float getPeakDbfs() const {
+      return toDbfs(_peak);
+    }
+
+    /**
+     * Returns the RMS level of the last block in dBFS (MIN_DBFS - 0)
+     */
+    float getRmsDbfs() const {
+      return toDbfs(_rms);
+    }
+
+    /**
+     * Returns the current estimate of the mic's DC offset
+     */
+    float getDcOffset() const {
+      return _dcOffset / 256.0;
+    }
+
+    /**
+     * Returns the number of valid samples in the last block
+     */
+    uint16_t getNumSamples() const {
+      return _numSamples;
+    }
+
+    /**
+     * Forgets the DC offset and the last measurements
+     */
+    void reset() {
+      _dcOffset = 0;
+      _hasDcOffset = false;
+      _peak = 0;
+      _rms = 0;
+      _numSamples = 0;
+    }
+};
+
+class I2sBlockCapture{
+
+  static_assert(I2S_CAPTURE_BUFFER_BYTES >= 8 && I2S_CAPTURE_BUFFER_BYTES % 4 == 0,
+                "I2S_CAPTURE_BUFFER_BYTES must be a multiple of 4");
+
+  public:
+    static const uint16_t MAX_BLOCK_SLOTS = I2S_CAPTURE_BUFFER_BYTES / sizeof(int32_t);
+
+  private:
+    static const int8_t NO_BLOCK = -1;
+
+    static int32_t _buffers[2][MAX_BLOCK_SLOTS];
+    static uint16_t _blockLengths[2];
+
+    // The interrupt fills _buffers[_fillIndex] and hands it to loop() by
+    // setting _readyIndex. loop() owns _buffers[_readyIndex] until it calls
+    // releaseBlock(), which sets _readyIndex back to NO_BLOCK.
+    static uint8_t _fillIndex;
+    static int8_t _readyIndex;
+
+    static volatile unsigned long _blockCount;
+    static volatile unsigned long _droppedBlockCount;
+
+    static void onReceive() {
+      uint8_t fillIndex = _fillIndex;
+      int numBytes = I2S.read(_buffers[fillIndex], I2S_CAPTURE_BUFFER_BYTES);
+      _blockCount++;
+
+      if (__atomic_load_n(&_readyIndex, __ATOMIC_ACQUIRE) != NO_BLOCK) {
+        // loop() still has the other buffer, so drop this block and
+        // fill the same buffer again next time
+        _droppedBlockCount++;
+        return;
+      }
+
+      _blockLengths[fillIndex] = numBytes / sizeof(int32_t);
+      __atomic_store_n(&_readyIndex, (int8_t)fillIndex, __ATOMIC_RELEASE);
+      _fillIndex = fillIndex ^ 1;
+    }
+
+  public:
+    /**
+     * Starts capturing 32-bit stereo I2S (Philips mode) at the given sample
+     * rate. For the SAMD I2S library, 48,000,000 / sampleRate must be a
+     * multiple of 64 (e.g., 15625 or 31250). Returns false if I2S didn't start
+     */
+    static bool begin(long sampleRate) {
+      _fillIndex = 0;
+      _readyIndex = NO_BLOCK;
+      _blockCount = 0;
+      _droppedBlockCount = 0;
+
+      I2S.onReceive(onReceive);
+      if (!I2S.begin(I2S_PHILIPS_MODE, sampleRate, 32)) {
+        return false;
+      }
+      I2S.read(); // One read call is required to start the interrupt handler
+      return true;
+    }
+
+    /**
+     * Stops capturing
+     */
+    static void end() {
+      I2S.end();
+    }
+
+    /**
+     * Returns true if a full block is waiting for loop()
+     */
+    static bool available() {
+      return __atomic_load_n(&_readyIndex, __ATOMIC_ACQUIRE) != NO_BLOCK;
+    }
+
+    /**
+     * Returns the waiting block of raw 32-bit I2S slots (and sets numSlots
+     * to its length) or NULL if there isn't one. The block is yours until
+     * you call releaseBlock(), so release it as soon as you're done with it
+     */
+    static const int32_t* getBlock(uint16_t& numSlots) {
+      int8_t readyIndex = __atomic_load_n(&_readyIndex, __ATOMIC_ACQUIRE);
+      if (readyIndex == NO_BLOCK) {
+        numSlots = 0;
+        return NULL;
+      }
+      numSlots = _blockLengths[readyIndex];
+      return _buffers[readyIndex];
+    }
+
+    /**
+     * Hands the block from getBlock() back so the interrupt can fill it
+     */
+    static void releaseBlock() {
+      __atomic_store_n(&_readyIndex, NO_BLOCK, __ATOMIC_RELEASE);
+    }
+
+    /**
+     * Returns the number of blocks received since begin() (including dropped ones)
+     */
+    static unsigned long getBlockCount() {
+      return _blockCount;
+    }
+
+    /**
+     * Returns the number of blocks dropped because loop() still had the
+     * previous one. If this goes up, loop() is doing too much per block
+     */
+    static unsigned long getDroppedBlockCount() {
+      return _droppedBlockCount;
+    }
+};
+
+int32_t I2sBlockCapture::_buffers[2][I2sBlockCapture::MAX_BLOCK_SLOTS];
+uint16_t I2sBlockCapture::_blockLengths[2];
+uint8_t I2sBlockCapture::_fillIndex = 0;
+int8_t I2sBlockCapture::_readyIndex = I2sBlockCapture::NO_BLOCK;
+volatile unsigned long I2sBlockCapture::_blockCount = 0;
+volatile unsigned long I2sBlockCapture::_droppedBlockCount = 0;
+
+#endif
@@ -16,45 +16,60 @@
  * Adafruit Feather M0 Express: https://www.adafruit.com/product/3403
  * with the Adafruit i2s MEMs Microphone Breakout for the SPH0645LM4H
  * https://www.adafruit.com/product/3421  
+ *
+ * The I2S data is captured with I2sBlockCapture.hpp (in this folder), which
+ * hands full blocks from the interrupt to loop() and measures the peak, RMS,
+ * and dBFS of every valid sample in each block. Every PRINT_INTERVAL_MS, we
+ * print the loudest block in that interval (a longer term maximum).
  */ 
 
 
 
-#include <I2S.h>
-#define INFINITY_NEGATIVE -99999
-#define I2S_BUFFER_SIZE 512
-#define I2S_BITS_PER_SAMPLE 32                    // 32-bits per I2S sample
-uint8_t buffer[I2S_BUFFER_SIZE];                  // Allocate the buffer size
-int *I2Svalues = (int *) buffer;                  // I2Svalues changes to integer type, rather than an unsigned int 8-bit type, same data, groups it differently
-volatile boolean I2SAvailable = false;            // Shouldn't this be a boolean?
-int I2Smax_2ms;                                   // Used to hold the maximum sound reading from each group of samples (i.e. each 2mS)
+#include "I2sBlockCapture.hpp"
+
+const long SAMPLE_RATE = 31250;                   // 48,000,000 / sampleRate must be a multiple of 64
+const unsigned long PRINT_INTERVAL_MS = 50;       // Printing every ~2ms block would be too slow for Serial
+
+AudioBlockLevel _level;                           // Peak, RMS, and dBFS of each block
+int32_t _intervalPeak = 0;                        // Loudest block peak since the last print
+float _intervalRmsDbfs = AudioBlockLevel::MIN_DBFS; // Loudest block RMS since the last print
+unsigned long _lastPrintTimestampMs = 0;
+unsigned long _lastDroppedBlockCount = 0;
     
 void setup() {
   Serial.begin(115200);
   while (!Serial) { ; }                           // wait for serial port to connect. Needed for native USB port only
-  I2S.onReceive(onI2SReceive);                    // Set the interrupt for when I2S data is available, to call the onI2SReceive sub
-  int sampleRate = 31250;                         // 48,000,000 / sampleRate must be a multiple of 64
-  if (!I2S.begin(I2S_PHILIPS_MODE, sampleRate, I2S_BITS_PER_SAMPLE)) { Serial.println("Failed to initialize I2S!"); while (1); } // do nothing
-  I2S.read();                                     // One read call is required to start the interrupt handler
+  if (!I2sBlockCapture::begin(SAMPLE_RATE)) { Serial.println("Failed to initialize I2S!"); while (1); } // do nothing
 }
 
-void onI2SReceive() { // This function will run at a frequency of (sampleRate / 64).  At 31.25khz, this is every 1962.5 microseconds so make sure any processing here takes less time than that
-  I2Smax_2ms = INFINITY_NEGATIVE;                 // Reset the maximum counter to detect a new peak from this cycle
-  if (I2SAvailable) { Serial.println("POTENTIAL OVERFLOW"); } // This indicates that the program is not keeping up with processing
-  I2S.read(buffer, I2S_BUFFER_SIZE);              // Will actually read 256 bytes
-  for (int i = 0; i < I2S_BITS_PER_SAMPLE; i++) { // Process the data
-    if ((I2Svalues[i]!= 0) && (I2Svalues[i] != -1) ) {  // All 0 or -1 readings need to be discarded (every second reading depending on SEL
-      I2Svalues[i] >>= 14;   // convert to 18 bit signed
-      if (I2Smax_2ms < I2Svalues[i]) { I2Smax_2ms = I2Svalues[i]; } // Record the new maximum value       
+void loop() {
+  uint16_t numSlots;
+  const int32_t* block = I2sBlockCapture::getBlock(numSlots);
+  if (block != NULL) {
+    bool hasSamples = _level.update(block, numSlots);
+    I2sBlockCapture::releaseBlock();              // Release right away so the interrupt can fill this buffer again
+
+    if (hasSamples) {
+      _intervalPeak = max(_intervalPeak, _level.getPeak());
+      _intervalRmsDbfs = max(_intervalRmsDbfs, _level.getRmsDbfs());
     }
-  }      
-  Serial.println(I2Smax_2ms);
-  I2SAvailable = true;
-}
+  }
 
-void loop() {
-  if (I2SAvailable) {
-    // Add a second round of processing to pick out a longer term maximum
-    I2SAvailable = false;
+  if (millis() - _lastPrintTimestampMs >= PRINT_INTERVAL_MS) {
+    Serial.print("Peak:");
+    Serial.print(_intervalPeak);
+    Serial.print(", RMSdBFS:");
+    Serial.println(_intervalRmsDbfs);
+    _intervalPeak = 0;
+    _intervalRmsDbfs = AudioBlockLevel::MIN_DBFS;
+    _lastPrintTimestampMs = millis();
+
+    unsigned long droppedBlockCount = I2sBlockCapture::getDroppedBlockCount();
+    if (droppedBlockCount != _lastDroppedBlockCount) { // This indicates that the program is not keeping up with processing
+      Serial.print("OVERFLOW: dropped ");
+      Serial.print(droppedBlockCount - _lastDroppedBlockCount);
+      Serial.println(" blocks");
+      _lastDroppedBlockCount = droppedBlockCount;
+    }
   }
 }
\ No newline at end of file
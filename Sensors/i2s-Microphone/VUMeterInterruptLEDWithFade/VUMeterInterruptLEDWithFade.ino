@@ -18,17 +18,15 @@
  * https://www.adafruit.com/product/3421  
  */ 
 
-#include <I2S.h>
 #include <Adafruit_NeoPixel.h>    //  Library that provides NeoPixel functions
 
-#define INFINITY_NEGATIVE -99999
-#define I2S_BUFFER_SIZE 512
-#define I2S_BITS_PER_SAMPLE 32                    // 32-bits per I2S sample
-uint8_t buffer[I2S_BUFFER_SIZE];                  // Allocate the buffer size
-int *I2Svalues = (int *) buffer;                  // I2Svalues changes to integer type, rather than an unsigned int 8-bit type, same data, groups it differently
-volatile boolean I2SAvailable = false;            // Shouldn't this be a boolean?
+#include "I2sBlockCapture.hpp"    // Hands full I2S blocks from the interrupt to loop() (in this folder)
+
+AudioBlockLevel _level;                           // Peak, RMS, and dBFS of each block with the mic's DC offset removed
 int _curI2sMax; 
-const int MIN_SOUND_LEVEL = 7000;
+// The peak is measured from the mic's DC offset (~6500) rather than from 0,
+// so these levels are 6500 lower than when the raw samples were used
+const int MIN_SOUND_LEVEL = 500;
 
 // Create a NeoPixel object called onePixel that addresses 1 pixel in pin 8
 Adafruit_NeoPixel _onePixel = Adafruit_NeoPixel(1, PIN_NEOPIXEL, NEO_GRB + NEO_KHZ800);
@@ -58,44 +56,29 @@ void setup() {
   _onePixel.setBrightness(20);   // Affects all subsequent settings
   _onePixel.show();              // Show
 
-  I2S.onReceive(onI2SReceive);                    // Set the interrupt for when I2S data is available, to call the onI2SReceive sub
   //int sampleRate = 31250;                         // 48,000,000 / sampleRate must be a multiple of 64
   int sampleRate = 15625;
-  if (!I2S.begin(I2S_PHILIPS_MODE, sampleRate, I2S_BITS_PER_SAMPLE)) { Serial.println("Failed to initialize I2S!"); while (1); } // do nothing
-  I2S.read();                                     // One read call is required to start the interrupt handler
+  if (!I2sBlockCapture::begin(sampleRate)) { Serial.println("Failed to initialize I2S!"); while (1); } // do nothing
 
   _onePixel.begin();             // Start the NeoPixel object
   _onePixel.setPixelColor(NEOPIXEL_IDX, 0, 0, 255);
   _onePixel.show();              // Show
 }
 
-// This function will run at a frequency of (sampleRate / 64).  
-// At 31.25khz, this is every 1962.5 microseconds so make sure any processing here takes less time than that
-// At 15.625kHz, this is every 3925 microseconds (~4ms)
-void onI2SReceive() { 
-  _curI2sMax = INFINITY_NEGATIVE;                 // Reset the maximum counter to detect a new peak from this cycle
-  if (I2SAvailable) { Serial.println("POTENTIAL OVERFLOW"); } // This indicates that the program is not keeping up with processing
-  I2S.read(buffer, I2S_BUFFER_SIZE);              // Will actually read 256 bytes
-  for (int i = 0; i < I2S_BITS_PER_SAMPLE; i++) { // Process the data
-    if ((I2Svalues[i]!= 0) && (I2Svalues[i] != -1) ) {  // All 0 or -1 readings need to be discarded (every second reading depending on SEL
-      I2Svalues[i] >>= 14;   // convert to 18 bit signed
-      int absVal = abs(I2Svalues[i]);
-      if (_curI2sMax < absVal) { _curI2sMax = absVal; } // Record the new maximum value       
-    }
-  }
-
-  //Serial.println(I2Smax_2ms);
-  I2SAvailable = true;
-}
-
 void loop() {
-  if (I2SAvailable) {
+  uint16_t numSlots;
+  const int32_t* block = I2sBlockCapture::getBlock(numSlots);
+  if (block != NULL) {
+    _level.update(block, numSlots);
+    I2sBlockCapture::releaseBlock();              // Release right away so the interrupt can fill this buffer again
+    _curI2sMax = _level.getPeak();
+
     if(_curI2sFadeVal < _curI2sMax){
       _curI2sFadeVal = _curI2sMax;
       _lastFadeTimestampMs = millis();
     }
 
-    int hueVal = map(_curI2sFadeVal, MIN_SOUND_LEVEL, 60000, 0, MAX_HUE_VALUE);
+    int hueVal = map(_curI2sFadeVal, MIN_SOUND_LEVEL, 53500, 0, MAX_HUE_VALUE);
     hueVal = constrain(hueVal, 0, MAX_HUE_VALUE);
     Serial.print(_curI2sMax);
     Serial.print(", ");
@@ -117,7 +100,7 @@ void loop() {
     _onePixel.setBrightness(brightness); 
     _onePixel.show();
 
-    int ledBrightnessVal = map(_curI2sFadeVal, MIN_SOUND_LEVEL, 25000, 0, MAX_ANALOG_OUT);
+    int ledBrightnessVal = map(_curI2sFadeVal, MIN_SOUND_LEVEL, 18500, 0, MAX_ANALOG_OUT);
     ledBrightnessVal = constrain(ledBrightnessVal, 0, MAX_ANALOG_OUT);
     analogWrite(SOUND_LEVEL_LED_PIN, ledBrightnessVal);
 
@@ -128,9 +111,6 @@ void loop() {
       }
       _lastFadeTimestampMs = millis();
     }
-    
-    // Add a second round of processing to pick out a longer term maximum
-    I2SAvailable = false;
   }
 }
 
@@ -0,0 +1,500 @@
+/**
+ * Fast text for the SSD1306 OLED: fixed-size text fields whose layout is
+ * worked out once, drawn a byte per column straight into the framebuffer.
+ *
+ * Our status bars call getTextBounds("XX.XX fps", ...) every frame just to
+ * find where the fps goes, and Adafruit_GFX draws each character one pixel
+ * at a time (40 drawPixel() calls for a 5x7 character). But the SSD1306
+ * framebuffer stores each column of a page (8 rows) as one byte, and each
+ * column of a 5x7 character is also one byte. So, FastText copies a
+ * character with 6 byte writes (5 columns plus a blank one) when its y is a
+ * multiple of 8, and with a shift and mask per byte when it isn't.
+ *
+ * A TextField is a fixed number of characters at a fixed spot, like the fps
+ * in a status bar. It formats numbers itself (no String or sprintf) and has
+ * two ways to draw:
+ *  - draw() draws every character. Use it if you clear the screen each frame
+ *  - update() only redraws the characters that changed since the last
+ *    update() (e.g., just the last digit of a counter) and erases the field's
+ *    background itself. Use it if you don't clear the screen each frame
+ *
+ * Notes:
+ *  - The font is the printable ASCII characters (32 - 126) of Adafruit GFX's
+ *    built-in font (glcdfont.c), so text looks the same as print(). Other
+ *    characters are drawn as spaces
+ *  - Text is drawn white on black (like setTextColor(WHITE, BLACK)), which
+ *    erases whatever was under the characters. Pass transparent = true to
+ *    drawChar(), drawText(), or a TextField to draw just the white pixels
+ *    (like setTextColor(WHITE)). update() always draws on black, since it
+ *    has to erase the characters it replaces
+ *  - This changes the framebuffer directly, so it expects the display's
+ *    rotation to be 0. If you use it with PartialFlushSSD1306, call
+ *    markDirty() for the field's area after drawing
+ *
+ * Usage:
+ *  // "XX.XX fps" in the top-right corner: 5 characters for the number, right aligned
+ *  TextField _fpsField(SCREEN_WIDTH - FastText::getTextWidth(9), 0, 5, TEXT_ALIGN_RIGHT);
+ *
+ *  loop(){
+ *    _display.clearDisplay();
+ *    _fpsField.draw(_display, _fps);
+ *    FastText::drawText(_display, _fpsField.getX() + _fpsField.getWidth(), 0, " fps");
+ *    _display.display();
+ *  }
+ *
+ * By Jon E. Froehlich
+ * @jonfroehlich
+ * http://makeabilitylab.io
+ *
+ */
+#ifndef FAST_TEXT_HPP
+#define FAST_TEXT_HPP
+
+#include <Arduino.h>
+#include <Adafruit_GFX.h>
+#include <Adafruit_SSD1306.h>
+
+// Adafruit GFX's built-in font (glcdfont.c) for ASCII 32 (space) to 126 (~).
+// Each character is 5 columns and each column is a byte with the top row in
+// the lowest bit. The 8th row (the highest bit) is only used by descenders
+static const uint8_t FAST_TEXT_FONT[] PROGMEM = {
+  0x00, 0x00, 0x00, 0x00, 0x00,  // ' '
+  0x00, 0x00, 0x5F, 0x00, 0x00,  // !
+  0x00, 0x07, 0x00, 0x07, 0x00,  // "
+  0x14, 0x7F, 0x14, 0x7F, 0x14,  // #
+  0x24, 0x2A, 0x7F, 0x2A, 0x12,  // $
+  0x23, 0x13, 0x08, 0x64, 0x62,  // %
+  0x36, 0x49, 0x56, 0x20, 0x50,  // &
+  0x00, 0x08, 0x07, 0x03, 0x00,  // '
+  0x00, 0x1C, 0x22, 0x41, 0x00,  // (
+  0x00, 0x41, 0x22, 0x1C, 0x00,  // )
+  0x2A, 0x1C, 0x7F, 0x1C, 0x2A,  // *
+  0x08, 0x08, 0x3E, 0x08, 0x08,  // +
+  0x00, 0x80, 0x70, 0x30, 0x00,  // ,
+  0x08, 0x08, 0x08, 0x08, 0x08,  // -
+  0x00, 0x00, 0x60, 0x60, 0x00,  // .
+  0x20, 0x10, 0x08, 0x04, 0x02,  // /
+  0x3E, 0x51, 0x49, 0x45, 0x3E,  // 0
+  0x00, 0x42, 0x7F, 0x40, 0x00,  // 1
+  0x72, 0x49, 0x49, 0x49, 0x46,  // 2
+  0x21, 0x41, 0x49, 0x4D, 0x33,  // 3
+  0x18, 0x14, 0x12, 0x7F, 0x10,  // 4
+  0x27, 0x45, 0x45, 0x45, 0x39,  // 5
+  0x3C, 0x4A, 0x49, 0x49, 0x31,  // 6
+  0x41, 0x21, 0x11, 0x09, 0x07,  // 7
+  0x36, 0x49, 0x49, 0x49, 0x36,  // 8
+  0x46, 0x49, 0x49, 0x29, 0x1E,  // 9
+  0x00, 0x00, 0x14, 0x00, 0x00,  // :
+  0x00, 0x40, 0x34, 0x00, 0x00,  // ;
+  0x00, 0x08, 0x14, 0x22, 0x41,  // <
+  0x14, 0x14, 0x14, 0x14, 0x14,  // =
+  0x00, 0x41, 0x22, 0x14, 0x08,  // >
+  0x02, 0x01, 0x59, 0x09, 0x06,  // ?
+  0x3E, 0x41, 0x5D, 0x59, 0x4E,  // @
+  0x7C, 0x12, 0x11, 0x12, 0x7C,  // A
+  0x7F, 0x49, 0x49, 0x49, 0x36,  // B
+  0x3E, 0x41, 0x41, 0x41, 0x22,  // C
+  0x7F, 0x41, 0x41, 0x41, 0x3E,  // D
+  0x7F, 0x49, 0x49, 0x49, 0x41,  // E
+  0x7F, 0x09, 0x09, 0x09, 0x01,  // F
+  0x3E, 0x41, 0x41, 0x51, 0x73,  // G
+  0x7F, 0x08, 0x08, 0x08, 0x7F,  // H
+  0x00, 0x41, 0x7F, 0x41, 0x00,  // I
+  0x20, 0x40, 0x41, 0x3F, 0x01,  // J
+  0x7F, 0x08, 0x14, 0x22, 0x41,  // K
+  0x7F, 0x40, 0x40, 0x40, 0x40,  // L
+  0x7F, 0x02, 0x1C, 0x02, 0x7F,  // M
+  0x7F, 0x04, 0x08, 0x10, 0x7F,  // N
+  0x3E, 0x41, 0x41, 0x41, 0x3E,  // O
+  0x7F, 0x09, 0x09, 0x09, 0x06,  // P
+  0x3E, 0x41, 0x51, 0x21, 0x5E,  // Q
+  0x7F, 0x09, 0x19, 0x29, 0x46,  // R
+  0x26, 0x49, 0x49, 0x49, 0x32,  // S
+  0x03, 0x01, 0x7F, 0x01, 0x03,  // T
+  0x3F, 0x40, 0x40, 0x40, 0x3F,  // U
+  0x1F, 0x20, 0x40, 0x20, 0x1F,  // V
+  0x3F, 0x40, 0x38, 0x40, 0x3F,  // W
+  0x63, 0x14, 0x08, 0x14, 0x63,  // X
+  0x03, 0x04, 0x78, 0x04, 0x03,  // Y
+  0x61, 0x59, 0x49, 0x4D, 0x43,  // Z
+  0x00, 0x7F, 0x41, 0x41, 0x41,  // [
+  0x02, 0x04, 0x08, 0x10, 0x20,  // backslash
+  0x00, 0x41, 0x41, 0x41, 0x7F,  // ]
+  0x04, 0x02, 0x01, 0x02, 0x04,  // ^
+  0x40, 0x40, 0x40, 0x40, 0x40,  // _
+  0x00, 0x03, 0x07, 0x08, 0x00,  // `
+  0x20, 0x54, 0x54, 0x78, 0x40,  // a
+  0x7F, 0x28, 0x44, 0x44, 0x38,  // b
+  0x38, 0x44, 0x44, 0x44, 0x28,  // c
+  0x38, 0x44, 0x44, 0x28, 0x7F,  // d
+  0x38, 0x54, 0x54, 0x54, 0x18,  // e
+  0x00, 0x08, 0x7E, 0x09, 0x02,  // f
+  0x18, 0xA4, 0xA4, 0x9C, 0x78,  // g
+  0x7F, 0x08, 0x04, 0x04, 0x78,  // h
+  0x00, 0x44, 0x7D, 0x40, 0x00,  // i
+  0x20, 0x40, 0x40, 0x3D, 0x00,  // j
+  0x7F, 0x10, 0x28, 0x44, 0x00,  // k
+  0x00, 0x41, 0x7F, 0x40, 0x00,  // l
+  0x7C, 0x04, 0x78, 0x04, 0x78,  // m
+  0x7C, 0x08, 0x04, 0x04, 0x78,  // n
+  0x38, 0x44, 0x44, 0x44, 0x38,  // o
+  0xFC, 0x18, 0x24, 0x24, 0x18,  // p
+  0x18, 0x24, 0x24, 0x18, 0xFC,  // q
+  0x7C, 0x08, 0x04, 0x04, 0x08,  // r
+  0x48, 0x54, 0x54, 0x54, 0x24,  // s
+  0x04, 0x04, 0x3F, 0x44, 0x24,  // t
+  0x3C, 0x40, 0x40, 0x20, 0x7C,  // u
+  0x1C, 0x20, 0x40, 0x20, 0x1C,  // v
+  0x3C, 0x40, 0x30, 0x40, 0x3C,  // w
+  0x44, 0x28, 0x10, 0x28, 0x44,  // x
+  0x4C, 0x90, 0x90, 0x90, 0x7C,  // y
+  0x44, 0x64, 0x54, 0x4C, 0x44,  // z
+  0x00, 0x08, 0x36, 0x41, 0x00,  // {
+  0x00, 0x00, 0x77, 0x00, 0x00,  // |
+  0x00, 0x41, 0x36, 0x08, 0x00,  // }
+  0x02, 0x01, 0x02, 0x04, 0x02   // ~
+};
+
+enum TextAlign{
+  TEXT_ALIGN_LEFT,
+  TEXT_ALIGN_CENTER,
+  TEXT_ALIGN_RIGHT
+};
+
+class FastText{
+
+  private:
+    // Writes 8 rows of a column (lowest bit on top) starting at (x, y). The
+    // 0 bits are drawn black, or left as they are if transparent
+    static void writeColumn(Adafruit_SSD1306& display, int16_t x, int16_t y, uint8_t bits, bool transparent) {
+      int16_t displayWidth = display.width();
+      int16_t numPages = display.height() / 8;
+      if (x < 0 || x >= displayWidth || y <= -8 || y >= display.height()) {
+        return;
+      }
+
+      uint8_t* buffer = display.getBuffer();
+      int16_t page = y >= 0 ? y / 8 : -1;
+      uint8_t shift = y - page * 8;
+      if (shift == 0) {
+        uint8_t& column = buffer[page * displayWidth + x];
+        column = transparent ? column | bits : bits;
+        return;
+      }
+
+      // The column straddles two pages: the top of it goes in the bottom of
+      // the first page and the rest in the top of the next one
+      uint8_t topMask = transparent ? 0xFF : (uint8_t)(0xFF >> (8 - shift));
+      uint8_t bottomMask = transparent ? 0xFF : (uint8_t)(0xFF << shift);
+      if (page >= 0) {
+        uint8_t& top = buffer[page * displayWidth + x];
+        top = (top & topMask) | (uint8_t)(bits << shift);
+      }
+      if (page + 1 < numPages) {
+        uint8_t& bottom = buffer[(page + 1) * displayWidth + x];
+        bottom = (bottom & bottomMask) | (uint8_t)(bits >> (8 - shift));
+      }
+    }
+
+    // Returns rows 8 * part to 8 * part + 7 of a font column scaled up size times
+    static uint8_t scaleColumn(uint8_t bits, uint8_t size, uint8_t part) {
+      uint8_t scaled = 0;
+      for (uint8_t row = 0; row < 8; row++) {
+        if (bits & (1 << ((part * 8 + row) / size))) {
+          scaled |= 1 << row;
+        }
+      }
+      return scaled;
+    }
+
+  public:
+    static const uint8_t CHAR_WIDTH = 6;   // 5 columns plus a blank one (at size 1)
+    static const uint8_t CHAR_HEIGHT = 8;  // 7 rows plus one for descenders (at size 1)
+
+    /**
+     * Returns the width in pixels of numChars characters (the same as
+     * getTextBounds() with the built-in font)
+     */
+    static int16_t getTextWidth(uint8_t numChars, uint8_t size = 1) {
+      return numChars * CHAR_WIDTH * size;
+    }
+
+    /**
+     * Draws c with its top-left corner at (x, y). size scales it up like
+     * setTextSize(). If transparent, only its white pixels are drawn
+     */
+    static void drawChar(Adafruit_SSD1306& display, int16_t x, int16_t y, char c, uint8_t size = 1,
+                         bool transparent = false) {
+      uint8_t fontIndex = c >= ' ' && c <= '~' ? c - ' ' : 0;
+      const uint8_t* glyph = FAST_TEXT_FONT + fontIndex * 5;
+      for (uint8_t column = 0; column < CHAR_WIDTH; column++) {
+        uint8_t bits = column < 5 ? pgm_read_byte(glyph + column) : 0;
+        if (size == 1) {
+          writeColumn(display, x + column, y, bits, transparent);
+          continue;
+        }
+        for (uint8_t part = 0; part < size; part++) {
+          uint8_t scaled = scaleColumn(bits, size, part);
+          for (uint8_t i = 0; i < size; i++) {
+            writeColumn(display, x + column * size + i, y + part * 8, scaled, transparent);
+          }
+        }
+      }
+    }
+
+    /**
+     * Draws text with its top-left corner at (x, y). Returns its width in pixels
+     */
+    static int16_t drawText(Adafruit_SSD1306& display, int16_t x, int16_t y, const char* text, uint8_t size = 1,
+                            bool transparent = false) {
+      int16_t startX = x;
+      for (; *text != '\0'; text++) {
+        drawChar(display, x, y, *text, size, transparent);
+        x += CHAR_WIDTH * size;
+      }
+      return x - startX;
+    }
+};
+
+class TextField{
+
+  public:
+    static const uint8_t MAX_CHARS = 21;  // a 128-pixel wide line at size 1
+
+  private:
+    const int16_t _x;
+    const int16_t _y;
+    const uint8_t _numChars;
+    const TextAlign _align;
+    const uint8_t _size;
+    const bool _transparent;  // draw() leaves the field's background as it is
+
+    // What update() last drew, and where. Empty until the first update()
+    char _text[MAX_CHARS + 1];
+    int16_t _textX;
+    uint8_t _lastNumChars;  // the length of the last text drawn or updated
+
+    // Writes the digits of n and a '\0' to text. Returns where the '\0' is
+    static char* formatDigits(char* text, unsigned long n) {
+      char digits[10];
+      uint8_t numDigits = 0;
+      do {
+        digits[numDigits++] = '0' + n % 10;
+        n /= 10;
+      } while (n > 0);
+
+      while (numDigits > 0) {
+        *text++ = digits[--numDigits];
+      }
+      *text = '\0';
+      return text;
+    }
+
+    // Formats value into text (which has room for MAX_CHARS + 1), like Print::print()
+    static void formatNumber(char* text, long value) {
+      if (value < 0) {
+        *text++ = '-';
+      }
+      formatDigits(text, value < 0 ? 0UL - (unsigned long)value : (unsigned long)value);
+    }
+
+    static void formatNumber(char* text, float value, uint8_t decimals) {
+      if (isnan(value)) {
+        strcpy(text, "nan");
+        return;
+      }
+      if (isinf(value)) {
+        strcpy(text, "inf");
+        return;
+      }
+      if (value > 4294967040.0 || value < -4294967040.0) {
+        strcpy(text, "ovf");
+        return;
+      }
+      if (decimals > MAX_CHARS - 12) {
+        decimals = MAX_CHARS - 12;
+      }
+
+      // The same rounding and digits as Print::printFloat()
+      bool isNegative = value < 0;
+      if (isNegative) {
+        value = -value;
+      }
+      float rounding = 0.5;
+      for (uint8_t i = 0; i < decimals; i++) {
+        rounding /= 10.0;
+      }
+      value += rounding;
+
+      unsigned long intPart = (unsigned long)value;
+      float remainder = value - (float)intPart;
+      if (isNegative) {
+        *text++ = '-';
+      }
+      text = formatDigits(text, intPart);
+      if (decimals > 0) {
+        *text++ = '.';
+      }
+      while (decimals-- > 0) {
+        remainder *= 10.0;
+        uint8_t digit = (uint8_t)remainder;
+        *text++ = '0' + digit;
+        remainder -= digit;
+      }
+      *text = '\0';
+    }
+
+    // Where text of length numChars starts in the field
+    int16_t getTextXFor(uint8_t numChars) const {
+      int16_t space = getWidth() - FastText::getTextWidth(numChars, _size);
+      switch (_align) {
+        case TEXT_ALIGN_CENTER:
+          return _x + space / 2;
+        case TEXT_ALIGN_RIGHT:
+          return _x + space;
+        default:
+          return _x;
+      }
+    }
+
+    // Returns text, or *s if it doesn't fit (like a spreadsheet)
+    const char* fit(const char* text, char* stars) const {
+      if (strlen(text) <= _numChars) {
+        return text;
+      }
+      memset(stars, '*', _numChars);
+      stars[_numChars] = '\0';
+      return stars;
+    }
+
+  public:
+    /**
+     * Creates a field of numChars characters (up to MAX_CHARS) with its
+     * top-left corner at (x, y). size scales the text up like setTextSize().
+     * If transparent, draw() only draws the text's white pixels
+     */
+    TextField(int16_t x, int16_t y, uint8_t numChars, TextAlign align = TEXT_ALIGN_LEFT, uint8_t size = 1,
+              bool transparent = false)
+      : _x(x), _y(y), _numChars(numChars > MAX_CHARS ? (uint8_t)MAX_CHARS : numChars),
+        _align(align), _size(size > 0 ? size : 1), _transparent(transparent), _lastNumChars(0) {
+      invalidate();
+    }
+
+    /**
+     * Draws text in the field. Use this if the field was cleared (e.g., by
+     * clearDisplay()) since it was last drawn; it doesn't erase the
+     * field first. Text that doesn't fit is shown as *s
+     */
+    void draw(Adafruit_SSD1306& display, const char* text) {
+      char stars[MAX_CHARS + 1];
+      text = fit(text, stars);
+      _lastNumChars = strlen(text);
+      FastText::drawText(display, getTextXFor(_lastNumChars), _y, text, _size, _transparent);
+      invalidate();
+    }
+
+    void draw(Adafruit_SSD1306& display, long value) {
+      char text[MAX_CHARS + 1];
+      formatNumber(text, value);
+      draw(display, text);
+    }
+
+    void draw(Adafruit_SSD1306& display, int value) {
+      draw(display, (long)value);
+    }
+
+    /**
+     * Draws value with decimals digits after the decimal point (like print(value, decimals))
+     */
+    void draw(Adafruit_SSD1306& display, float value, uint8_t decimals = 2) {
+      char text[MAX_CHARS + 1];
+      formatNumber(text, value, decimals);
+      draw(display, text);
+    }
+
+    /**
+     * Changes the text in the field, redrawing only the characters that
+     * changed since the last update() (or, if the text moved, erasing the
+     * field and drawing it all). Returns true if anything changed. The text
+     * is always drawn on black, even if the field is transparent
+     */
+    bool update(Adafruit_SSD1306& display, const char* text) {
+      char stars[MAX_CHARS + 1];
+      text = fit(text, stars);
+      uint8_t numChars = strlen(text);
+      int16_t textX = getTextXFor(numChars);
+      _lastNumChars = numChars;
+      int16_t charWidth = FastText::getTextWidth(1, _size);
+
+      if (textX == _textX && numChars == strlen(_text)) {
+        bool changed = false;
+        for (uint8_t i = 0; i < numChars; i++) {
+          if (text[i] != _text[i]) {
+            FastText::drawChar(display, textX + i * charWidth, _y, text[i], _size);
+            _text[i] = text[i];
+            changed = true;
+          }
+        }
+        return changed;
+      }
+
+      display.fillRect(_x, _y, getWidth(), getHeight(), SSD1306_BLACK);
+      FastText::drawText(display, textX, _y, text, _size);
+      strcpy(_text, text);
+      _textX = textX;
+      return true;
+    }
+
+    bool update(Adafruit_SSD1306& display, long value) {
+      char text[MAX_CHARS + 1];
+      formatNumber(text, value);
+      return update(display, text);
+    }
+
+    bool update(Adafruit_SSD1306& display, int value) {
+      return update(display, (long)value);
+    }
+
+    bool update(Adafruit_SSD1306& display, float value, uint8_t decimals = 2) {
+      char text[MAX_CHARS + 1];
+      formatNumber(text, value, decimals);
+      return update(display, text);
+    }
+
+    /**
+     * Makes the next update() erase and redraw the whole field. Call this if
+     * something else drew over the field or cleared it
+     */
+    void invalidate() {
+      _text[0] = '\0';
+      _textX = -32768;
+    }
+
+    int16_t getX() const {
+      return _x;
+    }
+
+    int16_t getY() const {
+      return _y;
+    }
+
+    /**
+     * Returns the field's width in pixels (numChars characters)
+     */
+    int16_t getWidth() const {
+      return FastText::getTextWidth(_numChars, _size);
+    }
+
+    int16_t getHeight() const {
+      return FastText::CHAR_HEIGHT * _size;
+    }
+
+    /**
+     * Returns the x just right of the last text drawn (e.g., to put a symbol after it)
+     */
+    int16_t getTextRight() const {
+      return getTextXFor(_lastNumChars) + FastText::getTextWidth(_lastNumChars, _size);
+    }
+};
+
+#endif
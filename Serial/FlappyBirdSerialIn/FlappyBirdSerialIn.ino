@@ -37,6 +37,7 @@
 
 #include <Adafruit_GFX.h>
 #include <Adafruit_SSD1306.h>
+#include "FastText.hpp"
 
 #define SCREEN_WIDTH 128 // OLED _display width, in pixels
 #define SCREEN_HEIGHT 64 // OLED _display height, in pixels
@@ -66,6 +67,10 @@ unsigned long _fpsStartTimeStamp = 0;
 const boolean _drawFrameCount = false; // change to show/hide frame count
 const int LOAD_SCREEN_SHOW_MS = 750;
 
+// The points in the top-left corner and "XX.XX fps" in the top-right corner
+TextField _pointsField(0, 0, 6);
+TextField _fpsField(SCREEN_WIDTH - FastText::getTextWidth(9), 0, 5, TEXT_ALIGN_RIGHT);
+
 class Bird : public Rectangle {
   public:
     Bird(int x, int y, int width, int height) : Rectangle(x, y, width, height)
@@ -285,6 +290,7 @@ void nonGamePlayLoop() {
   if (_gameState == NEW_GAME) {
 
     int yText = 11;
+    _display.setTextSize(1);
     _display.getTextBounds(STR_PRESS_FLAP_TO_PLAY, 0, 0, &x1, &y1, &w, &h);
     _display.setCursor(_display.width() / 2 - w / 2, yText);
     _display.print(STR_PRESS_FLAP_TO_PLAY);
@@ -509,17 +515,11 @@ void calcFrameRate() {
  */
 void drawStatusBar() {
   // Draw accumulated points
-  _display.setTextSize(1);
-  _display.setCursor(0, 0); // draw points
-  _display.print(_points);
+  _pointsField.draw(_display, _points);
 
   // Draw frame count
   if (_drawFrameCount) {
-    int16_t x1, y1;
-    uint16_t w, h;
-    _display.getTextBounds("XX.XX fps", 0, 0, &x1, &y1, &w, &h);
-    _display.setCursor(_display.width() - w, 0);
-    _display.print(_fps);
-    _display.print(" fps");
+    _fpsField.draw(_display, _fps);
+    FastText::drawText(_display, _fpsField.getX() + _fpsField.getWidth(), 0, " fps");
   }
 }
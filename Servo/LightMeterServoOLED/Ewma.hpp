@@ -0,0 +1,103 @@
+/**
+ * An exponentially weighted moving average (EWMA) filter that uses only
+ * integer adds and shifts, which is much faster than the usual float version
+ *
+ *   smoothed = alpha * newReading + (1 - alpha) * smoothed
+ *
+ * on boards without a floating point unit (e.g., the Uno and Leonardo).
+ *
+ * Alpha is set at compile time as AlphaNum / 2^AlphaShift, so the multiply
+ * by alpha becomes a multiply by a small constant and a shift. For example:
+ *
+ *   Ewma<int, 1>      _ewma;  // alpha = 1/2   = 0.5
+ *   Ewma<int, 3>      _ewma;  // alpha = 1/8   = 0.125
+ *   Ewma<int, 7, 51>  _ewma;  // alpha = 51/128 ~= 0.4
+ *
+ * The smoothed value is stored with FracBits extra fractional bits. Without
+ * them, an integer EWMA gets "stuck" whenever the difference between the
+ * input and the smoothed value is smaller than 1 / alpha (e.g., within 7 of
+ * the input for alpha = 1/8). With FracBits >= AlphaShift (the default is 8),
+ * the output converges to within rounding of the input, like the float version.
+ * The internal accumulator is 32 bits, which fits 12-bit ADC readings with
+ * any AlphaNum (up to 255) or full 16-bit inputs with AlphaNum = 1.
+ *
+ * Usage:
+ *  Ewma<int, 2> _ewma; // alpha = 0.25
+ *
+ *  loop(){
+ *    int smoothed = _ewma.add(analogRead(A0));
+ *  }
+ *
+ * By Jon E. Froehlich
+ * @jonfroehlich
+ * http://makeabilitylab.io
+ *
+ */
+#ifndef EWMA_HPP
+#define EWMA_HPP
+
+#include <Arduino.h>
+
+template<typename T, uint8_t AlphaShift, uint8_t AlphaNum = 1, uint8_t FracBits = 8>
+class Ewma{
+
+  static_assert(AlphaShift < 16, "AlphaShift must be less than 16");
+  static_assert(AlphaNum > 0 && AlphaNum <= (1UL << AlphaShift), "AlphaNum / 2^AlphaShift must be in (0, 1]");
+
+  private:
+    int32_t _smoothed;   // smoothed value scaled by 2^FracBits
+    bool _isEmpty;
+
+  public:
+    Ewma() {
+      reset();
+    }
+
+    /**
+     * Clears the filter. The next add() seeds it with that value
+     */
+    void reset() {
+      _smoothed = 0;
+      _isEmpty = true;
+    }
+
+    /**
+     * Adds a new value and returns the updated smoothed value
+     */
+    T add(T value) {
+      int32_t scaledValue = (int32_t)value << FracBits;
+
+      if (_isEmpty) {
+        _smoothed = scaledValue;
+        _isEmpty = false;
+      } else {
+        // Same as smoothed += alpha * (value - smoothed)
+        _smoothed += ((scaledValue - _smoothed) * AlphaNum) >> AlphaShift;
+      }
+
+      return get();
+    }
+
+    /**
+     * Returns the current smoothed value, rounded to the nearest integer
+     */
+    T get() const {
+      return (T)((_smoothed + (FracBits > 0 ? (1L << FracBits) / 2 : 0)) >> FracBits);
+    }
+
+    /**
+     * Returns the current smoothed value including its fractional part
+     */
+    float getFloat() const {
+      return _smoothed / (float)(1UL << FracBits);
+    }
+
+    /**
+     * Returns alpha as a float (e.g., for printing)
+     */
+    static float getAlpha() {
+      return AlphaNum / (float)(1UL << AlphaShift);
+    }
+};
+
+#endif
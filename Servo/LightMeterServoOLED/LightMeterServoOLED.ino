@@ -81,6 +81,8 @@
 #include <Wire.h>
 #include <Adafruit_GFX.h>
 #include <Adafruit_SSD1306.h>
+#include "Ewma.hpp"
+#include "FastText.hpp"
 
 // ─────────────────────────────────────────────────────────────
 // OLED CONFIGURATION
@@ -93,6 +95,22 @@
 // Create the display object (I2C)
 Adafruit_SSD1306 _display(SCREEN_WIDTH, SCREEN_HEIGHT, &Wire, OLED_RESET);
 
+// The big numbers (servo angle and countdown) are TextFields from
+// FastText.hpp (in this folder). A field's position is worked out once,
+// here, rather than building a String and measuring it with
+// getTextBounds() every frame, and its digits are copied into the
+// framebuffer a byte per column rather than drawn pixel by pixel.
+// Each field is centered on screen and wide enough for its longest
+// value at text size 4 (24×32 pixel characters). Like the rest of our
+// text (setTextColor(SSD1306_WHITE)), they're transparent: they only
+// draw white pixels, so they never blank out anything drawn under them.
+const int BIG_TEXT_SIZE = 4;
+TextField _angleField((SCREEN_WIDTH - FastText::getTextWidth(3, BIG_TEXT_SIZE)) / 2,  // 0–180
+                      12, 3, TEXT_ALIGN_CENTER, BIG_TEXT_SIZE, true);  // Fixed top: below top row, above bars
+TextField _countdownField((SCREEN_WIDTH - FastText::getTextWidth(2, BIG_TEXT_SIZE)) / 2,  // 1–10
+                          (SCREEN_HEIGHT - FastText::CHAR_HEIGHT * BIG_TEXT_SIZE) / 2 + 4,  // Slightly below center
+                          2, TEXT_ALIGN_CENTER, BIG_TEXT_SIZE, true);
+
 // ─────────────────────────────────────────────────────────────
 // PIN DEFINITIONS (board-specific where needed)
 // ─────────────────────────────────────────────────────────────
@@ -155,17 +173,20 @@ unsigned long _lastDebounceTime = 0;
 //
 // We keep separate EMA state for each input so that switching modes
 // doesn't cause a jarring jump — each input "remembers" where it was.
-const float EMA_ALPHA_POT = 0.4;  // Pot: moderate smoothing (human turning a knob)
-const float EMA_ALPHA_LDR = 0.15; // LDR: heavier smoothing (ambient light changes slowly & LDRs can be noisy)
+//
+// The Uno has no floating point hardware, so Ewma.hpp (in this folder)
+// does the same math with integers. Alpha is a compile-time fraction
+// AlphaNum / 2^AlphaShift so the multiply becomes a multiply and a shift:
+//   Ewma<int, 7, 51> → α = 51/128 ≈ 0.40
+//   Ewma<int, 7, 19> → α = 19/128 ≈ 0.15
+Ewma<int, 7, 51> _potEwma;   // Pot: moderate smoothing (human turning a knob)
+Ewma<int, 7, 19> _ldrEwma;   // LDR: heavier smoothing (ambient light changes slowly & LDRs can be noisy)
 
 // Minimum angle change required to move the servo. Prevents the servo
 // from buzzing back and forth between two adjacent angles due to ADC
 // noise or EMA rounding. A value of 1 absorbs ±1° jitter.
 const int SERVO_DEAD_BAND = 1;
 
-float _smoothedPotVal = 0;   // EMA accumulator for potentiometer
-float _smoothedLdrVal = 0;   // EMA accumulator for photoresistor
-
 // ─────────────────────────────────────────────────────────────
 // SERVO STATE
 // ─────────────────────────────────────────────────────────────
@@ -223,8 +244,8 @@ void setup() {
   // Seed both EMA accumulators with initial readings.
   // Without this, the smoothed values would start at 0 and slowly
   // ramp up to the actual reading, causing a visible sweep on startup.
-  _smoothedPotVal = analogRead(POT_PIN);
-  _smoothedLdrVal = analogRead(LDR_PIN);
+  _potEwma.add(analogRead(POT_PIN));
+  _ldrEwma.add(analogRead(LDR_PIN));
 
   // Initialize interaction tracking for display sleep
   _lastInteractionTime = millis();
@@ -253,12 +274,10 @@ void loop() {
   // accumulators "warm" so there's no jump when switching modes.
 
   int rawPot = analogRead(POT_PIN);
-  _smoothedPotVal = EMA_ALPHA_POT * rawPot + (1.0 - EMA_ALPHA_POT) * _smoothedPotVal;
-  int smoothedPot = (int)(_smoothedPotVal + 0.5);  // Round to nearest int
+  int smoothedPot = _potEwma.add(rawPot);  // Rounded to nearest int
 
   int rawLdr = analogRead(LDR_PIN);
-  _smoothedLdrVal = EMA_ALPHA_LDR * rawLdr + (1.0 - EMA_ALPHA_LDR) * _smoothedLdrVal;
-  int smoothedLdr = (int)(_smoothedLdrVal + 0.5);
+  int smoothedLdr = _ldrEwma.add(rawLdr);
 
   // ── 3. COMPUTE SERVO ANGLE FROM ACTIVE INPUT ────────────
 
@@ -453,17 +472,8 @@ void drawCountdown(int secondsLeft) {
   _display.print("Display off in...");
 
   // ── Big countdown number, centered ──
-  _display.setTextSize(4);
-  String strSeconds = String(secondsLeft);
-
-  int16_t x1, y1;
-  uint16_t textWidth, textHeight;
-  _display.getTextBounds(strSeconds, 0, 0, &x1, &y1, &textWidth, &textHeight);
-
-  uint16_t xText = (SCREEN_WIDTH - textWidth) / 2;
-  uint16_t yText = (SCREEN_HEIGHT - textHeight) / 2 + 4;  // Slightly below center
-  _display.setCursor(xText, yText);
-  _display.print(strSeconds);
+  // The screen was just cleared, so draw() the whole field
+  _countdownField.draw(_display, secondsLeft);
 
   _display.display();
 }
@@ -536,28 +546,16 @@ void drawDisplay(int rawPot, int smoothedPot, int rawLdr, int smoothedLdr, int s
 
   // ── CENTER: Large servo angle with degree symbol ────────
 
-  _display.setTextSize(4);  // 24×32 pixel characters — big and readable
-  String strAngle = String(servoAngle);
-
-  // Use getTextBounds to measure the rendered string for centering.
-  // This handles variable-width caused by different digit counts (0–180).
-  int16_t x1, y1;
-  uint16_t textWidth, textHeight;
-  _display.getTextBounds(strAngle, 0, 0, &x1, &y1, &textWidth, &textHeight);
-
-  // Center horizontally; vertically shift up slightly from true center
-  // to leave room for the two bar graph rows at the bottom
-  uint16_t xText = (SCREEN_WIDTH - textWidth) / 2;
-  uint16_t yText = 12;  // Fixed top position: sits below top row, above bars
-  _display.setCursor(xText, yText);
-  _display.print(strAngle);
+  // The field centers the angle itself, which handles the different
+  // digit counts (0–180) without measuring the text each frame
+  _angleField.draw(_display, servoAngle);
 
   // Draw a degree symbol as a small circle.
   // The actual '°' character renders poorly at large text sizes on the
   // SSD1306, so a small circle looks much cleaner.
   int degreeRadius = 3;
-  int degreeX = xText + textWidth + degreeRadius + 2;
-  int degreeY = yText + degreeRadius;
+  int degreeX = _angleField.getTextRight() + degreeRadius + 2;
+  int degreeY = _angleField.getY() + degreeRadius;
   _display.drawCircle(degreeX, degreeY, degreeRadius, SSD1306_WHITE);
 
   // ── BOTTOM: Dual bar graphs (LDR on top, POT below) ────
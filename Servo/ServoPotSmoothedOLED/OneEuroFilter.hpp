@@ -0,0 +1,214 @@
+/**
+ * An adaptive low-pass filter that smooths a lot when the input is still or
+ * moving slowly (to remove jitter) and very little when it's moving fast (to
+ * keep lag low). This is the "1 Euro Filter" by Casiez, Roussel, and Vogel:
+ * https://gery.casiez.net/1euro/
+ *
+ * It's an exponential moving average whose cutoff frequency rises with the
+ * signal's speed:
+ *
+ *   cutoff = minCutoffHz + beta * |smoothed speed in units per second|
+ *
+ * Tuning: set beta to 0 and lower minCutoffHz until the output is still
+ * enough when you're not moving the input. Then raise beta until fast
+ * movements no longer lag. For 10-bit analogRead values, minCutoffHz of
+ * about 1 and beta of about 0.005 are a good start.
+ *
+ * There are two versions with the same parameters:
+ *  - OneEuroFilter uses float math and can take the time between samples
+ *    for loops that don't run at a steady rate
+ *  - OneEuroFilterFixed uses only integer math (one 32-bit division per
+ *    sample), which is faster on boards without a floating point unit, but
+ *    assumes a steady sample rate and integer readings of up to 12 bits
+ *
+ * Usage:
+ *  OneEuroFilter _filter(50, 1.0, 0.005);      // 50 Hz, 1 Hz min cutoff, beta of 0.005
+ *  OneEuroFilterFixed _filter(50, 1.0, 0.005); // same, but integers only
+ *
+ *  loop(){
+ *    int smoothed = _filter.add(analogRead(A0));
+ *    delay(20);
+ *  }
+ *
+ * By Jon E. Froehlich
+ * @jonfroehlich
+ * http://makeabilitylab.io
+ *
+ */
+#ifndef ONE_EURO_FILTER_HPP
+#define ONE_EURO_FILTER_HPP
+
+#include <Arduino.h>
+
+class OneEuroFilter{
+
+  private:
+    float _minCutoffHz;
+    float _beta;
+    float _derivCutoffHz;
+    float _samplePeriodSecs;
+
+    float _smoothed;       // filtered value
+    float _smoothedSpeed;  // filtered speed in units per second
+    bool _isEmpty;
+
+    // The EWMA alpha for a low-pass filter with the given cutoff
+    static float alpha(float cutoffHz, float dtSecs) {
+      float w = 2 * PI * cutoffHz * dtSecs;
+      return w / (1 + w);
+    }
+
+  public:
+    /**
+     * Creates a new filter. sampleRateHz is how often add(value) is called;
+     * minCutoffHz is the cutoff when the input is still (lower = less jitter);
+     * beta is how fast the cutoff rises with speed (higher = less lag); and
+     * derivCutoffHz is the cutoff of the filter used on the speed
+     */
+    OneEuroFilter(float sampleRateHz, float minCutoffHz = 1.0, float beta = 0.0,
+                  float derivCutoffHz = 1.0)
+      : _minCutoffHz(minCutoffHz), _beta(beta), _derivCutoffHz(derivCutoffHz),
+        _samplePeriodSecs(1 / sampleRateHz) {
+      reset();
+    }
+
+    /**
+     * Clears the filter. The next add() seeds it with that value
+     */
+    void reset() {
+      _smoothed = 0;
+      _smoothedSpeed = 0;
+      _isEmpty = true;
+    }
+
+    /**
+     * Adds a new value taken at the sample rate and returns the filtered value
+     */
+    float add(float value) {
+      return add(value, _samplePeriodSecs);
+    }
+
+    /**
+     * Adds a new value taken dtSecs after the last one and returns the
+     * filtered value
+     */
+    float add(float value, float dtSecs) {
+      if (_isEmpty) {
+        _smoothed = value;
+        _isEmpty = false;
+        return _smoothed;
+      }
+
+      if (dtSecs <= 0) {
+        dtSecs = _samplePeriodSecs;
+      }
+
+      float speed = (value - _smoothed) / dtSecs;
+      _smoothedSpeed += alpha(_derivCutoffHz, dtSecs) * (speed - _smoothedSpeed);
+
+      float cutoffHz = _minCutoffHz + _beta * fabs(_smoothedSpeed);
+      _smoothed += alpha(cutoffHz, dtSecs) * (value - _smoothed);
+      return _smoothed;
+    }
+
+    /**
+     * Returns the current filtered value
+     */
+    float get() const {
+      return _smoothed;
+    }
+};
+
+class OneEuroFilterFixed{
+
+  private:
+    // The filtered value and speed have FRAC_BITS fractional bits and the
+    // EWMA alphas are scaled by ALPHA_ONE (i.e., 65536 = 1.0). That much
+    // precision is needed at high sample rates, where alpha gets small.
+    static const uint8_t FRAC_BITS = 8;
+    static const uint8_t ALPHA_BITS = 16;
+    static const int32_t ALPHA_ONE = 1L << ALPHA_BITS;
+
+    uint32_t _minW;     // 2 * PI * minCutoffHz / sampleRateHz, scaled by ALPHA_ONE
+    uint32_t _betaW;    // 2 * PI * beta, scaled by ALPHA_ONE
+    int32_t _derivAlpha;
+    uint32_t _maxSpeed; // speeds above this saturate the cutoff (alpha = 1)
+
+    int32_t _smoothed;       // filtered value, scaled by 2^FRAC_BITS
+    int32_t _smoothedSpeed;  // filtered change per sample, scaled by 2^FRAC_BITS
+    bool _isEmpty;
+
+    // Converts w = 2 * PI * cutoff / sampleRate (scaled by ALPHA_ONE) to
+    // alpha = w / (1 + w) = 1 - 1 / (1 + w) (scaled by ALPHA_ONE). ALPHA_ONE^2
+    // doesn't fit in 32 bits, so this uses 2^32 - 1, which is off by < 1
+    static int32_t alpha(uint32_t w) {
+      return ALPHA_ONE - (int32_t)(0xFFFFFFFFUL / (ALPHA_ONE + w));
+    }
+
+    // Moves smoothed toward target by alpha, rounding to nearest. The
+    // difference times alpha can need more than 32 bits, so the high and
+    // low bytes of the difference are multiplied separately
+    static void lerp(int32_t& smoothed, int32_t target, int32_t alphaScaled) {
+      int32_t diff = target - smoothed;
+      int32_t step = (diff >> 8) * alphaScaled + (((diff & 0xFF) * alphaScaled) >> 8);
+      smoothed += (step + (1L << (ALPHA_BITS - 9))) >> (ALPHA_BITS - 8);
+    }
+
+  public:
+    /**
+     * Creates a new filter with the same parameters as OneEuroFilter.
+     * add() must be called at sampleRateHz. The float parameters are only
+     * used here to set up the integer constants
+     */
+    OneEuroFilterFixed(float sampleRateHz, float minCutoffHz = 1.0, float beta = 0.0,
+                       float derivCutoffHz = 1.0) {
+      _minW = (uint32_t)(2 * PI * minCutoffHz / sampleRateHz * ALPHA_ONE + 0.5);
+      _betaW = (uint32_t)(2 * PI * beta * ALPHA_ONE + 0.5);
+      _derivAlpha = alpha((uint32_t)(2 * PI * derivCutoffHz / sampleRateHz * ALPHA_ONE + 0.5));
+      _maxSpeed = _betaW > 0 ? (0x7FFFFFFFUL / _betaW) : 0xFFFFFFFFUL;
+      reset();
+    }
+
+    /**
+     * Clears the filter. The next add() seeds it with that value
+     */
+    void reset() {
+      _smoothed = 0;
+      _smoothedSpeed = 0;
+      _isEmpty = true;
+    }
+
+    /**
+     * Adds a new value and returns the filtered value rounded to the nearest integer
+     */
+    int add(int value) {
+      int32_t scaledValue = (int32_t)value << FRAC_BITS;
+
+      if (_isEmpty) {
+        _smoothed = scaledValue;
+        _isEmpty = false;
+        return value;
+      }
+
+      // Speed is in units per sample here rather than per second, so the
+      // sample rate cancels out of beta's term: 2 * PI * beta * |speed|
+      lerp(_smoothedSpeed, scaledValue - _smoothed, _derivAlpha);
+      uint32_t speed = _smoothedSpeed < 0 ? -_smoothedSpeed : _smoothedSpeed;
+
+      int32_t alphaScaled = ALPHA_ONE;
+      if (speed < _maxSpeed) {
+        alphaScaled = alpha(_minW + ((_betaW * speed) >> FRAC_BITS));
+      }
+      lerp(_smoothed, scaledValue, alphaScaled);
+      return get();
+    }
+
+    /**
+     * Returns the current filtered value rounded to the nearest integer
+     */
+    int get() const {
+      return (int)((_smoothed + (1 << (FRAC_BITS - 1))) >> FRAC_BITS);
+    }
+};
+
+#endif
@@ -1,9 +1,10 @@
 
 /**
  * Control a servo motor angle with a potentiometer input and output
- * the angle on an OLED display. Uses exponential moving average (EMA)
- * smoothing to reduce ADC noise and only updates the servo when the
- * angle changes to eliminate jitter/buzz.
+ * the angle on an OLED display. Uses an adaptive "1 Euro" filter
+ * (OneEuroFilter.hpp in this folder) to reduce ADC noise without making the
+ * servo lag behind a quickly turned knob, and only updates the servo when
+ * the angle changes to eliminate jitter/buzz.
  * 
  * See the Arduino servo library:
  * https://www.arduino.cc/reference/en/libraries/servo/
@@ -34,6 +35,8 @@
 #include <Adafruit_GFX.h>
 #include <Adafruit_SSD1306.h>
 
+#include "OneEuroFilter.hpp"
+
 #define SCREEN_WIDTH 128 // OLED display width, in pixels
 #define SCREEN_HEIGHT 64 // OLED display height, in pixels
 
@@ -53,12 +56,16 @@ const int POTENTIOMETER_INPUT_PIN = A0;
 
 Servo _servo; 
 
-// Exponential moving average (EMA) smoothing for the potentiometer input.
-// Lower alpha = more smoothing (less responsive), higher = less smoothing.
-// 0.15 is a good balance for a physical knob: damps ADC noise without
-// introducing noticeable lag.
-float _smoothedPotVal = 0;
-const float ALPHA = 0.4;
+// Adaptive smoothing for the potentiometer input. A fixed EMA has to trade
+// off noise for lag; the 1 Euro filter is an EMA whose cutoff frequency
+// rises with how fast the knob is turning, so it smooths heavily when the
+// knob is still and barely at all when it's moving.
+// Lower MIN_CUTOFF_HZ = less jitter at rest; higher BETA = less lag when moving.
+const float NOMINAL_SAMPLE_RATE_HZ = 50; // only used if no time has passed between samples
+const float MIN_CUTOFF_HZ = 1.0;
+const float BETA = 0.005;
+OneEuroFilter _potFilter(NOMINAL_SAMPLE_RATE_HZ, MIN_CUTOFF_HZ, BETA);
+unsigned long _lastSampleTimestampUs = 0;
 
 // Minimum angle change required to move the servo. Prevents the servo
 // from buzzing back and forth between two adjacent angles due to ADC
@@ -82,9 +89,10 @@ void setup()
     for(;;); // Don't proceed, loop forever
   }
 
-  // Seed the EMA with an initial reading so the smoothed value
+  // Seed the filter with an initial reading so the smoothed value
   // starts at the current pot position rather than ramping up from 0
-  _smoothedPotVal = analogRead(POTENTIOMETER_INPUT_PIN);
+  _potFilter.add(analogRead(POTENTIOMETER_INPUT_PIN));
+  _lastSampleTimestampUs = micros();
 
   _display.clearDisplay();      
   _display.setTextColor(SSD1306_WHITE); // Draw white text
@@ -97,11 +105,12 @@ void loop()
   // from the potentiometer
   int potVal = analogRead(POTENTIOMETER_INPUT_PIN); 
 
-  // Apply exponential moving average to smooth out ADC noise.
-  // EMA formula: smoothed = alpha * newReading + (1 - alpha) * smoothed
-  // This acts as a simple low-pass filter without needing a ring buffer.
-  _smoothedPotVal = ALPHA * potVal + (1.0 - ALPHA) * _smoothedPotVal;
-  int smoothedVal = (int)(_smoothedPotVal + 0.5); // Round to nearest int
+  // Smooth out ADC noise. The loop's speed depends on how long the OLED
+  // takes to draw, so pass in the actual time since the last sample
+  unsigned long currentTimestampUs = micros();
+  float dtSecs = (currentTimestampUs - _lastSampleTimestampUs) / 1000000.0;
+  _lastSampleTimestampUs = currentTimestampUs;
+  int smoothedVal = (int)(_potFilter.add(potVal, dtSecs) + 0.5); // Round to nearest int
   int servoAngle = map(smoothedVal, 0, MAX_ANALOG_VAL, 0, 180);
 
   // Writing the same angle repeatedly causes micro-corrections
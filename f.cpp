@@ -0,0 +1,3 @@
+#include <Arduino.h>
+#include "/root/repo/HumanInterfaceDevice/MakeyMakey/FilterBank.hpp"
+FilterBank<2,float> x;